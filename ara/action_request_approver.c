@@ -33,6 +33,9 @@
  * 10/03/2024 | TP     | Refactored for Action Request Timeout
  * 10/24/2024 | AT     | Clean up actions
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | Range check of long values, payload block released when not approved
+ * 10/18/2026 | TP     | ARA_bActionRequestPending: lock-free check run before each request monitor cycle
+ * 10/18/2026 | TP     | THRD_ARA reset hook answers and releases the request being evaluated
  */
 
 /*** Include Files ***/
@@ -99,6 +102,9 @@ static uint8_t ara_u8RangeCheckEvaluation(stProcessMsgData stMsgData);
 /*** Internal Variables ***/
 static const action_request_t m_stActionList[TOTAL_AR] = PREDEFINED_ACTION_LIST;
 static uint8_t m_u8VehicleStatus = VEHICLE_NOT_PARK;
+/* Request being evaluated by ARA_vActionRequestMonitor(), THRD_ARA only */
+static stProcessMsgData m_stRequestInFlight;
+static bool m_bRequestInFlight = false;
 
 /*** Functions Provided to other modules ***/
 
@@ -179,6 +185,9 @@ void ARA_vActionRequestMonitor(void)
 
         if (s8DequeueStatus >= 0)
         {
+            /* Until it is handed on or released, for ARA_vResetAfterFault() */
+            m_stRequestInFlight = stTempMsgData;
+            m_bRequestInFlight = true;
             stActionReqData.u16ActionId = stTempMsgData.stMsgPairData.u16MsgId;
             u8ActionRangeCheck = ara_u8RangeCheckEvaluation(stTempMsgData);
             u8ActionListCheck = ARA_u8ActionListCheck(&stActionReqData);
@@ -274,10 +283,61 @@ void ARA_vActionRequestMonitor(void)
                     }
                 }
             }
+
+            /* An approved request hands its payload block on to ICM_TX */
+            if (s8Return != QUEUE_ACTION_SUCCESS)
+            {
+                ITCOM_vReleaseMsgPayload(&stTempMsgData);
+            }
+            m_bRequestInFlight = false;
         }
     }
 }
 
+/**
+ * @brief Reset hook of THRD_ARA, run after a faulted cycle
+ *
+ * @details
+ * A request whose evaluation faulted is answered as invalid, so that the
+ * sender is not left waiting for its timeout, and its payload block goes
+ * back to the pool. The vehicle status falls back to not parked until the
+ * next status monitor run.
+ *
+ * @return None
+ */
+void ARA_vResetAfterFault(void)
+{
+    m_u8VehicleStatus = (uint8_t)VEHICLE_NOT_PARK;
+
+    if (m_bRequestInFlight)
+    {
+        m_bRequestInFlight = false;
+        ITCOM_vReleaseMsgPayload(&m_stRequestInFlight);
+        if (ITCOM_s8LogNotificationMessage(m_stRequestInFlight.stMsgPairData.u16MsgId,
+                                           m_stRequestInFlight.stMsgPairData.u16SequenceNum,
+                                           (uint8_t)enInvalidActionReq, (uint8_t)enActionNotification) < 0)
+        {
+            log_message(global_log_file, LOG_ERROR, "Failed to log invalid action request notification after a faulted cycle");
+        }
+        log_message(global_log_file, LOG_WARNING, "THRD_ARA: action request 0x%04X dropped after a faulted cycle",
+                    m_stRequestInFlight.stMsgPairData.u16MsgId);
+    }
+}
+
+/**
+ * @brief Tells whether ARA_vActionRequestMonitor() has a request to evaluate
+ *
+ * @details
+ * Idle fast path of THRD_ARA: reads the data integrity queue size without
+ * taking the ITCOM mutex. The vehicle status monitor still runs every cycle.
+ *
+ * @return true when the data integrity queue holds a request
+ */
+bool ARA_bActionRequestPending(void)
+{
+    return ITCOM_bQueueHasData((uint8_t)DATA_INTEGRITY_QUEUE);
+}
+
 /**
  * @brief Monitors and validates vehicle status for safety-critical operations
  *
@@ -585,6 +645,25 @@ static uint8_t ara_u8RangeCheckEvaluation(stProcessMsgData stMsgData)
             break;
 
         default:
+            /* Long value: every byte of the payload block must be in range */
+            if ((uint16_t)stMsgData.u16Length > (uint16_t)MSG_PAYLOAD_SIZE)
+            {
+                const uint8_t *pu8Value = ITCOM_pu8MsgPayload(&stMsgData);
+                uint16_t u16Byte;
+
+                for (u16Byte = ARA_ZERO_INIT_U; (pu8Value != NULL) && (u16Byte < stMsgData.u16Length); u16Byte++)
+                {
+                    if (((uint32_t)pu8Value[u16Byte] < m_stActionList[s16MsgIndx].au32RangeLimits[0]) ||
+                        ((uint32_t)pu8Value[u16Byte] > m_stActionList[s16MsgIndx].au32RangeLimits[1]))
+                    {
+                        break;
+                    }
+                }
+                if ((pu8Value != NULL) && (u16Byte == stMsgData.u16Length))
+                {
+                    u8RangeCheckResult = RANGE_CHECK_PASSED;
+                }
+            }
             break;
         }
     }
@@ -33,6 +33,8 @@
  * 10/03/2024 | TP     | Refactored for Action Request Timeout
  * 10/24/2024 | AT     | Clean up actions
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | ARA_bActionRequestPending
+ * 10/18/2026 | TP     | ARA_vResetAfterFault
  */
 
 #ifndef ARA_ACTION_REQUEST_APPROVER_H
@@ -106,6 +108,8 @@ typedef struct
 /*** Functions Provided to other modules ***/
 extern void ARA_vActionRequestMonitor(void);
 extern void ARA_vVehicleStatusMonitor(void);
+extern bool ARA_bActionRequestPending(void);
+extern void ARA_vResetAfterFault(void);
 extern uint8_t ARA_u8ActionListCheck(action_request_t *stActionRequest);
 extern uint8_t ARA_u8PrecondListCheck(action_request_t stActionRequest);
 
@@ -23,6 +23,7 @@
  * 09/25/2024 | TP     | Cleaning up the code
  * 10/24/2024 | AT     | Cleaning up the code, removal of DEBUG_LOG
  * 11/02/2024 | TP     | MISRA & LHP compliance fixes
+ * 10/18/2026 | TP     | CRV_bHasWork: lock-free check run before each CRV cycle
  */
 
 #include "icm.h"
@@ -222,3 +223,19 @@ void CRV_vMainFunction(void)
         log_message(global_log_file, LOG_ERROR, "CRV_vMainFunction: Log file handle is invalid.");
     }
 }
+
+/**
+ * @brief Tells whether CRV_vMainFunction() has calibration data to verify.
+ *
+ * @details
+ * Idle fast path of THRD_CRV: reads the element counts of the calibration copy
+ * and readback buffers without taking the ITCOM mutex. With both buffers empty
+ * the cycle is skipped instead of logging an empty verification pass.
+ *
+ * @return true when either buffer holds elements
+ */
+bool CRV_bHasWork(void)
+{
+    return ITCOM_bTrackBufferHasData((uint8_t)enCalibDataCopyBuffer) ||
+           ITCOM_bTrackBufferHasData((uint8_t)enCalibReadbackData);
+}
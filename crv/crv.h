@@ -23,6 +23,7 @@
  * 09/25/2024 | TP     | Cleaning up the code
  * 10/24/2024 | AT     | Cleaning up the code, removal of DEBUG_LOG
  * 11/02/2024 | TP     | MISRA & LHP compliance fixes
+ * 10/18/2026 | TP     | CRV_bHasWork
  */
 
 #ifndef CRV_H
@@ -38,6 +39,7 @@
 
 /*** Functions Provided to other modules ***/
 extern void CRV_vMainFunction(void);
+extern bool CRV_bHasWork(void);
 
 /*** Variables Provided to other modules ***/
 
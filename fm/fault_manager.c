@@ -31,6 +31,13 @@
  * 10/24/2024 | AT     | Cleaning up the code, removal of DEBUG_LOG and pointer checks added
  * 11/17/2024 | TP     | MISRA & LHP compliance fixes, Functionality Check PASSED
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | Event processing timeout uses the UT time source
+ * 10/18/2026 | TP     | Event log file writes of THRD_FM run on the worker pool
+ * 10/18/2026 | TP     | FM_bHasWork: lock-free check run before each FM cycle
+ * 10/18/2026 | TP     | Event store cleared up to its configured capacity
+ * 10/18/2026 | TP     | THRD_FM reset hook, event log mutex counted as a held lock
+ * 10/18/2026 | TP     | Event timestamps and stage timing use the UT time source
+ * 10/18/2026 | TP     | Event log mutex taken through the lock_owner wrapper
  */
 
 /*** Include Files ***/
@@ -38,6 +45,8 @@
 #include "storage_handler.h"
 #include "thread_management.h"
 #include "data_queue.h"
+#include "worker_pool.h"
+#include "lock_owner.h"
 
 #include "fault_manager.h"
 
@@ -113,6 +122,8 @@ static void fm_vCallNotificationFunction(ErrorEvent *event);
 static void fm_vLogErrorEvent(ErrorEvent *event);
 static float64_t fm_f64GetElapsedTimeMs(struct timespec *start, struct timespec *end);
 static void fm_vRotateLogFile(void);
+static void fm_vEventLogJob(const void *arg, size_t arg_size);
+static void fm_vWriteEventLog(const fm_char_t *line, size_t length);
 static void fm_vPrintEventQueue(void);
 static void fm_vResetErrorEventCounters(void);
 static void fm_vCaptureSnapshotData(SystemSnapshot_t *snapshot);
@@ -147,6 +158,15 @@ static FILE *log_file = NULL;
  */
 static uint64_t current_log_size = 0;
 
+/**
+ * @var fm_event_log_mutex
+ * @brief Serializes event log file writes made by the worker pool and inline.
+ *        Taken through LOCK_OWNER_MUTEX_LOCK, so that a thread faulting
+ *        while it holds the mutex is not recovered in place.
+ *
+ */
+static pthread_mutex_t fm_event_log_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 /**
  * @var Error_Events
  * @brief Static array containing predefined error event configurations.
@@ -272,6 +292,39 @@ void FM_vMainFunction(void)
     }
 }
 
+/**
+ * @brief Reset hook of THRD_FM, run after a faulted cycle
+ *
+ * An event whose processing faulted would be resumed on the next cycle and
+ * most likely fault again. Its processing flag is cleared, so the next cycle
+ * takes the next event from the queue.
+ */
+void FM_vResetAfterFault(void)
+{
+    ErrorEvent stCurrentEvent;
+
+    if (ITCOM_s16GetProcessingFlag())
+    {
+        ITCOM_vGetErrorEvent(&stCurrentEvent);
+        ITCOM_vSetErrorProcessingFlag(0);
+        log_message(global_log_file, LOG_WARNING, "THRD_FM: processing of Error Event ID %d dropped after a faulted cycle",
+                    stCurrentEvent.Error_Event_ID);
+    }
+}
+
+/**
+ * @brief Tells whether FM_vMainFunction() has an error event to process.
+ *
+ * Idle fast path of THRD_FM: reads the event queue index and the processing
+ * flag without taking the ITCOM mutexes, so an empty cycle costs two loads.
+ *
+ * @return true when an event is queued or its processing was interrupted
+ */
+bool FM_bHasWork(void)
+{
+    return ITCOM_bErrorEventPending();
+}
+
 /**
  * @brief Logs any remaining events in the queue before shutdown.
  *
@@ -361,7 +414,7 @@ void FM_vLogSpecialEvent(FILE *event_log_file, event_type_t event_type, EVENT_ID
         return;
     }
     fm_char_t timestamp[FM_TIMESTAMP_BUFFER_SIZE];
-    time_t now = time(NULL);
+    time_t now = UT_tGetWallTime_s();
 
     size_t time_result = strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", localtime(&now));
     if ((size_t)time_result == (size_t)FM_ZERO_TIMESTAMP_RESULT)
@@ -465,6 +518,7 @@ static void fm_vCaptureSnapshotData(SystemSnapshot_t *snapshot)
  */
 void FM_vCloseEventLogger(void)
 {
+    (void)LOCK_OWNER_MUTEX_LOCK(&fm_event_log_mutex);
     if (log_file != NULL)
     {
         int32_t close_result = fclose(log_file);
@@ -475,6 +529,7 @@ void FM_vCloseEventLogger(void)
         }
         log_file = NULL;
     }
+    (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
 }
 
 /**
@@ -657,10 +712,10 @@ void FM_vLoadEventDataFromStorage(void)
     log_message(global_log_file, LOG_INFO, "Successfully loaded %zu bytes of event data from storage", total_bytes);
 
     ITCOM_vSetEventQueueIndx(FM_ZERO_QUEUE_INDEX);
-    uint8_t i;
-    for (i = FM_ZERO_QUEUE_INDEX; i < DATA_QUEUE_MAX_SIZE; i++)
+    uint32_t i;
+    for (i = FM_ZERO_QUEUE_INDEX; i < ITCOM_u32GetEventStoreCapacity(); i++)
     {
-        ITCOM_vSetEventQueueId(FM_ZERO_EVENT_ID, i);
+        ITCOM_vSetEventQueueId(FM_ZERO_EVENT_ID, (uint8_t)i);
     }
 
     fm_vResetErrorEventCounters();
@@ -928,7 +983,7 @@ static void fm_vSnapshotDataCollection(ErrorEvent *event)
                 event->SystemSnapshotData.VehicleSpeed,
                 event->SystemSnapshotData.GearShiftPosition,
                 event->SystemSnapshotData.ASI_State);
-    time_t now = time(NULL);
+    time_t now = UT_tGetWallTime_s();
     size_t time_result = strftime((fm_char_t *)event->SystemSnapshotData.SystemTime,
                                   sizeof(event->SystemSnapshotData.SystemTime),
                                   "%Y-%m-%d %H:%M:%S",
@@ -1172,18 +1227,18 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
         log_message(global_log_file, LOG_ERROR, "NULL state pointer passed to fm_vProcessErrorEventWithTimeout");
         return;
     }
-    int32_t start_time_result = clock_gettime(CLOCK_MONOTONIC, &state->start_time);
+    int32_t start_time_result = UT_s32GetMonotonicTime(&state->start_time);
     if (start_time_result != 0)
     {
         log_message(global_log_file, LOG_ERROR, "Failed to get start time");
         return;
     }
 
-    time_t start_time = time(NULL);
+    time_t start_time = UT_tGetWallTime_s();
 
     while (state->processing_stage < FM_PROCESSING_STAGES_COMPLETE)
     {
-        if (difftime(time(NULL), start_time) > EVENT_PROCESSING_TIMEOUT)
+        if (difftime(UT_tGetWallTime_s(), start_time) > EVENT_PROCESSING_TIMEOUT)
         {
             log_message(global_log_file, LOG_WARNING, "Error event processing timeout for Event ID: %d", state->current_event->Error_Event_ID);
             break;
@@ -1191,7 +1246,7 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
 
         struct timespec stage_start, stage_end;
 
-        int32_t stage_start_result = clock_gettime(CLOCK_MONOTONIC, &stage_start);
+        int32_t stage_start_result = UT_s32GetMonotonicTime(&stage_start);
         if (stage_start_result == (int32_t)-1)
         {
             log_message(global_log_file, LOG_ERROR, "Failed to get stage start time");
@@ -1203,7 +1258,7 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
         ITCOM_vUpdateCurrentEvent(state->current_event);
         ITCOM_vSetErrorProcessingFlag(1);
 
-        int32_t stage_end_result = clock_gettime(CLOCK_MONOTONIC, &stage_end);
+        int32_t stage_end_result = UT_s32GetMonotonicTime(&stage_end);
         if (stage_end_result != 0)
         {
             log_message(global_log_file, LOG_ERROR, "Failed to get stage end time");
@@ -1222,7 +1277,7 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
         }
     }
 
-    int32_t end_time_result = clock_gettime(CLOCK_MONOTONIC, &state->end_time);
+    int32_t end_time_result = UT_s32GetMonotonicTime(&state->end_time);
     if (end_time_result == (int32_t)-1)
     {
         log_message(global_log_file, LOG_ERROR, "Failed to get end time");
@@ -1247,31 +1302,24 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
  * @brief Logs error events and special events to a file.
  *
  * This function is responsible for logging error events and special events to a designated log file.
- * It handles log file rotation, ensures thread-safe logging, and formats the log entries.
+ * It formats the log entry on the caller; the file work is done by fm_vWriteEventLog(), on the
+ * worker pool when called from THRD_FM so that the periodic thread never waits for the disk.
  *
  * @param event Pointer to the ErrorEvent structure containing the event details to be logged.
  * @param special_event_type Pointer to a string specifying a special event type. If NULL, a regular event is logged.
  *
  * The function performs the following operations:
- * 1. Opens the log file if it's not already open.
- * 2. Checks if log rotation is needed based on the current log file size.
- * 3. Generates a timestamp for the log entry.
- * 4. Determines the severity level string based on the event's severity.
- * 5. Formats and writes the log entry, which includes:
+ * 1. Generates a timestamp for the log entry.
+ * 2. Determines the severity level string based on the event's severity.
+ * 3. Formats the log entry, which includes:
  *    - Timestamp
  *    - Special event type (if provided)
  *    - Event ID string
  *    - Severity level
  *    - Error event counter
  *    - Snapshot data (vehicle speed, gear shift position, ASI state)
- * 6. Flushes the file buffer to ensure the entry is written.
- * 7. Updates the current log file size.
- *
- * @note This function uses global variables:
- *       - log_file: FILE pointer to the current log file
- *       - current_log_size: Tracks the size of the current log file
- *       - MAX_LOG_SIZE: Maximum size of a log file before rotation
- *       - EVENT_LOG_PATH: Path to the log file
+ * 4. Queues the entry to the worker pool, or writes it inline when the caller
+ *    does not defer its logs or the queue is full.
  *
  * @warning This function assumes that the event pointer is valid and not NULL.
  *          It's the caller's responsibility to ensure this.
@@ -1279,45 +1327,14 @@ static void fm_vProcessErrorEventWithTimeout(EventProcessingState *state)
  */
 static void fm_vEventLogger(const ErrorEvent *event, string_t special_event_type)
 {
-    int32_t s32Result = 0;
     if (event == NULL)
     {
         log_message(global_log_file, LOG_ERROR, "NULL event pointer passed to fm_vEventLogger");
         return;
     }
-    if (log_file == NULL)
-    {
-        log_file = fopen(EVENT_LOG_PATH, "a");
-        if (log_file == NULL)
-        {
-            error_string_t error_str = strerror(errno);
-            log_message(global_log_file, LOG_ERROR, "Failed to open %s: %s", EVENT_LOG_PATH, error_str);
-            return;
-        }
-        s32Result = fseek(log_file, 0, SEEK_END);
-        if (s32Result != 0)
-        {
-            log_message(global_log_file, LOG_ERROR, "Failed to seek to end of file");
-            return;
-        }
-        current_log_size = ftell(log_file);
-    }
-
-    if ((uint64_t)current_log_size >= (uint64_t)MAX_LOG_SIZE)
-    {
-        fm_vRotateLogFile();
-        log_file = fopen(EVENT_LOG_PATH, "a");
-        if (log_file == NULL)
-        {
-            error_string_t error_str = strerror(errno);
-            log_message(global_log_file, LOG_ERROR, "Failed to open %s after rotation: %s", EVENT_LOG_PATH, error_str);
-            return;
-        }
-        current_log_size = 0;
-    }
 
     fm_char_t timestamp[FM_TIMESTAMP_STRING_LENGTH];
-    time_t now = time(NULL);
+    time_t now = UT_tGetWallTime_s();
     struct tm *timeinfo = localtime(&now);
     if (timeinfo == NULL)
     {
@@ -1403,18 +1420,88 @@ static void fm_vEventLogger(const ErrorEvent *event, string_t special_event_type
 
     total_chars += written_chars;
 
-    /* Write the formatted buffer to file using write() with retry for partial writes */
-    size_t bytes_to_write = (size_t)total_chars;
+    /* Periodic threads leave the file work to the worker pool, others write inline */
+    if (!WORKERPOOL_bLogDeferred() ||
+        (WORKERPOOL_s32Submit(&fm_vEventLogJob, log_buffer, (size_t)total_chars, enWorkerPrioHigh, WORKERPOOL_KEY_NONE) != WORKERPOOL_SUBMITTED))
+    {
+        fm_vWriteEventLog(log_buffer, (size_t)total_chars);
+    }
+}
+
+/**
+ * @brief Worker pool job writing an event log line formatted by fm_vEventLogger().
+ *
+ * @param arg Formatted line, not NUL terminated
+ * @param arg_size Length of the line
+ */
+static void fm_vEventLogJob(const void *arg, size_t arg_size)
+{
+    fm_vWriteEventLog((const fm_char_t *)arg, arg_size);
+}
+
+/**
+ * @brief Appends a formatted line to the event log file.
+ *
+ * Opens the log file on first use, rotates it once it reaches MAX_LOG_SIZE,
+ * writes the line and flushes. Runs on the worker pool for lines logged by
+ * THRD_FM, inline otherwise; fm_event_log_mutex serializes the two.
+ *
+ * @param line Formatted line
+ * @param length Length of the line
+ */
+static void fm_vWriteEventLog(const fm_char_t *line, size_t length)
+{
+    int32_t s32Result = 0;
+
+    (void)LOCK_OWNER_MUTEX_LOCK(&fm_event_log_mutex);
+
+    if (log_file == NULL)
+    {
+        log_file = fopen(EVENT_LOG_PATH, "a");
+        if (log_file == NULL)
+        {
+            error_string_t error_str = strerror(errno);
+            log_message(global_log_file, LOG_ERROR, "Failed to open %s: %s", EVENT_LOG_PATH, error_str);
+            (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
+            return;
+        }
+        s32Result = fseek(log_file, 0, SEEK_END);
+        if (s32Result != 0)
+        {
+            log_message(global_log_file, LOG_ERROR, "Failed to seek to end of file");
+            (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
+            return;
+        }
+        current_log_size = ftell(log_file);
+    }
+
+    if ((uint64_t)current_log_size >= (uint64_t)MAX_LOG_SIZE)
+    {
+        fm_vRotateLogFile();
+        log_file = fopen(EVENT_LOG_PATH, "a");
+        if (log_file == NULL)
+        {
+            error_string_t error_str = strerror(errno);
+            log_message(global_log_file, LOG_ERROR, "Failed to open %s after rotation: %s", EVENT_LOG_PATH, error_str);
+            (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
+            return;
+        }
+        current_log_size = 0;
+    }
+
+    /* Write the line to file using write() with retry for partial writes */
+    size_t bytes_to_write = length;
     size_t total_written = 0;
     while (total_written < bytes_to_write)
     {
         int32_t bytes_written = (int32_t)write(fileno(log_file),
-                                               log_buffer + total_written,
+                                               line + total_written,
                                                bytes_to_write - total_written);
         if (bytes_written < (int32_t)0)
         {
             error_string_t error_str = strerror(errno);
             log_message(global_log_file, LOG_ERROR, "Failed to write to log file: %s", error_str);
+            (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
             return;
         }
         total_written += (size_t)bytes_written;
@@ -1427,6 +1514,8 @@ static void fm_vEventLogger(const ErrorEvent *event, string_t special_event_type
         error_string_t error_str = strerror(errno);
         log_message(global_log_file, LOG_ERROR, "Failed to flush log file: %s", error_str);
     }
+
+    (void)LOCK_OWNER_MUTEX_UNLOCK(&fm_event_log_mutex);
 }
 
 /**
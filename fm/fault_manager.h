@@ -33,6 +33,8 @@
  * 10/24/2024 | AT     | Cleaning up the code, removal of DEBUG_LOG and pointer checks added
  * 11/17/2024 | TP     | MISRA & LHP compliance fixes, Functionality Check PASSED
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | FM_bHasWork
+ * 10/18/2026 | TP     | FM_vResetAfterFault
  */
 
 #ifndef FM_FAULT_MANAGER_H
@@ -151,6 +153,8 @@ extern void FM_vCloseEventLogger(void);
 extern void FM_vLogRemainingEvents(FILE *event_log_file);
 extern void FM_vLoadEventDataFromStorage(void);
 extern void FM_vMainFunction(void);
+extern bool FM_bHasWork(void);
+extern void FM_vResetAfterFault(void);
 extern void FM_vLogSpecialEvent(FILE *event_log_file, event_type_t event_type, EVENT_ID_t current_event_id);
 extern int8_t FM_s8SaveEventDataToStorage(void);
 extern uint32_t FM_u32FindLeastSevereEvent(uint8_t *queue, uint32_t size);
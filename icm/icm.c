@@ -46,9 +46,35 @@
  * 10/03/2024 | AT     | Thread crashing handling update
  * 11/15/2024 | TP     | MISRA & LHP compliance fixes
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | Rate limiter and TX timestamp use the UT time source
+ * 10/18/2026 | TP     | Per frame class RX cost accounting, RX injection entry
+ * 10/18/2026 | TP     | RX cost report includes the ICM_RX error counter snapshot
+ * 10/18/2026 | TP     | RX bookkeeping committed as one ITCOM transaction per frame
+ * 10/18/2026 | TP     | Socket reads buffered in per-connection receive rings, validated in batches
+ * 10/18/2026 | TP     | TX sequence number and rolling counter allocated atomically when the message is built
+ * 10/18/2026 | TP     | TX message picked by the ITCOM class scheduler, per-class delay report
+ * 10/18/2026 | TP     | Duplicate action requests classified and reported with the recent request counters
+ * 10/18/2026 | TP     | Admission control sheds action requests above the queue high water mark
+ * 10/18/2026 | TP     | Message pool counters reported
+ * 10/18/2026 | TP     | Long values: length-driven receive into payload blocks, gathered send, CRC over the value
+ * 10/18/2026 | TP     | ICM_RX reset hook drops the frame being validated when its cycle faulted
+ * 10/18/2026 | TP     | ICM_bTxPending: lock-free check run before each ICM_TX cycle
+ * 10/18/2026 | TP     | Shed action requests keep the RX rolling counter in step
+ * 10/18/2026 | TP     | Partial frames and long values read to the end, oversize values drained
+ * 10/18/2026 | TP     | Ring overflow counted only when the full ring left data in the socket
+ * 10/18/2026 | TP     | TX sequence number and rolling counter allocated right before the send, released if it fails
+ * 10/18/2026 | TP     | ICM_TX reset hook releases the payload of the message being sent
+ * 10/18/2026 | TP     | Host receive path benchmark and fuzz check on the RX injection entry (make rx-check)
+ * 10/18/2026 | TP     | RX check main moved to test/icm_rx_check.c
+ * 10/18/2026 | TP     | Dropped connections closed with SD_vDropTCPConnection, SD reconnects
+ * 10/18/2026 | TP     | RX_INJECTION builds read injected frames from ICM_RX_INJECTION_SOCKET
  */
 
 /*** Include Files ***/
+#ifdef ICM_RX_INJECTION
+#include <sys/un.h>
+#endif
+
 #include "itcom.h"
 #include "crc.h"
 #include "data_queue.h"
@@ -56,6 +82,7 @@
 #include "storage_handler.h"
 #include "state_machine.h"
 #include "fault_manager.h"
+#include "lock_profiler.h"
 
 #include "icm.h"
 
@@ -68,6 +95,13 @@
 #define VEHICLE_SPEED_LOW_LIMIT             (0x000)
 #define VEHICLE_SPEED_HIGH_LIMIT            (0x190)
 #define FLOAT_COMPARISON_EPSILON            (0.001f)
+#define ICM_SEC_TO_NSEC                     (1000000000LL)
+#define ICM_TX_IOV_COUNT                    (2U)      /* Fixed frame, rest of a long value */
+#define ICM_RX_NO_FRAME                     ((uint8_t)enTotalTCPConnections)
+#define ICM_RX_REST_WAIT_US                 (20000L)  /* Longest wait for the rest of a frame already started */
+#ifdef ICM_RX_INJECTION
+#define ICM_RX_INJECT_HEADER_SIZE           (1U)      /* Connection index byte in front of an injected frame */
+#endif
 
 #define MSG_STATIC_INTEGRITY_CONFIG_TABLE { \
 /*	 TimeoutLimit							CycleCount_Flag			ActionReqTimer_Flag		TypeLength_Flag		CRC_Flag			RC_Flag				RSN_Flag			CyclicMsg_Flag		SeqNumAssigner		TimeoutEventID							MsgName*/	\
@@ -116,28 +150,60 @@ typedef struct
     uint8_t u8TimeoutEventId;
 } MsgIntConfig_t;
 
+_Static_assert(MSG_PAYLOAD_SIZE == TLV_VALUE_SIZE, "Inline message data must match the fixed frame value");
+
 /*** Local Function Prototypes ***/
 static void icm_vSaveVehicleStatusData(int16_t s16Indx, uint8_t *pu8Data, uint8_t u8Status);
 static int8_t icm_s8CRCEval(TLVMessage_t stReceivedMsg, uint8_t u8Indx);
-static void icm_vRollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx);
-static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx, uint8_t u8ConnectionIndex);
-static void icm_vSaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int16_t s16TypeIndx);
-static void icm_vPopulateMsgHeader(TLVMessage_t *pstTempTxMsg, stProcessMsgData stMsgData, MessageDictionary_t stDictionaryData);
+static int8_t icm_s8RollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx);
+static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn);
+static int8_t icm_s8SaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int16_t s16TypeIndx, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn);
+static void icm_vPopulateMsgHeader(TLVMessage_t *pstTempTxMsg, stProcessMsgData stMsgData);
 static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData stMsgData, MessageDictionary_t stDictionaryData, MsgIntConfig_t stTempMsgConfig);
 static int8_t icm_s16CheckRateLimit(RateLimiter_t *pstRateLimiter);
 static float32_t icm_f32FixedPointToFloat(uint16_t u16Fixed, int16_t s16ScaleFactor);
-static void icm_vProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex);
-static void icm_vProcessValidMessage(TLVMessage_t *pstReceivedTCPMsg, int16_t s16Indx, int16_t s16TypeIndx, MsgIntConfig_t *pstTempMsgConfig, uint8_t u8ConnectionIndex);
+static void icm_vFillRxRing(enTCPConnectionsASI enConnection, int16_t s16Socket);
+static void icm_vConsumeRxRing(uint8_t u8ConnectionIndex);
+static ssize_t icm_sReceiveLongValue(int16_t s16Socket, const TLVMessage_t *pstSlot, uint16_t *pu16Payload);
+static size_t icm_szReceiveRest(int16_t s16Socket, uint8_t *pu8Dest, size_t szLength);
+static ssize_t icm_sSendFrame(int16_t s16Socket, const TLVMessage_t *pstTxMsg, stProcessMsgData *pstMsgData);
+static void icm_vHandleReceivedFrame(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex, size_t szReceived);
+static bool icm_bAdmitActionRequest(void);
+static RxFrameClass_t icm_enProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn);
+static RxFrameClass_t icm_enProcessValidMessage(TLVMessage_t *pstReceivedTCPMsg, int16_t s16Indx, int16_t s16TypeIndx, MsgIntConfig_t *pstTempMsgConfig, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn);
 static void icm_vLogReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, enTCPConnectionsASI enConnection);
 static enTCPConnectionsASI icm_enPrepareTransmitMessage(stProcessMsgData *pstMsgData, TLVMessage_t *pstTxMsg);
 static void icm_vTrackSentMessage(stProcessMsgData *pstMsgData);
-static void icm_vUpdateTransmissionCounters(TLVMessage_t *pstTxMsg, enTCPConnectionsASI enConnection);
+static void icm_vAssignTransmitCounters(TLVMessage_t *pstTxMsg, stProcessMsgData *pstMsgData);
+static void icm_vReleaseTransmitCounters(const TLVMessage_t *pstTxMsg, const stProcessMsgData *pstMsgData);
+static void icm_vReleaseTxPayload(stProcessMsgData *pstMsgData);
 static void icm_vLogTransmittedMessage(const TLVMessage_t *pstTxMsg, enTCPConnectionsASI enConnection);
+#ifdef ICM_RX_INJECTION
+static void icm_vWriteInjectedFrame(const uint8_t *pu8Frame, size_t szFrameLength, uint8_t u8ConnectionIndex);
+static void icm_vFillRxRingsFromInjection(uint8_t u8ASI_State);
+#endif
 
 /*** External Variables ***/
 
 /*** Internal Variables ***/
 static MsgIntConfig_t icm_stIntConfigTable[] = MSG_STATIC_INTEGRITY_CONFIG_TABLE;
+/* Receive path cost per frame class, written by the ICM_RX thread only */
+static RxFrameCost_t icm_astRxFrameCost[enTotalRxFrameClasses];
+static uint32_t icm_u32TruncatedFrames = ICM_INIT_VAL_U8;
+/* Admission control state with hysteresis, ICM_RX thread only */
+static bool icm_bAdmissionShedding = false;
+/* Payload block of the frame being validated, ICM_RX thread only; ITCOM_POOL_HANDLE_NONE once handed on */
+static uint16_t icm_u16RxPayload = ITCOM_POOL_HANDLE_NONE;
+/* Connection whose ring slot is being validated, ICM_RX thread only; ICM_RX_NO_FRAME between frames */
+static uint8_t icm_u8RxFrameConnection = ICM_RX_NO_FRAME;
+/* Message being sent, ICM_TX thread only; icm_bTxInFlight cleared once its payload is released */
+static stProcessMsgData icm_stTxInFlight;
+static bool icm_bTxInFlight = false;
+#ifdef ICM_RX_INJECTION
+/* ICM_RX_INJECTION_SOCKET, opened by the first ICM_vReceiveMessage; ICM_RX thread only */
+static int icm_s32InjectSocket = -1;
+static bool icm_bInjectSocketOpened = false;
+#endif
 
 /*** Functions Provided to other modules ***/
 
@@ -206,9 +272,11 @@ void ICM_vInit(void)
     stRateLimiter.u16AllowedMessages = RATE_LIMIT_MSG;
     stRateLimiter.u16TimeWindowMs = RATE_LIMIT_TIME_PERIOD;
     stRateLimiter.u16MessageCount = MESSAGE_COUNT_INIT;
-    stRateLimiter.stStartTime = clock();
+    stRateLimiter.u32StartTime_ms = UT_u32GetCurrentTime_ms();
 
     ITCOM_vSetMsgRateLimiter(&stRateLimiter);
+    ITCOM_vRxRingReset();
+    icm_bAdmissionShedding = false;
     log_message(global_log_file, LOG_DEBUG, "ICM_vInit: Rate limiter set - Allowed messages: %u, Time window: %u ms", RATE_LIMIT_MSG, RATE_LIMIT_TIME_PERIOD);
 
     log_message(global_log_file, LOG_DEBUG, "ICM_vInit: Setting up PRNDL message tracker");
@@ -406,6 +474,9 @@ void ICM_vCycleCountUpdater(void)
  *
  * 2. Message Reception Process:
  *    - Non-blocking message reception (MSG_DONTWAIT)
+ *    - Frames read directly into the connection's receive ring until the
+ *      socket is drained or the ring is full
+ *    - Buffered frames validated afterwards in one batch per connection
  *    - Connection-specific message handling
  *    - Buffer overflow protection
  *    - Error condition handling
@@ -461,7 +532,6 @@ void ICM_vCycleCountUpdater(void)
 void ICM_vReceiveMessage(void)
 {
     enTCPConnectionsASI enConnection = (enTCPConnectionsASI)ICM_INIT_VAL_S32;
-    TLVMessage_t stReceivedTCPMsg = MSG_TLV_DATA_INIT;
     uint8_t u8ASI_State = ITCOM_u8GetASIState();
     uint8_t u8AvailableConnections = ICM_INIT_VAL_U8;
     uint8_t u8ValidConfigurations = ICM_INIT_VAL_U8;
@@ -493,43 +563,16 @@ void ICM_vReceiveMessage(void)
         }
         u8ValidConfigurations++;
 
-        ssize_t recv_result = recv(config->s16Socket, &stReceivedTCPMsg, sizeof(stReceivedTCPMsg), MSG_DONTWAIT);
-
-        if (recv_result > 0)
-        {
-            MessageTypeDictionary_t stActionReqDict = MESSAGE_TYPE_DICTIONARY_INIT;
-            ITCOM_vGetMsgTypeDictionaryEntryAtIndex(&stActionReqDict, enActionRequest);
-            if (stReceivedTCPMsg.u16Type == (uint16_t)stActionReqDict.u16MessageTypeID)
-            {
-                ITCOM_vSetActionRequestStartTime(stReceivedTCPMsg.u16ID, stReceivedTCPMsg.u16SequenceNumber);
-            }
+        icm_vFillRxRing(enConnection, config->s16Socket);
+    }
+#ifdef ICM_RX_INJECTION
+    icm_vFillRxRingsFromInjection(u8ASI_State);
+#endif
 
-            icm_vProcessReceivedMessage(&stReceivedTCPMsg, enConnection);
-            ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_CONNECTED);
-        }
-        else if (recv_result == 0)
-        {
-            log_message(global_log_file, LOG_WARNING, "Connection closed by %s server",
-                        enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM");
-            SD_vCloseTCPConnection(enConnection);
-            ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_DISCONNECTED);
-        }
-        else
-        {
-            if (errno == EWOULDBLOCK || errno == EAGAIN)
-            {
-                log_message(global_log_file, LOG_WARNING, "No data available from %s server",
-                            enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM");
-            }
-            else
-            {
-                error_string_t error_str = strerror(errno);
-                log_message(global_log_file, LOG_ERROR, "Receive failed from %s server: %s",
-                            enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM", error_str);
-                SD_vCloseTCPConnection(enConnection);
-                ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_ERROR);
-            }
-        }
+    /* Validation stage: consume everything buffered this cycle, connection by connection */
+    for (enConnection = (enTCPConnectionsASI)0; enConnection < (enTCPConnectionsASI)enTotalTCPConnections; enConnection++)
+    {
+        icm_vConsumeRxRing((uint8_t)enConnection);
     }
 
     if (u8AvailableConnections == 0)
@@ -554,17 +597,17 @@ void ICM_vReceiveMessage(void)
  * comprehensive state handling, rate limiting, and error management. The function
  * operates differently based on system state and handles various transmission scenarios:
  *
- * 1. Message Queue Selection:
- *    - Normal/Startup State: Dequeues from approved actions queue
- *    - Safe State: Dequeues from safe state queue
- *    - Handles queue-specific processing requirements
+ * 1. Message Queue Selection (ITCOM_s8DequeueTxMessage):
+ *    - Safe state messages first, in every state
+ *    - Approvals and notifications by weighted round robin outside safe state
+ *    - Messages past their class deadline dropped instead of sent
  *
  * 2. Transmission Process:
  *    - Message preparation and validation
  *    - Rate limit checking
  *    - Connection state verification
  *    - Actual transmission with error handling
- *    - Transmission counter updates
+ *    - Sequence number and rolling counter allocation (lock-free)
  *
  * 3. Rate Limiting:
  *    - Enforces message transmission rate limits
@@ -617,20 +660,17 @@ void ICM_vTransmitMessage(void)
     log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Entry into ICM_vTransmitMessage");
     uint8_t u8ASI_State = ITCOM_u8GetASIState();
     int8_t s8DequeueState = ICM_INIT_VAL_U8;
+    uint8_t u8TxClass = ICM_INIT_VAL_U8;
     stProcessMsgData stMsgData = MSG_PROCESS_DATA_INIT;
     TLVMessage_t stTxMsg = MSG_TLV_DATA_INIT;
     RateLimiter_t stRateLimiter = RATE_LIMITER_INIT;
 
-    /* Dequeue appropriate message based on system state */
-    if (u8ASI_State == (uint8_t)STATE_NORM_OP || u8ASI_State == (uint8_t)STATE_STARTUP_TEST)
-    {
-        log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Dequeuing approved actions message");
-        s8DequeueState = ITCOM_s8DequeueActionReq(&stMsgData, APPROVED_ACTIONS_QUEUE);
-    }
-    else if (u8ASI_State == (uint8_t)STATE_SAFE_STATE)
+    /* Dequeue the next message: safe state first, then approvals/notifications (not in safe state) */
+    if (u8ASI_State == (uint8_t)STATE_NORM_OP || u8ASI_State == (uint8_t)STATE_STARTUP_TEST ||
+        u8ASI_State == (uint8_t)STATE_SAFE_STATE)
     {
-        log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Dequeuing safe state message");
-        s8DequeueState = ITCOM_s8DequeueActionReq(&stMsgData, SAFE_STATE_QUEUE);
+        s8DequeueState = ITCOM_s8DequeueTxMessage(&stMsgData, u8ASI_State, &u8TxClass);
+        log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Dequeued from TX class %u", u8TxClass);
     }
     else
     {
@@ -643,6 +683,9 @@ void ICM_vTransmitMessage(void)
         log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: No messages to transmit. s8DequeueState = %d", s8DequeueState);
         return;
     }
+    /* Until its payload is released, for ICM_vResetTxAfterFault() */
+    icm_stTxInFlight = stMsgData;
+    icm_bTxInFlight = true;
 
     /* Prepare the message for transmission */
     enTCPConnectionsASI enConnection = icm_enPrepareTransmitMessage(&stMsgData, &stTxMsg);
@@ -653,6 +696,7 @@ void ICM_vTransmitMessage(void)
     {
         log_message(global_log_file, LOG_WARNING, "ICM_vTransmitMessage: Connection %s is not available for message transmission",
                     enConnection == enVAMConnectionTCP ? "VAM" : "CM");
+        icm_vReleaseTxPayload(&stMsgData);
         return;
     }
 
@@ -661,6 +705,7 @@ void ICM_vTransmitMessage(void)
     {
         log_message(global_log_file, LOG_ERROR, "ICM_vTransmitMessage: Invalid connection configuration for %s",
                     enConnection == enVAMConnectionTCP ? "VAM" : "CM");
+        icm_vReleaseTxPayload(&stMsgData);
         return;
     }
 
@@ -679,17 +724,26 @@ void ICM_vTransmitMessage(void)
             }
         }
         log_message(global_log_file, LOG_WARNING, "ICM_vTransmitMessage: Rate limit exceeded, Message not sent");
+        icm_vReleaseTxPayload(&stMsgData);
         return;
     }
 
-    /* Attempt to send the message */
-    if (send(config->s16Socket, &stTxMsg, sizeof(stTxMsg), 0) >= 0)
+    /* Numbers are taken only for a message that is going out, so dropped messages leave no gaps */
+    icm_vAssignTransmitCounters(&stTxMsg, &stMsgData);
+
+    /* Attempt to send the message; ICM_TX is the last owner of a long value */
+    ssize_t send_result = icm_sSendFrame(config->s16Socket, &stTxMsg, &stMsgData);
+    if (send_result < 0)
+    {
+        icm_vReleaseTransmitCounters(&stTxMsg, &stMsgData);
+    }
+    icm_vReleaseTxPayload(&stMsgData);
+    if (send_result >= 0)
     {
         log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Message sent successfully");
         icm_vLogTransmittedMessage(&stTxMsg, enConnection);
         stMsgData.stMsgPairData.u16SequenceNum = stTxMsg.u16SequenceNumber;
         icm_vTrackSentMessage(&stMsgData);
-        icm_vUpdateTransmissionCounters(&stTxMsg, enConnection);
         ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_CONNECTED);
 
         /* Action Notification message for VAM */
@@ -707,7 +761,7 @@ void ICM_vTransmitMessage(void)
     {
         error_string_t error_str = strerror(errno);
         log_message(global_log_file, LOG_ERROR, "ICM_vTransmitMessage: Failed to send message: %s", error_str);
-        SD_vCloseTCPConnection(enConnection);
+        SD_vDropTCPConnection(enConnection);
         ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_ERROR);
 
         /* Action Notification message for VAM */
@@ -727,8 +781,358 @@ void ICM_vTransmitMessage(void)
     log_message(global_log_file, LOG_DEBUG, "ICM_vTransmitMessage: Exit from ICM_vTransmitMessage");
 }
 
+/**
+ * @brief Tells whether ICM_vTransmitMessage() has a message to send
+ *
+ * @details
+ * Idle fast path of THRD_ICM_TX: checks the safe state, approved action and
+ * notification queues without taking the ITCOM mutex. When all are empty the
+ * cycle is skipped, as ICM_vTransmitMessage() would return after a failed
+ * dequeue.
+ *
+ * @return true when any transmit queue holds a message
+ */
+bool ICM_bTxPending(void)
+{
+    return ITCOM_bQueueHasData((uint8_t)SAFE_STATE_QUEUE) ||
+           ITCOM_bQueueHasData((uint8_t)APPROVED_ACTIONS_QUEUE) ||
+           ITCOM_bQueueHasData((uint8_t)NOTIFICATION_QUEUE);
+}
+
+/**
+ * @brief Copies the receive path cost counters
+ *
+ * @details
+ * Every frame handed to the validation chain is classified by the first check
+ * it failed and the time spent processing it (validation, error events,
+ * notifications and logging included) is accumulated for that class. This
+ * bounds the CPU cost of hostile traffic: compare the average and maximum of
+ * the error classes with enRxFrameValid.
+ *
+ * @param[out] pastFrameCost        Array of enTotalRxFrameClasses entries
+ * @param[out] pu32TruncatedFrames  Frames shorter than TLVMessage_t (may be NULL)
+ *
+ * @return None
+ */
+void ICM_vGetRxFrameCost(RxFrameCost_t *pastFrameCost, uint32_t *pu32TruncatedFrames)
+{
+    if (pastFrameCost != NULL)
+    {
+        (void)memcpy(pastFrameCost, icm_astRxFrameCost, sizeof(icm_astRxFrameCost));
+    }
+    if (pu32TruncatedFrames != NULL)
+    {
+        *pu32TruncatedFrames = icm_u32TruncatedFrames;
+    }
+}
+
+/**
+ * @brief Logs the receive path cost per frame class, the duplicate action
+ *        request ratio, the receive ring counters and the messages with
+ *        pending CRC or rolling counter errors
+ *
+ * @param[in] pLogFile  Log file for the report
+ *
+ * @return None
+ *
+ * @pre ICM_RX thread is no longer running (called from the shutdown path)
+ */
+void ICM_vReportRxFrameCost(FILE *pLogFile)
+{
+    static const char *const apcClassName[enTotalRxFrameClasses] = {
+        "valid", "type/length", "crc", "sequence", "unknown id", "duplicate", "shed"
+    };
+    RecentRequestStats_t stRecent = {0};
+    MsgPoolStats_t stPool = {0};
+    MsgPoolStats_t stPayloadPool = {0};
+    uint8_t au8CrcErrors[enTotalMessagesASI];
+    uint8_t au8RcErrors[enTotalMessagesASI];
+    uint8_t u8Class;
+    uint8_t u8Msg;
+    uint8_t u8Conn;
+
+    for (u8Class = ICM_INIT_VAL_U8; u8Class < (uint8_t)enTotalRxFrameClasses; u8Class++)
+    {
+        const RxFrameCost_t *pstCost = &icm_astRxFrameCost[u8Class];
+        if (pstCost->u32FrameCount > 0U)
+        {
+            log_message(pLogFile, LOG_INFO, "ICM RX cost [%s]: frames %u, avg %llu ns, max %u ns, lock ops/frame %llu.%02llu",
+                        apcClassName[u8Class], pstCost->u32FrameCount,
+                        (unsigned long long)(pstCost->u64TotalCost_ns / pstCost->u32FrameCount),
+                        pstCost->u32MaxCost_ns,
+                        (unsigned long long)(pstCost->u64LockOps / pstCost->u32FrameCount),
+                        (unsigned long long)(((pstCost->u64LockOps * 100U) / pstCost->u32FrameCount) % 100U));
+        }
+    }
+    log_message(pLogFile, LOG_INFO, "ICM RX truncated frames: %u", icm_u32TruncatedFrames);
+
+    ITCOM_vGetRecentRequestStats(&stRecent);
+    if (stRecent.u32Requests > 0U)
+    {
+        uint32_t u32Duplicates = stRecent.u32Replayed + stRecent.u32Dropped;
+        log_message(pLogFile, LOG_INFO, "ICM RX duplicate action requests: %u of %u (%llu.%02llu%%), %u answered from cache, %u dropped, %u evictions",
+                    u32Duplicates, stRecent.u32Requests,
+                    (unsigned long long)(((uint64_t)u32Duplicates * 100U) / stRecent.u32Requests),
+                    (unsigned long long)((((uint64_t)u32Duplicates * 10000U) / stRecent.u32Requests) % 100U),
+                    stRecent.u32Replayed, stRecent.u32Dropped, stRecent.u32Evicted);
+    }
+
+    ITCOM_vGetPoolStats(&stPool);
+    log_message(pLogFile, LOG_INFO, "ICM RX message pool: allocs %u, frees %u, in use high %u/%u, exhausted %u",
+                stPool.u32Allocs, stPool.u32Frees, stPool.u32InUseHigh, (uint32_t)ITCOM_MSG_POOL_BLOCKS, stPool.u32Exhausted);
+    ITCOM_vGetPayloadPoolStats(&stPayloadPool);
+    log_message(pLogFile, LOG_INFO, "ICM RX payload pool: allocs %u, frees %u, in use high %u/%u, exhausted %u",
+                stPayloadPool.u32Allocs, stPayloadPool.u32Frees, stPayloadPool.u32InUseHigh,
+                (uint32_t)ITCOM_PAYLOAD_POOL_BLOCKS, stPayloadPool.u32Exhausted);
+
+    for (u8Conn = ICM_INIT_VAL_U8; u8Conn < (uint8_t)enTotalTCPConnections; u8Conn++)
+    {
+        RxRingStats_t stRing = {0};
+        ITCOM_vGetRxRingStats(u8Conn, &stRing);
+        log_message(pLogFile, LOG_INFO, "ICM RX ring [%s]: frames %u, occupancy %u, high water %u/%u, overflows %u",
+                    u8Conn == (uint8_t)enVAMConnectionTCP ? "VAM" : "CM", stRing.u32Frames, stRing.u32Occupancy,
+                    stRing.u32HighWater, ITCOM_RX_RING_DEPTH, stRing.u32Overflows);
+    }
+
+    ITCOM_vGetRxErrorCountSnapshot(au8CrcErrors, au8RcErrors);
+    for (u8Msg = ICM_INIT_VAL_U8; u8Msg < (uint8_t)enTotalMessagesASI; u8Msg++)
+    {
+        if ((au8CrcErrors[u8Msg] > 0U) || (au8RcErrors[u8Msg] > 0U))
+        {
+            log_message(pLogFile, LOG_INFO, "ICM RX message %u: CRC errors %u, rolling counter errors %u",
+                        u8Msg, au8CrcErrors[u8Msg], au8RcErrors[u8Msg]);
+        }
+    }
+}
+
+/**
+ * @brief Logs the queueing delay and deadline drops of each transmit class
+ *
+ * @param[in] pLogFile  Log file for the report
+ *
+ * @return None
+ */
+void ICM_vReportTxClassDelay(FILE *pLogFile)
+{
+    static const char *const apcClassName[enTotalTxClasses] = { "safe state", "approval", "notification" };
+    TxClassStats_t astStats[enTotalTxClasses];
+    uint8_t u8Class;
+
+    ITCOM_vGetTxClassStats(astStats);
+    for (u8Class = ICM_INIT_VAL_U8; u8Class < (uint8_t)enTotalTxClasses; u8Class++)
+    {
+        const TxClassStats_t *pstStats = &astStats[u8Class];
+        log_message(pLogFile, LOG_INFO, "ICM TX class [%s]: sent %u, avg delay %llu ms, max delay %u ms, dropped past deadline %u",
+                    apcClassName[u8Class], pstStats->u32Sent,
+                    (unsigned long long)((pstStats->u32Sent > 0U) ? (pstStats->u64DelayTotal_ms / pstStats->u32Sent) : 0U),
+                    pstStats->u32DelayMax_ms, pstStats->u32Dropped);
+    }
+}
+
+/**
+ * @brief Reset hook of the ICM_RX thread, run after a faulted cycle
+ *
+ * @details
+ * A fault while validating a frame leaves its ring slot unread and its
+ * payload block allocated. The frame is dropped rather than validated again
+ * on the next cycle, where it would most likely fault again, and the block
+ * goes back to the pool.
+ *
+ * @return None
+ */
+void ICM_vResetRxAfterFault(void)
+{
+    if (icm_u8RxFrameConnection != ICM_RX_NO_FRAME)
+    {
+        ITCOM_vPayloadFree(icm_u16RxPayload);
+        icm_u16RxPayload = ITCOM_POOL_HANDLE_NONE;
+        ITCOM_vRxRingCommitRead(icm_u8RxFrameConnection);
+        log_message(global_log_file, LOG_WARNING, "ICM_RX: frame on connection %u dropped after a faulted cycle",
+                    icm_u8RxFrameConnection);
+        icm_u8RxFrameConnection = ICM_RX_NO_FRAME;
+    }
+}
+
+/**
+ * @brief Reset hook of the ICM_TX thread, run after a faulted cycle
+ *
+ * @details
+ * A fault while sending a message leaves its payload block allocated. The
+ * message is dropped and the block goes back to the pool.
+ *
+ * @return None
+ */
+void ICM_vResetTxAfterFault(void)
+{
+    if (icm_bTxInFlight)
+    {
+        icm_vReleaseTxPayload(&icm_stTxInFlight);
+        log_message(global_log_file, LOG_WARNING, "ICM_TX: message 0x%04X dropped after a faulted cycle",
+                    icm_stTxInFlight.stMsgPairData.u16MsgId);
+    }
+}
+
+#ifdef ICM_RX_INJECTION
+/**
+ * @brief Feeds raw bytes into the receive path as if read from a socket
+ *
+ * @details
+ * Entry point for fuzzers (libFuzzer LLVMFuzzerTestOneInput / AFL persistent
+ * loop) and for replaying captured hostile traffic. Only built with
+ * make RX_INJECTION=1. Shared memory and ITCOM must be initialised by the
+ * caller; the frame then takes exactly the path of a socket read, including
+ * the receive ring, action request timing and cost accounting.
+ *
+ * A frame whose length field announces a long value carries the rest of
+ * the value after the fixed frame, as on the socket.
+ *
+ * @param[in] pu8Frame           Raw frame bytes
+ * @param[in] szFrameLength      Number of bytes (extra bytes beyond one TLV frame and its value are ignored, as with recv())
+ * @param[in] u8ConnectionIndex  Connection the frame is attributed to
+ *
+ * @return None
+ */
+void ICM_vInjectReceivedFrame(const uint8_t *pu8Frame, size_t szFrameLength, uint8_t u8ConnectionIndex)
+{
+    if ((pu8Frame == NULL) || (szFrameLength == 0U) || (u8ConnectionIndex >= (uint8_t)enTotalTCPConnections))
+    {
+        return;
+    }
+
+    icm_vWriteInjectedFrame(pu8Frame, szFrameLength, u8ConnectionIndex);
+    icm_vConsumeRxRing(u8ConnectionIndex);
+}
+#endif
+
 /*** Local Function Implementations ***/
 
+#ifdef ICM_RX_INJECTION
+/**
+ * @brief Writes an injected frame into a connection's receive ring
+ *
+ * @details
+ * The frame is stored the way icm_vFillRxRing() stores a socket read,
+ * long value in a payload pool block included. A full ring loses the frame
+ * and counts an overflow.
+ *
+ * @param[in] pu8Frame           Raw frame bytes, not empty
+ * @param[in] szFrameLength      Number of bytes
+ * @param[in] u8ConnectionIndex  Valid connection the frame is attributed to
+ *
+ * @return None
+ */
+static void icm_vWriteInjectedFrame(const uint8_t *pu8Frame, size_t szFrameLength, uint8_t u8ConnectionIndex)
+{
+    TLVMessage_t *pstSlot = ITCOM_pstRxRingGetWriteSlot(u8ConnectionIndex);
+    size_t szCopy = (szFrameLength < sizeof(TLVMessage_t)) ? szFrameLength : sizeof(TLVMessage_t);
+    uint16_t u16Payload = ITCOM_POOL_HANDLE_NONE;
+
+    if (pstSlot != NULL)
+    {
+        (void)memset(pstSlot, 0, sizeof(*pstSlot));
+        (void)memcpy(pstSlot, pu8Frame, szCopy);
+        if ((szCopy == sizeof(TLVMessage_t)) && (pstSlot->u16Length > TLV_VALUE_SIZE) && (pstSlot->u16Length <= TLV_MAX_VALUE_SIZE))
+        {
+            size_t szTail = (size_t)pstSlot->u16Length - TLV_VALUE_SIZE;
+            uint8_t *pu8Block = NULL;
+
+            szTail = ((szFrameLength - szCopy) < szTail) ? (szFrameLength - szCopy) : szTail;
+            u16Payload = ITCOM_u16PayloadAlloc();
+            pu8Block = ITCOM_pu8PayloadBlock(u16Payload);
+            if (pu8Block != NULL)
+            {
+                (void)memcpy(pu8Block, pstSlot->au8Value, TLV_VALUE_SIZE);
+                (void)memcpy(pu8Block + TLV_VALUE_SIZE, pu8Frame + szCopy, szTail);
+                szCopy += szTail;
+            }
+        }
+        ITCOM_vRxRingCommitWrite(u8ConnectionIndex, (uint16_t)szCopy, u16Payload);
+    }
+    else
+    {
+        /* The injected frame is lost */
+        ITCOM_vRxRingCountOverflow(u8ConnectionIndex);
+    }
+}
+
+/**
+ * @brief Reads the frames waiting on ICM_RX_INJECTION_SOCKET into the
+ *        receive rings
+ *
+ * @details
+ * Injection stage of ICM_vReceiveMessage in make RX_INJECTION=1 builds of
+ * the application: a test driver sends the frames of a connection here
+ * instead of on the TCP socket, and they take the socket path from the
+ * ring on. As on the socket, a frame for a connection not read this cycle
+ * (not connected, or VAM in safe state) is lost, and a full ring leaves the
+ * remaining datagrams for the next cycle. The socket is opened on the first
+ * call; if that fails the injection stage stays off.
+ *
+ * @param[in] u8ASI_State  ASI state of this ICM_RX cycle
+ *
+ * @return None
+ */
+static void icm_vFillRxRingsFromInjection(uint8_t u8ASI_State)
+{
+    static uint8_t au8Datagram[ICM_RX_INJECT_HEADER_SIZE + sizeof(TLVMessage_t) + TLV_MAX_VALUE_SIZE];
+    uint8_t u8Connection = ICM_INIT_VAL_U8;
+    ssize_t sPeek;
+
+    if (!icm_bInjectSocketOpened)
+    {
+        struct sockaddr_un stAddr;
+
+        icm_bInjectSocketOpened = true;
+        (void)memset(&stAddr, 0, sizeof(stAddr));
+        stAddr.sun_family = AF_UNIX;
+        (void)strncpy(stAddr.sun_path, ICM_RX_INJECTION_SOCKET, sizeof(stAddr.sun_path) - 1U);
+        (void)unlink(ICM_RX_INJECTION_SOCKET); /* Left behind by the previous child */
+        icm_s32InjectSocket = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if ((icm_s32InjectSocket >= 0) && (bind(icm_s32InjectSocket, (struct sockaddr *)&stAddr, sizeof(stAddr)) != 0))
+        {
+            (void)close(icm_s32InjectSocket);
+            icm_s32InjectSocket = -1;
+        }
+        if (icm_s32InjectSocket < 0)
+        {
+            log_message(global_log_file, LOG_WARNING, "RX injection socket %s unavailable: %s", ICM_RX_INJECTION_SOCKET, strerror(errno));
+        }
+        else
+        {
+            log_message(global_log_file, LOG_INFO, "RX injection socket %s open", ICM_RX_INJECTION_SOCKET);
+        }
+    }
+    if (icm_s32InjectSocket < 0)
+    {
+        return;
+    }
+
+    sPeek = recv(icm_s32InjectSocket, &u8Connection, sizeof(u8Connection), MSG_PEEK | MSG_DONTWAIT);
+    while (sPeek >= 0)
+    {
+        bool bRead = (sPeek > 0) && (u8Connection < (uint8_t)enTotalTCPConnections) &&
+                     (ITCOM_enGetTCPConnectionState((enTCPConnectionsASI)u8Connection) == (TCPConnectionState_t)CONNECTION_STATE_CONNECTED) &&
+                     ((u8ASI_State != (uint8_t)STATE_SAFE_STATE) || (u8Connection == (uint8_t)enCMConnectionTCP));
+        ssize_t sReceived;
+
+        if (bRead && (ITCOM_pstRxRingGetWriteSlot(u8Connection) == NULL))
+        {
+            break; /* Ring full, the rest waits for the next cycle */
+        }
+        sReceived = recv(icm_s32InjectSocket, au8Datagram, sizeof(au8Datagram), MSG_DONTWAIT);
+        if (bRead && (sReceived > (ssize_t)ICM_RX_INJECT_HEADER_SIZE))
+        {
+            icm_vWriteInjectedFrame(&au8Datagram[ICM_RX_INJECT_HEADER_SIZE], (size_t)sReceived - ICM_RX_INJECT_HEADER_SIZE, u8Connection);
+        }
+        else
+        {
+            log_message(global_log_file, LOG_DEBUG, "Injected frame for connection %u dropped", u8Connection);
+        }
+        sPeek = recv(icm_s32InjectSocket, &u8Connection, sizeof(u8Connection), MSG_PEEK | MSG_DONTWAIT);
+    }
+}
+#endif
+
 /**
  * @brief Saves and validates vehicle status data for PRNDL and vehicle speed
  *
@@ -834,6 +1238,13 @@ static int8_t icm_s8CRCEval(TLVMessage_t stReceivedMsg, uint8_t u8Indx)
     u8SizeCrc = sizeof(stReceivedMsg.u16SequenceNumber) + sizeof(stReceivedMsg.u16ID) + sizeof(stReceivedMsg.au8Value);
     u16CalcCrc = CRC_u16CalculateCrc((uint8_t *)&stReceivedMsg.u16SequenceNumber, u8SizeCrc);
 
+    /* A long value continues the CRC over the bytes received after the fixed frame */
+    uint8_t *pu8Block = ITCOM_pu8PayloadBlock(icm_u16RxPayload);
+    if ((stReceivedMsg.u16Length > TLV_VALUE_SIZE) && (stReceivedMsg.u16Length <= TLV_MAX_VALUE_SIZE) && (pu8Block != NULL))
+    {
+        u16CalcCrc = CRC_u16UpdateCrc(u16CalcCrc, pu8Block + TLV_VALUE_SIZE, stReceivedMsg.u16Length - TLV_VALUE_SIZE);
+    }
+
     if (u16CalcCrc == stReceivedMsg.u16CRC)
     {
         s8CrcEvalResult = E_OK;
@@ -874,10 +1285,12 @@ static int8_t icm_s8CRCEval(TLVMessage_t stReceivedMsg, uint8_t u8Indx)
  * @param[in] stMsgConfig     Message configuration structure
  * @param[in] s16Indx         Message index for tracking
  *
- * @return None
+ * @return int8_t  E_OK if in sequence (or RC not checked), E_NOT_OK otherwise
  */
-static void icm_vRollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx)
+static int8_t icm_s8RollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx)
 {
+    int8_t s8RcEvalResult = E_OK;
+
     if (stMsgConfig.u8RCFlag == ACTIVE_FLAG)
     {
         uint16_t u16PrevRollingCount = ICM_INIT_VAL_U16;
@@ -892,6 +1305,7 @@ static void icm_vRollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stM
         else
         {
             uint8_t u8RollingCountError = ITCOM_u8GetRollingCountError((uint8_t)s16Indx);
+            s8RcEvalResult = E_NOT_OK;
             u8RollingCountError++;
             ITCOM_vSetRollingCountError((uint8_t)s16Indx, u8RollingCountError);
             if (u8RollingCountError >= ROLLINC_COUNTER_ERROR_LIMIT)
@@ -904,6 +1318,8 @@ static void icm_vRollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stM
             }
         }
     }
+
+    return s8RcEvalResult;
 }
 
 /**
@@ -920,10 +1336,11 @@ static void icm_vRollingCountEval(TLVMessage_t stReceivedMsg, MsgIntConfig_t stM
  * @param[in] stMsgConfig     Message configuration data
  * @param[in] s16Indx         Message index
  * @param[in] u8ConnectionIndex Connection identifier
+ * @param[in,out] pstTxn      Transaction the tracker update is staged in
  *
  * @return None
  */
-static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx, uint8_t u8ConnectionIndex)
+static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMsgConfig, int16_t s16Indx, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn)
 {
     stMsgIntegrityData stMsgTracker = MSG_INTEGRITY_DATA_INIT;
     int16_t s16MsgEnum = ITCOM_s16GetMessageEnumById(stReceivedMsg.u16ID);
@@ -954,12 +1371,12 @@ static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMs
         stMsgTracker.stMsgPairData.u16SequenceNum = ICM_SEQUENCE_NUM_INIT;
         stMsgTracker.u8ResponseCycleCount = ICM_RESPONSE_COUNT_INIT;
         stMsgTracker.u8ClearCondition = ICM_CLEAR_CONDITION_INIT;
-        ITCOM_vSetMsgCycleCount(&stMsgTracker, UPDATE_ELEMENT);
+        (void)ITCOM_s8TxnSetMsgCycleCount(pstTxn, &stMsgTracker, UPDATE_ELEMENT);
     }
     else
     {
         stMsgTracker.stMsgPairData.u16SequenceNum = stReceivedMsg.u16SequenceNumber;
-        ITCOM_vSetMsgCycleCount(&stMsgTracker, REMOVE_ELEMENT);
+        (void)ITCOM_s8TxnSetMsgCycleCount(pstTxn, &stMsgTracker, REMOVE_ELEMENT);
     }
 }
 
@@ -974,23 +1391,29 @@ static void icm_vCycleCountReset(TLVMessage_t stReceivedMsg, MsgIntConfig_t stMs
  * - Response tracking
  * - Acknowledgment handling
  *
- * @param[in] pstReceivedMsg  Pointer to received TLV message
- * @param[in] s16Indx         Message index for processing
- * @param[in] s16TypeIndx     Message type index
+ * @param[in] pstReceivedMsg     Pointer to received TLV message
+ * @param[in] s16Indx            Message index for processing
+ * @param[in] s16TypeIndx        Message type index
+ * @param[in] u8ConnectionIndex  Connection the message was received on
+ * @param[in,out] pstTxn         Transaction holding the updates staged for this
+ *                               message; committed here together with the
+ *                               rolling counter and the action request
  *
- * @return None
+ * @return int8_t  Save result of an action request (ACTION_REQUEST_DUPLICATE_*
+ *                 for a repeated request), E_OK for other messages
  */
-static void icm_vSaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int16_t s16TypeIndx)
+static int8_t icm_s8SaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int16_t s16TypeIndx, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn)
 {
-    int8_t s8SaveMsgStatus = ICM_INIT_VAL_S32;
+    int8_t s8SaveOp = ITCOM_TXN_FULL;
+    int8_t s8Result = E_OK;
     stProcessMsgData stMsgDataTracker = {ICM_INIT_VAL_U16};
     generic_ptr_t memory_operation_result = NULL;
 
     /* Validate input parameters */
     if (pstReceivedMsg == NULL)
     {
-        log_message(global_log_file, LOG_ERROR, "icm_vSaveMsgData: Received NULL message pointer");
-        return;
+        log_message(global_log_file, LOG_ERROR, "icm_s8SaveMsgData: Received NULL message pointer");
+        return E_NOT_OK;
     }
 
     /* Initialize message tracker with received data */
@@ -998,32 +1421,54 @@ static void icm_vSaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int1
     stMsgDataTracker.stMsgPairData.u16SequenceNum = pstReceivedMsg->u16SequenceNumber;
     stMsgDataTracker.u16Type = pstReceivedMsg->u16Type;
     stMsgDataTracker.u16Length = pstReceivedMsg->u16Length;
+    stMsgDataTracker.u16PayloadHandle = icm_u16RxPayload;
 
     /* Perform memory copy with error handling */
     memory_operation_result = memcpy(stMsgDataTracker.au8MsgData, pstReceivedMsg->au8Value, sizeof(stMsgDataTracker.au8MsgData));
     if (memory_operation_result != stMsgDataTracker.au8MsgData)
     {
         log_message(global_log_file, LOG_ERROR, "Memory copy failed in message data population for MsgID: 0x%04X", pstReceivedMsg->u16ID);
-        return;
+        return E_NOT_OK;
     }
+    ITCOM_NOTE_MSG_COPY(sizeof(stMsgDataTracker));
 
     /* Record rolling counter */
-    ITCOM_vRecordRC((uint8_t)s16Indx, pstReceivedMsg->u16RollingCounter, ROLLING_COUNT_RX);
+    (void)ITCOM_s8TxnRecordRC(pstTxn, (uint8_t)s16Indx, pstReceivedMsg->u16RollingCounter, ROLLING_COUNT_RX);
 
     /* Process message based on type */
     uint8_t u8RollingCountError = ITCOM_u8GetRollingCountError((uint8_t)s16Indx);
+    if ((u8RollingCountError < ROLLINC_COUNTER_ERROR_LIMIT) && (s16TypeIndx == enActionRequest))
+    {
+        s8SaveOp = ITCOM_s8TxnSaveMsgData(pstTxn, &stMsgDataTracker, s16Indx, u8ConnectionIndex);
+    }
+
+    /* Tracker, rolling counter and action request become visible together */
+    (void)ITCOM_s8TxnCommit(pstTxn);
+
     if (u8RollingCountError < ROLLINC_COUNTER_ERROR_LIMIT)
     {
         switch (s16TypeIndx)
         {
         case enActionRequest:
-            s8SaveMsgStatus = ITCOM_s8SaveMsgData(&stMsgDataTracker, s16Indx);
-            if (s8SaveMsgStatus < 0)
+            s8Result = ITCOM_s8TxnGetResult(pstTxn, s8SaveOp);
+            if (s8Result == ACTION_REQUEST_DUPLICATE_REPLAYED)
+            {
+                log_message(global_log_file, LOG_DEBUG, "Duplicate Action Request 0x%04X/%u answered with the cached decision",
+                            pstReceivedMsg->u16ID, pstReceivedMsg->u16SequenceNumber);
+            }
+            else if (s8Result == ACTION_REQUEST_DUPLICATE_DROPPED)
+            {
+                log_message(global_log_file, LOG_DEBUG, "Duplicate Action Request 0x%04X/%u dropped, still in progress",
+                            pstReceivedMsg->u16ID, pstReceivedMsg->u16SequenceNumber);
+            }
+            else if (s8Result < 0)
             {
                 log_message(global_log_file, LOG_DEBUG, "Action Request NOT Saved");
             }
             else
             {
+                /* The queued request owns the payload block from here on */
+                icm_u16RxPayload = ITCOM_POOL_HANDLE_NONE;
                 log_message(global_log_file, LOG_DEBUG, "Action Request Saved");
             }
             break;
@@ -1049,6 +1494,8 @@ static void icm_vSaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int1
             break;
         }
     }
+
+    return s8Result;
 }
 
 /**
@@ -1058,32 +1505,24 @@ static void icm_vSaveMsgData(TLVMessage_t *pstReceivedMsg, int16_t s16Indx, int1
  * This internal function fills the header fields of a TLV message structure.
  * The function handles:
  * - Type and length assignment
- * - CRC calculation
- * - Rolling counter management
  * - Timestamp generation
  *
+ * The rolling counter and the CRC are filled in by
+ * icm_vAssignTransmitCounters() right before the send.
+ *
  * @param[out] pstTempTxMsg      Pointer to TLV message to populate
  * @param[in]  stMsgData         Message data structure
- * @param[in]  stDictionaryData  Message dictionary data
  *
  * @return None
  */
-static void icm_vPopulateMsgHeader(TLVMessage_t *pstTempTxMsg, stProcessMsgData stMsgData, MessageDictionary_t stDictionaryData)
+static void icm_vPopulateMsgHeader(TLVMessage_t *pstTempTxMsg, stProcessMsgData stMsgData)
 {
 
-    uint8_t u8SizeCrc = ICM_INIT_VAL_U8;
     pstTempTxMsg->u16Type = stMsgData.u16Type;
     pstTempTxMsg->u16Length = stMsgData.u16Length;
 
-    /*Calculate CRC*/
-    u8SizeCrc = sizeof(stMsgData.stMsgPairData) + sizeof(stMsgData.au8MsgData);
-    pstTempTxMsg->u16CRC = CRC_u16CalculateCrc((uint8_t *)&stMsgData.stMsgPairData, u8SizeCrc);
-
-    /*Get rolling counter data*/
-    pstTempTxMsg->u16RollingCounter = ITCOM_u16GetRCData(stDictionaryData.u8MessageEnum, ROLLING_COUNT_TX);
-
     /*Populate timestamp*/
-    time_t stTimeNow = time(NULL);
+    time_t stTimeNow = UT_tGetWallTime_s();
     pstTempTxMsg->u32TimeStamp = (uint32_t)stTimeNow; // Store as seconds since the Epoch
 }
 
@@ -1114,8 +1553,10 @@ static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData
         return;
     }
 
-    /* Validate message data size */
-    if (stMsgData.u16Length > sizeof(pstTempTxMsg->au8Value))
+    /* Validate message data size; values beyond the fixed frame are sent from their payload block */
+    uint16_t u16InlineLength = (stMsgData.u16Length < sizeof(pstTempTxMsg->au8Value)) ?
+                               stMsgData.u16Length : (uint16_t)sizeof(pstTempTxMsg->au8Value);
+    if (stMsgData.u16Length > TLV_MAX_VALUE_SIZE)
     {
         log_message(global_log_file, LOG_ERROR, "icm_vPopulateMsgPayload: Message data size exceeds buffer capacity");
         return;
@@ -1124,14 +1565,13 @@ static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData
     /* Get and validate Sequence Number */
     if (stTempMsgConfig.u8SeqNumberAssigner == SEQ_NUM_ASI)
     {
-        uint16_t u16SeqNum = ITCOM_u16GetSeqNumASIRecord(stDictionaryData.u8MessageEnum);
-        if (u16SeqNum == UINT16_MAX)
+        /* Allocated by icm_vAssignTransmitCounters() right before the send */
+        if (stDictionaryData.u8MessageEnum >= (uint8_t)enTotalMessagesASI)
         {
-            log_message(global_log_file, LOG_ERROR, "icm_vPopulateMsgPayload: Failed to get ASI sequence number for enum %d",
+            log_message(global_log_file, LOG_ERROR, "icm_vPopulateMsgPayload: No ASI sequence number for enum %d",
                         stDictionaryData.u8MessageEnum);
             return;
         }
-        pstTempTxMsg->u16SequenceNumber = u16SeqNum;
     }
     else if (stTempMsgConfig.u8SeqNumberAssigner == SEQ_NUM_VAM)
     {
@@ -1158,11 +1598,17 @@ static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData
         log_message(global_log_file, LOG_ERROR, "icm_vPopulateMsgPayload: Zero message data length");
         return;
     }
+    if ((stMsgData.u16Length > MSG_PAYLOAD_SIZE) && (ITCOM_pu8MsgPayload(&stMsgData) == NULL))
+    {
+        log_message(global_log_file, LOG_ERROR, "icm_vPopulateMsgPayload: No payload block for %u byte value of message ID: 0x%04X",
+                    stMsgData.u16Length, stMsgData.stMsgPairData.u16MsgId);
+        return;
+    }
 
     /* Copy message payload with validation */
     generic_ptr_t memory_operation_result = memcpy(pstTempTxMsg->au8Value,
                                                    stMsgData.au8MsgData,
-                                                   stMsgData.u16Length);
+                                                   u16InlineLength);
 
     if (memory_operation_result != pstTempTxMsg->au8Value)
     {
@@ -1178,12 +1624,12 @@ static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData
     }
 
     /* Clear any remaining bytes in the destination buffer if message is shorter than buffer */
-    if (stMsgData.u16Length < sizeof(pstTempTxMsg->au8Value))
+    if (u16InlineLength < sizeof(pstTempTxMsg->au8Value))
     {
-        memory_operation_result = memset(pstTempTxMsg->au8Value + stMsgData.u16Length,
+        memory_operation_result = memset(pstTempTxMsg->au8Value + u16InlineLength,
                                          0,
-                                         sizeof(pstTempTxMsg->au8Value) - stMsgData.u16Length);
-        if (memory_operation_result != (pstTempTxMsg->au8Value + stMsgData.u16Length))
+                                         sizeof(pstTempTxMsg->au8Value) - u16InlineLength);
+        if (memory_operation_result != (pstTempTxMsg->au8Value + u16InlineLength))
         {
             log_message(global_log_file, LOG_ERROR, "Buffer clearing failed");
             return;
@@ -1212,13 +1658,13 @@ static void icm_vPopulateMsgPayload(TLVMessage_t *pstTempTxMsg, stProcessMsgData
 static int8_t icm_s16CheckRateLimit(RateLimiter_t *pstRateLimiter)
 {
     int8_t s8Result = RATE_LIMIT_EXCEEDED;
-    clock_t stCurrentTime = clock();
-    float64_t f64ElapsedTimeMs = (float64_t)(stCurrentTime - pstRateLimiter->stStartTime) / CLOCKS_PER_SEC * ICM_TIME_FACTOR_MS;
+    uint32_t u32CurrentTime = UT_u32GetCurrentTime_ms();
+    uint32_t u32ElapsedTimeMs = u32CurrentTime - pstRateLimiter->u32StartTime_ms;
 
-    if (f64ElapsedTimeMs >= pstRateLimiter->u16TimeWindowMs)
+    if (u32ElapsedTimeMs >= pstRateLimiter->u16TimeWindowMs)
     {
         pstRateLimiter->u16MessageCount = ICM_MSG_COUNT_INIT;
-        pstRateLimiter->stStartTime = stCurrentTime;
+        pstRateLimiter->u32StartTime_ms = u32CurrentTime;
     }
 
     if (pstRateLimiter->u16MessageCount < pstRateLimiter->u16AllowedMessages)
@@ -1250,6 +1696,412 @@ static float32_t icm_f32FixedPointToFloat(uint16_t u16Fixed, int16_t s16ScaleFac
     return (float32_t)u16Fixed / s16ScaleFactor;
 }
 
+/**
+ * @brief Reads frames from one connection into its receive ring
+ *
+ * @details
+ * Socket reader stage of ICM_vReceiveMessage. Frames are received directly
+ * into free ring slots until the socket has no more data or the ring is full;
+ * a full ring leaves the remaining data in the socket buffer for the next
+ * cycle and is counted as an overflow if data is actually waiting. The ring
+ * is consumed right after this on the same ICM_RX cycle, so the reader and
+ * the validation stage are batched rather than concurrent. A frame that has started to
+ * arrive is always read to its end, so the stream stays in frame; when the
+ * peer does not complete it the connection is closed.
+ *
+ * @param[in] enConnection  Connection to read
+ * @param[in] s16Socket     Socket of the connection
+ *
+ * @return None
+ */
+static void icm_vFillRxRing(enTCPConnectionsASI enConnection, int16_t s16Socket)
+{
+    uint16_t u16Frames = ICM_INIT_VAL_U16;
+    TLVMessage_t *pstSlot = ITCOM_pstRxRingGetWriteSlot((uint8_t)enConnection);
+
+    while (pstSlot != NULL)
+    {
+        ssize_t recv_result = recv(s16Socket, pstSlot, sizeof(*pstSlot), MSG_DONTWAIT);
+        uint16_t u16Payload = ITCOM_POOL_HANDLE_NONE;
+
+        if (recv_result > 0)
+        {
+            ssize_t value_result = 0;
+
+            if (recv_result < (ssize_t)sizeof(*pstSlot))
+            {
+                recv_result += (ssize_t)icm_szReceiveRest(s16Socket, (uint8_t *)pstSlot + recv_result,
+                                                          sizeof(*pstSlot) - (size_t)recv_result);
+            }
+            if (recv_result == (ssize_t)sizeof(*pstSlot))
+            {
+                value_result = icm_sReceiveLongValue(s16Socket, pstSlot, &u16Payload);
+            }
+            if ((recv_result < (ssize_t)sizeof(*pstSlot)) || (value_result < 0))
+            {
+                log_message(global_log_file, LOG_ERROR, "Incomplete frame from %s server, closing the connection",
+                            enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM");
+                ITCOM_vPayloadFree(u16Payload);
+                SD_vDropTCPConnection(enConnection);
+                ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_ERROR);
+                return;
+            }
+            recv_result += value_result;
+            ITCOM_vRxRingCommitWrite((uint8_t)enConnection, (uint16_t)recv_result, u16Payload);
+            u16Frames++;
+            pstSlot = ITCOM_pstRxRingGetWriteSlot((uint8_t)enConnection);
+        }
+        else if (recv_result == 0)
+        {
+            log_message(global_log_file, LOG_WARNING, "Connection closed by %s server",
+                        enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM");
+            SD_vDropTCPConnection(enConnection);
+            ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_DISCONNECTED);
+            return;
+        }
+        else if (errno == EWOULDBLOCK || errno == EAGAIN)
+        {
+            if (u16Frames == ICM_INIT_VAL_U16)
+            {
+                log_message(global_log_file, LOG_WARNING, "No data available from %s server",
+                            enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM");
+            }
+            break;
+        }
+        else
+        {
+            error_string_t error_str = strerror(errno);
+            log_message(global_log_file, LOG_ERROR, "Receive failed from %s server: %s",
+                        enConnection == (enTCPConnectionsASI)enVAMConnectionTCP ? "VAM" : "CM", error_str);
+            SD_vDropTCPConnection(enConnection);
+            ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_ERROR);
+            return;
+        }
+    }
+
+    /* Ring full: an overflow only if the socket still holds data */
+    if (pstSlot == NULL)
+    {
+        uint8_t u8Peek;
+        if (recv(s16Socket, &u8Peek, sizeof(u8Peek), MSG_PEEK | MSG_DONTWAIT) > 0)
+        {
+            ITCOM_vRxRingCountOverflow((uint8_t)enConnection);
+        }
+    }
+
+    if (u16Frames > ICM_INIT_VAL_U16)
+    {
+        ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_CONNECTED);
+    }
+}
+
+/**
+ * @brief Runs every frame buffered in a connection's receive ring through
+ *        the validation chain
+ *
+ * @details
+ * Frames are validated in place in the ring slot and released afterwards, in
+ * arrival order. The payload block of a long value is freed with its slot
+ * unless the frame was queued as an action request.
+ *
+ * @param[in] u8ConnectionIndex  Connection whose ring is consumed
+ *
+ * @return None
+ */
+static void icm_vConsumeRxRing(uint8_t u8ConnectionIndex)
+{
+    uint16_t u16Received = ICM_INIT_VAL_U16;
+    TLVMessage_t *pstFrame = ITCOM_pstRxRingGetReadSlot(u8ConnectionIndex, &u16Received, &icm_u16RxPayload);
+
+    while (pstFrame != NULL)
+    {
+        icm_u8RxFrameConnection = u8ConnectionIndex;
+        icm_vHandleReceivedFrame(pstFrame, u8ConnectionIndex, (size_t)u16Received);
+        /* Not handed on to the action request queue: the block goes back to the pool */
+        ITCOM_vPayloadFree(icm_u16RxPayload);
+        icm_u16RxPayload = ITCOM_POOL_HANDLE_NONE;
+        ITCOM_vRxRingCommitRead(u8ConnectionIndex);
+        icm_u8RxFrameConnection = ICM_RX_NO_FRAME;
+        pstFrame = ITCOM_pstRxRingGetReadSlot(u8ConnectionIndex, &u16Received, &icm_u16RxPayload);
+    }
+}
+
+/**
+ * @brief Receives the part of a long value that follows the fixed frame
+ *
+ * @details
+ * A frame whose length field is above TLV_VALUE_SIZE carries its first
+ * TLV_VALUE_SIZE value bytes in the fixed frame and the rest right after it.
+ * The whole value is assembled in a payload pool block: the inline bytes are
+ * copied, the rest is received straight into the block. Without a free block
+ * the rest is still read from the socket, to keep the stream in frame, and
+ * the frame goes on without a block. The rest of a value above
+ * TLV_MAX_VALUE_SIZE is read and discarded; type/length validation rejects
+ * the frame.
+ *
+ * @param[in]  s16Socket    Socket of the connection
+ * @param[in]  pstSlot      Fixed frame just received
+ * @param[out] pu16Payload  Payload block, ITCOM_POOL_HANDLE_NONE if none was taken
+ *
+ * @return ssize_t  Value bytes kept after the fixed frame, -1 if the peer did
+ *                  not send the whole value
+ */
+static ssize_t icm_sReceiveLongValue(int16_t s16Socket, const TLVMessage_t *pstSlot, uint16_t *pu16Payload)
+{
+    uint8_t au8Discard[TLV_MAX_VALUE_SIZE];
+    uint8_t *pu8Dest = au8Discard;
+    size_t szTail;
+
+    *pu16Payload = ITCOM_POOL_HANDLE_NONE;
+    if (pstSlot->u16Length <= TLV_VALUE_SIZE)
+    {
+        return 0;
+    }
+    szTail = (size_t)pstSlot->u16Length - TLV_VALUE_SIZE;
+
+    if (pstSlot->u16Length > TLV_MAX_VALUE_SIZE)
+    {
+        log_message(global_log_file, LOG_WARNING, "%u byte value of message 0x%04X above %u bytes, discarded",
+                    pstSlot->u16Length, pstSlot->u16ID, (uint32_t)TLV_MAX_VALUE_SIZE);
+        while (szTail > 0U)
+        {
+            size_t szChunk = (szTail < sizeof(au8Discard)) ? szTail : sizeof(au8Discard);
+            if (icm_szReceiveRest(s16Socket, au8Discard, szChunk) != szChunk)
+            {
+                return -1;
+            }
+            szTail -= szChunk;
+        }
+        return 0;
+    }
+
+    *pu16Payload = ITCOM_u16PayloadAlloc();
+    uint8_t *pu8Block = ITCOM_pu8PayloadBlock(*pu16Payload);
+    if (pu8Block != NULL)
+    {
+        (void)memcpy(pu8Block, pstSlot->au8Value, TLV_VALUE_SIZE);
+        pu8Dest = pu8Block + TLV_VALUE_SIZE;
+    }
+    else
+    {
+        log_message(global_log_file, LOG_WARNING, "Payload pool exhausted, %u byte value of message 0x%04X discarded",
+                    pstSlot->u16Length, pstSlot->u16ID);
+    }
+
+    return (icm_szReceiveRest(s16Socket, pu8Dest, szTail) == szTail) ? (ssize_t)szTail : -1;
+}
+
+/**
+ * @brief Receives the rest of a frame that has started to arrive
+ *
+ * @details
+ * The socket is non-blocking; when the rest is not there yet the reader
+ * waits for it up to ICM_RX_REST_WAIT_US per read.
+ *
+ * @param[in]  s16Socket  Socket of the connection
+ * @param[out] pu8Dest    Destination of the bytes
+ * @param[in]  szLength   Bytes still expected
+ *
+ * @return size_t  Bytes received, less than szLength if the peer stalled,
+ *                 closed the connection or the read failed
+ */
+static size_t icm_szReceiveRest(int16_t s16Socket, uint8_t *pu8Dest, size_t szLength)
+{
+    size_t szDone = 0U;
+
+    while (szDone < szLength)
+    {
+        ssize_t recv_result = recv(s16Socket, pu8Dest + szDone, szLength - szDone, MSG_DONTWAIT);
+
+        if (recv_result > 0)
+        {
+            szDone += (size_t)recv_result;
+        }
+        else if ((recv_result < 0) && (errno == EINTR))
+        {
+            /* Interrupted before any data, read again */
+        }
+        else if ((recv_result < 0) && ((errno == EWOULDBLOCK) || (errno == EAGAIN)))
+        {
+            fd_set stReadSet;
+            struct timeval stWait = {0, ICM_RX_REST_WAIT_US};
+
+            FD_ZERO(&stReadSet);
+            FD_SET(s16Socket, &stReadSet);
+            if (select(s16Socket + 1, &stReadSet, NULL, NULL, &stWait) <= 0)
+            {
+                break;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+    return szDone;
+}
+
+/**
+ * @brief Sends one frame, gathering a long value from its payload block
+ *
+ * @details
+ * Short values go out as the fixed frame. For a long value the bytes beyond
+ * the fixed frame are sent from the payload block in the same sendmsg(), so
+ * the value is never copied into a contiguous transmit buffer.
+ *
+ * @param[in] s16Socket   Socket of the connection
+ * @param[in] pstTxMsg    Fixed frame, value bytes up to TLV_VALUE_SIZE filled in
+ * @param[in] pstMsgData  Message with the whole value
+ *
+ * @return ssize_t  Bytes sent, -1 on error (errno set)
+ */
+static ssize_t icm_sSendFrame(int16_t s16Socket, const TLVMessage_t *pstTxMsg, stProcessMsgData *pstMsgData)
+{
+    struct iovec astIov[ICM_TX_IOV_COUNT];
+    struct msghdr stMsgHdr = {0};
+    uint8_t *pu8Value = ITCOM_pu8MsgPayload(pstMsgData);
+
+    astIov[0].iov_base = (void *)pstTxMsg;
+    astIov[0].iov_len = sizeof(*pstTxMsg);
+    stMsgHdr.msg_iov = astIov;
+    stMsgHdr.msg_iovlen = 1U;
+
+    if ((pstMsgData->u16Length > MSG_PAYLOAD_SIZE) && (pu8Value != NULL))
+    {
+        astIov[1].iov_base = pu8Value + MSG_PAYLOAD_SIZE;
+        astIov[1].iov_len = (size_t)pstMsgData->u16Length - MSG_PAYLOAD_SIZE;
+        stMsgHdr.msg_iovlen = ICM_TX_IOV_COUNT;
+    }
+
+    return sendmsg(s16Socket, &stMsgHdr, 0);
+}
+
+/**
+ * @brief Runs one received frame through the validation chain and accounts its cost
+ *
+ * @details
+ * Common handling for socket reads and injected frames:
+ * - Admission control: while the action request queue is above its high
+ *   water mark, or no payload block was free for a long value, action
+ *   requests are answered busy without validation
+ * - Action request start time recording
+ * - Validation and processing
+ * - Per frame class cost and truncated frame accounting
+ *
+ * @param[in] pstReceivedTCPMsg   Pointer to received message
+ * @param[in] u8ConnectionIndex   Connection identifier
+ * @param[in] szReceived          Number of bytes actually received
+ *
+ * @return None
+ */
+static void icm_vHandleReceivedFrame(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex, size_t szReceived)
+{
+    struct timespec stStart = {0};
+    struct timespec stEnd = {0};
+    MessageTypeDictionary_t stActionReqDict = MESSAGE_TYPE_DICTIONARY_INIT;
+    ItcomTransaction_t stTxn;
+    RxFrameClass_t enFrameClass;
+    uint64_t u64LockOps = LOCK_PROFILER_THREAD_LOCK_OPS();
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+    ITCOM_vTxnBegin(&stTxn);
+
+    bool bLongValue = (pstReceivedTCPMsg->u16Length > TLV_VALUE_SIZE) && (pstReceivedTCPMsg->u16Length <= TLV_MAX_VALUE_SIZE);
+    size_t szExpected = sizeof(*pstReceivedTCPMsg) + (bLongValue ? ((size_t)pstReceivedTCPMsg->u16Length - TLV_VALUE_SIZE) : 0U);
+
+    if (szReceived < szExpected)
+    {
+        icm_u32TruncatedFrames++;
+    }
+
+    ITCOM_vGetMsgTypeDictionaryEntryAtIndex(&stActionReqDict, enActionRequest);
+    bool bActionRequest = (pstReceivedTCPMsg->u16Type == (uint16_t)stActionReqDict.u16MessageTypeID);
+
+    /* A long action request without a payload block is shed like an overload */
+    if (bActionRequest && (!icm_bAdmitActionRequest() || (bLongValue && (icm_u16RxPayload == ITCOM_POOL_HANDLE_NONE))))
+    {
+        enFrameClass = enRxFrameShed;
+
+        /* Still counted in the rolling counter sequence, so the next accepted request is not flagged */
+        int16_t s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(pstReceivedTCPMsg->u16Type, pstReceivedTCPMsg->u16ID, (enTCPConnectionsASI)u8ConnectionIndex);
+        if ((s16Indx >= 0) && (icm_s8CRCEval(*pstReceivedTCPMsg, s16Indx) == E_OK))
+        {
+            (void)ITCOM_s8TxnRecordRC(&stTxn, (uint8_t)s16Indx, pstReceivedTCPMsg->u16RollingCounter, ROLLING_COUNT_RX);
+            (void)ITCOM_s8TxnCommit(&stTxn);
+        }
+
+        if (u8ConnectionIndex == enVAMConnectionTCP)
+        {
+            int8_t s8NotificationStatus = ITCOM_s8LogNotificationMessage(pstReceivedTCPMsg->u16ID,
+                                                                         pstReceivedTCPMsg->u16SequenceNumber,
+                                                                         (uint8_t)enBusyRetryLater,
+                                                                         (uint8_t)enActionNotification);
+            if (s8NotificationStatus < QUEUE_ACTION_SUCCESS)
+            {
+                log_message(global_log_file, LOG_ERROR, "Failed to log busy notification for VAM: %d", s8NotificationStatus);
+            }
+        }
+    }
+    else
+    {
+        if (bActionRequest)
+        {
+            (void)ITCOM_s8TxnSetActionRequestStartTime(&stTxn, pstReceivedTCPMsg->u16ID, pstReceivedTCPMsg->u16SequenceNumber);
+        }
+
+        enFrameClass = icm_enProcessReceivedMessage(pstReceivedTCPMsg, u8ConnectionIndex, &stTxn);
+        /* Frames that did not reach icm_s8SaveMsgData still carry the start time */
+        (void)ITCOM_s8TxnCommit(&stTxn);
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stEnd);
+    int64_t s64Cost_ns = ((int64_t)(stEnd.tv_sec - stStart.tv_sec) * ICM_SEC_TO_NSEC) + (int64_t)(stEnd.tv_nsec - stStart.tv_nsec);
+    uint32_t u32Cost_ns = (s64Cost_ns > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)((s64Cost_ns > 0) ? s64Cost_ns : 0);
+
+    RxFrameCost_t *pstCost = &icm_astRxFrameCost[enFrameClass];
+    pstCost->u32FrameCount++;
+    pstCost->u64TotalCost_ns += u32Cost_ns;
+    pstCost->u64LockOps += LOCK_PROFILER_THREAD_LOCK_OPS() - u64LockOps;
+    if (u32Cost_ns > pstCost->u32MaxCost_ns)
+    {
+        pstCost->u32MaxCost_ns = u32Cost_ns;
+    }
+}
+
+/**
+ * @brief Admission control for action requests
+ *
+ * @details
+ * Checked before validation, so a shed frame costs one lock-free read of the
+ * action request queue occupancy and the busy reply. Shedding starts at
+ * ITCOM_ADMISSION_HIGH_WATER and stops once ARA has drained the queue to
+ * ITCOM_ADMISSION_LOW_WATER, so the peer sees a stable busy period instead
+ * of every other request being refused.
+ *
+ * @return bool  true if the action request may enter the validation chain
+ */
+static bool icm_bAdmitActionRequest(void)
+{
+    uint8_t u8Occupancy = ITCOM_u8GetActionReqOccupancy();
+
+    if (icm_bAdmissionShedding && (u8Occupancy <= (uint8_t)ITCOM_ADMISSION_LOW_WATER))
+    {
+        icm_bAdmissionShedding = false;
+        log_message(global_log_file, LOG_INFO, "ICM RX admission: accepting action requests again (%u queued)", u8Occupancy);
+    }
+    else if (!icm_bAdmissionShedding && (u8Occupancy >= (uint8_t)ITCOM_ADMISSION_HIGH_WATER))
+    {
+        icm_bAdmissionShedding = true;
+        log_message(global_log_file, LOG_WARNING, "ICM RX admission: shedding action requests (%u queued)", u8Occupancy);
+    }
+    else
+    {
+        /* Intentionally empty else block */
+    }
+
+    return !icm_bAdmissionShedding;
+}
+
 /**
  * @brief Processes received TCP messages with validation
  *
@@ -1263,19 +2115,29 @@ static float32_t icm_f32FixedPointToFloat(uint16_t u16Fixed, int16_t s16ScaleFac
  *
  * @param[in] pstReceivedTCPMsg   Pointer to received message
  * @param[in] u8ConnectionIndex   Connection identifier
+ * @param[in,out] pstTxn          Transaction for the ITCOM updates of this frame
  *
- * @return None
+ * @return RxFrameClass_t  First check the frame failed, enRxFrameValid if none
  */
-static void icm_vProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex)
+static RxFrameClass_t icm_enProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn)
 {
     int8_t s8Eval = E_OK;
+    RxFrameClass_t enFrameClass = enRxFrameValid;
     int16_t s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(pstReceivedTCPMsg->u16Type, pstReceivedTCPMsg->u16ID, (enTCPConnectionsASI)u8ConnectionIndex);
     int16_t s16TypeIndx = ITCOM_s16GetMessageTypeEnum(pstReceivedTCPMsg->u16Type);
 
     icm_vLogReceivedMessage(pstReceivedTCPMsg, (enTCPConnectionsASI)u8ConnectionIndex);
 
-    s8Eval = (ITCOM_s8ValidateMessageTypeLength(pstReceivedTCPMsg->u16Type, pstReceivedTCPMsg->u16Length) == E_OK) ? s8Eval : E_NOT_OK;
-    s8Eval = (icm_s8CRCEval(*pstReceivedTCPMsg, s16Indx) == E_OK) ? s8Eval : E_NOT_OK;
+    if (ITCOM_s8ValidateMessageTypeLength(pstReceivedTCPMsg->u16Type, pstReceivedTCPMsg->u16Length) != E_OK)
+    {
+        s8Eval = E_NOT_OK;
+        enFrameClass = enRxFrameTypeLengthError;
+    }
+    if (icm_s8CRCEval(*pstReceivedTCPMsg, s16Indx) != E_OK)
+    {
+        s8Eval = E_NOT_OK;
+        enFrameClass = (enFrameClass == enRxFrameValid) ? enRxFrameCrcError : enFrameClass;
+    }
 
     if (s8Eval == E_OK)
     {
@@ -1305,12 +2167,13 @@ static void icm_vProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t
                 break;
             }
             default:
-                icm_vProcessValidMessage(pstReceivedTCPMsg, s16Indx, s16TypeIndx, &stTempMsgConfig, u8ConnectionIndex);
+                enFrameClass = icm_enProcessValidMessage(pstReceivedTCPMsg, s16Indx, s16TypeIndx, &stTempMsgConfig, u8ConnectionIndex, pstTxn);
                 break;
             }
         }
         else
         {
+            enFrameClass = enRxFrameUnknownMessage;
             /* Action Notification message for VAM */
             if (u8ConnectionIndex == enVAMConnectionTCP)
             {
@@ -1342,6 +2205,8 @@ static void icm_vProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t
         }
         log_message(global_log_file, LOG_WARNING, "Message validation failed for Type: %d, ID: %d", pstReceivedTCPMsg->u16Type, pstReceivedTCPMsg->u16ID);
     }
+
+    return enFrameClass;
 }
 
 /**
@@ -1359,14 +2224,23 @@ static void icm_vProcessReceivedMessage(TLVMessage_t *pstReceivedTCPMsg, uint8_t
  * @param[in] s16TypeIndx         Message type index
  * @param[in] pstTempMsgConfig    Message configuration
  * @param[in] u8ConnectionIndex   Connection identifier
+ * @param[in,out] pstTxn          Transaction for the ITCOM updates of this frame
  *
- * @return None
+ * @return RxFrameClass_t  enRxFrameDuplicate for a repeated action request,
+ *                         otherwise the rolling counter evaluation result
+ *                         (enRxFrameValid or enRxFrameSequenceError)
  */
-static void icm_vProcessValidMessage(TLVMessage_t *pstReceivedTCPMsg, int16_t s16Indx, int16_t s16TypeIndx, MsgIntConfig_t *pstTempMsgConfig, uint8_t u8ConnectionIndex)
+static RxFrameClass_t icm_enProcessValidMessage(TLVMessage_t *pstReceivedTCPMsg, int16_t s16Indx, int16_t s16TypeIndx, MsgIntConfig_t *pstTempMsgConfig, uint8_t u8ConnectionIndex, ItcomTransaction_t *pstTxn)
 {
-    icm_vRollingCountEval(*pstReceivedTCPMsg, *pstTempMsgConfig, s16Indx);
-    icm_vCycleCountReset(*pstReceivedTCPMsg, *pstTempMsgConfig, s16Indx, u8ConnectionIndex);
-    icm_vSaveMsgData(pstReceivedTCPMsg, s16Indx, s16TypeIndx);
+    int8_t s8RcEval = icm_s8RollingCountEval(*pstReceivedTCPMsg, *pstTempMsgConfig, s16Indx);
+    icm_vCycleCountReset(*pstReceivedTCPMsg, *pstTempMsgConfig, s16Indx, u8ConnectionIndex, pstTxn);
+    int8_t s8Save = icm_s8SaveMsgData(pstReceivedTCPMsg, s16Indx, s16TypeIndx, u8ConnectionIndex, pstTxn);
+
+    if ((s8Save == ACTION_REQUEST_DUPLICATE_REPLAYED) || (s8Save == ACTION_REQUEST_DUPLICATE_DROPPED))
+    {
+        return enRxFrameDuplicate;
+    }
+    return (s8RcEval == E_OK) ? enRxFrameValid : enRxFrameSequenceError;
 }
 
 /**
@@ -1438,7 +2312,7 @@ static enTCPConnectionsASI icm_enPrepareTransmitMessage(stProcessMsgData *pstMsg
         stTempMsgConfig = icm_stIntConfigTable[s16Indx];
         enConnectionindx = (stDictionaryData.u16MessageType == enNotificationMessage) ? enVAMConnectionTCP : enCMConnectionTCP;
 
-        icm_vPopulateMsgHeader(pstTxMsg, *pstMsgData, stDictionaryData);
+        icm_vPopulateMsgHeader(pstTxMsg, *pstMsgData);
         icm_vPopulateMsgPayload(pstTxMsg, *pstMsgData, stDictionaryData, stTempMsgConfig);
     }
     else
@@ -1451,6 +2325,93 @@ static enTCPConnectionsASI icm_enPrepareTransmitMessage(stProcessMsgData *pstMsg
     return enConnectionindx;
 }
 
+/**
+ * @brief Allocates the rolling counter and ASI sequence number of a message
+ *        about to be sent and computes its CRC
+ *
+ * @details
+ * Called once the connection, its configuration and the rate limiter let the
+ * message go, so a dropped message consumes no number. The CRC covers the
+ * sequence number, ID and value (the whole long value) as received by the
+ * peer, so it is computed after the sequence number is known.
+ *
+ * @param[in,out] pstTxMsg    Frame built by icm_enPrepareTransmitMessage()
+ * @param[in,out] pstMsgData  Message being sent, its sequence number is updated
+ *
+ * @return None
+ */
+static void icm_vAssignTransmitCounters(TLVMessage_t *pstTxMsg, stProcessMsgData *pstMsgData)
+{
+    MessageDictionary_t stDictionaryData = MESSAGE_DICTIONARY_INIT;
+    uint8_t u8SizeCrc = ICM_INIT_VAL_U8;
+    int16_t s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(pstMsgData->u16Type, pstMsgData->stMsgPairData.u16MsgId, enVAMConnectionTCP);
+
+    if (s16Indx != MESSAGE_NOT_FOUND)
+    {
+        ITCOM_vGetMsgDictionaryEntryAtIndex(&stDictionaryData, s16Indx);
+        pstTxMsg->u16RollingCounter = ITCOM_u16AllocTxRollingCounter(stDictionaryData.u8MessageEnum);
+        if (icm_stIntConfigTable[s16Indx].u8SeqNumberAssigner == SEQ_NUM_ASI)
+        {
+            pstTxMsg->u16SequenceNumber = ITCOM_u16AllocSeqNumASI(stDictionaryData.u8MessageEnum);
+            pstMsgData->stMsgPairData.u16SequenceNum = pstTxMsg->u16SequenceNumber;
+        }
+    }
+
+    /*Calculate CRC*/
+    u8SizeCrc = sizeof(pstMsgData->stMsgPairData) + sizeof(pstMsgData->au8MsgData);
+    pstTxMsg->u16CRC = CRC_u16CalculateCrc((uint8_t *)&pstMsgData->stMsgPairData, u8SizeCrc);
+    if (pstMsgData->u16Length > MSG_PAYLOAD_SIZE)
+    {
+        uint8_t *pu8Value = ITCOM_pu8MsgPayload(pstMsgData);
+        if (pu8Value != NULL)
+        {
+            pstTxMsg->u16CRC = CRC_u16UpdateCrc(pstTxMsg->u16CRC, pu8Value + MSG_PAYLOAD_SIZE,
+                                                pstMsgData->u16Length - MSG_PAYLOAD_SIZE);
+        }
+    }
+}
+
+/**
+ * @brief Gives back the numbers of a message whose send failed
+ *
+ * @details
+ * The numbers are handed out again unless another sender allocated after
+ * them in the meantime; then they stay consumed and the peer sees a gap.
+ *
+ * @param[in] pstTxMsg    Frame that was not sent
+ * @param[in] pstMsgData  Message that was not sent
+ *
+ * @return None
+ */
+static void icm_vReleaseTransmitCounters(const TLVMessage_t *pstTxMsg, const stProcessMsgData *pstMsgData)
+{
+    MessageDictionary_t stDictionaryData = MESSAGE_DICTIONARY_INIT;
+    int16_t s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(pstMsgData->u16Type, pstMsgData->stMsgPairData.u16MsgId, enVAMConnectionTCP);
+
+    if (s16Indx != MESSAGE_NOT_FOUND)
+    {
+        ITCOM_vGetMsgDictionaryEntryAtIndex(&stDictionaryData, s16Indx);
+        (void)ITCOM_bReleaseTxRollingCounter(stDictionaryData.u8MessageEnum, pstTxMsg->u16RollingCounter);
+        if (icm_stIntConfigTable[s16Indx].u8SeqNumberAssigner == SEQ_NUM_ASI)
+        {
+            (void)ITCOM_bReleaseSeqNumASI(stDictionaryData.u8MessageEnum, pstTxMsg->u16SequenceNumber);
+        }
+    }
+}
+
+/**
+ * @brief Releases the payload block of the message being sent
+ *
+ * @param[in,out] pstMsgData  Message dequeued by ICM_vTransmitMessage()
+ *
+ * @return None
+ */
+static void icm_vReleaseTxPayload(stProcessMsgData *pstMsgData)
+{
+    icm_bTxInFlight = false;
+    ITCOM_vReleaseMsgPayload(pstMsgData);
+}
+
 /**
  * @brief Tracks sent message information
  *
@@ -1552,32 +2513,3 @@ static void icm_vLogTransmittedMessage(const TLVMessage_t *pstTxMsg, enTCPConnec
                 pstTxMsg->au8Value[ICM_MSG_BYTE_2], pstTxMsg->au8Value[ICM_MSG_BYTE_3], pstTxMsg->au8Value[ICM_MSG_BYTE_4],
                 pstTxMsg->au8Value[ICM_MSG_BYTE_5], pstTxMsg->au8Value[ICM_MSG_BYTE_6], pstTxMsg->au8Value[ICM_MSG_BYTE_7]);
 }
-
-/**
- * @brief Updates transmission counter values
- *
- * @details
- * This internal function manages transmission counters.
- * The function handles:
- * - Rolling counter updates
- * - Sequence number management
- * - Counter overflow handling
- *
- * @param[in,out] pstTxMsg      Pointer to transmission message
- * @param[in]     enConnection  Connection type
- *
- * @return None
- */
-static void icm_vUpdateTransmissionCounters(TLVMessage_t *pstTxMsg, enTCPConnectionsASI enConnection)
-{
-    int16_t s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(pstTxMsg->u16Type, pstTxMsg->u16ID, enConnection);
-    MsgIntConfig_t stTempMsgConfig = icm_stIntConfigTable[s16Indx];
-
-    pstTxMsg->u16RollingCounter = (pstTxMsg->u16RollingCounter + 1) % UINT16_MAX_VALUE;
-    ITCOM_vRecordRC(s16Indx, pstTxMsg->u16RollingCounter, ROLLING_COUNT_TX);
-    if (stTempMsgConfig.u8SeqNumberAssigner == SEQ_NUM_ASI)
-    {
-        pstTxMsg->u16SequenceNumber = (pstTxMsg->u16SequenceNumber + 1) % UINT16_MAX_VALUE;
-        ITCOM_vSetSeqNumASIRecord(pstTxMsg->u16SequenceNumber, s16Indx);
-    }
-}
@@ -46,6 +46,17 @@
  * 10/03/2024 | AT     | Thread crashing handling update
  * 11/15/2024 | TP     | MISRA & LHP compliance fixes
  * 11/22/2024 | TP     | Cleaning up the code
+ * 10/18/2026 | TP     | Rate limiter start time taken from the UT time source
+ * 10/18/2026 | TP     | Per frame class RX cost accounting, RX injection entry
+ * 10/18/2026 | TP     | Lock operations counted per frame class
+ * 10/18/2026 | TP     | Per TX class queueing delay report
+ * 10/18/2026 | TP     | Duplicate action request frame class
+ * 10/18/2026 | TP     | Busy notification code and shed frame class
+ * 10/18/2026 | TP     | Variable-length values up to TLV_MAX_VALUE_SIZE
+ * 10/18/2026 | TP     | ICM_RX reset hook
+ * 10/18/2026 | TP     | ICM_bTxPending
+ * 10/18/2026 | TP     | ICM_TX reset hook
+ * 10/18/2026 | TP     | RX injection socket of the running application
  */
 
 #ifndef ICM_H
@@ -78,6 +89,12 @@
 #define NUM_TRACKED_ELEMENTS                 (40)
 #define MSG_PAYLOAD_SIZE                     (8U)
 #define TLV_VALUE_SIZE                       (8U)
+#ifndef TLV_MAX_VALUE_SIZE
+#define TLV_MAX_VALUE_SIZE                   (256U)  /* Longest value; longer than TLV_VALUE_SIZE is held in the payload pool */
+#endif
+#define TLV_HEADER_SIZE                      (sizeof(TLVMessage_t) - TLV_VALUE_SIZE)
+/* Value bytes on the wire: short values are padded to TLV_VALUE_SIZE, long ones are sent as is */
+#define TLV_WIRE_VALUE_SIZE(length)          (((length) > TLV_VALUE_SIZE) ? (length) : TLV_VALUE_SIZE)
 
 /* Timeout and Limit Values */
 #define TIMEOUT_NA                           (0)
@@ -87,6 +104,11 @@
 #define ROLLINC_COUNTER_ERROR_LIMIT          (3)
 #define NO_MSG_ID_ASSIGN                     (0xFFFFU)
 
+#ifdef ICM_RX_INJECTION
+/* Datagram socket of ICM_RX: one datagram = connection index byte + frame as sent on that connection */
+#define ICM_RX_INJECTION_SOCKET              "ASI_DATA/rx_inject.sock"
+#endif
+
 /* Generic Initialization Values */
 #define ICM_INIT_VAL_U8                      (0U)
 #define ICM_INIT_VAL_U16                     (0U)
@@ -126,7 +148,7 @@
     ICM_ALLOWED_MSGS_INIT,                    /* u16AllowedMessages */                       \
     ICM_TIME_WINDOW_INIT,                     /* u16TimeWindowMs */                          \
     ICM_MSG_COUNT_INIT,                       /* u16MessageCount */                          \
-    ICM_START_TIME_INIT                       /* stStartTime */                              \
+    ICM_START_TIME_INIT                       /* u32StartTime_ms */                          \
 }
 
 /**
@@ -247,6 +269,7 @@ typedef enum
     enRateLimiterDrop,
     enTimeoutLimit,
     enTransmissionFailed,
+    enBusyRetryLater,             /* Not accepted, retry after the hint in the notification */
     enTotalNotificationActions
 } enNotificationActions;
 
@@ -299,7 +322,8 @@ typedef struct
     uint16_t u16Type;
     uint16_t u16Length;
     stIdSequencePair stMsgPairData;
-    uint8_t au8MsgData[MSG_PAYLOAD_SIZE];
+    uint8_t au8MsgData[MSG_PAYLOAD_SIZE];     /* First MSG_PAYLOAD_SIZE bytes of the value */
+    uint16_t u16PayloadHandle;                /* Payload pool block with the whole value if u16Length > MSG_PAYLOAD_SIZE */
 } stProcessMsgData;
 
 typedef struct
@@ -319,14 +343,49 @@ typedef struct
     uint16_t u16AllowedMessages;
     uint16_t u16TimeWindowMs;
     uint16_t u16MessageCount;
-    clock_t stStartTime;
+    uint32_t u32StartTime_ms;
 } RateLimiter_t;
 
+/**
+ * @brief Outcome of the receive path validation chain for one frame
+ */
+typedef enum
+{
+    enRxFrameValid = 0,           /* Passed all checks */
+    enRxFrameTypeLengthError,     /* Unknown type or length (covers oversized frames) */
+    enRxFrameCrcError,            /* CRC mismatch */
+    enRxFrameSequenceError,       /* Rolling counter out of sequence */
+    enRxFrameUnknownMessage,      /* Valid frame, Type/ID not in dictionary */
+    enRxFrameDuplicate,           /* Action request repeated within ITCOM_RECENT_REQ_AGE_MS */
+    enRxFrameShed,                /* Action request refused by admission control, not validated */
+    enTotalRxFrameClasses
+} RxFrameClass_t;
+
+/**
+ * @brief CPU cost of the receive path for one frame class
+ */
+typedef struct
+{
+    uint32_t u32FrameCount;       /* Frames seen in this class */
+    uint32_t u32MaxCost_ns;       /* Most expensive single frame */
+    uint64_t u64TotalCost_ns;     /* Accumulated processing time */
+    uint64_t u64LockOps;          /* ITCOM lock acquisitions (LOCK_PROFILING builds only) */
+} RxFrameCost_t;
+
 /*** Functions Provided to other modules ***/
 extern void ICM_vInit(void);
 extern void ICM_vCycleCountUpdater(void);
 extern void ICM_vReceiveMessage(void);
 extern void ICM_vTransmitMessage(void);
+extern bool ICM_bTxPending(void);
+extern void ICM_vGetRxFrameCost(RxFrameCost_t *pastFrameCost, uint32_t *pu32TruncatedFrames);
+extern void ICM_vReportRxFrameCost(FILE *pLogFile);
+extern void ICM_vReportTxClassDelay(FILE *pLogFile);
+extern void ICM_vResetRxAfterFault(void);
+extern void ICM_vResetTxAfterFault(void);
+#ifdef ICM_RX_INJECTION
+extern void ICM_vInjectReceivedFrame(const uint8_t *pu8Frame, size_t szFrameLength, uint8_t u8ConnectionIndex);
+#endif
 
 /*** Variables Provided to other modules ***/
 
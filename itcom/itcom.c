@@ -15,6 +15,39 @@
 * ----------|---|-----------
 * 08/08/2024|AT |Initial
 * 10/03/2024|TP |Refactored for Action Request Timeout
+* 10/18/2026|TP |ITCOM mutexes taken through the lock profiler wrapper
+* 10/18/2026|TP |SLO metrics: approval latency, queue overflows, restart time
+* 10/18/2026|TP |Action request timeout measured with the UT time source
+* 10/18/2026|TP |Writes noted for the false sharing check, layout summary at init
+* 10/18/2026|TP |ICM_RX error counters and ICM_TX rate limiter accessed lock-free by their owner
+* 10/18/2026|TP |Transaction API sharing the locked helpers of the single updates
+* 10/18/2026|TP |Lock-free per-connection receive rings with occupancy and overflow counters
+* 10/18/2026|TP |Outgoing sequence numbers and TX rolling counters allocated with one atomic fetch-add
+* 10/18/2026|TP |Type/length validation through a per-type length bitmap built from the dictionary
+* 10/18/2026|TP |TX scheduler: safe-state priority, weighted approvals/notifications, deadlines
+* 10/18/2026|TP |Duplicate action requests answered from the recent request set at commit
+* 10/18/2026|TP |ASI notifications carry queue occupancy and a retry-after hint, busy reply when not queued
+* 10/18/2026|TP |Lock-free message pool; action requests staged into pool blocks and queued by handle
+* 10/18/2026|TP |Payload pool for values above TLV_VALUE_SIZE, receive ring slots carry a payload handle
+* 10/18/2026|TP |Thread wrappers wait for their release through wait_for_thread_release
+* 10/18/2026|TP |Thread tuning block: request, validated publication, per-thread copy
+* 10/18/2026|TP |Lock-free pending work checks for the idle fast path
+* 10/18/2026|TP |Frame wrapper of the optional cyclic executive
+* 10/18/2026|TP |Thread stack usage published lock-free by the child
+* 10/18/2026|TP |Shared memory mapping sized by the region layout descriptor
+* 10/18/2026|TP |Pool free lists rebuilt from the surviving queues at soft restart
+* 10/18/2026|TP |Recent requests aged from first arrival and released on every terminal path
+* 10/18/2026|TP |Receive ring overflow counted by the reader only when data is left unread
+* 10/18/2026|TP |Unsent sequence numbers and TX rolling counters released, safe state message peeks its number
+* 10/18/2026|TP |Simulated time check of the action request timeout (ITCOM_TIME_CHECK_MAIN)
+* 10/18/2026|TP |ITCOM mutexes taken through the lock_owner wrapper
+* 10/18/2026|TP |SLO metrics read by the parent without the child's common mutex
+* 10/18/2026|TP |Thread tuning requested and read by the parent through sequence counters, no mutex
+* 10/18/2026|TP |Recent request set sized for the request rate over the aging window
+* 10/18/2026|TP |Message copy counting for the copy benchmark (ITCOM_COPY_COUNTING)
+* 10/18/2026|TP |Time check main moved to test/itcom_time_check.c
+* 10/18/2026|TP |Alloc check main moved to test/itcom_alloc_check.c
+* 10/18/2026|TP |Cyclic frame steps moved to thread_management.c
 *
 */
 //*****************************************************************************
@@ -24,6 +57,8 @@
 #include "process_management.h"
 #include "thread_management.h"
 #include "storage_handler.h"
+#include "lock_owner.h"
+#include "false_sharing.h"
 
 #include "itcom.h"
 
@@ -47,9 +82,33 @@
 #define ELEMENT_NOT_FOUND_IN_CIR_BUFFER       (-1)
 #define QUEUE_INDEX_INVALID                   (-1)
 
+#define ITCOM_TYPE_INDEX_SIZE                 (16U)       /**< Slots of the type/length index, power of two */
+#define ITCOM_TYPE_INDEX_HASH(u16Type)        ((uint32_t)((u16Type) ^ ((u16Type) >> 8)) & (ITCOM_TYPE_INDEX_SIZE - 1U))
+#define ITCOM_NOTIFY_LENGTH_INDEX             (1U)        /**< ASI sends notifications with the overload fields */
+#define ITCOM_PERCENT                         (100U)
+#define ITCOM_POOL_TAG_SHIFT                  (16U)       /**< Free list head: ABA tag above the handle */
+#define ITCOM_POOL_HANDLE_MASK                (0xFFFFU)
+#define ITCOM_RECENT_REQ_HASH_MULT            (2654435761U)  /**< Knuth multiplicative hash constant */
+#define ITCOM_RECENT_REQ_HASH(u8Conn, u16Id, u16Seq) \
+    ((((((uint32_t)(u16Id) << 16) | (uint32_t)(u16Seq)) ^ ((uint32_t)(u8Conn) << 13)) * ITCOM_RECENT_REQ_HASH_MULT) >> 16)
+#define ITCOM_RECENT_REQ_ANY_CONNECTION       ((uint8_t)enTotalTCPConnections)  /**< Request received on whichever connection holds it */
+#define ITCOM_TUNING_SEQ_RETRIES              (8U)        /**< Lock-free copies of the active tuning tried by the parent */
+#define ITCOM_BITMAP_WORD_BITS                (32U)
+#define ITCOM_LENGTH_BITMAP_BITS              (256U)      /**< One bit per possible uint8_t length */
 
-/*** Internal Types ***/
 
+/*** Internal Types ***/
+/**
+ * @brief Slot of the type/length index: the legal lengths of one message
+ *        type as a bitmap, bit n set if length n is legal, and the range of
+ *        long lengths (above TLV_VALUE_SIZE) held in the payload pool.
+ */
+typedef struct {
+    uint16_t u16MessageTypeID;
+    uint8_t u8Used;
+    uint16_t u16MaxLength;
+    uint32_t au32LengthBitmap[ITCOM_LENGTH_BITMAP_BITS / ITCOM_BITMAP_WORD_BITS];
+} ItcomTypeLengthEntry_t;
 
 /*** Local Function Prototypes ***/
 static uint8_t itcom_u8CompareMsgIdAndSequence(const_generic_ptr_t a, const_generic_ptr_t b);
@@ -57,6 +116,41 @@ static uint8_t itcom_u8CompareCalibData(const_generic_ptr_t a, const_generic_ptr
 static void itcom_vRemoveActionRequestTiming(uint16_t u16MsgId, uint16_t u16SequenceNum);
 static void ITCOM_vInit(void);
 static struct timespec* ITCOM_pstGetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum);
+static void itcom_vRecordApprovalLatency(int64_t s64Latency_ms);
+static void itcom_vCountQueueOverflow(uint8_t u8SelectQueue, int8_t s8EnqueueStatus);
+static data_queue_t* itcom_pstTxQueue(uint8_t u8Class);
+static int8_t itcom_s8EnqueueTxLocked(uint8_t u8Class, const stProcessMsgData* pstMsgData);
+static int8_t itcom_s8DequeueTxClassLocked(uint8_t u8Class, stProcessMsgData* pstMsgData, uint32_t u32Now_ms);
+static void itcom_vRecordRCLocked(uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction);
+static void itcom_vSetMsgCycleCountLocked(const stMsgIntegrityData* pstTempMsgTracker, uint8_t u8Action);
+static int8_t itcom_s8SaveMsgDataLocked(uint16_t u16Handle, int16_t s16Indx);
+static uint8_t itcom_u8StoreActionRequestTimingLocked(const ActionRequestTiming_t* pstTiming);
+static ItcomTxnOp_t* itcom_pstTxnStage(ItcomTransaction_t* pstTxn, ItcomTxnOpType_t enType, int8_t* ps8Op);
+static uint16_t itcom_u16AllocWrapped(uint16_t* pu16Counter);
+static uint16_t itcom_u16PeekWrapped(const uint16_t* pu16Counter);
+static bool itcom_bReleaseWrapped(uint16_t* pu16Counter, uint16_t u16Value);
+static void itcom_vBuildTypeLengthIndex(void);
+static const ItcomTypeLengthEntry_t* itcom_pstFindTypeLength(uint16_t u16MsgType);
+static RecentRequestEntry_t* itcom_pstFindRecentRequestLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint32_t u32Now_ms);
+static int8_t itcom_s8AdmitActionRequestLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum);
+static void itcom_vRecordRecentDecisionLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Decision);
+static int8_t itcom_s8LogActionNotificationLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Data);
+static void itcom_vInitNotificationLocked(stProcessMsgData* pstMsgData, uint8_t u8Data);
+static void itcom_vPoolInit(void);
+static void itcom_vFreeListInit(PoolFreeList_t* pstList, uint16_t* pu16Next, uint16_t u16Blocks);
+static void itcom_vPoolRebuild(void);
+static void itcom_vMarkTxQueuePayloads(const data_queue_t* pstQueue, uint8_t* pu8PayloadUsed);
+static void itcom_vFreeListRebuild(PoolFreeList_t* pstList, uint16_t* pu16Next, const uint8_t* pu8Used, uint16_t u16Blocks);
+static uint16_t itcom_u16FreeListPop(PoolFreeList_t* pstList, uint16_t* pu16Next);
+static void itcom_vFreeListPush(PoolFreeList_t* pstList, uint16_t* pu16Next, uint16_t u16Handle);
+static void itcom_vCopyPoolStats(const MsgPoolStats_t* pstPoolStats, MsgPoolStats_t* pstStats);
+static void itcom_vClearActionReqQueueLocked(void);
+static void itcom_vBuildRegionLayout(FILE* itcom_log_file);
+static DataOnSharedMemory* itcom_pstMapSharedMemory(FILE* itcom_log_file);
+static void itcom_vBindRegions(uint32_t u32ResetMask);
+static uint32_t itcom_u32SeqWriteBegin(uint32_t* pu32Seq);
+static void itcom_vSeqWriteEnd(uint32_t* pu32Seq, uint32_t u32Seq);
+static bool itcom_bSeqReadValid(const uint32_t* pu32Seq, uint32_t u32Seq);
 
 /*** External Variables ***/
 
@@ -65,6 +159,8 @@ static struct timespec* ITCOM_pstGetActionRequestStartTime(uint16_t u16MsgId, ui
 /*** Internal Variables ***/
 
 static DataOnSharedMemory* pstSharedMemData;
+/* Layout of the mapping, process-local copy of pstSharedMemData->stRegionLayout inherited through fork() */
+static ItcomRegionLayout_t itcom_stRegionLayout;
 
 /*_______________________SHARED MEMORY VARIABLES_______________________*/
 
@@ -98,14 +194,32 @@ static MessageDictionary_t stMsgDictionary[] = {
 
 
 static MessageTypeDictionary_t stMsgTypeDictionary[] = {
-    /*MessageTypeID        MessageTypeEnum             AssociatedLength */
-        {0xFF11U,      (uint8_t)enActionRequest,        {0x02, 0x04, 0x08}},
-        {0xFF22U,      (uint8_t)enStatusMessageCM,      {0x02, 0x04}      },
-        {0xFF33U,      (uint8_t)enAckMessage,           {0x01}            },
-        {0xFF44U,      (uint8_t)enNotificationMessage,  {0x01}            },
-        {0xFF55U,      (uint8_t)enCalibReadbackMessage, {0x02, 0x04, 0x08}}
+    /*MessageTypeID        MessageTypeEnum             AssociatedLength    MaxLength */
+        {0xFF11U,      (uint8_t)enActionRequest,        {0x02, 0x04, 0x08}, TLV_MAX_VALUE_SIZE},
+        {0xFF22U,      (uint8_t)enStatusMessageCM,      {0x02, 0x04},       0U                },
+        {0xFF33U,      (uint8_t)enAckMessage,           {0x01},             0U                },
+        {0xFF44U,      (uint8_t)enNotificationMessage,  {0x01, 0x04},       0U                },
+        {0xFF55U,      (uint8_t)enCalibReadbackMessage, {0x02, 0x04, 0x08}, 0U                }
 };
 
+_Static_assert((sizeof(stMsgTypeDictionary) / sizeof(stMsgTypeDictionary[0])) <= (ITCOM_TYPE_INDEX_SIZE / 2U),
+               "ITCOM_TYPE_INDEX_SIZE must be at least twice the number of message types");
+_Static_assert((TLV_MAX_VALUE_SIZE >= TLV_VALUE_SIZE) && (TLV_MAX_VALUE_SIZE <= (UINT16_MAX - sizeof(TLVMessage_t))),
+               "TLV_MAX_VALUE_SIZE must fit a frame length in uint16_t");
+_Static_assert((ITCOM_MSG_POOL_BLOCKS > MSG_QUEUE_BUFFER_SIZE) && (ITCOM_MSG_POOL_BLOCKS < ITCOM_POOL_HANDLE_NONE),
+               "ITCOM_MSG_POOL_BLOCKS must cover a full action request queue plus the blocks in flight");
+_Static_assert(((ITCOM_RECENT_REQ_SLOTS & (ITCOM_RECENT_REQ_SLOTS - 1U)) == 0U) && (ITCOM_RECENT_REQ_SLOTS >= (2U * ITCOM_RECENT_REQ_LIVE)),
+               "ITCOM_RECENT_REQ_SLOTS must be a power of two holding the requests of one aging window at half load");
+
+/* Built from stMsgTypeDictionary by itcom_vBuildTypeLengthIndex, read-only afterwards */
+static ItcomTypeLengthEntry_t itcom_astTypeLengthIndex[ITCOM_TYPE_INDEX_SIZE];
+
+#ifdef ITCOM_COPY_COUNTING
+/* Copies noted with ITCOM_NOTE_MSG_COPY in this process */
+static uint32_t itcom_u32MsgCopies = ITCOM_ZERO_INIT_U;
+static uint64_t itcom_u64MsgCopyBytes = ITCOM_ZERO_INIT_U;
+#endif
+
 /*** External Functions ***/
 
 /**
@@ -124,9 +238,13 @@ void ITCOM_vSharedMemoryInit(FILE* itcom_log_file, enRestartReason restart_reaso
     error_string_t error_str = NULL;
     uint8_t operation_status = ITCOM_OP_SUCCESS;
 
+    /* Process-local lookup tables, inherited by the child through fork() */
+    itcom_vBuildTypeLengthIndex();
+
     /* Allocate shared memory for inter-process communication */
     if (restart_reason == (enRestartReason)enHardRestart) {
-        pstSharedMemData = (DataOnSharedMemory*)mmap(NULL, SHARED_BUFFER_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        itcom_vBuildRegionLayout(itcom_log_file);
+        pstSharedMemData = itcom_pstMapSharedMemory(itcom_log_file);
         if (pstSharedMemData == MAP_FAILED) {
             error_str = strerror(errno);
             if (error_str != NULL) {
@@ -134,16 +252,29 @@ void ITCOM_vSharedMemoryInit(FILE* itcom_log_file, enRestartReason restart_reaso
             }
             operation_status = ITCOM_OP_FAILURE;
         } else {
+            FALSE_SHARING_REGISTER(pstSharedMemData, itcom_stRegionLayout.u32DataSize);
             ITCOM_vInit();
             log_message(itcom_log_file, LOG_INFO, "Shared data initialized with default values");
+            ITCOM_vLogSharedMemoryUsage(itcom_log_file, &itcom_stRegionLayout);
         }
     } else if (restart_reason == (enRestartReason)enSoftRestart) {
-        /* Load data from existing storage */
-        if (compare_and_load_storage(pstSharedMemData) == -1) {
+        uint32_t u32ResetRegions = ITCOM_ZERO_INIT_U;
+        uint8_t u8Region;
+
+        /* Load data from existing storage, regions stored with another capacity are reset */
+        if (compare_and_load_storage(pstSharedMemData, &u32ResetRegions) == -1) {
             log_message(itcom_log_file, LOG_ERROR, "Failed to compare and load storage data");
             operation_status = ITCOM_OP_FAILURE;
         } else {
+            itcom_vBindRegions(u32ResetRegions);
+            itcom_vPoolRebuild();
             log_message(itcom_log_file, LOG_INFO, "Storage data loaded successfully");
+            for (u8Region = ITCOM_ZERO_INIT_U; u8Region < (uint8_t)enTotalRegions; u8Region++) {
+                if ((u32ResetRegions & ITCOM_REGION_BIT(u8Region)) != ITCOM_ZERO_INIT_U) {
+                    log_message(itcom_log_file, LOG_WARNING, "Region %s stored with another layout, reset",
+                                ITCOM_pcRegionName(u8Region));
+                }
+            }
         }
     } else {
         /* Intentionally empty else block */
@@ -172,7 +303,7 @@ void ITCOM_vCleanResources(void) {
     // Clean up resources
     destroy_mutexes_and_sems(pstSharedMemData);
     destroy_timers();
-    if (munmap(pstSharedMemData, SHARED_BUFFER_SIZE) == -1) {
+    if (munmap(pstSharedMemData, itcom_stRegionLayout.u32MappingSize) == -1) {
         error_string_t error_str = strerror(errno);
         if (error_str != NULL) {
             log_message(global_log_file, LOG_ERROR, "munmap failed: %s", error_str);
@@ -187,16 +318,16 @@ void ITCOM_vWrapperThread_CCU(void) {
     log_message(global_log_file, LOG_INFO, "THRD_CCU: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_CCU.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_CCU.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_CCU: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_CCU: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_CCU: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_CCU: release wait failed: Unknown error");
             }
             break;
         }
@@ -212,16 +343,16 @@ void ITCOM_vWrapperThread_STM(void) {
     log_message(global_log_file, LOG_INFO, "THRD_STM: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_STM.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_STM.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_STM: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_STM: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_STM: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_STM: release wait failed: Unknown error");
             }
             break;
         }
@@ -237,16 +368,16 @@ void ITCOM_vWrapperThread_ICM_RX(void) {
     log_message(global_log_file, LOG_INFO, "THRD_ICM_RX: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_ICM_RX.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_ICM_RX.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_ICM_RX: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_ICM_RX: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_ICM_RX: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_ICM_RX: release wait failed: Unknown error");
             }
             break;
         }
@@ -262,21 +393,24 @@ void ITCOM_vWrapperThread_ARA(void) {
     log_message(global_log_file, LOG_INFO, "THRD_ARA: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_ARA.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_ARA.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_ARA: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_ARA: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_ARA: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_ARA: release wait failed: Unknown error");
             }
             break;
         }
         ARA_vVehicleStatusMonitor();
-        ARA_vActionRequestMonitor();
+        /* Idle fast path: nothing queued, skip the request monitor */
+        if (ARA_bActionRequestPending()) {
+            ARA_vActionRequestMonitor();
+        }
     }
     log_message(global_log_file, LOG_INFO, "THRD_ARA: Exiting thread");
 }
@@ -288,20 +422,22 @@ void ITCOM_vWrapperThread_ICM_TX(void) {
     log_message(global_log_file, LOG_INFO, "THRD_ICM_TX: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_ICM_TX.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_ICM_TX.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_ICM_TX: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_ICM_TX: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_ICM_TX: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_ICM_TX: release wait failed: Unknown error");
             }
             break;
         }
-        ICM_vTransmitMessage();
+        if (ICM_bTxPending()) {
+            ICM_vTransmitMessage();
+        }
     }
     log_message(global_log_file, LOG_INFO, "THRD_ICM_TX: Exiting thread");
 }
@@ -313,20 +449,22 @@ void ITCOM_vWrapperThread_FM(void) {
     log_message(global_log_file, LOG_INFO, "THRD_FM: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_FM.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_FM.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_FM: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_FM: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_FM: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_FM: release wait failed: Unknown error");
             }
             break;
         }
-        FM_vMainFunction();
+        if (FM_bHasWork()) {
+            FM_vMainFunction();
+        }
     }
     log_message(global_log_file, LOG_INFO, "THRD_FM: Exiting thread");
 }
@@ -343,7 +481,7 @@ void ITCOM_vWrapperThread_SD(void) {
         if (get_thread_exit() || sd_shutdown_initiated) {
             exit_loop = true;
         } else {
-            sem_status = sem_wait(&pstSharedMemData->stThread_SD.sem);
+            sem_status = wait_for_thread_release(&pstSharedMemData->stThread_SD.sem);
             if (sem_status == -1) {
                 if (errno == EINTR) {
                     /* Continue waiting if interrupted */
@@ -352,9 +490,9 @@ void ITCOM_vWrapperThread_SD(void) {
                 /* Handle semaphore error */
                 error_str = strerror(errno);
                 if (error_str != NULL) {
-                    log_message(global_log_file, LOG_ERROR, "THRD_SD: sem_wait failed: %s", error_str);
+                    log_message(global_log_file, LOG_ERROR, "THRD_SD: release wait failed: %s", error_str);
                 } else {
-                    log_message(global_log_file, LOG_ERROR, "THRD_SD: sem_wait failed with unknown error");
+                    log_message(global_log_file, LOG_ERROR, "THRD_SD: release wait failed with unknown error");
                 }
                 exit_loop = true;
             } else if (!sd_shutdown_initiated) {
@@ -377,24 +515,53 @@ void ITCOM_vWrapperThread_CRV(void) {
     log_message(global_log_file, LOG_INFO, "THRD_CRV: Entering thread");
 
     while (!get_thread_exit()) {
-        sem_status = sem_wait(&pstSharedMemData->stThread_CRV.sem);
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_CRV.sem);
         if (sem_status == -1) {
             if (errno == EINTR) {
                 continue;
             }
             error_str = strerror(errno);
             if (error_str != NULL) {
-                log_message(global_log_file, LOG_ERROR, "THRD_CRV: sem_wait failed: %s", error_str);
+                log_message(global_log_file, LOG_ERROR, "THRD_CRV: release wait failed: %s", error_str);
             } else {
-                log_message(global_log_file, LOG_ERROR, "THRD_CRV: sem_wait failed: Unknown error");
+                log_message(global_log_file, LOG_ERROR, "THRD_CRV: release wait failed: Unknown error");
             }
             break;
         }
-        CRV_vMainFunction();
+        if (CRV_bHasWork()) {
+            CRV_vMainFunction();
+        }
     }
     log_message(global_log_file, LOG_INFO, "THRD_CRV: Exiting thread");
 }
 
+#ifdef THRD_CYCLIC_EXECUTIVE
+void ITCOM_vWrapperFrame_50ms(void) {
+    int32_t sem_status;
+    error_string_t error_str = NULL;
+
+    log_message(global_log_file, LOG_INFO, "THRD_FRAME: Entering thread");
+
+    while (!get_thread_exit()) {
+        sem_status = wait_for_thread_release(&pstSharedMemData->stThread_ICM_RX.sem);
+        if (sem_status == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            error_str = strerror(errno);
+            if (error_str != NULL) {
+                log_message(global_log_file, LOG_ERROR, "THRD_FRAME: release wait failed: %s", error_str);
+            } else {
+                log_message(global_log_file, LOG_ERROR, "THRD_FRAME: release wait failed: Unknown error");
+            }
+            break;
+        }
+        run_cyclic_frame();
+    }
+    log_message(global_log_file, LOG_INFO, "THRD_FRAME: Exiting thread");
+}
+#endif
+
 void ITCOM_vChildProcessWrapper(FILE* itcom_log_file, enRestartReason start_reason) {
 	child_process(pstSharedMemData, itcom_log_file, start_reason);
 }
@@ -432,38 +599,16 @@ static void ITCOM_vInit(void) {
     generic_ptr_t memory_operation_result = NULL;
     uint8_t initialization_complete = ITCOM_OP_FAILURE;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Init all zeros with result checking */
-        memory_operation_result = memset(pstSharedMemData, 0, sizeof(DataOnSharedMemory));
+        memory_operation_result = memset(pstSharedMemData, 0, itcom_stRegionLayout.u32DataSize);
         if ((memory_operation_result != NULL) && (memory_operation_result == pstSharedMemData)) {
-            // Sequence Number Record
-            InstanceManager_vInitialize(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, 
-                                     sizeof(stMsgIntegrityData), NUM_TRACKED_ELEMENTS);
-            // Calibration Data Copy
-            InstanceManager_vInitialize(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, 
-                                     sizeof(stProcessMsgData), NUM_TRACKED_ELEMENTS);
-            // Calibration Readback Data
-            InstanceManager_vInitialize(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, 
-                                     sizeof(stProcessMsgData), NUM_TRACKED_ELEMENTS);
-            // Data Integrity Queue
-            DataQueue_vInit(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, 
-                          (uint8_t*)pstSharedMemData->stThreadsCommonData.astDataIntegrityMsgBuffer,
-                          (sizeof(pstSharedMemData->stThreadsCommonData.astSSMsgBuffer) / 
-                           sizeof(pstSharedMemData->stThreadsCommonData.astSSMsgBuffer[0])),
-                          (uint16_t)sizeof(stProcessMsgData), CIRCULAR_BUFF_INACTIVE);
-            // Approved Actions Queue
-            DataQueue_vInit(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, 
-                          (uint8_t*)pstSharedMemData->stThreadsCommonData.astApprovedMsgBuffer,
-                          (sizeof(pstSharedMemData->stThreadsCommonData.astApprovedMsgBuffer) / 
-                           sizeof(pstSharedMemData->stThreadsCommonData.astApprovedMsgBuffer[0])),
-                          (uint16_t)sizeof(stProcessMsgData), CIRCULAR_BUFF_INACTIVE);
-            // Safe State Queue
-            DataQueue_vInit(&pstSharedMemData->stThreadsCommonData.stMsgQueueSS, 
-                          (uint8_t*)pstSharedMemData->stThreadsCommonData.astSSMsgBuffer,
-                          (sizeof(pstSharedMemData->stThreadsCommonData.astSSMsgBuffer) / 
-                           sizeof(pstSharedMemData->stThreadsCommonData.astSSMsgBuffer[0])),
-                          (uint16_t)sizeof(stProcessMsgData), CIRCULAR_BUFF_INACTIVE);
+            // Region Layout Descriptor, then the tracking buffers, queues, event store and SLO metrics it places
+            pstSharedMemData->stRegionLayout = itcom_stRegionLayout;
+            itcom_vBindRegions(ITCOM_REGION_ALL);
+            // Message Pool
+            itcom_vPoolInit();
             
             ///State Machine Initialization
             pstSharedMemData->stThreadsCommonData.u8ASI_State = (uint8_t)STATE_INITIAL;
@@ -495,7 +640,7 @@ static void ITCOM_vInit(void) {
         }
 
         /* Always unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vInit failed to unlock mutex: error %d", mutex_unlock_status);
             initialization_complete = ITCOM_OP_FAILURE;
@@ -527,13 +672,14 @@ void ITCOM_vSetASIState(uint8_t u8Value) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Set the ASI state value */
         pstSharedMemData->stThreadsCommonData.u8ASI_State = u8Value;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8ASI_State);
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vSetASIState failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -560,13 +706,13 @@ uint8_t ITCOM_u8GetASIState(void) {
     mutex_status_t mutex_unlock_status;
     uint8_t u8Status = ITCOM_ZERO_INIT_U;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Get the ASI state value */
         u8Status = pstSharedMemData->stThreadsCommonData.u8ASI_State;
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetASIState failed to unlock mutex: error %d", mutex_unlock_status);
             u8Status = ITCOM_ZERO_INIT_U;
@@ -633,7 +779,7 @@ enSetErrorEventStatus ITCOM_s16SetErrorEvent(uint8_t u8EventId)
     }
 
     /* Attempt to lock mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status != E_OK)
     {
         log_message(global_log_file, LOG_ERROR, "ITCOM_s16SetErrorEvent failed to lock mutex: error %d", mutex_lock_status);
@@ -641,16 +787,21 @@ enSetErrorEventStatus ITCOM_s16SetErrorEvent(uint8_t u8EventId)
     }
 
     /* Process the event */
-    if (pstSharedMemData->stThreadsCommonData.Event_Queue_Index < (int32_t)DATA_QUEUE_MAX_SIZE)
+    if (pstSharedMemData->stThreadsCommonData.Event_Queue_Index < (int32_t)itcom_stRegionLayout.astRegions[enRegionEventStore].u32Capacity)
     {
         /* Update snapshot data and add event to queue */
         pstSharedMemData->stThreadsCommonData.SystemSnapshotData.ASI_State = pstSharedMemData->stThreadsCommonData.u8ASI_State;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.ASI_State);
         pstSharedMemData->stThreadsCommonData.SystemSnapshotData.GearShiftPosition = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.GearShiftPosition);
         pstSharedMemData->stThreadsCommonData.SystemSnapshotData.VehicleSpeed = pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.VehicleSpeed);
 
         const int32_t current_index = pstSharedMemData->stThreadsCommonData.Event_Queue_Index;
         pstSharedMemData->stThreadsCommonData.Event_Queue[current_index] = u8EventId;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue[current_index]);
         pstSharedMemData->stThreadsCommonData.Event_Queue_Index++;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue_Index);
 
         log_message(global_log_file, LOG_INFO, "Thread %s added Event ID %d to the Event_Queue", thread_name, u8EventId);
         result = enSuccess_EventAddedToQueue;
@@ -658,7 +809,8 @@ enSetErrorEventStatus ITCOM_s16SetErrorEvent(uint8_t u8EventId)
     else
     {
         /* Handle queue full scenario */
-        uint32_t least_severe_index = FM_u32FindLeastSevereEvent(pstSharedMemData->stThreadsCommonData.Event_Queue, DATA_QUEUE_MAX_SIZE);
+        uint32_t least_severe_index = FM_u32FindLeastSevereEvent(pstSharedMemData->stThreadsCommonData.Event_Queue,
+                                                                itcom_stRegionLayout.astRegions[enRegionEventStore].u32Capacity);
         uint8_t least_severe_event_id = (uint8_t)pstSharedMemData->stThreadsCommonData.Event_Queue[least_severe_index];
         uint8_t u8EventSeverity = FM_u8GetEventSeverity(u8EventId);
         uint8_t u8EventLowestSeverity = FM_u8GetEventSeverity(least_severe_event_id);
@@ -667,10 +819,14 @@ enSetErrorEventStatus ITCOM_s16SetErrorEvent(uint8_t u8EventId)
         {
             /* Update snapshot data and replace least severe event */
             pstSharedMemData->stThreadsCommonData.SystemSnapshotData.ASI_State = pstSharedMemData->stThreadsCommonData.u8ASI_State;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.ASI_State);
             pstSharedMemData->stThreadsCommonData.SystemSnapshotData.GearShiftPosition = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.GearShiftPosition);
             pstSharedMemData->stThreadsCommonData.SystemSnapshotData.VehicleSpeed = pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.SystemSnapshotData.VehicleSpeed);
             log_message(global_log_file, LOG_WARNING, "Event Queue full. Replacing Event ID %d with new Event ID %d", least_severe_event_id, u8EventId);
             pstSharedMemData->stThreadsCommonData.Event_Queue[least_severe_index] = u8EventId;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue[least_severe_index]);
             result = enSuccess_EventAddedToQueue;
         }
         else
@@ -683,7 +839,7 @@ enSetErrorEventStatus ITCOM_s16SetErrorEvent(uint8_t u8EventId)
     }
 
     /* Unlock mutex */
-    mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_unlock_status != E_OK)
     {
         log_message(global_log_file, LOG_ERROR, "ITCOM_s16SetErrorEvent failed to unlock mutex: error %d", mutex_unlock_status);
@@ -716,13 +872,14 @@ void ITCOM_vUpdateCurrentEvent(ErrorEvent* pstCurrentEvent) {
         return;
     }
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_FM.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThread_FM.mutex);
     if (mutex_lock_status == E_OK) {
         /* Update the current event */
         pstSharedMemData->stThread_FM.current_event = *pstCurrentEvent;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThread_FM.current_event);
 
         /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_FM.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThread_FM.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vUpdateCurrentEvent failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -761,14 +918,14 @@ void ITCOM_vGetErrorEvent(ErrorEvent* const pstCurrentEvent)
 
     if (TRUE == is_operation_valid)
     {
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&(pstSharedMemData->stThread_FM.mutex));
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&(pstSharedMemData->stThread_FM.mutex));
         if (E_OK == mutex_lock_status)
         {
             /* Critical section - keep it minimal */
             *pstCurrentEvent = pstSharedMemData->stThread_FM.current_event;
 
             /* Release mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&(pstSharedMemData->stThread_FM.mutex));
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&(pstSharedMemData->stThread_FM.mutex));
             if (E_OK != mutex_unlock_status)
             {
                 log_message(global_log_file, LOG_ERROR, 
@@ -804,13 +961,14 @@ void ITCOM_vSetInitFlagStatus(uint8_t u8FlagValue) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Set the init flag value */
         pstSharedMemData->stThreadsCommonData.u8InitFinishFlag = u8FlagValue;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8InitFinishFlag);
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vSetInitFlagStatus failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -837,13 +995,13 @@ uint8_t ITCOM_u8GetInitFlagStatus(void) {
     mutex_status_t mutex_unlock_status;
     uint8_t u8TempInitFlagStatus = INACTIVE_FLAG;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Get the init flag value */
         u8TempInitFlagStatus = pstSharedMemData->stThreadsCommonData.u8InitFinishFlag;
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetInitFlagStatus failed to unlock mutex: error %d", mutex_unlock_status);
             u8TempInitFlagStatus = INACTIVE_FLAG;
@@ -871,13 +1029,14 @@ static void ITCOM_vSetCriticalFault(void) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Set the critical fault flag to active */
         pstSharedMemData->stThreadsCommonData.u8CriticalFaultFlag = (uint8_t)ACTIVE_FLAG;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8CriticalFaultFlag);
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCriticalFault failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -904,13 +1063,13 @@ uint8_t ITCOM_u8GetCriticalFaultStatus(void) {
     mutex_status_t mutex_unlock_status;
     uint8_t u8CriticalFaultStatus = ITCOM_ZERO_INIT_U;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Get the critical fault status */
         u8CriticalFaultStatus = pstSharedMemData->stThreadsCommonData.u8CriticalFaultFlag;
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetCriticalFaultStatus failed to unlock mutex: error %d", mutex_unlock_status);
             u8CriticalFaultStatus = ITCOM_ZERO_INIT_U;
@@ -940,13 +1099,14 @@ void ITCOM_vSetCycleCountData(uint16_t u16Value) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Set the cycle count value */
         pstSharedMemData->stThreadsCommonData.u16GnrlCycleCount = u16Value;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u16GnrlCycleCount);
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCycleCountData failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -973,13 +1133,13 @@ uint16_t ITCOM_u16GetCycleCountData(void) {
     mutex_status_t mutex_unlock_status;
     uint16_t u16CycleCount = CYCLE_COUNT_INVALID;
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Get the cycle count value */
         u16CycleCount = pstSharedMemData->stThreadsCommonData.u16GnrlCycleCount;
         
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetCycleCountData failed to unlock mutex: error %d", mutex_unlock_status);
             u16CycleCount = CYCLE_COUNT_INVALID;
@@ -1021,71 +1181,19 @@ uint16_t ITCOM_u16GetCycleCountData(void) {
 void ITCOM_vSetMsgCycleCount(stMsgIntegrityData* pstTempMsgTracker, uint8_t u8Action) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
-    int16_t s16Indx = ITCOM_ZERO_INIT_U;
-    stMsgIntegrityData stFoundInstance;
-    
+
     /* Attempt to lock mutex - continue even if logging fails */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status != E_OK) {
         (void)log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgCycleCount failed to lock mutex: error %d", 
                    mutex_lock_status);
         return;
     }
 
-    /* Process based on action type */
-    if(u8Action == (uint8_t)ADD_ELEMENT) {
-        InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, pstTempMsgTracker);
-        (void)log_message(global_log_file, LOG_DEBUG, "MESSAGE STARTED TRACKING, MSG: 0x%04X, Sequence Num: 0x%04X", 
-                   pstTempMsgTracker->stMsgPairData.u16MsgId, 
-                   pstTempMsgTracker->stMsgPairData.u16SequenceNum);
-    } else {
-        s16Indx = InstanceManager_s8FindElement(
-            (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, 
-            (generic_ptr_t)pstTempMsgTracker, 
-            (ElementCompareFn)&itcom_u8CompareMsgIdAndSequence, 
-            (generic_ptr_t)&stFoundInstance);
-        
-        if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
-            if (u8Action == (uint8_t)UPDATE_ELEMENT) {
-                InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, 
-                                            s16Indx, 
-                                            pstTempMsgTracker);
-                (void)log_message(global_log_file, LOG_DEBUG, 
-                          "MESSAGE UPDATED, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d, Response Cycle: %d", 
-                          pstTempMsgTracker->u16Type, 
-                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
-                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
-                          pstTempMsgTracker->u8ClearCondition,
-                          pstTempMsgTracker->u8ResponseCycleCount);
-            } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
-                InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, s16Indx);
-                (void)log_message(global_log_file, LOG_DEBUG, 
-                          "REMOVE FROM TRACKING, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d, Response Cycle: %d", 
-                          pstTempMsgTracker->u16Type, 
-                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
-                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
-                          pstTempMsgTracker->u8ClearCondition,
-                          pstTempMsgTracker->u8ResponseCycleCount);
-            } else {
-                (void)log_message(global_log_file, LOG_DEBUG, 
-                          "INVALID ACTION, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d", 
-                          pstTempMsgTracker->u16Type, 
-                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
-                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
-                          pstTempMsgTracker->u8ClearCondition);
-            }
-        } else {
-            (void)log_message(global_log_file, LOG_DEBUG, 
-                      "ELEMENT NOT FOUND, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d", 
-                      pstTempMsgTracker->u16Type, 
-                      pstTempMsgTracker->stMsgPairData.u16MsgId, 
-                      pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
-                      pstTempMsgTracker->u8ClearCondition);
-        }
-    }
+    itcom_vSetMsgCycleCountLocked(pstTempMsgTracker, u8Action);
 
     /* Always attempt to unlock mutex */
-    mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_unlock_status != E_OK) {
         (void)log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgCycleCount failed to unlock mutex: error %d", 
                    mutex_unlock_status);
@@ -1110,21 +1218,31 @@ int8_t ITCOM_s8SaveMsgData(stProcessMsgData* pstMsgPayload, int16_t s16Indx) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
     int8_t s8Return = ACTION_REQUEST_NOT_SAVED;
+    uint16_t u16Handle = ITCOM_u16PoolAlloc();
+
+    if (u16Handle == ITCOM_POOL_HANDLE_NONE) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s8SaveMsgData: message pool exhausted");
+        return ACTION_REQUEST_NOT_SAVED;
+    }
+    *ITCOM_pstPoolBlock(u16Handle) = *pstMsgPayload;
+    ITCOM_NOTE_MSG_COPY(sizeof(stProcessMsgData));
 
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Enqueue the message data and update sequence number */
-        s8Return = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, (uint8_t *)pstMsgPayload, sizeof(stProcessMsgData));
-        pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[s16Indx].u16SeqNumberSender = pstMsgPayload->stMsgPairData.u16SequenceNum;
+        s8Return = itcom_s8SaveMsgDataLocked(u16Handle, s16Indx);
+        if (s8Return != QUEUE_ACTION_SUCCESS) {
+            ITCOM_vPoolFree(u16Handle);
+        }
 
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_s8SaveMsgData failed to unlock mutex: error %d", mutex_unlock_status);
             s8Return = ACTION_REQUEST_NOT_SAVED; /* Adjust return in case of unlock failure */
         }
     } else {
         log_message(global_log_file, LOG_ERROR, "ITCOM_s8SaveMsgData failed to lock mutex: error %d", mutex_lock_status);
+        ITCOM_vPoolFree(u16Handle);
         s8Return = ACTION_REQUEST_NOT_SAVED;
     }
     return s8Return;
@@ -1155,11 +1273,11 @@ int8_t ITCOM_s8QueueActionReq(stProcessMsgData* pstMsgInfo) {
     int64_t elapsed_ms = ITCOM_ZERO_INIT_U;
     uint8_t operation_status = ITCOM_OP_FAILURE;
 
-    time_status = clock_gettime(CLOCK_MONOTONIC, &end_time);
+    time_status = UT_s32GetMonotonicTime(&end_time);
     if (time_status != (int32_t)ITCOM_ZERO_INIT_U) {
         log_message(global_log_file, LOG_ERROR, "ITCOM_s8QueueActionReq failed to get time: error %d", time_status);
     } else {
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_lock_status == E_OK) {
             p_start_time = ITCOM_pstGetActionRequestStartTime(pstMsgInfo->stMsgPairData.u16MsgId, pstMsgInfo->stMsgPairData.u16SequenceNum);
 
@@ -1167,8 +1285,11 @@ int8_t ITCOM_s8QueueActionReq(stProcessMsgData* pstMsgInfo) {
                 elapsed_ms = (end_time.tv_sec - p_start_time->tv_sec) * SEC_TO_MS +
                              (end_time.tv_nsec - p_start_time->tv_nsec) / NSEC_TO_MS;
 
+                itcom_vRecordApprovalLatency(elapsed_ms);
+
                 if (elapsed_ms <= (int64_t)ACTION_REQUEST_PROCESS_TIMEOUT_THRESHOLD) {
-                    s8Return = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, (uint8_t *)pstMsgInfo, sizeof(stProcessMsgData));
+                    s8Return = itcom_s8EnqueueTxLocked((uint8_t)enTxClassApproval, pstMsgInfo);
+                    itcom_vCountQueueOverflow((uint8_t)APPROVED_ACTIONS_QUEUE, s8Return);
                 } else {
                     log_message(global_log_file, LOG_WARNING, "Action request processing timeout: %ld ms", elapsed_ms);
                     s8Return = QUEUE_ACTION_TIMEOUT;
@@ -1181,7 +1302,13 @@ int8_t ITCOM_s8QueueActionReq(stProcessMsgData* pstMsgInfo) {
                             pstMsgInfo->stMsgPairData.u16MsgId, pstMsgInfo->stMsgPairData.u16SequenceNum);
             }
 
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+            /* Timed out, approved queue full or untracked: no answer follows, forget it so a retransmission is processed again */
+            if (s8Return != QUEUE_ACTION_SUCCESS) {
+                itcom_vRecordRecentDecisionLocked(ITCOM_RECENT_REQ_ANY_CONNECTION, pstMsgInfo->stMsgPairData.u16MsgId,
+                                                  pstMsgInfo->stMsgPairData.u16SequenceNum, (uint8_t)enTimeoutLimit);
+            }
+
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
             if (mutex_unlock_status != E_OK) {
                 log_message(global_log_file, LOG_ERROR, "ITCOM_s8QueueActionReq failed to unlock mutex: error %d", mutex_unlock_status);
                 s8Return = QUEUE_ACTION_FAILURE_DEFAULT;
@@ -1206,7 +1333,9 @@ int8_t ITCOM_s8QueueActionReq(stProcessMsgData* pstMsgInfo) {
 * @brief Dequeues an action request from the specified queue.
 *
 * @param [out] pstActionReqData Pointer to store dequeued action request data
-* @param [in] u8SelectQueue Queue selection flag (DATA_INTEGRITY_QUEUE or APPROVED_ACTIONS_QUEUE)
+* @param [in] u8SelectQueue Queue selection flag (DATA_INTEGRITY_QUEUE, APPROVED_ACTIONS_QUEUE,
+*                           SAFE_STATE_QUEUE or NOTIFICATION_QUEUE). The transmit queues are
+*                           normally drained through ITCOM_s8DequeueTxMessage.
 *
 * @global {r/w; shared_mutex; shared mutex for thread synchronization}
 *
@@ -1218,15 +1347,29 @@ int8_t ITCOM_s8DequeueActionReq(stProcessMsgData* pstActionReqData, uint8_t u8Se
     int8_t s8Return = QUEUE_ACTION_FAILURE_DEFAULT;
 
     /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
         /* Select the appropriate queue based on u8SelectQueue */
         if (u8SelectQueue == (uint8_t)DATA_INTEGRITY_QUEUE) {
-            s8Return = DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, (uint8_t *)pstActionReqData, sizeof(stProcessMsgData));
+            uint16_t u16Handle = ITCOM_POOL_HANDLE_NONE;
+            s8Return = DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, (uint8_t *)&u16Handle, sizeof(u16Handle));
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stActionReqQueue);
+            if (s8Return == QUEUE_ACTION_SUCCESS) {
+                ITCOM_NOTE_MSG_COPY(sizeof(u16Handle));
+                /* The only copy of the payload since it was staged by ICM_RX */
+                *pstActionReqData = *ITCOM_pstPoolBlock(u16Handle);
+                ITCOM_NOTE_MSG_COPY(sizeof(stProcessMsgData));
+                ITCOM_vPoolFree(u16Handle);
+            }
         } else if (u8SelectQueue == (uint8_t)APPROVED_ACTIONS_QUEUE) {
             s8Return = DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, (uint8_t *)pstActionReqData, sizeof(stProcessMsgData));
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue);
         } else if (u8SelectQueue == (uint8_t)SAFE_STATE_QUEUE) {
             s8Return = DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stMsgQueueSS, (uint8_t *)pstActionReqData, sizeof(stProcessMsgData));
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stMsgQueueSS);
+        } else if (u8SelectQueue == (uint8_t)NOTIFICATION_QUEUE) {
+            s8Return = DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stNotificationQueue, (uint8_t *)pstActionReqData, sizeof(stProcessMsgData));
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stNotificationQueue);
         } else {
             /* Intentionally empty else block */
         }
@@ -1240,7 +1383,7 @@ int8_t ITCOM_s8DequeueActionReq(stProcessMsgData* pstActionReqData, uint8_t u8Se
         }
 
         /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
             log_message(global_log_file, LOG_ERROR, "ITCOM_s8DequeueActionReq failed to unlock mutex: error %d", mutex_unlock_status);
         }
@@ -1251,1975 +1394,4075 @@ int8_t ITCOM_s8DequeueActionReq(stProcessMsgData* pstActionReqData, uint8_t u8Se
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s8LogSSMessage
+// FUNCTION NAME : ITCOM_s8DequeueTxMessage
 //*****************************************************************************
 /**
 *
-* @brief Logs a safe state message by clearing action request and approved actions queues.
+* @brief Picks the next message to transmit from the transmit classes.
 *
-* @param none
+* @details Scheduling, all under one lock:
+*          - enTxClassSafeState has strict priority and is served in every state.
+*          - In safe state nothing else is sent.
+*          - Otherwise approvals and notifications share the slot by weighted
+*            round robin (ITCOM_TX_WEIGHT_*); an empty class yields its credit.
+*          Messages queued longer than their class deadline
+*          (ITCOM_TX_DEADLINE_*_MS) are dropped instead of sent. Queueing delay
+*          and drops are accumulated per class (ITCOM_vGetTxClassStats).
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @param [out] pstMsgData Message to transmit
+* @param [in] u8ASIState Current ASI state
+* @param [out] pu8Class Class the message was taken from (may be NULL)
 *
-* @return int8_t Status of enqueue operation for safe state message
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return int8_t 0 if a message was dequeued, a negative queue status otherwise
 */
-int8_t ITCOM_s8LogSSMessage(void) {
+int8_t ITCOM_s8DequeueTxMessage(stProcessMsgData* pstMsgData, uint8_t u8ASIState, uint8_t* pu8Class) {
+    static const uint8_t au8Weight[enTotalTxClasses] = { 0U, ITCOM_TX_WEIGHT_APPROVAL, ITCOM_TX_WEIGHT_NOTIFICATION };
+    uint8_t* pau8Credits = pstSharedMemData->stThread_ICM_TX.au8TxCredits;
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
-    stProcessMsgData stTemp;
-    int8_t s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
+    int8_t s8Return = QUEUE_ACTION_FAILURE_DATAQUEUE_QUEUE_EMPTY;
+    uint8_t u8Class = (uint8_t)enTxClassSafeState;
+    uint32_t u32Now_ms = UT_u32GetCurrentTime_ms();
+    uint8_t u8Round;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (!VALID_PTR(pstMsgData)) {
+        return QUEUE_ACTION_FAILURE_DATAQUEUE_INVALID_INPUT;
+    }
+
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Clear the queues if they are not empty */
-        if (!DataQueue_u8IsEmpty(&pstSharedMemData->stThreadsCommonData.stActionReqQueue)) {
-            DataQueue_vClear(&pstSharedMemData->stThreadsCommonData.stActionReqQueue);
-        }
-        if (!DataQueue_u8IsEmpty(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue)) {
-            DataQueue_vClear(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue);
+        s8Return = itcom_s8DequeueTxClassLocked((uint8_t)enTxClassSafeState, pstMsgData, u32Now_ms);
+
+        /* Two rounds: spend the remaining credits, then refill once */
+        for (u8Round = ITCOM_ZERO_INIT_U; (u8Round < 2U) && (s8Return != QUEUE_ACTION_SUCCESS) &&
+                                          (u8ASIState != (uint8_t)STATE_SAFE_STATE); u8Round++) {
+            for (u8Class = (uint8_t)enTxClassApproval; u8Class < (uint8_t)enTotalTxClasses; u8Class++) {
+                if (pau8Credits[u8Class] > ITCOM_ZERO_INIT_U) {
+                    s8Return = itcom_s8DequeueTxClassLocked(u8Class, pstMsgData, u32Now_ms);
+                    if (s8Return == QUEUE_ACTION_SUCCESS) {
+                        pau8Credits[u8Class]--;
+                        break;
+                    }
+                    pau8Credits[u8Class] = ITCOM_ZERO_INIT_U;
+                }
+            }
+            if (s8Return != QUEUE_ACTION_SUCCESS) {
+                (void)memcpy(pau8Credits, au8Weight, sizeof(au8Weight));
+            }
         }
+        FALSE_SHARING_NOTE_OBJECT(pau8Credits, sizeof(au8Weight), "pstSharedMemData->stThread_ICM_TX.au8TxCredits");
 
-        /* Set message data */
-        stTemp.stMsgPairData.u16SequenceNum = pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[enStatusNotificationASI].u16SeqNumberASI;
-        stTemp.stMsgPairData.u16MsgId = stMsgDictionary[enStatusNotificationASI].u16MessageId;
-        stTemp.u16Type = stMsgTypeDictionary[enNotificationMessage].u16MessageTypeID;
-        stTemp.au8MsgData[0] = (uint8_t)STATE_SAFE_STATE;
-        pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[enStatusNotificationASI].u16SeqNumberASI++;
-
-        /* Enqueue the message */
-        s8EequeueStatus = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stMsgQueueSS, (uint8_t *)&stTemp, sizeof(stProcessMsgData));
-
-        /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status == E_OK) {
-            s8EequeueStatus = ENQUEUE_OPERATION_SUCCESS;
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogSSMessage failed to unlock mutex: error %d", mutex_unlock_status);
-            s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s8DequeueTxMessage failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogSSMessage failed to lock mutex: error %d", mutex_lock_status);
-        s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s8DequeueTxMessage failed to lock mutex: error %d", mutex_lock_status);
+        s8Return = QUEUE_ACTION_FAILURE_DEFAULT;
     }
 
-    return s8EequeueStatus;
+    if ((s8Return == QUEUE_ACTION_SUCCESS) && VALID_PTR(pu8Class)) {
+        *pu8Class = u8Class;
+    }
+    return s8Return;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s8LogNotificationMessage
+// FUNCTION NAME : ITCOM_vGetTxClassStats
 //*****************************************************************************
 /**
- * @brief Logs a notification message to the approved actions queue.
- *
- * This function creates and enqueues a notification message based on the provided parameters.
- * It handles different types of notifications, including action notifications, startup test
- * notifications, and ASI status notifications.
- *
- * @param u16MsgId The message ID for the notification. This is used directly for action
- *                 notifications, while for other types, it's retrieved from the message dictionary.
- * @param u16SequenceNum The sequence number for the notification. This is used directly for
- *                       action notifications, while for other types, it's retrieved from the
- *                       sequence number register.
- * @param u8Data The data payload for the notification message. This is stored in the first
- *               byte of the message data array.
- * @param u8SelectNotification The type of notification to be logged. This parameter determines
- *                             how the message is constructed and which queue it's added to.
- *                             Possible values are:
- *                             - enActionNotification
- *                             - enStartUpTestNotification
- *                             - enStatusNotificationASI
- *
- * @return int8_t Returns the status of the enqueue operation:
- *         - 0 if the message was successfully enqueued
- *         - -1 if the enqueue operation failed
- *
- * @note This function uses a mutex to ensure thread-safe access to shared data structures.
- *
- * @details The function performs the following steps:
- * 1. Initializes a temporary message data structure with the notification message type and length.
- * 2. Sets the data payload in the message structure.
- * 3. Locks the mutex to ensure exclusive access to shared data.
- * 4. Based on the notification type:
- *    - For action notifications:
- *      - Sets the message ID and sequence number directly from the parameters.
- *      - Updates the sequence number register for the sender.
- *    - For startup test and ASI status notifications:
- *      - Retrieves the message ID from the message dictionary.
- *      - Retrieves the sequence number from the ASI sequence number register.
- * 5. Enqueues the message to the approved actions queue.
- * 6. Unlocks the mutex.
- * 7. Returns the status of the enqueue operation.
- *
- */
-int8_t ITCOM_s8LogNotificationMessage(uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Data, uint8_t u8SelectNotification) {
+*
+* @brief Copies the queueing delay and deadline drop counters of all transmit classes.
+*
+* @param [out] pastStats Array of enTotalTxClasses entries
+*
+* @global {r; shared_mutex; shared mutex for thread synchronization}
+*
+* @return none
+*/
+void ITCOM_vGetTxClassStats(TxClassStats_t* pastStats) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
-    stProcessMsgData stTempMsgData = {ITCOM_ZERO_INIT_U};
-    int8_t s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;
 
-    /* Initialize message data */
-    stTempMsgData.u16Type = stMsgTypeDictionary[enNotificationMessage].u16MessageTypeID;
-    stTempMsgData.u16Length = stMsgTypeDictionary[enNotificationMessage].au8AssociatedLengths[0];
-    stTempMsgData.au8MsgData[0] = u8Data;
+    if (!VALID_PTR(pastStats)) {
+        return;
+    }
 
-    /* Lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Process the notification based on selection */
-        if (u8SelectNotification == enActionNotification) {
-            stTempMsgData.stMsgPairData.u16MsgId = u16MsgId;
-            stTempMsgData.stMsgPairData.u16SequenceNum = u16SequenceNum;
-            pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[enActionNotification].u16SeqNumberSender = stTempMsgData.stMsgPairData.u16SequenceNum;
-            s8QueueStatus = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, (uint8_t *)&stTempMsgData, sizeof(stProcessMsgData));
-        } else if ((u8SelectNotification == enStartUpTestNotification) || (u8SelectNotification == enStatusNotificationASI)) {
-            stTempMsgData.stMsgPairData.u16MsgId = stMsgDictionary[u8SelectNotification].u16MessageId;
-            stTempMsgData.stMsgPairData.u16SequenceNum = pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8SelectNotification].u16SeqNumberASI;
-            s8QueueStatus = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, (uint8_t *)&stTempMsgData, sizeof(stProcessMsgData));
-        } else {
-            /* Intentionally empty else block */
-        }
+        (void)memcpy(pastStats, pstSharedMemData->stThread_ICM_TX.astTxClassStats, sizeof(pstSharedMemData->stThread_ICM_TX.astTxClassStats));
 
-        /* Unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogNotificationMessage failed to unlock mutex: error %d", mutex_unlock_status);
-            s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;  /* Adjust return value on mutex unlock failure */
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetTxClassStats failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogNotificationMessage failed to lock mutex: error %d", mutex_lock_status);
-        s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetTxClassStats failed to lock mutex: error %d", mutex_lock_status);
+        (void)memset(pastStats, 0, sizeof(pstSharedMemData->stThread_ICM_TX.astTxClassStats));
     }
-    return s8QueueStatus;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetSeqNumASIRecord
+// FUNCTION NAME : ITCOM_vGetRecentRequestStats
 //*****************************************************************************
 /**
 *
-* @brief Sets the sequence number for the ASI record at the specified index.
+* @brief Copies the counters of the recent action request set.
 *
-* @param [in] u16SequenceNum Sequence number to set
-* @param [in] u8Indx Index of the ASI record to update
+* @param [out] pstStats Lookups, replayed and dropped duplicates, evictions
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @global {r; shared_mutex; shared mutex for thread synchronization}
 *
 * @return none
 */
-void ITCOM_vSetSeqNumASIRecord(uint16_t u16SequenceNum, uint8_t u8Indx) {
+void ITCOM_vGetRecentRequestStats(RecentRequestStats_t* pstStats) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (!VALID_PTR(pstStats)) {
+        return;
+    }
+
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Update the sequence number if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI = u16SequenceNum;
-        }
+        *pstStats = pstSharedMemData->stThreadsCommonData.stRecentRequests.stStats;
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetSeqNumASIRecord failed to unlock mutex: error %d", mutex_unlock_status);
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetRecentRequestStats failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetSeqNumASIRecord failed to lock mutex: error %d", mutex_lock_status);
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetRecentRequestStats failed to lock mutex: error %d", mutex_lock_status);
+        (void)memset(pstStats, 0, sizeof(*pstStats));
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u16GetSeqNumASIRecord
+// FUNCTION NAME : ITCOM_u8GetActionReqOccupancy
 //*****************************************************************************
 /**
 *
-* @brief Retrieves the sequence number for the ASI record at the specified index.
+* @brief Returns the number of action requests waiting in stActionReqQueue,
+*        read without the common mutex.
 *
-* @param [in] u8Indx Index of the ASI record
-*
-* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+* @details Used by the ICM_RX admission control on every action request
+*          frame, before validation. The count is updated under the common
+*          mutex; a value one update old is good enough for a shedding
+*          decision and keeps rejected frames off the lock.
 *
-* @return uint16_t Sequence number of the ASI record
+* @return uint8_t Queued action requests
 */
-uint16_t ITCOM_u16GetSeqNumASIRecord(uint8_t u8Indx) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint16_t u16TempSeqNum = ITCOM_ZERO_INIT_U;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Read the sequence number if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            u16TempSeqNum = pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI;
-        }
+uint8_t ITCOM_u8GetActionReqOccupancy(void) {
+    queue_size_t u32Size = __atomic_load_n(&pstSharedMemData->stThreadsCommonData.stActionReqQueue.u16_qSize, __ATOMIC_RELAXED);
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetSeqNumASIRecord failed to unlock mutex: error %d", mutex_unlock_status);
-            u16TempSeqNum = ITCOM_ZERO_INIT_U;
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetSeqNumASIRecord failed to lock mutex: error %d", mutex_lock_status);
-        u16TempSeqNum = ITCOM_ZERO_INIT_U;
-    }
-    return u16TempSeqNum;
+    return (u32Size > (queue_size_t)UINT8_MAX) ? (uint8_t)UINT8_MAX : (uint8_t)u32Size;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vRecordRC
+// FUNCTION NAME : ITCOM_u16PoolAlloc
 //*****************************************************************************
 /**
 *
+* @brief Takes a block from the shared message pool (lock-free).
 *
+* @return uint16_t Handle of the block, ITCOM_POOL_HANDLE_NONE if the pool is exhausted
 */
-void ITCOM_vRecordRC(uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Record the rolling counter if the message instance is valid */
-        if (u8MsgInstance < enTotalMessagesASI) {
-            if (u8Direction == (uint8_t)ROLLING_COUNT_RX) {
-                pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountRX = u16RollingCounter;
-            } else if (u8Direction == (uint8_t)ROLLING_COUNT_TX) {
-                pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX = u16RollingCounter;
-            } else {
-                /* Intentionally empty else block */
-            }
-        }
+uint16_t ITCOM_u16PoolAlloc(void) {
+    return itcom_u16FreeListPop(&pstSharedMemData->stMsgPool.stFreeList, pstSharedMemData->stMsgPool.au16Next);
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordRC failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordRC failed to lock mutex: error %d", mutex_lock_status);
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vPoolFree
+//*****************************************************************************
+/**
+*
+* @brief Returns a block to the shared message pool (lock-free).
+*
+* @param [in] u16Handle Handle from ITCOM_u16PoolAlloc; ITCOM_POOL_HANDLE_NONE is ignored
+*
+* @return none
+*/
+void ITCOM_vPoolFree(uint16_t u16Handle) {
+    if (u16Handle < (uint16_t)ITCOM_MSG_POOL_BLOCKS) {
+        itcom_vFreeListPush(&pstSharedMemData->stMsgPool.stFreeList, pstSharedMemData->stMsgPool.au16Next, u16Handle);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u16GetRCData
+// FUNCTION NAME : ITCOM_pstPoolBlock
 //*****************************************************************************
 /**
 *
-* @brief Retrieves rolling counter data for the specified message instance and direction.
-*
-* @param [in] u8MsgInstance Message instance to check
-* @param [in] u8Direction Direction of rolling count (ROLLING_COUNT_RX or ROLLING_COUNT_TX)
+* @brief Resolves a pool handle. The block belongs to whoever holds the
+*        handle: the allocating thread, then the queue, then the consumer.
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+* @param [in] u16Handle Handle from ITCOM_u16PoolAlloc
 *
-* @return int16_t Rolling counter data for the specified direction
+* @return stProcessMsgData* Message of the block, NULL for an invalid handle
 */
-int16_t ITCOM_u16GetRCData(uint8_t u8MsgInstance, uint8_t u8Direction) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    int16_t u16RC = ITCOM_ZERO_INIT_U;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Retrieve the rolling counter based on the direction */
-        if (u8Direction == (uint8_t)ROLLING_COUNT_RX) {
-            u16RC = pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountRX;
-        } else if (u8Direction == (uint8_t)ROLLING_COUNT_TX) {
-            u16RC = pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX;
-        } else {
-            /* Intentionally empty else block */
-        }
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetRCData failed to unlock mutex: error %d", mutex_unlock_status);
-            u16RC = ITCOM_ZERO_INIT_U;
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetRCData failed to lock mutex: error %d", mutex_lock_status);
-        u16RC = ITCOM_ZERO_INIT_U;
+stProcessMsgData* ITCOM_pstPoolBlock(uint16_t u16Handle) {
+    if (u16Handle >= (uint16_t)ITCOM_MSG_POOL_BLOCKS) {
+        return NULL;
     }
-    /* Return the rolling counter, error handling is managed by operation_status */
-    return u16RC;
+    return &pstSharedMemData->stMsgPool.astBlocks[u16Handle];
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetParkStatus
+// FUNCTION NAME : ITCOM_vGetPoolStats
 //*****************************************************************************
 /**
 *
+* @brief Copies the allocation and exhaustion counters of the message pool.
 *
+* @param [out] pstStats Pool counters
+*
+* @return none
 */
-void ITCOM_vSetParkStatus(uint8_t u8ParkStatus, uint8_t u8Status) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Update the park status and vehicle info status */
-        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus = u8ParkStatus;
-        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[0] = u8Status; /* Index for Park Info Status */
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetParkStatus failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetParkStatus failed to lock mutex: error %d", mutex_lock_status);
-    }
+void ITCOM_vGetPoolStats(MsgPoolStats_t* pstStats) {
+    itcom_vCopyPoolStats(&pstSharedMemData->stMsgPool.stFreeList.stStats, pstStats);
 }
 
-
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u8GetParkStatus
+// FUNCTION NAME : ITCOM_u16PayloadAlloc
 //*****************************************************************************
 /**
 *
-* @brief Retrieves the current park status and info status.
+* @brief Takes a block for a long message value from the payload pool (lock-free).
 *
-* @param [out] pu8ParkStaus Pointer to store park status
+* @return uint16_t Handle of the block, ITCOM_POOL_HANDLE_NONE if the pool is exhausted
+*/
+uint16_t ITCOM_u16PayloadAlloc(void) {
+    return itcom_u16FreeListPop(&pstSharedMemData->stPayloadPool.stFreeList, pstSharedMemData->stPayloadPool.au16Next);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vPayloadFree
+//*****************************************************************************
+/**
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+* @brief Returns a block to the payload pool (lock-free).
 *
-* @return uint8_t Info status for the park
+* @param [in] u16Handle Handle from ITCOM_u16PayloadAlloc; ITCOM_POOL_HANDLE_NONE is ignored
+*
+* @return none
 */
-uint8_t ITCOM_u8GetParkStatus(uint8_t* pu8ParkStatus) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint8_t u8InfoStatus = INFO_OUTDATED;
-
-    /* Check for NULL pointer */
-    if (pu8ParkStatus != (uint8_t*)NULL) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Retrieve the park status and info status */
-            *pu8ParkStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus;
-            u8InfoStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[0]; /* Index for Park Info Status */
-
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus failed to unlock mutex: error %d", mutex_unlock_status);
-                u8InfoStatus = INFO_OUTDATED;
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus failed to lock mutex: error %d", mutex_lock_status);
-            u8InfoStatus = INFO_OUTDATED;
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus: NULL pointer provided");
+void ITCOM_vPayloadFree(uint16_t u16Handle) {
+    if (u16Handle < (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS) {
+        itcom_vFreeListPush(&pstSharedMemData->stPayloadPool.stFreeList, pstSharedMemData->stPayloadPool.au16Next, u16Handle);
     }
-    return u8InfoStatus;
 }
 
-
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetVehicleSpeed
+// FUNCTION NAME : ITCOM_pu8PayloadBlock
 //*****************************************************************************
 /**
 *
+* @brief Resolves a payload pool handle to its TLV_MAX_VALUE_SIZE bytes.
 *
+* @param [in] u16Handle Handle from ITCOM_u16PayloadAlloc
+*
+* @return uint8_t* Block, NULL for an invalid handle
 */
-void ITCOM_vSetVehicleSpeed(float32_t f32VehicleSpeed, uint8_t u8Status) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Set the vehicle speed and update info status */
-        pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed = f32VehicleSpeed;
-        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[1] = u8Status; // Index for Vehicle Info Status
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetVehicleSpeed failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetVehicleSpeed failed to lock mutex: error %d", mutex_lock_status);
+uint8_t* ITCOM_pu8PayloadBlock(uint16_t u16Handle) {
+    if (u16Handle >= (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS) {
+        return NULL;
     }
+    return pstSharedMemData->stPayloadPool.aau8Blocks[u16Handle];
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u8GetVehicleSpeed
+// FUNCTION NAME : ITCOM_vGetPayloadPoolStats
 //*****************************************************************************
 /**
 *
-* @brief Retrieves the current vehicle speed and info status.
-*
-* @param [out] pf32VehicleSpeed Pointer to store vehicle speed
+* @brief Copies the allocation and exhaustion counters of the payload pool.
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+* @param [out] pstStats Pool counters
 *
-* @return uint8_t Info status for the vehicle speed
+* @return none
 */
-uint8_t ITCOM_u8GetVehicleSpeed(float32_t* pf32VehicleSpeed) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint8_t u8InfoStatus = INFO_OUTDATED;
-
-    if(VALID_PTR(pf32VehicleSpeed)) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Retrieve the vehicle speed and info status */
-            *pf32VehicleSpeed = pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed;
-            u8InfoStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[1]; // Index for Vehicle Info Status
+void ITCOM_vGetPayloadPoolStats(MsgPoolStats_t* pstStats) {
+    itcom_vCopyPoolStats(&pstSharedMemData->stPayloadPool.stFreeList.stStats, pstStats);
+}
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed failed to unlock mutex: error %d", mutex_unlock_status);
-                u8InfoStatus = INFO_OUTDATED;
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed failed to lock mutex: error %d", mutex_lock_status);
-            u8InfoStatus = INFO_OUTDATED;
-        }
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_pu8MsgPayload
+//*****************************************************************************
+/**
+*
+* @brief Returns the whole value of a message: au8MsgData for values up to
+*        MSG_PAYLOAD_SIZE bytes, the payload pool block for longer ones.
+*
+* @param [in] pstMsgData Message
+*
+* @return uint8_t* u16Length bytes of value, NULL if a long value has no block
+*                  (already released)
+*/
+uint8_t* ITCOM_pu8MsgPayload(stProcessMsgData* pstMsgData) {
+    if (!VALID_PTR(pstMsgData)) {
+        return NULL;
     }
-    else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed: Invalid input parameter pointer pf32VehicleSpeed");
-        u8InfoStatus = INFO_OUTDATED;
+    if (pstMsgData->u16Length <= (uint16_t)MSG_PAYLOAD_SIZE) {
+        return pstMsgData->au8MsgData;
     }
-    /* Return the info status; error handling is managed by operation_status */
-    return u8InfoStatus;
+    return ITCOM_pu8PayloadBlock(pstMsgData->u16PayloadHandle);
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vWriteSUTRes
+// FUNCTION NAME : ITCOM_vReleaseMsgPayload
 //*****************************************************************************
 /**
 *
-* @brief Writes start-up test results to the SUT results structure.
-*
-* @param [in] stTestResults Structure containing start-up test results
+* @brief Frees the payload block of a long message and clears its handle.
+*        Called by the stage that retires the message; no-op for short
+*        messages and for messages already released.
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @param [in,out] pstMsgData Message
 *
 * @return none
 */
-void ITCOM_vWriteSUTRes(SutTestResults_t stTestResults) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Copy the test results to the shared memory structure */
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < enTotalSUT; i++) {
-            pstSharedMemData->stThreadsCommonData.stSUTResults.enRunResult[i] = stTestResults.enRunResult[i];
-        }
-        pstSharedMemData->stThreadsCommonData.stSUTResults.u8SkippedTests = stTestResults.u8SkippedTests;
-        pstSharedMemData->stThreadsCommonData.stSUTResults.enFinalResult = stTestResults.enFinalResult;
-        pstSharedMemData->stThreadsCommonData.stSUTResults.u8Completion = stTestResults.u8Completion;
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vWriteSUTRes failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vWriteSUTRes failed to lock mutex: error %d", mutex_lock_status);
+void ITCOM_vReleaseMsgPayload(stProcessMsgData* pstMsgData) {
+    if (VALID_PTR(pstMsgData) && (pstMsgData->u16Length > (uint16_t)MSG_PAYLOAD_SIZE)) {
+        ITCOM_vPayloadFree(pstMsgData->u16PayloadHandle);
+        pstMsgData->u16PayloadHandle = ITCOM_POOL_HANDLE_NONE;
     }
 }
 
+#ifdef ITCOM_COPY_COUNTING
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vRecordSutCompTime
+// FUNCTION NAME : ITCOM_vNoteMsgCopy
 //*****************************************************************************
 /**
 *
-* @brief Records the completion time for start-up tests.
-*
-* @param [in] u32TimeRegister Completion time to record
+* @brief Counts one copy of message data (ITCOM_NOTE_MSG_COPY).
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @param [in] szBytes Size of the copy
 *
 * @return none
 */
-void ITCOM_vRecordSutCompTime(DateRecord_t u32TimeRegister) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Record the completion time */
-        pstSharedMemData->stThreadsCommonData.stSutTimeRegister = u32TimeRegister;
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordSutCompTime failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordSutCompTime failed to lock mutex: error %d", mutex_lock_status);
-    }
+void ITCOM_vNoteMsgCopy(size_t szBytes) {
+    (void)__atomic_fetch_add(&itcom_u32MsgCopies, 1U, __ATOMIC_RELAXED);
+    (void)__atomic_fetch_add(&itcom_u64MsgCopyBytes, (uint64_t)szBytes, __ATOMIC_RELAXED);
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetActionListTestResult
+// FUNCTION NAME : ITCOM_vGetMsgCopyCount
 //*****************************************************************************
 /**
 *
-* @brief Sets the test results for the action list tests.
-*
-* @param [in] stTestResults Structure containing action list test results
+* @brief Returns the copies of message data counted so far in this process.
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @param [out] pu32Copies Number of copies
+* @param [out] pu64Bytes  Bytes copied
 *
 * @return none
 */
-void ITCOM_vSetActionListTestResult(AraTestResults_t stTestResults) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Set the test results */
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < enTotalActionListTests; i++) {
-            pstSharedMemData->stThreadsCommonData.stActionListTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
-        }
-        pstSharedMemData->stThreadsCommonData.stActionListTestResults.enGroupResult = stTestResults.enGroupResult;
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionListTestResult failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionListTestResult failed to lock mutex: error %d", mutex_lock_status);
+void ITCOM_vGetMsgCopyCount(uint32_t* pu32Copies, uint64_t* pu64Bytes) {
+    if (VALID_PTR(pu32Copies) && VALID_PTR(pu64Bytes)) {
+        *pu32Copies = __atomic_load_n(&itcom_u32MsgCopies, __ATOMIC_RELAXED);
+        *pu64Bytes = __atomic_load_n(&itcom_u64MsgCopyBytes, __ATOMIC_RELAXED);
     }
 }
+#endif
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetPrecondListTestResult
+// FUNCTION NAME : ITCOM_s8LogSSMessage
 //*****************************************************************************
 /**
 *
-* @brief Sets the test results for the precondition list tests.
+* @brief Logs a safe state message and clears the pending action requests.
 *
-* @param [in] stTestResults Structure containing precondition list test results
+* @param none
 *
 * @global {r/w; shared_mutex; shared mutex for thread synchronization},
 *         {r/w; shared_cond; shared condition variable for thread signaling}
 *
-* @return none
+* @return int8_t Status of enqueue operation for safe state message
 */
-void ITCOM_vSetPrecondListTestResult(AraTestResults_t stTestResults) {
+int8_t ITCOM_s8LogSSMessage(void) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
+    stProcessMsgData stTemp = MSG_PROCESS_DATA_INIT;
+    int8_t s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
 
     /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Set the precondition test results */
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < enTotalPrecondListTests; i++) {
-            pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
-        }
-        pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enGroupResult = stTestResults.enGroupResult;
+        /* Drop pending action requests. Queued approvals and notifications stay:
+           the safe state message preempts them and they expire by deadline. */
+        itcom_vClearActionReqQueueLocked();
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetPrecondListTestResult failed to unlock mutex: error %d", mutex_unlock_status);
+        /* Set message data */
+        /* ICM allocates the number sent when the message goes out */
+        stTemp.stMsgPairData.u16SequenceNum = ITCOM_u16GetSeqNumASIRecord((uint8_t)enStatusNotificationASI);
+        stTemp.stMsgPairData.u16MsgId = stMsgDictionary[enStatusNotificationASI].u16MessageId;
+        stTemp.u16Type = stMsgTypeDictionary[enNotificationMessage].u16MessageTypeID;
+        stTemp.u16Length = stMsgTypeDictionary[enNotificationMessage].au8AssociatedLengths[0];
+        stTemp.au8MsgData[0] = (uint8_t)STATE_SAFE_STATE;
+
+        /* Enqueue the message */
+        s8EequeueStatus = itcom_s8EnqueueTxLocked((uint8_t)enTxClassSafeState, &stTemp);
+        itcom_vCountQueueOverflow((uint8_t)SAFE_STATE_QUEUE, s8EequeueStatus);
+
+        /* Unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status == E_OK) {
+            s8EequeueStatus = ENQUEUE_OPERATION_SUCCESS;
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogSSMessage failed to unlock mutex: error %d", mutex_unlock_status);
+            s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetPrecondListTestResult failed to lock mutex: error %d", mutex_lock_status);
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogSSMessage failed to lock mutex: error %d", mutex_lock_status);
+        s8EequeueStatus = ENQUEUE_OPERATION_FAILURE;
     }
+
+    return s8EequeueStatus;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetMemoryTestResult
+// FUNCTION NAME : ITCOM_s8LogNotificationMessage
 //*****************************************************************************
 /**
-*
-* @brief Sets the test results for memory tests.
-*
-* @param [in] stTestResults Structure containing memory test results
-*
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
-*
-* @return none
-*/
-void ITCOM_vSetMemoryTestResult(MemTestResult_t stTestResults) {
+ * @brief Logs a notification message to the notification queue.
+ *
+ * This function creates and enqueues a notification message based on the provided parameters.
+ * It handles different types of notifications, including action notifications, startup test
+ * notifications, and ASI status notifications.
+ *
+ * @param u16MsgId The message ID for the notification. This is used directly for action
+ *                 notifications, while for other types, it's retrieved from the message dictionary.
+ * @param u16SequenceNum The sequence number for the notification. This is used directly for
+ *                       action notifications, while for other types, it's retrieved from the
+ *                       sequence number register.
+ * @param u8Data The data payload for the notification message. This is stored in the first
+ *               byte of the message data array; the next bytes carry the action request
+ *               queue occupancy and the retry-after hint (ITCOM_NOTIFY_BYTE_*).
+ * @param u8SelectNotification The type of notification to be logged. This parameter determines
+ *                             how the message is constructed and which queue it's added to.
+ *                             Possible values are:
+ *                             - enActionNotification
+ *                             - enStartUpTestNotification
+ *                             - enStatusNotificationASI
+ *
+ * @return int8_t Returns the status of the enqueue operation:
+ *         - 0 if the message was successfully enqueued
+ *         - -1 if the enqueue operation failed
+ *
+ * @note This function uses a mutex to ensure thread-safe access to shared data structures.
+ *
+ * @details The function performs the following steps:
+ * 1. Locks the mutex to ensure exclusive access to shared data.
+ * 2. Initializes the notification with its type, length, data payload and
+ *    the overload fields taken from the action request queue.
+ * 3. Based on the notification type:
+ *    - For action notifications:
+ *      - Sets the message ID and sequence number directly from the parameters.
+ *      - Updates the sequence number register for the sender.
+ *      - Records the outcome in the recent action request set, so that a
+ *        retransmission of the request is answered with the same decision.
+ *    - For startup test and ASI status notifications:
+ *      - Retrieves the message ID from the message dictionary.
+ *      - Retrieves the sequence number from the ASI sequence number register.
+ * 4. Enqueues the message to the notification queue (enTxClassNotification).
+ * 5. Unlocks the mutex.
+ * 6. Returns the status of the enqueue operation.
+ *
+ */
+int8_t ITCOM_s8LogNotificationMessage(uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Data, uint8_t u8SelectNotification) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
+    stProcessMsgData stTempMsgData = {ITCOM_ZERO_INIT_U};
+    int8_t s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    /* Lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Set the memory test results */
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < enTotalMemoryTests; i++) {
-            pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
+        /* Process the notification based on selection */
+        if (u8SelectNotification == enActionNotification) {
+            s8QueueStatus = itcom_s8LogActionNotificationLocked(ITCOM_RECENT_REQ_ANY_CONNECTION, u16MsgId, u16SequenceNum, u8Data);
+        } else if ((u8SelectNotification == enStartUpTestNotification) || (u8SelectNotification == enStatusNotificationASI)) {
+            itcom_vInitNotificationLocked(&stTempMsgData, u8Data);
+            stTempMsgData.stMsgPairData.u16MsgId = stMsgDictionary[u8SelectNotification].u16MessageId;
+            stTempMsgData.stMsgPairData.u16SequenceNum = ITCOM_u16GetSeqNumASIRecord(u8SelectNotification);
+            s8QueueStatus = itcom_s8EnqueueTxLocked((uint8_t)enTxClassNotification, &stTempMsgData);
+            itcom_vCountQueueOverflow((uint8_t)NOTIFICATION_QUEUE, s8QueueStatus);
+        } else {
+            /* Intentionally empty else block */
         }
-        pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enGroupResult = stTestResults.enGroupResult;
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        /* Unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMemoryTestResult failed to unlock mutex: error %d", mutex_unlock_status);
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogNotificationMessage failed to unlock mutex: error %d", mutex_unlock_status);
+            s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;  /* Adjust return value on mutex unlock failure */
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMemoryTestResult failed to lock mutex: error %d", mutex_lock_status);
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s8LogNotificationMessage failed to lock mutex: error %d", mutex_lock_status);
+        s8QueueStatus = QUEUE_ACTION_FAILURE_DEFAULT;
     }
+    return s8QueueStatus;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetCalibReadbackData
+// FUNCTION NAME : ITCOM_vSetSeqNumASIRecord
 //*****************************************************************************
 /**
 *
-* @brief Sets the calibration readback data.
+* @brief Sets the next sequence number handed out for the ASI record at the
+*        specified index.
 *
-* @param [in] pu8Data Pointer to calibration readback data
-* @param [in] u8DataSize Size of calibration readback data
+* @param [in] u16SequenceNum Sequence number to set
+* @param [in] u8Indx Index of the ASI record to update
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @global {w; lock-free; atomic store, see ITCOM_u16AllocSeqNumASI}
 *
 * @return none
 */
-void ITCOM_vSetCalibReadbackData(stProcessMsgData* pstTempMsgDataTracker, uint8_t u8Action) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Handle different actions based on u8Action */
-        if (u8Action == (uint8_t)ADD_ELEMENT) {
-            InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, pstTempMsgDataTracker);
-        } else {
-            int16_t s16Indx = InstanceManager_s8FindElement(
-                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, 
-                (generic_ptr_t)pstTempMsgDataTracker, 
-                (ElementCompareFn)&itcom_u8CompareCalibData, 
-                NULL);
-            if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
-                if (u8Action == (uint8_t)UPDATE_ELEMENT) {
-                    InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, s16Indx, pstTempMsgDataTracker);
-                } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
-                    InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, s16Indx);
-                } else {
-                    /* Intentionally empty else block */
-                }
-            }
-        }
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibReadbackData failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibReadbackData failed to lock mutex: error %d", mutex_lock_status);
+void ITCOM_vSetSeqNumASIRecord(uint16_t u16SequenceNum, uint8_t u8Indx) {
+    if (u8Indx < enTotalMessagesASI) {
+        __atomic_store_n(&pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI,
+                         (uint16_t)(u16SequenceNum % UINT16_MAX_VALUE), __ATOMIC_RELAXED);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s16GetCalibReadbackData
+// FUNCTION NAME : ITCOM_u16GetSeqNumASIRecord
 //*****************************************************************************
 /**
 *
-* @brief Retrieves the calibration readback data.
+* @brief Retrieves the next sequence number that will be handed out for the
+*        ASI record at the specified index, without allocating it.
 *
-* @param [out] pu8Data Pointer to store calibration readback data
+* @param [in] u8Indx Index of the ASI record
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+* @global {r; lock-free; atomic load, see ITCOM_u16AllocSeqNumASI}
 *
-* @return none
+* @return uint16_t Sequence number of the ASI record
 */
-int16_t ITCOM_s16GetCalibReadbackData(stProcessMsgData stTempMsgDataTracker, uint8_t* pu8Data) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    stProcessMsgData stFoundInstance = {0};
-    int16_t s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
-    generic_ptr_t memory_operation_result = NULL;
-
-    /* Validate input parameter */
-    if (pu8Data != NULL) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        
-        if (mutex_lock_status == E_OK) {
-            /* Find the element in the calibration readback track */
-            s16Indx = InstanceManager_s8FindElement(
-                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, 
-                (generic_ptr_t)&stTempMsgDataTracker, 
-                (ElementCompareFn)&itcom_u8CompareCalibData, 
-                (generic_ptr_t)&stFoundInstance);
-
-            if (s16Indx >= (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER) {
-                /* Perform memory copy operation */
-                memory_operation_result = (generic_ptr_t)memcpy((void*)pu8Data, (const void*)stFoundInstance.au8MsgData, sizeof(stFoundInstance.au8MsgData));
-                
-                if (memory_operation_result == NULL) {
-                    log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Memory copy operation failed");
-                    s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
-                }
-            }
+uint16_t ITCOM_u16GetSeqNumASIRecord(uint8_t u8Indx) {
+    uint16_t u16TempSeqNum = ITCOM_ZERO_INIT_U;
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Failed to unlock mutex: error %d", (int)mutex_unlock_status);
-                s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
-            }
-        }
-        else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Failed to lock mutex: error %d", (int)mutex_lock_status);
-            s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
-        }
-    }
-    else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: NULL pointer received");
+    if (u8Indx < enTotalMessagesASI) {
+        u16TempSeqNum = itcom_u16PeekWrapped(&pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI);
     }
-    /* Return index or -1 in case of error */
-    return s16Indx;
+    return u16TempSeqNum;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetCalibDataCopy
+// FUNCTION NAME : ITCOM_u16AllocSeqNumASI
 //*****************************************************************************
 /**
 *
-* @brief Sets the calibration data copy.
+* @brief Allocates the sequence number of an outgoing ASI message.
 *
-* @param [in] pu8Data Pointer to calibration data
-* @param [in] u8DataSize Size of calibration data
+* @details One atomic fetch-add, no mutex: concurrent callers always get
+*          distinct numbers. Numbers wrap modulo UINT16_MAX_VALUE, i.e.
+*          65534 is followed by 0, as with the previous read/increment/store.
 *
-* @global {r/w; shared_mutex; shared mutex for thread synchronization},
-*         {r/w; shared_cond; shared condition variable for thread signaling}
+* @param [in] u8Indx Message enum of the ASI record
 *
-* @return none
+* @global {r/w; lock-free; atomic fetch-add}
+*
+* @return uint16_t Allocated sequence number, UINT16_MAX for an invalid index
 */
-void ITCOM_vSetCalibDataCopy(stProcessMsgData* pstTempMsgDataTracker, uint8_t u8Action) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+uint16_t ITCOM_u16AllocSeqNumASI(uint8_t u8Indx) {
+    if (u8Indx >= enTotalMessagesASI) {
+        return UINT16_MAX;
+    }
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI);
+    return itcom_u16AllocWrapped(&pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI);
+}
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Perform action based on u8Action */
-        if (u8Action == (uint8_t)ADD_ELEMENT) {
-            InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, pstTempMsgDataTracker);
-        } else {
-            int16_t s16Indx = InstanceManager_s8FindElement(
-                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, 
-                (generic_ptr_t)pstTempMsgDataTracker, 
-                (ElementCompareFn)&itcom_u8CompareCalibData, 
-                NULL);
-            if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
-                if (u8Action == (uint8_t)UPDATE_ELEMENT) {
-                    InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, s16Indx, pstTempMsgDataTracker);
-                } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
-                    InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, s16Indx);
-                    log_message(global_log_file, LOG_DEBUG, "CALIBRATION ELEMENT REMOVED, TYPE: 0x%04X, MSG ID: 0x%04X, Sequence: 0x%04X", 
-                        pstTempMsgDataTracker->u16Type, 
-                        pstTempMsgDataTracker->stMsgPairData.u16MsgId, 
-                        pstTempMsgDataTracker->stMsgPairData.u16SequenceNum);
-                } else {
-                    /* Intentionally empty else block */
-                }
-            }
-        }
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u16AllocTxRollingCounter
+//*****************************************************************************
+/**
+*
+* @brief Allocates the rolling counter of an outgoing message.
+*
+* @details Same allocation scheme and wraparound as ITCOM_u16AllocSeqNumASI,
+*          applied to the TX rolling counter register.
+*
+* @param [in] u8MsgInstance Message enum
+*
+* @global {r/w; lock-free; atomic fetch-add}
+*
+* @return uint16_t Allocated rolling counter, UINT16_MAX for an invalid index
+*/
+uint16_t ITCOM_u16AllocTxRollingCounter(uint8_t u8MsgInstance) {
+    if (u8MsgInstance >= enTotalMessagesASI) {
+        return UINT16_MAX;
+    }
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX);
+    return itcom_u16AllocWrapped(&pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX);
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibDataCopy failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibDataCopy failed to lock mutex: error %d", mutex_lock_status);
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bReleaseSeqNumASI
+//*****************************************************************************
+/**
+*
+* @brief Gives back a sequence number from ITCOM_u16AllocSeqNumASI whose
+*        message was not sent.
+*
+* @details The number is only taken back while it is the last one handed out
+*          (one compare-and-swap); once another sender allocated after it,
+*          it stays consumed and the peer sees a gap.
+*
+* @param [in] u8Indx Message enum of the ASI record
+* @param [in] u16SequenceNum Number returned by ITCOM_u16AllocSeqNumASI
+*
+* @global {r/w; lock-free; atomic compare-and-swap}
+*
+* @return bool true if the number will be handed out again
+*/
+bool ITCOM_bReleaseSeqNumASI(uint8_t u8Indx, uint16_t u16SequenceNum) {
+    if (u8Indx >= enTotalMessagesASI) {
+        return false;
     }
+    return itcom_bReleaseWrapped(&pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[u8Indx].u16SeqNumberASI, u16SequenceNum);
 }
 
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bReleaseTxRollingCounter
+//*****************************************************************************
+/**
+*
+* @brief Gives back a rolling counter from ITCOM_u16AllocTxRollingCounter
+*        whose message was not sent, see ITCOM_bReleaseSeqNumASI.
+*
+* @param [in] u8MsgInstance Message enum
+* @param [in] u16RollingCounter Value returned by ITCOM_u16AllocTxRollingCounter
+*
+* @global {r/w; lock-free; atomic compare-and-swap}
+*
+* @return bool true if the value will be handed out again
+*/
+bool ITCOM_bReleaseTxRollingCounter(uint8_t u8MsgInstance, uint16_t u16RollingCounter) {
+    if (u8MsgInstance >= enTotalMessagesASI) {
+        return false;
+    }
+    return itcom_bReleaseWrapped(&pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX,
+                                 u16RollingCounter);
+}
 
-void ITCOM_vSetCalibComparisonResult(uint8_t u8Result) {
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vRecordRC
+//*****************************************************************************
+/**
+*
+*
+*/
+void ITCOM_vRecordRC(uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
     /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Set the calibration comparison result */
-        pstSharedMemData->stThreadsCommonData.u8CalibComparisonResult = u8Result;
+        itcom_vRecordRCLocked(u8MsgInstance, u16RollingCounter, u8Direction);
 
         /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibComparisonResult failed to unlock mutex: error %d", mutex_unlock_status);
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordRC failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibComparisonResult failed to lock mutex: error %d", mutex_lock_status);
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordRC failed to lock mutex: error %d", mutex_lock_status);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s16GetIndxTableWithMsgType
+// FUNCTION NAME : ITCOM_u16GetRCData
+//*****************************************************************************
+/**
+*
+* @brief Retrieves rolling counter data for the specified message instance and direction.
+*
+* @param [in] u8MsgInstance Message instance to check
+* @param [in] u8Direction Direction of rolling count (ROLLING_COUNT_RX or ROLLING_COUNT_TX)
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return int16_t Rolling counter data for the specified direction
+*/
+int16_t ITCOM_u16GetRCData(uint8_t u8MsgInstance, uint8_t u8Direction) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    int16_t u16RC = ITCOM_ZERO_INIT_U;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Retrieve the rolling counter based on the direction */
+        if (u8Direction == (uint8_t)ROLLING_COUNT_RX) {
+            u16RC = pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountRX;
+        } else if (u8Direction == (uint8_t)ROLLING_COUNT_TX) {
+            u16RC = itcom_u16PeekWrapped(&pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX);
+        } else {
+            /* Intentionally empty else block */
+        }
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetRCData failed to unlock mutex: error %d", mutex_unlock_status);
+            u16RC = ITCOM_ZERO_INIT_U;
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetRCData failed to lock mutex: error %d", mutex_lock_status);
+        u16RC = ITCOM_ZERO_INIT_U;
+    }
+    /* Return the rolling counter, error handling is managed by operation_status */
+    return u16RC;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetParkStatus
+//*****************************************************************************
+/**
+*
+*
+*/
+void ITCOM_vSetParkStatus(uint8_t u8ParkStatus, uint8_t u8Status) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Update the park status and vehicle info status */
+        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus = u8ParkStatus;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus);
+        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[0] = u8Status; /* Index for Park Info Status */
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[0]);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetParkStatus failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetParkStatus failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u8GetParkStatus
+//*****************************************************************************
+/**
+*
+* @brief Retrieves the current park status and info status.
+*
+* @param [out] pu8ParkStaus Pointer to store park status
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return uint8_t Info status for the park
+*/
+uint8_t ITCOM_u8GetParkStatus(uint8_t* pu8ParkStatus) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    uint8_t u8InfoStatus = INFO_OUTDATED;
+
+    /* Check for NULL pointer */
+    if (pu8ParkStatus != (uint8_t*)NULL) {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Retrieve the park status and info status */
+            *pu8ParkStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8ParkStatus;
+            u8InfoStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[0]; /* Index for Park Info Status */
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus failed to unlock mutex: error %d", mutex_unlock_status);
+                u8InfoStatus = INFO_OUTDATED;
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus failed to lock mutex: error %d", mutex_lock_status);
+            u8InfoStatus = INFO_OUTDATED;
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetParkStatus: NULL pointer provided");
+    }
+    return u8InfoStatus;
+}
+
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetVehicleSpeed
+//*****************************************************************************
+/**
+*
+*
+*/
+void ITCOM_vSetVehicleSpeed(float32_t f32VehicleSpeed, uint8_t u8Status) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the vehicle speed and update info status */
+        pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed = f32VehicleSpeed;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed);
+        pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[1] = u8Status; // Index for Vehicle Info Status
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[1]);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetVehicleSpeed failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetVehicleSpeed failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u8GetVehicleSpeed
+//*****************************************************************************
+/**
+*
+* @brief Retrieves the current vehicle speed and info status.
+*
+* @param [out] pf32VehicleSpeed Pointer to store vehicle speed
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return uint8_t Info status for the vehicle speed
+*/
+uint8_t ITCOM_u8GetVehicleSpeed(float32_t* pf32VehicleSpeed) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    uint8_t u8InfoStatus = INFO_OUTDATED;
+
+    if(VALID_PTR(pf32VehicleSpeed)) {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Retrieve the vehicle speed and info status */
+            *pf32VehicleSpeed = pstSharedMemData->stThreadsCommonData.stVehicleStatus.fVehicleSpeed;
+            u8InfoStatus = pstSharedMemData->stThreadsCommonData.stVehicleStatus.u8InfoStatus[1]; // Index for Vehicle Info Status
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed failed to unlock mutex: error %d", mutex_unlock_status);
+                u8InfoStatus = INFO_OUTDATED;
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed failed to lock mutex: error %d", mutex_lock_status);
+            u8InfoStatus = INFO_OUTDATED;
+        }
+    }
+    else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetVehicleSpeed: Invalid input parameter pointer pf32VehicleSpeed");
+        u8InfoStatus = INFO_OUTDATED;
+    }
+    /* Return the info status; error handling is managed by operation_status */
+    return u8InfoStatus;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vWriteSUTRes
+//*****************************************************************************
+/**
+*
+* @brief Writes start-up test results to the SUT results structure.
+*
+* @param [in] stTestResults Structure containing start-up test results
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vWriteSUTRes(SutTestResults_t stTestResults) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Copy the test results to the shared memory structure */
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < enTotalSUT; i++) {
+            pstSharedMemData->stThreadsCommonData.stSUTResults.enRunResult[i] = stTestResults.enRunResult[i];
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSUTResults.enRunResult[i]);
+        }
+        pstSharedMemData->stThreadsCommonData.stSUTResults.u8SkippedTests = stTestResults.u8SkippedTests;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSUTResults.u8SkippedTests);
+        pstSharedMemData->stThreadsCommonData.stSUTResults.enFinalResult = stTestResults.enFinalResult;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSUTResults.enFinalResult);
+        pstSharedMemData->stThreadsCommonData.stSUTResults.u8Completion = stTestResults.u8Completion;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSUTResults.u8Completion);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vWriteSUTRes failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vWriteSUTRes failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vRecordSutCompTime
+//*****************************************************************************
+/**
+*
+* @brief Records the completion time for start-up tests.
+*
+* @param [in] u32TimeRegister Completion time to record
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vRecordSutCompTime(DateRecord_t u32TimeRegister) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Record the completion time */
+        pstSharedMemData->stThreadsCommonData.stSutTimeRegister = u32TimeRegister;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSutTimeRegister);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordSutCompTime failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordSutCompTime failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetActionListTestResult
+//*****************************************************************************
+/**
+*
+* @brief Sets the test results for the action list tests.
+*
+* @param [in] stTestResults Structure containing action list test results
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vSetActionListTestResult(AraTestResults_t stTestResults) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the test results */
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < enTotalActionListTests; i++) {
+            pstSharedMemData->stThreadsCommonData.stActionListTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stActionListTestResults.enSubTestResult[i]);
+        }
+        pstSharedMemData->stThreadsCommonData.stActionListTestResults.enGroupResult = stTestResults.enGroupResult;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stActionListTestResults.enGroupResult);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionListTestResult failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionListTestResult failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetPrecondListTestResult
+//*****************************************************************************
+/**
+*
+* @brief Sets the test results for the precondition list tests.
+*
+* @param [in] stTestResults Structure containing precondition list test results
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vSetPrecondListTestResult(AraTestResults_t stTestResults) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the precondition test results */
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < enTotalPrecondListTests; i++) {
+            pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enSubTestResult[i]);
+        }
+        pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enGroupResult = stTestResults.enGroupResult;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stPrecondTestResults.enGroupResult);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetPrecondListTestResult failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetPrecondListTestResult failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetMemoryTestResult
+//*****************************************************************************
+/**
+*
+* @brief Sets the test results for memory tests.
+*
+* @param [in] stTestResults Structure containing memory test results
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vSetMemoryTestResult(MemTestResult_t stTestResults) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the memory test results */
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < enTotalMemoryTests; i++) {
+            pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enSubTestResult[i] = stTestResults.enSubTestResult[i];
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enSubTestResult[i]);
+        }
+        pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enGroupResult = stTestResults.enGroupResult;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stMemoryTestResults.enGroupResult);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMemoryTestResult failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMemoryTestResult failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetCalibReadbackData
+//*****************************************************************************
+/**
+*
+* @brief Sets the calibration readback data.
+*
+* @param [in] pu8Data Pointer to calibration readback data
+* @param [in] u8DataSize Size of calibration readback data
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vSetCalibReadbackData(stProcessMsgData* pstTempMsgDataTracker, uint8_t u8Action) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Handle different actions based on u8Action */
+        if (u8Action == (uint8_t)ADD_ELEMENT) {
+            InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, pstTempMsgDataTracker);
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack);
+        } else {
+            int16_t s16Indx = InstanceManager_s8FindElement(
+                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, 
+                (generic_ptr_t)pstTempMsgDataTracker, 
+                (ElementCompareFn)&itcom_u8CompareCalibData, 
+                NULL);
+            if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
+                if (u8Action == (uint8_t)UPDATE_ELEMENT) {
+                    InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, s16Indx, pstTempMsgDataTracker);
+                    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack);
+                } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
+                    InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, s16Indx);
+                    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack);
+                } else {
+                    /* Intentionally empty else block */
+                }
+            }
+        }
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibReadbackData failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibReadbackData failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s16GetCalibReadbackData
+//*****************************************************************************
+/**
+*
+* @brief Retrieves the calibration readback data.
+*
+* @param [out] pu8Data Pointer to store calibration readback data
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return none
+*/
+int16_t ITCOM_s16GetCalibReadbackData(stProcessMsgData stTempMsgDataTracker, uint8_t* pu8Data) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    stProcessMsgData stFoundInstance = {0};
+    int16_t s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
+    generic_ptr_t memory_operation_result = NULL;
+
+    /* Validate input parameter */
+    if (pu8Data != NULL) {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        
+        if (mutex_lock_status == E_OK) {
+            /* Find the element in the calibration readback track */
+            s16Indx = InstanceManager_s8FindElement(
+                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack, 
+                (generic_ptr_t)&stTempMsgDataTracker, 
+                (ElementCompareFn)&itcom_u8CompareCalibData, 
+                (generic_ptr_t)&stFoundInstance);
+
+            if (s16Indx >= (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER) {
+                /* Perform memory copy operation */
+                memory_operation_result = (generic_ptr_t)memcpy((void*)pu8Data, (const void*)stFoundInstance.au8MsgData, sizeof(stFoundInstance.au8MsgData));
+                
+                if (memory_operation_result == NULL) {
+                    log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Memory copy operation failed");
+                    s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
+                }
+            }
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Failed to unlock mutex: error %d", (int)mutex_unlock_status);
+                s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
+            }
+        }
+        else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: Failed to lock mutex: error %d", (int)mutex_lock_status);
+            s16Indx = (int16_t)ELEMENT_NOT_FOUND_IN_CIR_BUFFER;
+        }
+    }
+    else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetCalibReadbackData: NULL pointer received");
+    }
+    /* Return index or -1 in case of error */
+    return s16Indx;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetCalibDataCopy
+//*****************************************************************************
+/**
+*
+* @brief Sets the calibration data copy.
+*
+* @param [in] pu8Data Pointer to calibration data
+* @param [in] u8DataSize Size of calibration data
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization},
+*         {r/w; shared_cond; shared condition variable for thread signaling}
+*
+* @return none
+*/
+void ITCOM_vSetCalibDataCopy(stProcessMsgData* pstTempMsgDataTracker, uint8_t u8Action) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Perform action based on u8Action */
+        if (u8Action == (uint8_t)ADD_ELEMENT) {
+            InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, pstTempMsgDataTracker);
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack);
+        } else {
+            int16_t s16Indx = InstanceManager_s8FindElement(
+                (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, 
+                (generic_ptr_t)pstTempMsgDataTracker, 
+                (ElementCompareFn)&itcom_u8CompareCalibData, 
+                NULL);
+            if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
+                if (u8Action == (uint8_t)UPDATE_ELEMENT) {
+                    InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, s16Indx, pstTempMsgDataTracker);
+                    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack);
+                } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
+                    InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack, s16Indx);
+                    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack);
+                    log_message(global_log_file, LOG_DEBUG, "CALIBRATION ELEMENT REMOVED, TYPE: 0x%04X, MSG ID: 0x%04X, Sequence: 0x%04X", 
+                        pstTempMsgDataTracker->u16Type, 
+                        pstTempMsgDataTracker->stMsgPairData.u16MsgId, 
+                        pstTempMsgDataTracker->stMsgPairData.u16SequenceNum);
+                } else {
+                    /* Intentionally empty else block */
+                }
+            }
+        }
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibDataCopy failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibDataCopy failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+
+void ITCOM_vSetCalibComparisonResult(uint8_t u8Result) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the calibration comparison result */
+        pstSharedMemData->stThreadsCommonData.u8CalibComparisonResult = u8Result;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8CalibComparisonResult);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibComparisonResult failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCalibComparisonResult failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s16GetIndxTableWithMsgType
 //*****************************************************************************
 /**
 * @brief Retrieves the enumeration associated with a message type.
 *
-* @param [in] u16MsgType The message type (e.g., 0xFF33 for ACK Message).
+* @param [in] u16MsgType The message type (e.g., 0xFF33 for ACK Message).
+*
+* @global {r; shared_mutex; shared mutex for dictionary access},
+*         {r; shared_cond; shared condition variable for thread signaling}
+*
+* @return int8_t Returns the message type enum if found, otherwise returns MESSAGE_TYPE_NOT_FOUND.
+*/
+int16_t ITCOM_s16GetMessageTypeEnum(uint16_t u16MsgType) {
+    uint8_t u8DictionarySize = sizeof(stMsgTypeDictionary) / sizeof(stMsgTypeDictionary[0]);
+    int16_t s16Indx = MESSAGE_TYPE_NOT_FOUND;
+    uint8_t i;
+    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+        if (stMsgTypeDictionary[i].u16MessageTypeID == u16MsgType) {
+            s16Indx = (int16_t)stMsgTypeDictionary[i].u8MessageTypeEnum;
+            break;
+        }
+    }
+    
+    if (s16Indx == (uint8_t)MESSAGE_TYPE_NOT_FOUND) {
+        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageTypeEnum: No match found for u16MsgType: 0x%04X", u16MsgType);
+    }
+
+    return s16Indx;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s16GetMessageEnumById
+//*****************************************************************************
+/**
+* @brief Retrieves the enumeration associated with a message id.
+*
+* @param [in] u16MsgId The message type ...
+*
+* @global {r; shared_mutex; shared mutex for dictionary access},
+*         {r; shared_cond; shared condition variable for thread signaling}
+*
+* @return int8_t Returns the message type enum if found, otherwise returns MESSAGE_TYPE_NOT_FOUND.
+*/
+int16_t ITCOM_s16GetMessageEnumById(uint16_t u16MsgId) {
+    uint8_t u8DictionarySize = sizeof(stMsgDictionary) / sizeof(stMsgDictionary[0]);
+    int16_t s16Indx = MESSAGE_NOT_FOUND;
+    uint8_t i;
+    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+        if (stMsgDictionary[i].u16MessageId == u16MsgId) {
+            s16Indx = (int16_t)stMsgDictionary[i].u8MessageEnum;
+            break;
+        }
+    }
+    
+    if (s16Indx == (int16_t)MESSAGE_NOT_FOUND) {
+        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageEnumById: No match found for u16MsgId: 0x%04X", u16MsgId);
+    }
+    return s16Indx;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s16GetIndxTableWithMsgID
+//*****************************************************************************
+/**
+* @brief Retrieves the index of the message in the dictionary based on message type, ID, and connection source.
+*
+* @param [in] u16MsgType The message type (e.g., 0xFF11 for Action Request, 0xFF33 for ACK).
+* @param [in] u16MsgId The message ID (e.g., 0x0007 for enDoorLockState).
+* @param [in] enTCPConn The connection source (enVAMConnectionTCP or enCMConnectionTCP).
+*
+* @global {r; shared_mutex; shared mutex for dictionary access},
+*         {r; shared_cond; shared condition variable for thread signaling}
+*
+* @return int8_t Returns the enum value if found, otherwise returns MESSAGE_NOT_FOUND.
+*/
+int16_t ITCOM_s16GetMessageEnumFromTypeAndId(uint16_t u16MsgType, uint16_t u16MsgId, enTCPConnectionsASI enTCPConn) {
+    uint8_t u8DictionarySize = (uint8_t)(sizeof(stMsgDictionary) / sizeof(stMsgDictionary[0]));
+    int16_t s16MsgIdEnum = ITCOM_s16GetMessageEnumById(u16MsgId);
+    int16_t s16MsgTypeEnum = ITCOM_s16GetMessageTypeEnum(u16MsgType);
+    int16_t s16Result = MESSAGE_NOT_FOUND;
+
+    /* Handle special case for acknowledgment messages */
+    if (s16MsgTypeEnum == enAckMessage) {
+        s16Result = (enTCPConn == (uint8_t)enVAMConnectionTCP) ? (int16_t)enAckVAM : (int16_t)enAckCM;
+    }
+    /* Handle notification messages */
+    else if (s16MsgTypeEnum == enNotificationMessage) {
+    	if((s16MsgIdEnum != (int16_t)enActionNotification) && (s16MsgIdEnum >= (int16_t)enNonCriticalFail && s16MsgIdEnum <= (int16_t)enStatusNotificationASI)) {
+            s16Result = s16MsgIdEnum;
+        }
+        else {
+            uint8_t i;
+            for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+                if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == enActionRequest) {
+                    s16Result = (int16_t)enActionNotification;
+                    break;
+                }
+            }
+        }
+    }
+    /* Handle calibration readback messages */
+    else if (s16MsgTypeEnum == enCalibReadbackMessage) {
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+            if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == enActionRequest) {
+                s16Result = (int16_t)enCalibReadback;
+                break;
+            }
+        }
+    }
+    /* General search for message ID and type */
+    else {
+        uint8_t i;
+        for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+            if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == s16MsgTypeEnum) {
+                s16Result = (int16_t)stMsgDictionary[i].u8MessageEnum;
+                break;
+            }
+        }
+    }
+
+    /* Return the result */
+    if (s16Result == (int16_t)MESSAGE_NOT_FOUND) {
+        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageEnumFromTypeAndId: Message not found for MsgType: 0x%04X, MsgId: 0x%04X", u16MsgType, u16MsgId);
+    }
+
+    return s16Result;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetDictionaryTypeDataAtIndx
+//*****************************************************************************
+/**
+ * @brief Retrieves a message type dictionary entry at a specified index.
+ *
+ * This function fetches a MessageTypeDictionary_t entry from the global stMsgTypeDictionary array
+ * at the index specified by u16MsgId. It provides a thread-safe way to access the message type
+ * dictionary data.
+ *
+ * @param[out] pstDictionaryTypeData Pointer to a MessageTypeDictionary_t structure where the
+ *                                   retrieved dictionary entry will be stored. This parameter
+ *                                   must not be NULL.
+ * @param[in] u16MsgId The index of the desired dictionary entry. This value must be less than
+ *                     enTotalASIMessageClassification.
+ *
+ */
+void ITCOM_vGetMsgTypeDictionaryEntryAtIndex(MessageTypeDictionary_t* pstDictionaryTypeData, uint16_t u16MsgId) {
+
+    /* Check if pstDictionaryTypeData is NULL */
+    if (pstDictionaryTypeData == NULL) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: NULL pointer provided for pstDictionaryTypeData");
+    }
+    /* Check if u16MsgId is valid */
+    else if (u16MsgId >= enTotalASIMessageClassification) {
+        log_message(global_log_file, LOG_WARNING, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: Invalid u16MsgId: %u. Must be less than %u", u16MsgId, enTotalASIMessageClassification);
+    }
+    else {
+        /* Successfully retrieve the dictionary entry */
+        *pstDictionaryTypeData = stMsgTypeDictionary[u16MsgId];
+        log_message(global_log_file, LOG_DEBUG, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: Successfully retrieved entry for u16MsgId: %u", u16MsgId);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetMsgDictionaryEntryAtIndex
+//*****************************************************************************
+/**
+ *
+*/
+void ITCOM_vGetMsgDictionaryEntryAtIndex(MessageDictionary_t* pstDictionaryData, uint16_t u16MsgId) {
+    generic_ptr_t memory_operation_result = NULL;
+
+    /* Check if pstDictionaryData is NULL */
+    if (pstDictionaryData == NULL) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgDictionaryEntryAtIndex: NULL pointer provided for pstDictionaryData");
+    }
+    /* Check if u16MsgId is valid */
+    else if (u16MsgId >= enTotalMessagesASI) {
+        log_message(global_log_file, LOG_WARNING, "ITCOM_vGetMsgDictionaryEntryAtIndex: Invalid u16MsgId: %u. Must be less than %u", u16MsgId, enTotalMessagesASI);
+
+        /* Initialize the structure with zeros to indicate an invalid entry */
+        memory_operation_result = memset(pstDictionaryData, 0, sizeof(MessageDictionary_t));
+        if ((memory_operation_result == NULL) || (memory_operation_result != pstDictionaryData)) {
+            log_message(global_log_file, LOG_ERROR, "Memory initialization failed");
+        }
+    }
+    /* Valid case: retrieve the dictionary entry */
+    else {
+        *pstDictionaryData = stMsgDictionary[u16MsgId];
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s16CheckAssociatedLength
+//*****************************************************************************
+/**
+* @brief Checks if the given length is valid for the specified message type.
+*
+* @details One hash lookup of the type and one bit test of the length in
+*          the bitmap built from stMsgTypeDictionary at init, independent of
+*          the number of types and associated lengths. Lengths above
+*          TLV_VALUE_SIZE are legal up to the u16MaxLength of the type.
+*
+* @param [in] u16MsgType The message type (e.g., 0xFF11 for Action Request).
+* @param [in] u16Length The length to check (e.g., 16, 32).
+*
+* @global {r; shared_mutex; shared mutex for dictionary access},
+*         {r; shared_cond; shared condition variable for thread signaling}
+*
+* @return int8_t Returns E_OK if the length is found, otherwise returns ASSOCIATED_LENGTH_NOT_FOUND.
+*/
+int8_t ITCOM_s8ValidateMessageTypeLength(uint16_t u16MsgType, uint16_t u16Length) {
+    const ItcomTypeLengthEntry_t* pstEntry = itcom_pstFindTypeLength(u16MsgType);
+    int8_t s8Result = MESSAGE_TYPE_NOT_FOUND;
+
+    if (pstEntry != NULL) {
+        if ((u16Length < ITCOM_LENGTH_BITMAP_BITS) &&
+            ((pstEntry->au32LengthBitmap[u16Length / ITCOM_BITMAP_WORD_BITS] & (1UL << (u16Length % ITCOM_BITMAP_WORD_BITS))) != ITCOM_ZERO_INIT_U)) {
+            s8Result = E_OK;
+        } else if ((u16Length > (uint16_t)TLV_VALUE_SIZE) && (u16Length <= pstEntry->u16MaxLength)) {
+            s8Result = E_OK;
+        } else {
+            /* The length is not legal for this type, record an error */
+            enSetErrorEventStatus error_status = ITCOM_s16SetErrorEvent(EVENT_ID_FAULT_MSG_TYPE_LENGTH);
+            if (error_status != (enSetErrorEventStatus)enSuccess_EventAddedToQueue) {
+                log_message(global_log_file, LOG_ERROR, "Failed to set error event: status %d", error_status);
+            }
+            log_message(global_log_file, LOG_WARNING, "ITCOM_s8ValidateMessageTypeLength: Length %u not found for message type 0x%04X", u16Length, u16MsgType);
+            s8Result = ASSOCIATED_LENGTH_NOT_FOUND;
+        }
+    }
+
+    /* Log a message type not found warning if applicable */
+    if (s8Result == (int8_t)MESSAGE_TYPE_NOT_FOUND) {
+        log_message(global_log_file, LOG_WARNING, "ITCOM_s8ValidateMessageTypeLength: Message type 0x%04X not found in dictionary", u16MsgType);
+    }
+
+    return s8Result;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u16GetTrackBufferSize
+//*****************************************************************************
+/**
+ * @brief Retrieves the size of a specified tracking buffer.
+ *
+ * This function returns the current count of elements in one of three tracking buffers:
+ * Action Message Buffer, Calibration Data Copy Buffer, or Calibration Readback Data Buffer.
+ * The specific buffer is selected using the input parameter.
+ *
+ * @param[in] u8SelectBuffer An 8-bit unsigned integer that specifies which buffer's size to retrieve.
+ *                           Valid values are:
+ *                           - enActionMsgBuffer: For the Action Message Buffer
+ *                           - enCalibDataCopyBuffer: For the Calibration Data Copy Buffer
+ *                           - enCalibReadbackData: For the Calibration Readback Data Buffer
+ *
+ * @return uint16_t The number of elements currently in the selected buffer.
+ *                  Returns 0 if pstSharedMemData is NULL or if an invalid buffer type is specified.
+ *
+ */
+uint16_t ITCOM_u16GetTrackBufferSize(uint8_t u8SelectBuffer) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    uint16_t u16BufferTrackSize = ITCOM_ZERO_INIT_U;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Select the appropriate buffer */
+        switch (u8SelectBuffer) {
+            case enActionMsgBuffer:
+                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Count;
+                break;
+
+            case enCalibDataCopyBuffer:
+                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Count;
+                break;
+
+            case enCalibReadbackData:
+                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Count;
+                break;
+
+            default:
+                log_message(global_log_file, LOG_WARNING, "ITCOM_u16GetTrackBufferSize: Invalid buffer type: %u", u8SelectBuffer);
+                break;
+        }
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetTrackBufferSize: Failed to unlock mutex: error %d", mutex_unlock_status);
+            u16BufferTrackSize = ITCOM_ZERO_INIT_U;
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetTrackBufferSize: Failed to lock mutex: error %d", mutex_lock_status);
+        u16BufferTrackSize = ITCOM_ZERO_INIT_U;
+    }
+    return u16BufferTrackSize;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bTrackBufferHasData
+//*****************************************************************************
+/**
+*
+* @brief Tells whether a tracking buffer holds elements, without taking the
+*        common data mutex.
+*
+* @details Used by the idle fast path of the periodic threads. The count is
+*          written under the mutex; a stale read only delays the work to the
+*          next period. The consumer still reads the buffer under the mutex.
+*
+* @param [in] u8SelectBuffer enActionMsgBuffer, enCalibDataCopyBuffer or enCalibReadbackData
+*
+* @return true when the buffer is not empty
+*/
+bool ITCOM_bTrackBufferHasData(uint8_t u8SelectBuffer) {
+    const stIMBuffer* pstBuffer;
+
+    switch (u8SelectBuffer) {
+        case enActionMsgBuffer:
+            pstBuffer = &pstSharedMemData->stThreadsCommonData.stCycleSeqTrack;
+            break;
+        case enCalibDataCopyBuffer:
+            pstBuffer = &pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack;
+            break;
+        case enCalibReadbackData:
+            pstBuffer = &pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack;
+            break;
+        default:
+            return false;
+    }
+    return __atomic_load_n(&pstBuffer->u16Count, __ATOMIC_RELAXED) != ITCOM_ZERO_INIT_U;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bQueueHasData
+//*****************************************************************************
+/**
+*
+* @brief Tells whether a message queue holds elements, without taking the
+*        common data mutex. Same staleness as ITCOM_bTrackBufferHasData.
+*
+* @param [in] u8SelectQueue DATA_INTEGRITY_QUEUE, APPROVED_ACTIONS_QUEUE,
+*                           SAFE_STATE_QUEUE or NOTIFICATION_QUEUE
+*
+* @return true when the queue is not empty
+*/
+bool ITCOM_bQueueHasData(uint8_t u8SelectQueue) {
+    const data_queue_t* pstQueue;
+
+    switch (u8SelectQueue) {
+        case DATA_INTEGRITY_QUEUE:
+            pstQueue = &pstSharedMemData->stThreadsCommonData.stActionReqQueue;
+            break;
+        case APPROVED_ACTIONS_QUEUE:
+            pstQueue = &pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue;
+            break;
+        case SAFE_STATE_QUEUE:
+            pstQueue = &pstSharedMemData->stThreadsCommonData.stMsgQueueSS;
+            break;
+        case NOTIFICATION_QUEUE:
+            pstQueue = &pstSharedMemData->stThreadsCommonData.stNotificationQueue;
+            break;
+        default:
+            return false;
+    }
+    return __atomic_load_n(&pstQueue->u16_qSize, __ATOMIC_RELAXED) != ITCOM_ZERO_INIT_U;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bErrorEventPending
+//*****************************************************************************
+/**
+*
+* @brief Tells whether FM has an error event to process, queued or
+*        interrupted, without taking the FM or common data mutex.
+*
+* @return true when the event queue is not empty or an event is in progress
+*/
+bool ITCOM_bErrorEventPending(void) {
+    return (__atomic_load_n(&pstSharedMemData->stThreadsCommonData.Event_Queue_Index, __ATOMIC_RELAXED) > 0) ||
+           (__atomic_load_n(&pstSharedMemData->stThread_FM.processing, __ATOMIC_RELAXED) != 0);
+}
+
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetElementAtIndex
+//*****************************************************************************
+/**
+ * @brief Retrieves an element from the cycle sequence tracking buffer at a specified index.
+ *
+ * This function copies an element from the cycle sequence tracking buffer (stCycleSeqTrack) 
+ * to a provided memory location. It handles the circular buffer logic and ensures thread-safe 
+ * access to the shared data structure.
+ *
+ * @param[in] u16Indx The logical index of the element to retrieve from the buffer.
+ *                    This index is relative to the current head of the circular buffer.
+ * @param[out] pvElement Pointer to the memory location where the retrieved element will be copied.
+ *                       The caller must ensure that this pointer is valid and points to a memory 
+ *                       location large enough to hold the element.
+ *
+ * @par Implementation Details
+ * The function performs the following steps:
+ * 1. Checks for NULL pointers in the input parameters.
+ * 2. Locks the mutex to ensure exclusive access to the shared data.
+ * 3. Checks if the provided index is within the valid range.
+ * 4. If valid, calculates the actual index in the circular buffer.
+ * 5. Copies the element from the buffer to the provided memory location.
+ * 6. Unlocks the mutex.
+ *
+ */
+
+void ITCOM_vGetCycleSeqElementAtIndex(uint16_t u16Indx, generic_ptr_t pvElement, uint8_t u8SelectBuffer) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    uint16_t u16ActualIndex = ITCOM_ZERO_INIT_U;
+    generic_ptr_t memory_operation_result = NULL;
+    size_t buffer_element_size = ITCOM_ZERO_INIT_U;
+    uint16_t buffer_count = ITCOM_ZERO_INIT_U;
+    uint8_t* source_buffer = NULL;
+
+    /* Check for NULL pointer */
+    if (pvElement == NULL) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: NULL pointer provided for pvElement");
+    } else {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Select the appropriate buffer based on u8SelectBuffer */
+            switch (u8SelectBuffer) {
+                case enActionMsgBuffer:
+                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.sz_ElementSize;
+                    buffer_count = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Count;
+                    if (u16Indx < buffer_count) {
+                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Head + u16Indx) % 
+                                         pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Capacity;
+                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.pu8_Buffer[(u16ActualIndex) * (buffer_element_size)];
+                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
+                        if (memory_operation_result != pvElement) {
+                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for ActionMsgBuffer");
+                        }
+                    }
+                    break;
+
+                case enCalibDataCopyBuffer:
+                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.sz_ElementSize;
+                    buffer_count = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Count;
+                    if (u16Indx < buffer_count) {
+                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Head + u16Indx) % 
+                                         pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Capacity;
+                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.pu8_Buffer[(u16ActualIndex) * (buffer_element_size)];
+                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
+                        if (memory_operation_result != pvElement) {
+                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for CalibDataCopyBuffer");
+                        }
+                    }
+                    break;
+
+                case enCalibReadbackData:
+                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.sz_ElementSize;
+                    buffer_count = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Count;
+                    if (u16Indx < buffer_count) {
+                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Head + u16Indx) % 
+                                         pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Capacity;
+                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.pu8_Buffer[(u16ActualIndex) * (buffer_element_size)];
+                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
+                        if (memory_operation_result != pvElement) {
+                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for CalibReadbackData");
+                        }
+                    }
+                    break;
+
+                default:
+                    log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Invalid buffer type: %u", u8SelectBuffer);
+                    break;
+            }
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Failed to unlock mutex: error %d", mutex_unlock_status);
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Failed to lock mutex: error %d", mutex_lock_status);
+        }
+    }
+}
+
+
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetCrcErrorCount
+//*****************************************************************************
+/**
+ *
+ * @brief Stores the CRC error counter of a message. Called by ICM_RX only.
+ *
+*/
+void ITCOM_vSetCrcErrorCount(uint8_t u8Indx, uint8_t u8Value) {
+    if (u8Indx < enTotalMessagesASI) {
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx], u8Value);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx]);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u8GetCrcErrorCount
+//*****************************************************************************
+/**
+ *
+ *
+*/
+uint8_t ITCOM_u8GetCrcErrorCount(uint8_t u8Indx) {
+    uint8_t u8CrcErrorCount = ITCOM_ZERO_INIT_U;
+
+    if (u8Indx < enTotalMessagesASI) {
+        u8CrcErrorCount = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx]);
+    }
+    return u8CrcErrorCount;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetRollingCountError
+//*****************************************************************************
+/**
+ *
+ * @brief Stores the rolling counter error count of a message. Called by ICM_RX only.
+ *
+*/
+void ITCOM_vSetRollingCountError(uint8_t u8Indx, uint8_t u8Value) {
+    if (u8Indx < enTotalMessagesASI) {
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx], u8Value);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx]);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u8GetRollingCountError
+//*****************************************************************************
+/**
+ *
+ *
+*/
+uint8_t ITCOM_u8GetRollingCountError(uint8_t u8Indx) {
+    uint8_t u8RollingCounterError = ITCOM_ZERO_INIT_U;
+
+    if (u8Indx < enTotalMessagesASI) {
+        u8RollingCounterError = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx]);
+    }
+    return u8RollingCounterError;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetRxErrorCountSnapshot
+//*****************************************************************************
+/**
+ *
+ * @brief Copies the CRC and rolling counter error counters of all messages
+ *        for readers outside ICM_RX.
+ *
+ * @details Every counter is read atomically; the copy as a whole is not a
+ *          single point in time, which is acceptable for monitoring.
+ *
+ * @param [out] pau8CrcErrors Array of enTotalMessagesASI entries (may be NULL)
+ * @param [out] pau8RcErrors Array of enTotalMessagesASI entries (may be NULL)
+ *
+ * @return none
+*/
+void ITCOM_vGetRxErrorCountSnapshot(uint8_t* pau8CrcErrors, uint8_t* pau8RcErrors) {
+    uint8_t u8Indx;
+
+    for (u8Indx = ITCOM_ZERO_INIT_U; u8Indx < (uint8_t)enTotalMessagesASI; u8Indx++) {
+        if (VALID_PTR(pau8CrcErrors)) {
+            pau8CrcErrors[u8Indx] = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx]);
+        }
+        if (VALID_PTR(pau8RcErrors)) {
+            pau8RcErrors[u8Indx] = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx]);
+        }
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetMsgRateLimiter
+//*****************************************************************************
+/**
+ *
+ * @brief Stores the TX rate limiter. Called by ICM_vInit before the threads
+ *        start and by ICM_TX afterwards.
+ *
+*/
+void ITCOM_vSetMsgRateLimiter(RateLimiter_t* pstRateLimiter) {
+    if(VALID_PTR(pstRateLimiter)) {
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16AllowedMessages, pstRateLimiter->u16AllowedMessages);
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16TimeWindowMs, pstRateLimiter->u16TimeWindowMs);
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16MessageCount, pstRateLimiter->u16MessageCount);
+        ITCOM_OWNER_STORE(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u32StartTime_ms, pstRateLimiter->u32StartTime_ms);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThread_ICM_TX.stRateLimiter);
+    }
+    else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgRateLimiter: Invalid input parameter pointer pstRateLimiter");
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetMsgRateLimiter
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vGetMsgRateLimiter(RateLimiter_t* pstRateLimiter) {
+    if(VALID_PTR(pstRateLimiter)) {
+        pstRateLimiter->u16AllowedMessages = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16AllowedMessages);
+        pstRateLimiter->u16TimeWindowMs = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16TimeWindowMs);
+        pstRateLimiter->u16MessageCount = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16MessageCount);
+        pstRateLimiter->u32StartTime_ms = ITCOM_OWNER_LOAD(pstSharedMemData->stThread_ICM_TX.stRateLimiter.u32StartTime_ms);
+    }
+    else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgRateLimiter: Invalid input parameter pointer pstRateLimiter");
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetErrorProcessingFlag
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vSetErrorProcessingFlag(int16_t s16Value) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThread_FM.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the error processing flag */
+        pstSharedMemData->stThread_FM.processing = s16Value;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThread_FM.processing);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThread_FM.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetErrorProcessingFlag: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetErrorProcessingFlag: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetErrorProcessingFlag
+//*****************************************************************************
+/**
+ *
+ *
+*/
+int16_t ITCOM_s16GetProcessingFlag(void)
+{
+    mutex_status_t mutex_lock_status = 0;
+    mutex_status_t mutex_unlock_status = 0;
+    int16_t s16ErrorProcessing = (int16_t)ITCOM_NEG_ONE_INIT;
+    bool is_operation_valid = TRUE;
+    
+    /* Validate shared memory */
+    if (NULL == pstSharedMemData)
+    {
+        log_message(global_log_file, LOG_ERROR, 
+                   "ITCOM_s16GetProcessingFlag: Invalid shared memory pointer");
+        is_operation_valid = FALSE;
+    }
+    
+    if (TRUE == is_operation_valid)
+    {
+        /* Try to acquire mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&(pstSharedMemData->stThread_FM.mutex));
+        if (E_OK == mutex_lock_status)
+        {
+            /* Critical section - keep it minimal */
+            s16ErrorProcessing = pstSharedMemData->stThread_FM.processing;
+            
+            /* Release mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&(pstSharedMemData->stThread_FM.mutex));
+            if (E_OK != mutex_unlock_status)
+            {
+                log_message(global_log_file, LOG_ERROR, 
+                           "ITCOM_s16GetProcessingFlag: Failed to unlock mutex: error %d", 
+                           (int)mutex_unlock_status);
+                is_operation_valid = FALSE;
+            }
+        }
+        else
+        {
+            log_message(global_log_file, LOG_ERROR, 
+                       "ITCOM_s16GetProcessingFlag: Failed to lock mutex: error %d", 
+                       (int)mutex_lock_status);
+            is_operation_valid = FALSE;
+        }
+    }
+    
+    /* Reset to error value if any operation failed */
+    if (FALSE == is_operation_valid)
+    {
+        s16ErrorProcessing = (int16_t)ITCOM_NEG_ONE_INIT;
+    }
+    
+    return s16ErrorProcessing;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetEventQueueIndx
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vSetEventQueueIndx(uint8_t u8IndxValue) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the event queue index */
+        pstSharedMemData->stThreadsCommonData.Event_Queue_Index = u8IndxValue;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue_Index);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueIndx: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueIndx: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetErrorProcessingFlag
+//*****************************************************************************
+/**
+ *
+ *
+*/
+int16_t ITCOM_s16GetEventQueueIndx(void) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    int16_t s16EventQueueIndx = QUEUE_INDEX_INVALID;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Retrieve the event queue index */
+        s16EventQueueIndx = (int16_t)pstSharedMemData->stThreadsCommonData.Event_Queue_Index;
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetEventQueueIndx: Failed to unlock mutex: error %d", mutex_unlock_status);
+            s16EventQueueIndx = QUEUE_INDEX_INVALID;  /* Set to error value if unlocking fails */
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetEventQueueIndx: Failed to lock mutex: error %d", mutex_lock_status);
+        s16EventQueueIndx = QUEUE_INDEX_INVALID;
+    }
+    return s16EventQueueIndx;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetEventQueueId
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vSetEventQueueId(uint8_t u8EventQueue, uint8_t u8Indx) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    if ((uint32_t)u8Indx >= itcom_stRegionLayout.astRegions[enRegionEventStore].u32Capacity) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueId: Index %u beyond the event store", u8Indx);
+        return;
+    }
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the event queue ID at the specified index */
+        pstSharedMemData->stThreadsCommonData.Event_Queue[u8Indx] = u8EventQueue;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue[u8Indx]);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueId: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueId: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetEventQueueId
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vGetEventQueueId(uint8_t* pu8EventQueue, uint8_t u8Indx) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    if ((uint32_t)u8Indx >= itcom_stRegionLayout.astRegions[enRegionEventStore].u32Capacity) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetEventQueueId: Index %u beyond the event store", u8Indx);
+        return;
+    }
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Retrieve the event queue ID at the specified index */
+        *pu8EventQueue = pstSharedMemData->stThreadsCommonData.Event_Queue[u8Indx];
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetEventQueueId: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetEventQueueId: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vRemoveProcessedEvent
+//*****************************************************************************
+/**
+ * @brief Removes the first event from the event queue after processing.
+ *
+ * This function is responsible for removing the first event from the shared
+ * event queue after it has been processed. It ensures thread-safe operation
+ * by using mutex locks when accessing the shared data.
+ *
+ * The function performs the following operations:
+ * 1. Locks the mutex for the shared event queue.
+ * 2. Checks if there are any events in the queue.
+ * 3. If events exist, it removes the first event by shifting all subsequent
+ *    events one position forward in the queue.
+ * 4. Decrements the event queue index.
+ * 5. Unlocks the mutex.
+ *
+ * @note This function assumes the existence of a global shared data structure
+ *       (shared_data) containing the event queue and associated mutex.
+ *
+ * @warning This function does not return any status about whether an event
+ *          was actually removed. Callers should ensure that an event is
+ *          available for removal before calling this function.
+ *
+ */
+void ITCOM_vRemoveProcessedEvent(void) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    generic_ptr_t move_result = NULL;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Check if there is an event to remove */
+        if (pstSharedMemData->stThreadsCommonData.Event_Queue_Index > 0) {
+            move_result = memmove(pstSharedMemData->stThreadsCommonData.Event_Queue,
+                                  pstSharedMemData->stThreadsCommonData.Event_Queue + 1,
+                                  (pstSharedMemData->stThreadsCommonData.Event_Queue_Index - 1) * sizeof(unsigned char));
+
+            /* Check for success of memmove operation */
+            if ((move_result != NULL) && (move_result == pstSharedMemData->stThreadsCommonData.Event_Queue)) {
+                FALSE_SHARING_NOTE_OBJECT(pstSharedMemData->stThreadsCommonData.Event_Queue,
+                                          itcom_stRegionLayout.astRegions[enRegionEventStore].u32Size, "Event_Queue");
+                pstSharedMemData->stThreadsCommonData.Event_Queue_Index--;
+                FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.Event_Queue_Index);
+            } else {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Memory move operation failed");
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: No events to remove");
+        }
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSemaphoreTryWait
+//*****************************************************************************
+/**
+ *
+ *
+*/
+int16_t ITCOM_vSemaphoreTryWait(void) {
+    int16_t s16SemTryWait = -1;
+    s16SemTryWait = sem_trywait(&pstSharedMemData->stThread_FM.sem);
+    return s16SemTryWait;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vNotification_SM
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vNotification_SM(void)
+{
+    log_message(global_log_file, LOG_INFO, "SM_Notification called");
+    ITCOM_vSetCriticalFault();
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vExtSysNotification
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vExtSysNotification(void)
+{
+    log_message(global_log_file, LOG_INFO, "External_System_Notification called");
+    (void)ITCOM_s8LogNotificationMessage(0U, 0U, 0U, (uint8_t)enStatusNotificationASI);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetTCPConnectionState
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vSetTCPConnectionState(enTCPConnectionsASI enConnection, TCPConnectionState_t enState) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Validate connection index */
+    if (enConnection >= (enTCPConnectionsASI)enTotalTCPConnections) {
+        log_message(global_log_file, LOG_ERROR, "Invalid connection index %d", enConnection);
+    } else {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Set the TCP connection state */
+            pstSharedMemData->stThreadsCommonData.enTCPConnectionState[enConnection] = enState;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.enTCPConnectionState[enConnection]);
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vSetTCPConnectionState: Failed to unlock mutex: error %d", mutex_unlock_status);
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetTCPConnectionState: Failed to lock mutex: error %d", mutex_lock_status);
+        }
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_enGetTCPConnectionState
+//*****************************************************************************
+/**
+ *
+ *
+*/
+TCPConnectionState_t ITCOM_enGetTCPConnectionState(enTCPConnectionsASI enConnection) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    TCPConnectionState_t enState = CONNECTION_STATE_DISCONNECTED;
+
+    /* Validate connection index */
+    if (enConnection >= (enTCPConnectionsASI)enTotalTCPConnections) {
+        log_message(global_log_file, LOG_ERROR, "Invalid connection index %d", enConnection);
+    } else {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Retrieve the TCP connection state */
+            enState = pstSharedMemData->stThreadsCommonData.enTCPConnectionState[enConnection];
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_enGetTCPConnectionState: Failed to unlock mutex: error %d", mutex_unlock_status);
+                enState = CONNECTION_STATE_ERROR;  /* Set error state on unlock failure */
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_enGetTCPConnectionState: Failed to lock mutex: error %d", mutex_lock_status);
+        }
+    }
+    return enState;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vSetStateMonitorTestData
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vSetStateMonitorTestData(StateMonitor_t stStateMonitorData) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Attempt to lock the mutex */
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        /* Set the state monitor data */
+        pstSharedMemData->stThreadsCommonData.stStateMonitorData.stCurrentState = stStateMonitorData.stCurrentState;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stStateMonitorData.stCurrentState);
+        pstSharedMemData->stThreadsCommonData.stStateMonitorData.u8StateError = stStateMonitorData.u8StateError;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stStateMonitorData.u8StateError);
+
+        /* Attempt to unlock the mutex */
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetStateMonitorTestData: Failed to unlock mutex: error %d", mutex_unlock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetStateMonitorTestData: Failed to lock mutex: error %d", mutex_lock_status);
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vGetStateMonitorTestData
+//*****************************************************************************
+/**
+ *
+ *
+*/
+void ITCOM_vGetStateMonitorTestData(StateMonitor_t* pstStateMonitorData) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+
+    /* Check if the pointer is valid */
+    if (VALID_PTR(pstStateMonitorData)) {
+        /* Attempt to lock the mutex */
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            /* Retrieve the state monitor data */
+            pstStateMonitorData->stCurrentState = pstSharedMemData->stThreadsCommonData.stStateMonitorData.stCurrentState;
+            pstStateMonitorData->u8StateError = pstSharedMemData->stThreadsCommonData.stStateMonitorData.u8StateError;
+
+            /* Attempt to unlock the mutex */
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Failed to unlock mutex: error %d", mutex_unlock_status);
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Failed to lock mutex: error %d", mutex_lock_status);
+        }
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Invalid pointer for pstStateMonitorData");
+    }
+}
+
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vTxnBegin
+//*****************************************************************************
+/**
+*
+* @brief Starts an empty transaction.
 *
-* @global {r; shared_mutex; shared mutex for dictionary access},
-*         {r; shared_cond; shared condition variable for thread signaling}
+* @details A transaction collects updates of the common data locally and
+*          applies them with a single acquisition of the common mutex in
+*          ITCOM_s8TxnCommit, instead of one lock round trip per update.
+*          Staging only copies the arguments, nothing is visible to other
+*          threads before the commit.
 *
-* @return int8_t Returns the message type enum if found, otherwise returns MESSAGE_TYPE_NOT_FOUND.
+* @param [out] pstTxn Transaction to initialise
+*
+* @return none
 */
-int16_t ITCOM_s16GetMessageTypeEnum(uint16_t u16MsgType) {
-    uint8_t u8DictionarySize = sizeof(stMsgTypeDictionary) / sizeof(stMsgTypeDictionary[0]);
-    int16_t s16Indx = MESSAGE_TYPE_NOT_FOUND;
-    uint8_t i;
-    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-        if (stMsgTypeDictionary[i].u16MessageTypeID == u16MsgType) {
-            s16Indx = (int16_t)stMsgTypeDictionary[i].u8MessageTypeEnum;
-            break;
-        }
+void ITCOM_vTxnBegin(ItcomTransaction_t* pstTxn) {
+    if (VALID_PTR(pstTxn)) {
+        pstTxn->u8OpCount = ITCOM_ZERO_INIT_U;
     }
-    
-    if (s16Indx == (uint8_t)MESSAGE_TYPE_NOT_FOUND) {
-        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageTypeEnum: No match found for u16MsgType: 0x%04X", u16MsgType);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s8TxnRecordRC
+//*****************************************************************************
+/**
+*
+* @brief Stages ITCOM_vRecordRC.
+*
+* @return int8_t Handle of the staged update for ITCOM_s8TxnGetResult, or ITCOM_TXN_FULL
+*/
+int8_t ITCOM_s8TxnRecordRC(ItcomTransaction_t* pstTxn, uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction) {
+    int8_t s8Op = ITCOM_TXN_FULL;
+    ItcomTxnOp_t* pstOp = itcom_pstTxnStage(pstTxn, enTxnRecordRC, &s8Op);
+
+    if (pstOp != NULL) {
+        pstOp->s16Indx = (int16_t)u8MsgInstance;
+        pstOp->u8Arg = u8Direction;
+        pstOp->uData.u16RollingCounter = u16RollingCounter;
     }
+    return s8Op;
+}
 
-    return s16Indx;
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s8TxnSetMsgCycleCount
+//*****************************************************************************
+/**
+*
+* @brief Stages ITCOM_vSetMsgCycleCount.
+*
+* @return int8_t Handle of the staged update for ITCOM_s8TxnGetResult, or ITCOM_TXN_FULL
+*/
+int8_t ITCOM_s8TxnSetMsgCycleCount(ItcomTransaction_t* pstTxn, const stMsgIntegrityData* pstTempMsgTracker, uint8_t u8Action) {
+    int8_t s8Op = ITCOM_TXN_FULL;
+    ItcomTxnOp_t* pstOp = NULL;
+
+    if (VALID_PTR(pstTempMsgTracker)) {
+        pstOp = itcom_pstTxnStage(pstTxn, enTxnSetMsgCycleCount, &s8Op);
+    }
+    if (pstOp != NULL) {
+        pstOp->u8Arg = u8Action;
+        pstOp->uData.stMsgTracker = *pstTempMsgTracker;
+    }
+    return s8Op;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s16GetMessageEnumById
+// FUNCTION NAME : ITCOM_s8TxnSaveMsgData
 //*****************************************************************************
 /**
-* @brief Retrieves the enumeration associated with a message id.
 *
-* @param [in] u16MsgId The message type ...
+* @brief Stages ITCOM_s8SaveMsgData. The enqueue status is available through
+*        ITCOM_s8TxnGetResult after the commit.
 *
-* @global {r; shared_mutex; shared mutex for dictionary access},
-*         {r; shared_cond; shared condition variable for thread signaling}
+* @details At commit the request is first looked up in the recent action
+*          request set by (u8Connection, ID, sequence number). A repeat of a
+*          decided request is answered with the cached notification
+*          (ACTION_REQUEST_DUPLICATE_REPLAYED), a repeat of a request still in
+*          progress is dropped (ACTION_REQUEST_DUPLICATE_DROPPED). Neither is
+*          queued for approval again.
+*          The payload is copied into a message pool block when staged; a
+*          request that finds the pool exhausted is answered busy at commit.
 *
-* @return int8_t Returns the message type enum if found, otherwise returns MESSAGE_TYPE_NOT_FOUND.
+* @return int8_t Handle of the staged update for ITCOM_s8TxnGetResult, or ITCOM_TXN_FULL
 */
-int16_t ITCOM_s16GetMessageEnumById(uint16_t u16MsgId) {
-    uint8_t u8DictionarySize = sizeof(stMsgDictionary) / sizeof(stMsgDictionary[0]);
-    int16_t s16Indx = MESSAGE_NOT_FOUND;
-    uint8_t i;
-    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-        if (stMsgDictionary[i].u16MessageId == u16MsgId) {
-            s16Indx = (int16_t)stMsgDictionary[i].u8MessageEnum;
-            break;
+int8_t ITCOM_s8TxnSaveMsgData(ItcomTransaction_t* pstTxn, const stProcessMsgData* pstMsgPayload, int16_t s16Indx, uint8_t u8Connection) {
+    int8_t s8Op = ITCOM_TXN_FULL;
+    ItcomTxnOp_t* pstOp = NULL;
+
+    if (VALID_PTR(pstMsgPayload) && (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) && (s16Indx < (int16_t)enTotalMessagesASI)) {
+        pstOp = itcom_pstTxnStage(pstTxn, enTxnSaveMsgData, &s8Op);
+    }
+    if (pstOp != NULL) {
+        pstOp->s16Indx = s16Indx;
+        pstOp->u8Arg = u8Connection;
+        pstOp->uData.stPooledMsg.stMsgPair = pstMsgPayload->stMsgPairData;
+        /* The payload is copied once, into its pool block; the queue takes the handle */
+        pstOp->uData.stPooledMsg.u16Handle = ITCOM_u16PoolAlloc();
+        if (pstOp->uData.stPooledMsg.u16Handle != ITCOM_POOL_HANDLE_NONE) {
+            *ITCOM_pstPoolBlock(pstOp->uData.stPooledMsg.u16Handle) = *pstMsgPayload;
+            ITCOM_NOTE_MSG_COPY(sizeof(stProcessMsgData));
         }
     }
-    
-    if (s16Indx == (int16_t)MESSAGE_NOT_FOUND) {
-        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageEnumById: No match found for u16MsgId: 0x%04X", u16MsgId);
+    return s8Op;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s8TxnSetActionRequestStartTime
+//*****************************************************************************
+/**
+*
+* @brief Stages ITCOM_vSetActionRequestStartTime. The start time is taken
+*        now, so the measured latency does not depend on when the
+*        transaction is committed.
+*
+* @return int8_t Handle of the staged update for ITCOM_s8TxnGetResult, or ITCOM_TXN_FULL
+*/
+int8_t ITCOM_s8TxnSetActionRequestStartTime(ItcomTransaction_t* pstTxn, uint16_t u16MsgId, uint16_t u16SequenceNum) {
+    int8_t s8Op = ITCOM_TXN_FULL;
+    ItcomTxnOp_t* pstOp = itcom_pstTxnStage(pstTxn, enTxnActionRequestStartTime, &s8Op);
+
+    if (pstOp != NULL) {
+        pstOp->uData.stTiming.u16MsgId = u16MsgId;
+        pstOp->uData.stTiming.u16SequenceNum = u16SequenceNum;
+        if (UT_s32GetMonotonicTime(&pstOp->uData.stTiming.start_time) != (int32_t)ITCOM_ZERO_INIT_U) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s8TxnSetActionRequestStartTime: Failed to get time");
+            pstTxn->u8OpCount--;
+            s8Op = ITCOM_TXN_FULL;
+        }
     }
-    return s16Indx;
+    return s8Op;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s16GetIndxTableWithMsgID
+// FUNCTION NAME : ITCOM_s8TxnCommit
 //*****************************************************************************
 /**
-* @brief Retrieves the index of the message in the dictionary based on message type, ID, and connection source.
 *
-* @param [in] u16MsgType The message type (e.g., 0xFF11 for Action Request, 0xFF33 for ACK).
-* @param [in] u16MsgId The message ID (e.g., 0x0007 for enDoorLockState).
-* @param [in] enTCPConn The connection source (enVAMConnectionTCP or enCMConnectionTCP).
+* @brief Applies all staged updates, in staging order, under one acquisition
+*        of the common mutex. The transaction is empty afterwards.
 *
-* @global {r; shared_mutex; shared mutex for dictionary access},
-*         {r; shared_cond; shared condition variable for thread signaling}
+* @param [in,out] pstTxn Transaction to commit
 *
-* @return int8_t Returns the enum value if found, otherwise returns MESSAGE_NOT_FOUND.
+* @return int8_t E_OK, or E_NOT_OK if the mutex could not be taken (no update applied)
 */
-int16_t ITCOM_s16GetMessageEnumFromTypeAndId(uint16_t u16MsgType, uint16_t u16MsgId, enTCPConnectionsASI enTCPConn) {
-    uint8_t u8DictionarySize = (uint8_t)(sizeof(stMsgDictionary) / sizeof(stMsgDictionary[0]));
-    int16_t s16MsgIdEnum = ITCOM_s16GetMessageEnumById(u16MsgId);
-    int16_t s16MsgTypeEnum = ITCOM_s16GetMessageTypeEnum(u16MsgType);
-    int16_t s16Result = MESSAGE_NOT_FOUND;
+int8_t ITCOM_s8TxnCommit(ItcomTransaction_t* pstTxn) {
+    mutex_status_t mutex_lock_status;
+    mutex_status_t mutex_unlock_status;
+    int8_t s8Return = E_OK;
+    uint8_t u8Op;
 
-    /* Handle special case for acknowledgment messages */
-    if (s16MsgTypeEnum == enAckMessage) {
-        s16Result = (enTCPConn == (uint8_t)enVAMConnectionTCP) ? (int16_t)enAckVAM : (int16_t)enAckCM;
+    if (!VALID_PTR(pstTxn)) {
+        return E_NOT_OK;
     }
-    /* Handle notification messages */
-    else if (s16MsgTypeEnum == enNotificationMessage) {
-    	if((s16MsgIdEnum != (int16_t)enActionNotification) && (s16MsgIdEnum >= (int16_t)enNonCriticalFail && s16MsgIdEnum <= (int16_t)enStatusNotificationASI)) {
-            s16Result = s16MsgIdEnum;
-        }
-        else {
-            uint8_t i;
-            for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-                if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == enActionRequest) {
-                    s16Result = (int16_t)enActionNotification;
+    if (pstTxn->u8OpCount == ITCOM_ZERO_INIT_U) {
+        return E_OK;
+    }
+
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+    if (mutex_lock_status == E_OK) {
+        for (u8Op = ITCOM_ZERO_INIT_U; u8Op < pstTxn->u8OpCount; u8Op++) {
+            ItcomTxnOp_t* pstOp = &pstTxn->astOps[u8Op];
+
+            switch (pstOp->enType) {
+                case enTxnRecordRC:
+                    itcom_vRecordRCLocked((uint8_t)pstOp->s16Indx, pstOp->uData.u16RollingCounter, pstOp->u8Arg);
+                    pstOp->s8Result = E_OK;
+                    break;
+                case enTxnSetMsgCycleCount:
+                    itcom_vSetMsgCycleCountLocked(&pstOp->uData.stMsgTracker, pstOp->u8Arg);
+                    pstOp->s8Result = E_OK;
+                    break;
+                case enTxnSaveMsgData:
+                    pstOp->s8Result = itcom_s8AdmitActionRequestLocked(pstOp->u8Arg, pstOp->uData.stPooledMsg.stMsgPair.u16MsgId,
+                                                                       pstOp->uData.stPooledMsg.stMsgPair.u16SequenceNum);
+                    if (pstOp->s8Result == QUEUE_ACTION_SUCCESS) {
+                        pstOp->s8Result = (pstOp->uData.stPooledMsg.u16Handle != ITCOM_POOL_HANDLE_NONE) ?
+                                          itcom_s8SaveMsgDataLocked(pstOp->uData.stPooledMsg.u16Handle, pstOp->s16Indx) :
+                                          (int8_t)ACTION_REQUEST_NOT_SAVED;
+                        if (pstOp->s8Result != QUEUE_ACTION_SUCCESS) {
+                            /* Not queued: forget it so a retransmission is processed again, and say so */
+                            itcom_vRecordRecentDecisionLocked(pstOp->u8Arg, pstOp->uData.stPooledMsg.stMsgPair.u16MsgId,
+                                                              pstOp->uData.stPooledMsg.stMsgPair.u16SequenceNum,
+                                                              (uint8_t)enBusyRetryLater);
+                            if (pstOp->u8Arg == (uint8_t)enVAMConnectionTCP) {
+                                (void)itcom_s8LogActionNotificationLocked(pstOp->u8Arg, pstOp->uData.stPooledMsg.stMsgPair.u16MsgId,
+                                                                          pstOp->uData.stPooledMsg.stMsgPair.u16SequenceNum,
+                                                                          (uint8_t)enBusyRetryLater);
+                            }
+                        }
+                    }
+                    if (pstOp->s8Result != QUEUE_ACTION_SUCCESS) {
+                        ITCOM_vPoolFree(pstOp->uData.stPooledMsg.u16Handle);
+                    }
+                    break;
+                case enTxnActionRequestStartTime:
+                    pstOp->s8Result = (itcom_u8StoreActionRequestTimingLocked(&pstOp->uData.stTiming) == (uint8_t)ITCOM_OP_SUCCESS) ? E_OK : E_NOT_OK;
+                    break;
+                default:
+                    pstOp->s8Result = E_NOT_OK;
                     break;
-                }
             }
         }
-    }
-    /* Handle calibration readback messages */
-    else if (s16MsgTypeEnum == enCalibReadbackMessage) {
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-            if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == enActionRequest) {
-                s16Result = (int16_t)enCalibReadback;
-                break;
-            }
+
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_unlock_status != E_OK) {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_s8TxnCommit failed to unlock mutex: error %d", mutex_unlock_status);
         }
-    }
-    /* General search for message ID and type */
-    else {
-        uint8_t i;
-        for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-            if (stMsgDictionary[i].u16MessageId == u16MsgId && stMsgDictionary[i].u16MessageType == s16MsgTypeEnum) {
-                s16Result = (int16_t)stMsgDictionary[i].u8MessageEnum;
-                break;
+    } else {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_s8TxnCommit failed to lock mutex: error %d", mutex_lock_status);
+        for (u8Op = ITCOM_ZERO_INIT_U; u8Op < pstTxn->u8OpCount; u8Op++) {
+            if (pstTxn->astOps[u8Op].enType == enTxnSaveMsgData) {
+                ITCOM_vPoolFree(pstTxn->astOps[u8Op].uData.stPooledMsg.u16Handle);
             }
         }
+        s8Return = E_NOT_OK;
     }
 
-    /* Return the result */
-    if (s16Result == (int16_t)MESSAGE_NOT_FOUND) {
-        log_message(global_log_file, LOG_DEBUG, "ITCOM_s16GetMessageEnumFromTypeAndId: Message not found for MsgType: 0x%04X, MsgId: 0x%04X", u16MsgType, u16MsgId);
-    }
-
-    return s16Result;
+    pstTxn->u8OpCount = ITCOM_ZERO_INIT_U;
+    return s8Return;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetDictionaryTypeDataAtIndx
+// FUNCTION NAME : ITCOM_s8TxnGetResult
 //*****************************************************************************
 /**
- * @brief Retrieves a message type dictionary entry at a specified index.
- *
- * This function fetches a MessageTypeDictionary_t entry from the global stMsgTypeDictionary array
- * at the index specified by u16MsgId. It provides a thread-safe way to access the message type
- * dictionary data.
- *
- * @param[out] pstDictionaryTypeData Pointer to a MessageTypeDictionary_t structure where the
- *                                   retrieved dictionary entry will be stored. This parameter
- *                                   must not be NULL.
- * @param[in] u16MsgId The index of the desired dictionary entry. This value must be less than
- *                     enTotalASIMessageClassification.
- *
- */
-void ITCOM_vGetMsgTypeDictionaryEntryAtIndex(MessageTypeDictionary_t* pstDictionaryTypeData, uint16_t u16MsgId) {
-
-    /* Check if pstDictionaryTypeData is NULL */
-    if (pstDictionaryTypeData == NULL) {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: NULL pointer provided for pstDictionaryTypeData");
-    }
-    /* Check if u16MsgId is valid */
-    else if (u16MsgId >= enTotalASIMessageClassification) {
-        log_message(global_log_file, LOG_WARNING, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: Invalid u16MsgId: %u. Must be less than %u", u16MsgId, enTotalASIMessageClassification);
+*
+* @brief Returns the result of a committed update.
+*
+* @param [in] pstTxn Committed transaction
+* @param [in] s8Op Handle returned when the update was staged
+*
+* @return int8_t Result of the update, E_NOT_OK for an invalid handle. For
+*         enTxnSaveMsgData this is the enqueue status (ACTION_REQUEST_NOT_SAVED
+*         if the commit failed) or one of the ACTION_REQUEST_DUPLICATE_* codes.
+*/
+int8_t ITCOM_s8TxnGetResult(const ItcomTransaction_t* pstTxn, int8_t s8Op) {
+    if (!VALID_PTR(pstTxn) || (s8Op < (int8_t)ITCOM_ZERO_INIT_U) || (s8Op >= (int8_t)ITCOM_TXN_MAX_OPS)) {
+        return E_NOT_OK;
     }
-    else {
-        /* Successfully retrieve the dictionary entry */
-        *pstDictionaryTypeData = stMsgTypeDictionary[u16MsgId];
-        log_message(global_log_file, LOG_DEBUG, "ITCOM_vGetMsgTypeDictionaryEntryAtIndex: Successfully retrieved entry for u16MsgId: %u", u16MsgId);
+    return pstTxn->astOps[s8Op].s8Result;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vRxRingReset
+//*****************************************************************************
+/**
+*
+* @brief Empties the receive rings of all connections and clears their
+*        counters. Called by ICM_vInit before the threads start. Payload
+*        blocks of frames still in a ring go back to the pool.
+*
+* @return none
+*/
+void ITCOM_vRxRingReset(void) {
+    uint8_t u8Conn;
+    uint32_t u32Slot;
+
+    for (u8Conn = ITCOM_ZERO_INIT_U; u8Conn < (uint8_t)enTotalTCPConnections; u8Conn++) {
+        RxRing_t* pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Conn];
+
+        for (u32Slot = pstRing->u32Tail; u32Slot != pstRing->u32Head; u32Slot++) {
+            ITCOM_vPayloadFree(pstRing->au16Payload[u32Slot & (ITCOM_RX_RING_DEPTH - 1U)]);
+        }
+
+        __atomic_store_n(&pstRing->u32Head, ITCOM_ZERO_INIT_U, __ATOMIC_RELAXED);
+        __atomic_store_n(&pstRing->u32Tail, ITCOM_ZERO_INIT_U, __ATOMIC_RELAXED);
+        ITCOM_OWNER_STORE(pstRing->u32HighWater, ITCOM_ZERO_INIT_U);
+        ITCOM_OWNER_STORE(pstRing->u32Overflows, ITCOM_ZERO_INIT_U);
+        ITCOM_OWNER_STORE(pstRing->u32Frames, ITCOM_ZERO_INIT_U);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetMsgDictionaryEntryAtIndex
+// FUNCTION NAME : ITCOM_pstRxRingGetWriteSlot
 //*****************************************************************************
 /**
- *
+*
+* @brief Returns the next free slot of a connection's receive ring for the
+*        socket reader to receive into.
+*
+* @details A full ring defers the read: the data stays in the socket buffer
+*          until the validation stage catches up. The reader reports that with
+*          ITCOM_vRxRingCountOverflow when it actually left data unread.
+*
+* @param [in] u8Connection TCP connection index
+*
+* @return TLVMessage_t* Free slot, NULL if the ring is full or the index is invalid
 */
-void ITCOM_vGetMsgDictionaryEntryAtIndex(MessageDictionary_t* pstDictionaryData, uint16_t u16MsgId) {
-    generic_ptr_t memory_operation_result = NULL;
+TLVMessage_t* ITCOM_pstRxRingGetWriteSlot(uint8_t u8Connection) {
+    RxRing_t* pstRing;
+    uint32_t u32Head;
 
-    /* Check if pstDictionaryData is NULL */
-    if (pstDictionaryData == NULL) {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgDictionaryEntryAtIndex: NULL pointer provided for pstDictionaryData");
+    if (u8Connection >= (uint8_t)enTotalTCPConnections) {
+        return NULL;
     }
-    /* Check if u16MsgId is valid */
-    else if (u16MsgId >= enTotalMessagesASI) {
-        log_message(global_log_file, LOG_WARNING, "ITCOM_vGetMsgDictionaryEntryAtIndex: Invalid u16MsgId: %u. Must be less than %u", u16MsgId, enTotalMessagesASI);
+    pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
+    u32Head = __atomic_load_n(&pstRing->u32Head, __ATOMIC_RELAXED);
 
-        /* Initialize the structure with zeros to indicate an invalid entry */
-        memory_operation_result = memset(pstDictionaryData, 0, sizeof(MessageDictionary_t));
-        if ((memory_operation_result == NULL) || (memory_operation_result != pstDictionaryData)) {
-            log_message(global_log_file, LOG_ERROR, "Memory initialization failed");
-        }
-    }
-    /* Valid case: retrieve the dictionary entry */
-    else {
-        *pstDictionaryData = stMsgDictionary[u16MsgId];
+    if ((u32Head - __atomic_load_n(&pstRing->u32Tail, __ATOMIC_ACQUIRE)) >= ITCOM_RX_RING_DEPTH) {
+        return NULL;
     }
+    return &pstRing->astFrames[u32Head & (ITCOM_RX_RING_DEPTH - 1U)];
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_s16CheckAssociatedLength
+// FUNCTION NAME : ITCOM_vRxRingCountOverflow
 //*****************************************************************************
 /**
-* @brief Checks if the given length is valid for the specified message type.
 *
-* @param [in] u16MsgType The message type (e.g., 0xFF11 for Action Request).
-* @param [in] u8Length The length to check (e.g., 16, 32).
+* @brief Counts one overflow of a connection's receive ring: the ring was
+*        full while received data was still waiting to be read.
 *
-* @global {r; shared_mutex; shared mutex for dictionary access},
-*         {r; shared_cond; shared condition variable for thread signaling}
+* @param [in] u8Connection TCP connection index
 *
-* @return int8_t Returns E_OK if the length is found, otherwise returns ASSOCIATED_LENGTH_NOT_FOUND.
+* @return none
 */
-int8_t ITCOM_s8ValidateMessageTypeLength(uint16_t u16MsgType, uint8_t u8Length) {
-    const uint8_t u8DictionarySize = (uint8_t)(sizeof(stMsgTypeDictionary) / sizeof(stMsgTypeDictionary[0]));
-    int8_t s8Result = MESSAGE_TYPE_NOT_FOUND;
-
-    /* Iterate over the message type dictionary */
-    uint8_t i;
-    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
-        if (stMsgTypeDictionary[i].u16MessageTypeID == (uint16_t)u16MsgType) {
-            /* Check against the associated lengths */
-            uint8_t j;
-            for (j = ITCOM_ZERO_INIT_U; j < (uint8_t)NUM_ASSOCIATED_LENGHTS; j++) {
-                if (stMsgTypeDictionary[i].au8AssociatedLengths[j] == u8Length) {
-                    s8Result = E_OK;
-                    break;
-                }
-            }
-
-            /* If the length was not found, record an error */
-            if (s8Result != (int8_t)E_OK) {
-                enSetErrorEventStatus error_status = ITCOM_s16SetErrorEvent(EVENT_ID_FAULT_MSG_TYPE_LENGTH);
-                if (error_status != (enSetErrorEventStatus)enSuccess_EventAddedToQueue) {
-                    log_message(global_log_file, LOG_ERROR, "Failed to set error event: status %d", error_status);
-                }
-                log_message(global_log_file, LOG_WARNING, "ITCOM_s8ValidateMessageTypeLength: Length %u not found for message type 0x%04X", u8Length, u16MsgType);
-                s8Result = ASSOCIATED_LENGTH_NOT_FOUND;
-            }
-            break;
-        }
-    }
+void ITCOM_vRxRingCountOverflow(uint8_t u8Connection) {
+    RxRing_t* pstRing;
 
-    /* Log a message type not found warning if applicable */
-    if (s8Result == (int8_t)MESSAGE_TYPE_NOT_FOUND) {
-        log_message(global_log_file, LOG_WARNING, "ITCOM_s8ValidateMessageTypeLength: Message type 0x%04X not found in dictionary", u16MsgType);
+    if (u8Connection < (uint8_t)enTotalTCPConnections) {
+        pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
+        ITCOM_OWNER_STORE(pstRing->u32Overflows, pstRing->u32Overflows + 1U);
     }
-
-    return s8Result;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u16GetTrackBufferSize
+// FUNCTION NAME : ITCOM_vRxRingCommitWrite
 //*****************************************************************************
 /**
- * @brief Retrieves the size of a specified tracking buffer.
- *
- * This function returns the current count of elements in one of three tracking buffers:
- * Action Message Buffer, Calibration Data Copy Buffer, or Calibration Readback Data Buffer.
- * The specific buffer is selected using the input parameter.
- *
- * @param[in] u8SelectBuffer An 8-bit unsigned integer that specifies which buffer's size to retrieve.
- *                           Valid values are:
- *                           - enActionMsgBuffer: For the Action Message Buffer
- *                           - enCalibDataCopyBuffer: For the Calibration Data Copy Buffer
- *                           - enCalibReadbackData: For the Calibration Readback Data Buffer
- *
- * @return uint16_t The number of elements currently in the selected buffer.
- *                  Returns 0 if pstSharedMemData is NULL or if an invalid buffer type is specified.
- *
- */
-uint16_t ITCOM_u16GetTrackBufferSize(uint8_t u8SelectBuffer) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint16_t u16BufferTrackSize = ITCOM_ZERO_INIT_U;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Select the appropriate buffer */
-        switch (u8SelectBuffer) {
-            case enActionMsgBuffer:
-                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Count;
-                break;
-
-            case enCalibDataCopyBuffer:
-                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Count;
-                break;
+*
+* @brief Publishes the slot returned by ITCOM_pstRxRingGetWriteSlot to the
+*        validation stage.
+*
+* @param [in] u8Connection TCP connection index
+* @param [in] u16Received Number of bytes received into the slot and the payload block
+* @param [in] u16Payload Payload pool block holding a long value, ITCOM_POOL_HANDLE_NONE if none;
+*                        owned by the slot until ITCOM_vRxRingCommitRead
+*
+* @return none
+*/
+void ITCOM_vRxRingCommitWrite(uint8_t u8Connection, uint16_t u16Received, uint16_t u16Payload) {
+    RxRing_t* pstRing;
+    uint32_t u32Head;
+    uint32_t u32Occupancy;
 
-            case enCalibReadbackData:
-                u16BufferTrackSize = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Count;
-                break;
+    if (u8Connection >= (uint8_t)enTotalTCPConnections) {
+        return;
+    }
+    pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
+    u32Head = __atomic_load_n(&pstRing->u32Head, __ATOMIC_RELAXED);
 
-            default:
-                log_message(global_log_file, LOG_WARNING, "ITCOM_u16GetTrackBufferSize: Invalid buffer type: %u", u8SelectBuffer);
-                break;
-        }
+    pstRing->au16Received[u32Head & (ITCOM_RX_RING_DEPTH - 1U)] = u16Received;
+    pstRing->au16Payload[u32Head & (ITCOM_RX_RING_DEPTH - 1U)] = u16Payload;
+    __atomic_store_n(&pstRing->u32Head, u32Head + 1U, __ATOMIC_RELEASE);
+    FALSE_SHARING_NOTE_WRITE(pstRing->u32Head);
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetTrackBufferSize: Failed to unlock mutex: error %d", mutex_unlock_status);
-            u16BufferTrackSize = ITCOM_ZERO_INIT_U;
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u16GetTrackBufferSize: Failed to lock mutex: error %d", mutex_lock_status);
-        u16BufferTrackSize = ITCOM_ZERO_INIT_U;
+    u32Occupancy = (u32Head + 1U) - __atomic_load_n(&pstRing->u32Tail, __ATOMIC_RELAXED);
+    if (u32Occupancy > pstRing->u32HighWater) {
+        ITCOM_OWNER_STORE(pstRing->u32HighWater, u32Occupancy);
     }
-    return u16BufferTrackSize;
+    ITCOM_OWNER_STORE(pstRing->u32Frames, pstRing->u32Frames + 1U);
 }
 
-
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetElementAtIndex
+// FUNCTION NAME : ITCOM_pstRxRingGetReadSlot
 //*****************************************************************************
 /**
- * @brief Retrieves an element from the cycle sequence tracking buffer at a specified index.
- *
- * This function copies an element from the cycle sequence tracking buffer (stCycleSeqTrack) 
- * to a provided memory location. It handles the circular buffer logic and ensures thread-safe 
- * access to the shared data structure.
- *
- * @param[in] u16Indx The logical index of the element to retrieve from the buffer.
- *                    This index is relative to the current head of the circular buffer.
- * @param[out] pvElement Pointer to the memory location where the retrieved element will be copied.
- *                       The caller must ensure that this pointer is valid and points to a memory 
- *                       location large enough to hold the element.
- *
- * @par Implementation Details
- * The function performs the following steps:
- * 1. Checks for NULL pointers in the input parameters.
- * 2. Locks the mutex to ensure exclusive access to the shared data.
- * 3. Checks if the provided index is within the valid range.
- * 4. If valid, calculates the actual index in the circular buffer.
- * 5. Copies the element from the buffer to the provided memory location.
- * 6. Unlocks the mutex.
- *
- */
-
-void ITCOM_vGetCycleSeqElementAtIndex(uint16_t u16Indx, generic_ptr_t pvElement, uint8_t u8SelectBuffer) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint16_t u16ActualIndex = ITCOM_ZERO_INIT_U;
-    generic_ptr_t memory_operation_result = NULL;
-    size_t buffer_element_size = ITCOM_ZERO_INIT_U;
-    uint16_t buffer_count = ITCOM_ZERO_INIT_U;
-    uint8_t* source_buffer = NULL;
-
-    /* Check for NULL pointer */
-    if (pvElement == NULL) {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: NULL pointer provided for pvElement");
-    } else {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Select the appropriate buffer based on u8SelectBuffer */
-            switch (u8SelectBuffer) {
-                case enActionMsgBuffer:
-                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.sz_ElementSize;
-                    buffer_count = pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Count;
-                    if (u16Indx < buffer_count) {
-                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Head + u16Indx) % 
-                                         pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.u16Capacity;
-                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack.au8_Buffer[(u16ActualIndex) * (buffer_element_size)];
-                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
-                        if (memory_operation_result != pvElement) {
-                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for ActionMsgBuffer");
-                        }
-                    }
-                    break;
-
-                case enCalibDataCopyBuffer:
-                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.sz_ElementSize;
-                    buffer_count = pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Count;
-                    if (u16Indx < buffer_count) {
-                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Head + u16Indx) % 
-                                         pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.u16Capacity;
-                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCalibrationDataCopyTrack.au8_Buffer[(u16ActualIndex) * (buffer_element_size)];
-                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
-                        if (memory_operation_result != pvElement) {
-                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for CalibDataCopyBuffer");
-                        }
-                    }
-                    break;
-
-                case enCalibReadbackData:
-                    buffer_element_size = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.sz_ElementSize;
-                    buffer_count = pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Count;
-                    if (u16Indx < buffer_count) {
-                        u16ActualIndex = (pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Head + u16Indx) % 
-                                         pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.u16Capacity;
-                        source_buffer = (uint8_t*)&pstSharedMemData->stThreadsCommonData.stCalibrationReadbackTrack.au8_Buffer[(u16ActualIndex) * (buffer_element_size)];
-                        memory_operation_result = memcpy(pvElement, source_buffer, buffer_element_size);
-                        if (memory_operation_result != pvElement) {
-                            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Memory copy operation failed for CalibReadbackData");
-                        }
-                    }
-                    break;
+*
+* @brief Returns the oldest published frame of a connection's receive ring.
+*        The frame stays valid until ITCOM_vRxRingCommitRead.
+*
+* @param [in] u8Connection TCP connection index
+* @param [out] pu16Received Number of bytes received into the slot and the payload block
+* @param [out] pu16Payload Payload pool block of a long value, ITCOM_POOL_HANDLE_NONE if none.
+*                          Freed by the caller unless handed on with the message.
+*
+* @return TLVMessage_t* Oldest frame, NULL if the ring is empty or a parameter is invalid
+*/
+TLVMessage_t* ITCOM_pstRxRingGetReadSlot(uint8_t u8Connection, uint16_t* pu16Received, uint16_t* pu16Payload) {
+    RxRing_t* pstRing;
+    uint32_t u32Tail;
 
-                default:
-                    log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Invalid buffer type: %u", u8SelectBuffer);
-                    break;
-            }
+    if ((u8Connection >= (uint8_t)enTotalTCPConnections) || !VALID_PTR(pu16Received) || !VALID_PTR(pu16Payload)) {
+        return NULL;
+    }
+    pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
+    u32Tail = __atomic_load_n(&pstRing->u32Tail, __ATOMIC_RELAXED);
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Failed to unlock mutex: error %d", mutex_unlock_status);
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetCycleSeqElementAtIndex: Failed to lock mutex: error %d", mutex_lock_status);
-        }
+    if (__atomic_load_n(&pstRing->u32Head, __ATOMIC_ACQUIRE) == u32Tail) {
+        return NULL;
     }
+    *pu16Received = pstRing->au16Received[u32Tail & (ITCOM_RX_RING_DEPTH - 1U)];
+    *pu16Payload = pstRing->au16Payload[u32Tail & (ITCOM_RX_RING_DEPTH - 1U)];
+    return &pstRing->astFrames[u32Tail & (ITCOM_RX_RING_DEPTH - 1U)];
 }
 
-
-
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetCrcErrorCount
+// FUNCTION NAME : ITCOM_vRxRingCommitRead
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Releases the frame returned by ITCOM_pstRxRingGetReadSlot back to
+*        the socket reader.
+*
+* @param [in] u8Connection TCP connection index
+*
+* @return none
 */
-void ITCOM_vSetCrcErrorCount(uint8_t u8Indx, uint8_t u8Value) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_RX.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Update the CRC error counter if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx] = u8Value;
-        }
+void ITCOM_vRxRingCommitRead(uint8_t u8Connection) {
+    RxRing_t* pstRing;
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_RX.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCrcErrorCount: Failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetCrcErrorCount: Failed to lock mutex: error %d", mutex_lock_status);
+    if (u8Connection >= (uint8_t)enTotalTCPConnections) {
+        return;
+    }
+    pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
+    if (__atomic_load_n(&pstRing->u32Head, __ATOMIC_RELAXED) != __atomic_load_n(&pstRing->u32Tail, __ATOMIC_RELAXED)) {
+        __atomic_store_n(&pstRing->u32Tail, pstRing->u32Tail + 1U, __ATOMIC_RELEASE);
+        FALSE_SHARING_NOTE_WRITE(pstRing->u32Tail);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_u8GetCrcErrorCount
+// FUNCTION NAME : ITCOM_vGetRxRingStats
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Reads the occupancy and counters of a connection's receive ring.
+*
+* @param [in] u8Connection TCP connection index
+* @param [out] pstStats Counters, zeroed for an invalid index
+*
+* @return none
 */
-uint8_t ITCOM_u8GetCrcErrorCount(uint8_t u8Indx) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    uint8_t u8CrcErrorCount = ITCOM_ZERO_INIT_U;
+void ITCOM_vGetRxRingStats(uint8_t u8Connection, RxRingStats_t* pstStats) {
+    const RxRing_t* pstRing;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_RX.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Retrieve the CRC error count if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            u8CrcErrorCount = pstSharedMemData->stThread_ICM_RX.u8CrcErrorCounter[u8Indx];
-        }
+    if (!VALID_PTR(pstStats)) {
+        return;
+    }
+    (void)memset(pstStats, 0, sizeof(*pstStats));
+    if (u8Connection >= (uint8_t)enTotalTCPConnections) {
+        return;
+    }
+    pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Connection];
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_RX.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetCrcErrorCount: Failed to unlock mutex: error %d", mutex_unlock_status);
-            u8CrcErrorCount = ITCOM_ZERO_INIT_U;
+    pstStats->u32Occupancy = __atomic_load_n(&pstRing->u32Head, __ATOMIC_ACQUIRE) -
+                             __atomic_load_n(&pstRing->u32Tail, __ATOMIC_ACQUIRE);
+    pstStats->u32HighWater = ITCOM_OWNER_LOAD(pstRing->u32HighWater);
+    pstStats->u32Overflows = ITCOM_OWNER_LOAD(pstRing->u32Overflows);
+    pstStats->u32Frames = ITCOM_OWNER_LOAD(pstRing->u32Frames);
+}
+
+/*** Private Functions ***/
+
+static uint8_t itcom_u8CompareMsgIdAndSequence(const_generic_ptr_t a, const_generic_ptr_t b) {
+    const stMsgIntegrityData* const element = (const stMsgIntegrityData* const)a;
+    const stMsgIntegrityData* const criteria = (const stMsgIntegrityData* const)b;
+    uint8_t result = ITCOM_ONE_INIT_U;
+
+    if ((bool)(element != (stMsgIntegrityData*)NULL) && (bool)(criteria != (stMsgIntegrityData*)NULL)) {
+        if (((uint16_t)element->stMsgPairData.u16MsgId == (uint16_t)criteria->stMsgPairData.u16MsgId) && 
+            ((uint16_t)element->stMsgPairData.u16SequenceNum == (uint16_t)criteria->stMsgPairData.u16SequenceNum) && 
+            ((uint8_t)element->u8ClearCondition == (uint8_t)criteria->u8ClearCondition)) {
+            result = ITCOM_ZERO_INIT_U;
         }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetCrcErrorCount: Failed to lock mutex: error %d", mutex_lock_status);
-        u8CrcErrorCount = ITCOM_ZERO_INIT_U;
     }
-    return u8CrcErrorCount;
+    return result;
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetRollingCountError
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vSetRollingCountError(uint8_t u8Indx, uint8_t u8Value) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+static uint8_t itcom_u8CompareCalibData(const_generic_ptr_t a, const_generic_ptr_t b) {
+    const stProcessMsgData* const element = (const stProcessMsgData* const)a;
+    const stProcessMsgData* const criteria = (const stProcessMsgData* const)b;
+    uint8_t result = ITCOM_ONE_INIT_U;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_RX.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Update the rolling count error if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx] = u8Value;
+    if ((element != (stProcessMsgData*)NULL) && (criteria != (stProcessMsgData*)NULL)) {
+        if (((uint16_t)element->stMsgPairData.u16MsgId == (uint16_t)criteria->stMsgPairData.u16MsgId) && 
+            ((uint16_t)element->stMsgPairData.u16SequenceNum == (uint16_t)criteria->stMsgPairData.u16SequenceNum)) {
+            result = ITCOM_ZERO_INIT_U;
         }
+    }
+    return result;
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_RX.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetRollingCountError: Failed to unlock mutex: error %d", mutex_unlock_status);
+static void itcom_vRemoveActionRequestTiming(uint16_t u16MsgId, uint16_t u16SequenceNum) {
+    uint8_t actionRequestCount = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
+    uint8_t i;
+    for (i = ITCOM_ZERO_INIT_U; i < actionRequestCount; i++) {
+        if (pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16MsgId == u16MsgId &&
+            pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16SequenceNum == u16SequenceNum) {
+            // Remove this entry by shifting the remaining entries
+            uint8_t j;
+            for (j = i; j < actionRequestCount - 1; j++) {
+                pstSharedMemData->stThreadsCommonData.astActionRequestTiming[j] = pstSharedMemData->stThreadsCommonData.astActionRequestTiming[j+1];
+                FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.astActionRequestTiming[j]);
+            }
+            pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount--;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount);
+            break;
         }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetRollingCountError: Failed to lock mutex: error %d", mutex_lock_status);
     }
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_u8GetRollingCountError
-//*****************************************************************************
-/**
- *
- *
-*/
-uint8_t ITCOM_u8GetRollingCountError(uint8_t u8Indx) {
+void ITCOM_vSetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
-    uint8_t u8RollingCounterError = ITCOM_ZERO_INIT_U;
+    int32_t time_status;
+    ActionRequestTiming_t stTiming;
+
+    stTiming.u16MsgId = u16MsgId;
+    stTiming.u16SequenceNum = u16SequenceNum;
+
+    /* Attempt to get the start time */
+    time_status = UT_s32GetMonotonicTime(&stTiming.start_time);
+    if (time_status != (int32_t)ITCOM_ZERO_INIT_U) {
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to get time: error %d", time_status);
+        return;
+    }
 
     /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_RX.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Retrieve the rolling count error if the index is valid */
-        if (u8Indx < enTotalMessagesASI) {
-            u8RollingCounterError = pstSharedMemData->stThread_ICM_RX.u8RollingCounterError[u8Indx];
-        }
+        (void)itcom_u8StoreActionRequestTimingLocked(&stTiming);
 
         /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_RX.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetRollingCountError: Failed to unlock mutex: error %d", mutex_unlock_status);
-            u8RollingCounterError = ITCOM_ZERO_INIT_U;
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_u8GetRollingCountError: Failed to lock mutex: error %d", mutex_lock_status);
-        u8RollingCounterError = ITCOM_ZERO_INIT_U;
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to lock mutex: error %d", mutex_lock_status);
     }
-    return u8RollingCounterError;
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetMsgRateLimiter
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vSetMsgRateLimiter(RateLimiter_t* pstRateLimiter) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+/* Caller must hold stThreadsCommonData.mutex */
+static uint8_t itcom_u8StoreActionRequestTimingLocked(const ActionRequestTiming_t* pstTiming) {
+    generic_ptr_t move_result = NULL;
+    uint8_t operation_status = ITCOM_OP_FAILURE;
+    uint8_t index = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
+    uint8_t i;
 
-    if(VALID_PTR(pstRateLimiter)) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_TX.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Update the rate limiter parameters */
-            pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16AllowedMessages = pstRateLimiter->u16AllowedMessages;
-            pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16TimeWindowMs = pstRateLimiter->u16TimeWindowMs;
-            pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16MessageCount = pstRateLimiter->u16MessageCount;
-            pstSharedMemData->stThread_ICM_TX.stRateLimiter.stStartTime = pstRateLimiter->stStartTime;
+    /* A retransmitted request keeps the start time of its first arrival */
+    for (i = ITCOM_ZERO_INIT_U; i < index; i++) {
+        if ((pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16MsgId == pstTiming->u16MsgId) &&
+            (pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16SequenceNum == pstTiming->u16SequenceNum)) {
+            return ITCOM_OP_SUCCESS;
+        }
+    }
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_TX.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgRateLimiter: Failed to unlock mutex: error %d", mutex_unlock_status);
-            }
+    /* Check if the timing count exceeds the limit */
+    if (index >= (uint8_t)MAX_PENDING_ACTION_REQUESTS) {
+        move_result = memmove(&pstSharedMemData->stThreadsCommonData.astActionRequestTiming[0],
+                              &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[1],
+                              sizeof(ActionRequestTiming_t) * (MAX_PENDING_ACTION_REQUESTS - 1));
+
+        /* Check if the memmove operation was successful */
+        if ((move_result != NULL) && (move_result == &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[0])) {
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.astActionRequestTiming);
+            index = MAX_PENDING_ACTION_REQUESTS - 1;
+            operation_status = ITCOM_OP_SUCCESS;
         } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgRateLimiter: Failed to lock mutex: error %d", mutex_lock_status);
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Memory move operation failed");
         }
+    } else {
+        pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount++;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount);
+        operation_status = ITCOM_OP_SUCCESS;
     }
-    else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetMsgRateLimiter: Invalid input parameter pointer pstRateLimiter");
+
+    /* Proceed if memory operation or index update was successful */
+    if (operation_status == (uint8_t)ITCOM_OP_SUCCESS) {
+        pstSharedMemData->stThreadsCommonData.astActionRequestTiming[index] = *pstTiming;
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.astActionRequestTiming[index]);
     }
-}
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetMsgRateLimiter
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vGetMsgRateLimiter(RateLimiter_t* pstRateLimiter) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+    return operation_status;
+}
 
-    if(VALID_PTR(pstRateLimiter)) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_ICM_TX.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Retrieve the rate limiter parameters */
-            pstRateLimiter->u16AllowedMessages = pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16AllowedMessages;
-            pstRateLimiter->u16TimeWindowMs = pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16TimeWindowMs;
-            pstRateLimiter->u16MessageCount = pstSharedMemData->stThread_ICM_TX.stRateLimiter.u16MessageCount;
-            pstRateLimiter->stStartTime = pstSharedMemData->stThread_ICM_TX.stRateLimiter.stStartTime;
+static struct timespec* ITCOM_pstGetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum) {
+    struct timespec* pstStartTime = NULL;
+    uint8_t maxTimingCount = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_ICM_TX.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgRateLimiter: Failed to unlock mutex: error %d", mutex_unlock_status);
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgRateLimiter: Failed to lock mutex: error %d", mutex_lock_status);
+    /* Iterate through the action request timing records */
+    uint8_t i;
+    for (i = ITCOM_ZERO_INIT_U; i < maxTimingCount; i++) {
+        if ((pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16MsgId == u16MsgId) &&
+            (pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16SequenceNum == u16SequenceNum)) {
+            pstStartTime = &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].start_time;
+            break;
         }
     }
-    else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetMsgRateLimiter: Invalid input parameter pointer pstRateLimiter");
-    }
+
+    return pstStartTime;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetErrorProcessingFlag
+// FUNCTION NAME : ITCOM_vRecordChildRestartTime
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Records how long a child restart took, from the parent's restart
+*        request until the child threads were running again.
+*
+* @param [in] u32RestartTime_ms Measured restart time in milliseconds
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return none
 */
-void ITCOM_vSetErrorProcessingFlag(int16_t s16Value) {
+void ITCOM_vRecordChildRestartTime(uint32_t u32RestartTime_ms) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThread_FM.mutex);
+    mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
     if (mutex_lock_status == E_OK) {
-        /* Set the error processing flag */
-        pstSharedMemData->stThread_FM.processing = s16Value;
+        /* Atomic stores: the parent reads the metrics without the lock (ITCOM_vGetSloMetrics) */
+        (void)__atomic_fetch_add(&pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32ChildRestartCount, ITCOM_ONE_INIT_U, __ATOMIC_RELAXED);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32ChildRestartCount);
+        __atomic_store_n(&pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32LastRestartTime_ms, u32RestartTime_ms, __ATOMIC_RELAXED);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32LastRestartTime_ms);
+        if (u32RestartTime_ms > pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32MaxRestartTime_ms) {
+            __atomic_store_n(&pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32MaxRestartTime_ms, u32RestartTime_ms, __ATOMIC_RELAXED);
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.pstSloMetrics->u32MaxRestartTime_ms);
+        }
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThread_FM.mutex);
+        mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
         if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetErrorProcessingFlag: Failed to unlock mutex: error %d", mutex_unlock_status);
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordChildRestartTime failed to unlock mutex: error %d", mutex_unlock_status);
         }
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetErrorProcessingFlag: Failed to lock mutex: error %d", mutex_lock_status);
+        log_message(global_log_file, LOG_ERROR, "ITCOM_vRecordChildRestartTime failed to lock mutex: error %d", mutex_lock_status);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetErrorProcessingFlag
+// FUNCTION NAME : ITCOM_vGetSloMetrics
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Copies a snapshot of the SLO metrics without taking a lock.
+*
+* @details Called by the parent, which must never block on a mutex of the
+*          child: the child may die holding it or re-initialise it while it
+*          restarts. Every field is written with an atomic store under the
+*          common mutex and read here with an atomic load, so each field is
+*          whole; fields updated between two loads may come from different
+*          updates, which the periodic evaluation tolerates.
+*
+* @param [out] pstSloMetrics Destination of the snapshot
+*
+* @global {r; lock-free; atomic loads, the writers hold shared_mutex}
+*
+* @return none
 */
-int16_t ITCOM_s16GetProcessingFlag(void)
-{
-    mutex_status_t mutex_lock_status = 0;
-    mutex_status_t mutex_unlock_status = 0;
-    int16_t s16ErrorProcessing = (int16_t)ITCOM_NEG_ONE_INIT;
-    bool is_operation_valid = TRUE;
-    
-    /* Validate shared memory */
-    if (NULL == pstSharedMemData)
-    {
-        log_message(global_log_file, LOG_ERROR, 
-                   "ITCOM_s16GetProcessingFlag: Invalid shared memory pointer");
-        is_operation_valid = FALSE;
-    }
-    
-    if (TRUE == is_operation_valid)
-    {
-        /* Try to acquire mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&(pstSharedMemData->stThread_FM.mutex));
-        if (E_OK == mutex_lock_status)
-        {
-            /* Critical section - keep it minimal */
-            s16ErrorProcessing = pstSharedMemData->stThread_FM.processing;
-            
-            /* Release mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&(pstSharedMemData->stThread_FM.mutex));
-            if (E_OK != mutex_unlock_status)
-            {
-                log_message(global_log_file, LOG_ERROR, 
-                           "ITCOM_s16GetProcessingFlag: Failed to unlock mutex: error %d", 
-                           (int)mutex_unlock_status);
-                is_operation_valid = FALSE;
-            }
+void ITCOM_vGetSloMetrics(SloMetrics_t* pstSloMetrics) {
+    const SloMetrics_t* pstSlo = pstSharedMemData->stThreadsCommonData.pstSloMetrics;
+    uint32_t u32Idx;
+
+    if (pstSloMetrics != NULL) {
+        for (u32Idx = ITCOM_ZERO_INIT_U; u32Idx < SLO_LATENCY_HIST_BUCKETS; u32Idx++) {
+            pstSloMetrics->au32ApprovalLatencyHist[u32Idx] = __atomic_load_n(&pstSlo->au32ApprovalLatencyHist[u32Idx], __ATOMIC_RELAXED);
         }
-        else
-        {
-            log_message(global_log_file, LOG_ERROR, 
-                       "ITCOM_s16GetProcessingFlag: Failed to lock mutex: error %d", 
-                       (int)mutex_lock_status);
-            is_operation_valid = FALSE;
+        pstSloMetrics->u32ApprovalCount = __atomic_load_n(&pstSlo->u32ApprovalCount, __ATOMIC_RELAXED);
+        pstSloMetrics->u32ApprovalLatencyMax_ms = __atomic_load_n(&pstSlo->u32ApprovalLatencyMax_ms, __ATOMIC_RELAXED);
+        for (u32Idx = ITCOM_ZERO_INIT_U; u32Idx < SLO_TOTAL_QUEUES; u32Idx++) {
+            pstSloMetrics->au32QueueOverflowCount[u32Idx] = __atomic_load_n(&pstSlo->au32QueueOverflowCount[u32Idx], __ATOMIC_RELAXED);
         }
+        pstSloMetrics->u32ChildRestartCount = __atomic_load_n(&pstSlo->u32ChildRestartCount, __ATOMIC_RELAXED);
+        pstSloMetrics->u32LastRestartTime_ms = __atomic_load_n(&pstSlo->u32LastRestartTime_ms, __ATOMIC_RELAXED);
+        pstSloMetrics->u32MaxRestartTime_ms = __atomic_load_n(&pstSlo->u32MaxRestartTime_ms, __ATOMIC_RELAXED);
     }
-    
-    /* Reset to error value if any operation failed */
-    if (FALSE == is_operation_valid)
-    {
-        s16ErrorProcessing = (int16_t)ITCOM_NEG_ONE_INIT;
-    }
-    
-    return s16ErrorProcessing;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetEventQueueIndx
+// FUNCTION NAME : ITCOM_vRequestThreadTuning
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Stores a new set of thread scheduling parameters and bumps the
+*        request generation. The child validates it before any thread uses it.
+*
+* @details Written by the parent, the only writer of astRequested, without a
+*          lock: u32RequestSeq is odd while the set is copied, and the child
+*          drops a copy that overlapped a write (ITCOM_u32GetThreadTuningRequest).
+*          A child dying with a lock held can therefore not stall the parent.
+*
+* @param [in] pastTuning ITCOM_TUNING_THREADS entries indexed by thread label
+*
+* @global {w; lock-free; sequence counter u32RequestSeq, single writer}
+*
+* @return none
 */
-void ITCOM_vSetEventQueueIndx(uint8_t u8IndxValue) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Set the event queue index */
-        pstSharedMemData->stThreadsCommonData.Event_Queue_Index = u8IndxValue;
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueIndx: Failed to unlock mutex: error %d", mutex_unlock_status);
+void ITCOM_vRequestThreadTuning(const ThreadTuning_t* pastTuning) {
+    ThreadTuningBlock_t* pstBlock = &pstSharedMemData->stThreadTuning;
+    uint32_t u32Generation;
+    uint32_t u32Seq;
+
+    if (pastTuning != NULL) {
+        u32Seq = itcom_u32SeqWriteBegin(&pstBlock->u32RequestSeq);
+        (void)memcpy(pstBlock->astRequested, pastTuning, sizeof(pstBlock->astRequested));
+        u32Generation = __atomic_load_n(&pstBlock->u32Requested, __ATOMIC_RELAXED) + 1U;
+        if (u32Generation == ITCOM_TUNING_NONE) {
+            u32Generation++;
         }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueIndx: Failed to lock mutex: error %d", mutex_lock_status);
+        __atomic_store_n(&pstBlock->u32Requested, u32Generation, __ATOMIC_RELEASE);
+        itcom_vSeqWriteEnd(&pstBlock->u32RequestSeq, u32Seq);
+        FALSE_SHARING_NOTE_WRITE(pstBlock->astRequested);
+        FALSE_SHARING_NOTE_WRITE(pstBlock->u32Requested);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetErrorProcessingFlag
+// FUNCTION NAME : ITCOM_u32GetThreadTuningPending
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Lock-free check for a requested thread tuning that was neither
+*        applied nor rejected yet.
+*
+* @return uint32_t Pending generation, ITCOM_TUNING_NONE if nothing is pending
 */
-int16_t ITCOM_s16GetEventQueueIndx(void) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    int16_t s16EventQueueIndx = QUEUE_INDEX_INVALID;
+uint32_t ITCOM_u32GetThreadTuningPending(void) {
+    const ThreadTuningBlock_t* pstBlock = &pstSharedMemData->stThreadTuning;
+    uint32_t u32Requested = __atomic_load_n(&pstBlock->u32Requested, __ATOMIC_ACQUIRE);
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Retrieve the event queue index */
-        s16EventQueueIndx = (int16_t)pstSharedMemData->stThreadsCommonData.Event_Queue_Index;
+    if ((u32Requested == __atomic_load_n(&pstBlock->u32Applied, __ATOMIC_RELAXED)) ||
+        (u32Requested == __atomic_load_n(&pstBlock->u32Rejected, __ATOMIC_RELAXED))) {
+        u32Requested = ITCOM_TUNING_NONE;
+    }
+    return u32Requested;
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetEventQueueIndx: Failed to unlock mutex: error %d", mutex_unlock_status);
-            s16EventQueueIndx = QUEUE_INDEX_INVALID;  /* Set to error value if unlocking fails */
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u32GetThreadTuningRequest
+//*****************************************************************************
+/**
+*
+* @brief Copies the requested thread scheduling parameters.
+*
+* @param [out] pastTuning ITCOM_TUNING_THREADS entries indexed by thread label
+*
+* @global {r; lock-free; sequence counter u32RequestSeq}
+*
+* @return uint32_t Generation of the copied set, ITCOM_TUNING_NONE if the copy
+*         overlapped a write of the parent (the request stays pending)
+*/
+uint32_t ITCOM_u32GetThreadTuningRequest(ThreadTuning_t* pastTuning) {
+    const ThreadTuningBlock_t* pstBlock = &pstSharedMemData->stThreadTuning;
+    uint32_t u32Generation = ITCOM_TUNING_NONE;
+    uint32_t u32Seq;
+
+    if (pastTuning != NULL) {
+        u32Seq = __atomic_load_n(&pstBlock->u32RequestSeq, __ATOMIC_ACQUIRE);
+        (void)memcpy(pastTuning, pstBlock->astRequested, sizeof(pstBlock->astRequested));
+        u32Generation = __atomic_load_n(&pstBlock->u32Requested, __ATOMIC_RELAXED);
+        if (!itcom_bSeqReadValid(&pstBlock->u32RequestSeq, u32Seq)) {
+            u32Generation = ITCOM_TUNING_NONE;
         }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_s16GetEventQueueIndx: Failed to lock mutex: error %d", mutex_lock_status);
-        s16EventQueueIndx = QUEUE_INDEX_INVALID;
     }
-    return s16EventQueueIndx;
+
+    return u32Generation;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetEventQueueId
+// FUNCTION NAME : ITCOM_vPublishThreadTuning
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Makes a validated set of thread scheduling parameters active. The
+*        threads pick it up at their next cycle boundary.
+*
+* @details Only the child publishes, under the common mutex; u32ActiveSeq
+*          lets the parent copy the set without that mutex
+*          (ITCOM_bGetActiveThreadTuningSet).
+*
+* @param [in] u32Generation Generation of the set
+* @param [in] pastTuning ITCOM_TUNING_THREADS entries indexed by thread label
+* @param [in] u32UtilizationPct Highest per-CPU utilization of the set
+*
+* @global {r/w; shared_mutex; shared mutex for thread synchronization}
+*
+* @return none
 */
-void ITCOM_vSetEventQueueId(uint8_t u8EventQueue, uint8_t u8Indx) {
+void ITCOM_vPublishThreadTuning(uint32_t u32Generation, const ThreadTuning_t* pastTuning, uint32_t u32UtilizationPct) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
+    ThreadTuningBlock_t* pstBlock = &pstSharedMemData->stThreadTuning;
+    uint32_t u32Seq;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Set the event queue ID at the specified index */
-        pstSharedMemData->stThreadsCommonData.Event_Queue[u8Indx] = u8EventQueue;
-
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueId: Failed to unlock mutex: error %d", mutex_unlock_status);
+    if (pastTuning != NULL) {
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            u32Seq = itcom_u32SeqWriteBegin(&pstBlock->u32ActiveSeq);
+            (void)memcpy(pstBlock->astActive, pastTuning, sizeof(pstBlock->astActive));
+            itcom_vSeqWriteEnd(&pstBlock->u32ActiveSeq, u32Seq);
+            pstBlock->u32UtilizationPct = u32UtilizationPct;
+            __atomic_store_n(&pstBlock->u32Applied, u32Generation, __ATOMIC_RELEASE);
+            FALSE_SHARING_NOTE_WRITE(pstBlock->astActive);
+            FALSE_SHARING_NOTE_WRITE(pstBlock->u32Applied);
+
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vPublishThreadTuning failed to unlock mutex: error %d", mutex_unlock_status);
+            }
+        } else {
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vPublishThreadTuning failed to lock mutex: error %d", mutex_lock_status);
         }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetEventQueueId: Failed to lock mutex: error %d", mutex_lock_status);
     }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetEventQueueId
+// FUNCTION NAME : ITCOM_vRejectThreadTuning
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Records a requested generation that failed validation, so that it
+*        is not validated again.
+*
+* @param [in] u32Generation Rejected generation
+*
+* @return none
 */
-void ITCOM_vGetEventQueueId(uint8_t* pu8EventQueue, uint8_t u8Indx) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+void ITCOM_vRejectThreadTuning(uint32_t u32Generation) {
+    __atomic_store_n(&pstSharedMemData->stThreadTuning.u32Rejected, u32Generation, __ATOMIC_RELAXED);
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadTuning.u32Rejected);
+}
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Retrieve the event queue ID at the specified index */
-        *pu8EventQueue = pstSharedMemData->stThreadsCommonData.Event_Queue[u8Indx];
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u32GetThreadTuningApplied
+//*****************************************************************************
+/**
+*
+* @brief Returns the generation of the active thread tuning. Lock-free, read
+*        by every thread once per cycle.
+*
+* @return uint32_t Active generation, ITCOM_TUNING_NONE if never tuned
+*/
+uint32_t ITCOM_u32GetThreadTuningApplied(void) {
+    return __atomic_load_n(&pstSharedMemData->stThreadTuning.u32Applied, __ATOMIC_ACQUIRE);
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetEventQueueId: Failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetEventQueueId: Failed to lock mutex: error %d", mutex_lock_status);
-    }
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_u32GetThreadTuningRejected
+//*****************************************************************************
+/**
+*
+* @brief Returns the last requested generation that failed validation.
+*
+* @return uint32_t Rejected generation, ITCOM_TUNING_NONE if none
+*/
+uint32_t ITCOM_u32GetThreadTuningRejected(void) {
+    return __atomic_load_n(&pstSharedMemData->stThreadTuning.u32Rejected, __ATOMIC_RELAXED);
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vRemoveProcessedEvent
+// FUNCTION NAME : ITCOM_vGetActiveThreadTuning
 //*****************************************************************************
 /**
- * @brief Removes the first event from the event queue after processing.
- *
- * This function is responsible for removing the first event from the shared
- * event queue after it has been processed. It ensures thread-safe operation
- * by using mutex locks when accessing the shared data.
- *
- * The function performs the following operations:
- * 1. Locks the mutex for the shared event queue.
- * 2. Checks if there are any events in the queue.
- * 3. If events exist, it removes the first event by shifting all subsequent
- *    events one position forward in the queue.
- * 4. Decrements the event queue index.
- * 5. Unlocks the mutex.
- *
- * @note This function assumes the existence of a global shared data structure
- *       (shared_data) containing the event queue and associated mutex.
- *
- * @warning This function does not return any status about whether an event
- *          was actually removed. Callers should ensure that an event is
- *          available for removal before calling this function.
- *
- */
-void ITCOM_vRemoveProcessedEvent(void) {
+*
+* @brief Copies the active scheduling parameters of one thread.
+*
+* @param [in] u8Thread Thread label
+* @param [out] pstTuning Destination of the copy
+*
+* @global {r; shared_mutex; shared mutex for thread synchronization}
+*
+* @return none
+*/
+void ITCOM_vGetActiveThreadTuning(uint8_t u8Thread, ThreadTuning_t* pstTuning) {
     mutex_status_t mutex_lock_status;
     mutex_status_t mutex_unlock_status;
-    generic_ptr_t move_result = NULL;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Check if there is an event to remove */
-        if (pstSharedMemData->stThreadsCommonData.Event_Queue_Index > 0) {
-            move_result = memmove(pstSharedMemData->stThreadsCommonData.Event_Queue,
-                                  pstSharedMemData->stThreadsCommonData.Event_Queue + 1,
-                                  (pstSharedMemData->stThreadsCommonData.Event_Queue_Index - 1) * sizeof(unsigned char));
+    if ((pstTuning != NULL) && (u8Thread < ITCOM_TUNING_THREADS)) {
+        mutex_lock_status = (mutex_status_t)LOCK_OWNER_MUTEX_LOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+        if (mutex_lock_status == E_OK) {
+            *pstTuning = pstSharedMemData->stThreadTuning.astActive[u8Thread];
 
-            /* Check for success of memmove operation */
-            if ((move_result != NULL) && (move_result == pstSharedMemData->stThreadsCommonData.Event_Queue)) {
-                pstSharedMemData->stThreadsCommonData.Event_Queue_Index--;
-            } else {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Memory move operation failed");
+            mutex_unlock_status = (mutex_status_t)LOCK_OWNER_MUTEX_UNLOCK(&pstSharedMemData->stThreadsCommonData.mutex);
+            if (mutex_unlock_status != E_OK) {
+                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetActiveThreadTuning failed to unlock mutex: error %d", mutex_unlock_status);
             }
         } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: No events to remove");
+            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetActiveThreadTuning failed to lock mutex: error %d", mutex_lock_status);
         }
+    }
+}
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vRemoveProcessedEvent: Failed to lock mutex: error %d", mutex_lock_status);
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bGetActiveThreadTuningSet
+//*****************************************************************************
+/**
+*
+* @brief Copies the active scheduling parameters of all threads without a
+*        lock, for the parent.
+*
+* @details Retries a copy that overlapped a publication of the child up to
+*          ITCOM_TUNING_SEQ_RETRIES times.
+*
+* @param [out] pastTuning ITCOM_TUNING_THREADS entries indexed by thread label
+*
+* @global {r; lock-free; sequence counter u32ActiveSeq}
+*
+* @return bool true for a copy of one publication, false if none was stable
+*/
+bool ITCOM_bGetActiveThreadTuningSet(ThreadTuning_t* pastTuning) {
+    const ThreadTuningBlock_t* pstBlock = &pstSharedMemData->stThreadTuning;
+    bool bStable = false;
+    uint32_t u32Retry;
+    uint32_t u32Seq;
+
+    for (u32Retry = ITCOM_ZERO_INIT_U; (pastTuning != NULL) && !bStable && (u32Retry < ITCOM_TUNING_SEQ_RETRIES); u32Retry++) {
+        u32Seq = __atomic_load_n(&pstBlock->u32ActiveSeq, __ATOMIC_ACQUIRE);
+        (void)memcpy(pastTuning, pstBlock->astActive, sizeof(pstBlock->astActive));
+        bStable = itcom_bSeqReadValid(&pstBlock->u32ActiveSeq, u32Seq);
     }
+
+    return bStable;
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vSemaphoreTryWait
+// FUNCTION NAME : ITCOM_vSetThreadStackUsage
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Publishes the stack size and high-water mark of one thread. Only
+*        the child monitor writes the block, readers never block it.
+*
+* @param [in] u8Thread Thread label
+* @param [in] u32Size Stack bytes, guard page excluded
+* @param [in] u32HighWaterMark Most stack bytes used so far
+*
+* @return none
 */
-int16_t ITCOM_vSemaphoreTryWait(void) {
-    int16_t s16SemTryWait = -1;
-    s16SemTryWait = sem_trywait(&pstSharedMemData->stThread_FM.sem);
-    return s16SemTryWait;
+void ITCOM_vSetThreadStackUsage(uint8_t u8Thread, uint32_t u32Size, uint32_t u32HighWaterMark) {
+    if (u8Thread < ITCOM_STACK_THREADS) {
+        ThreadStackUsage_t* pstUsage = &pstSharedMemData->astThreadStack[u8Thread];
+        __atomic_store_n(&pstUsage->u32Size, u32Size, __ATOMIC_RELAXED);
+        __atomic_store_n(&pstUsage->u32HighWaterMark, u32HighWaterMark, __ATOMIC_RELAXED);
+        FALSE_SHARING_NOTE_WRITE(*pstUsage);
+    }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vNotification_SM
+// FUNCTION NAME : ITCOM_vGetThreadStackUsage
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Copies the published stack usage of one thread.
+*
+* @param [in] u8Thread Thread label
+* @param [out] pstUsage Destination of the copy
+*
+* @return none
 */
-void ITCOM_vNotification_SM(void)
-{
-    log_message(global_log_file, LOG_INFO, "SM_Notification called");
-    ITCOM_vSetCriticalFault();
+void ITCOM_vGetThreadStackUsage(uint8_t u8Thread, ThreadStackUsage_t* pstUsage) {
+    if ((pstUsage != NULL) && (u8Thread < ITCOM_STACK_THREADS)) {
+        const ThreadStackUsage_t* pstSource = &pstSharedMemData->astThreadStack[u8Thread];
+        pstUsage->u32Size = __atomic_load_n(&pstSource->u32Size, __ATOMIC_RELAXED);
+        pstUsage->u32HighWaterMark = __atomic_load_n(&pstSource->u32HighWaterMark, __ATOMIC_RELAXED);
+    }
 }
 
 //*****************************************************************************
-// FUNCTION NAME : ITCOM_vExtSysNotification
+// FUNCTION NAME : ITCOM_u32GetEventStoreCapacity
 //*****************************************************************************
 /**
- *
- *
+*
+* @brief Number of event IDs the event store region holds.
+*
+* @details Fixed for the life of the mapping, read without the mutex.
+*
+* @return Event store capacity
 */
-void ITCOM_vExtSysNotification(void)
-{
-    log_message(global_log_file, LOG_INFO, "External_System_Notification called");
-    (void)ITCOM_s8LogNotificationMessage(0U, 0U, 0U, (uint8_t)enStatusNotificationASI);
+uint32_t ITCOM_u32GetEventStoreCapacity(void) {
+    return itcom_stRegionLayout.astRegions[enRegionEventStore].u32Capacity;
+}
+
+/* Reserves the next slot of a transaction; the result stays "failed" until committed */
+static ItcomTxnOp_t* itcom_pstTxnStage(ItcomTransaction_t* pstTxn, ItcomTxnOpType_t enType, int8_t* ps8Op) {
+    ItcomTxnOp_t* pstOp = NULL;
+
+    if (VALID_PTR(pstTxn) && (pstTxn->u8OpCount < (uint8_t)ITCOM_TXN_MAX_OPS)) {
+        *ps8Op = (int8_t)pstTxn->u8OpCount;
+        pstOp = &pstTxn->astOps[pstTxn->u8OpCount];
+        pstTxn->u8OpCount++;
+        pstOp->enType = enType;
+        pstOp->u8Arg = ITCOM_ZERO_INIT_U;
+        pstOp->s16Indx = ITCOM_ZERO_INIT_U;
+        pstOp->s8Result = (enType == enTxnSaveMsgData) ? (int8_t)ACTION_REQUEST_NOT_SAVED : E_NOT_OK;
+    } else {
+        log_message(global_log_file, LOG_ERROR, "itcom_pstTxnStage: transaction full or invalid, update %d dropped", (int)enType);
+    }
+    return pstOp;
+}
+
+/*
+ * Hands out *pu16Counter and advances it with one atomic fetch-add. The raw
+ * counter wraps at 65536; the value UINT16_MAX_VALUE is skipped so that the
+ * numbers handed out wrap modulo UINT16_MAX_VALUE like (n + 1) % UINT16_MAX_VALUE.
+ */
+static uint16_t itcom_u16AllocWrapped(uint16_t* pu16Counter) {
+    uint16_t u16Value = __atomic_fetch_add(pu16Counter, 1U, __ATOMIC_RELAXED);
+
+    if (u16Value == (uint16_t)UINT16_MAX_VALUE) {
+        u16Value = __atomic_fetch_add(pu16Counter, 1U, __ATOMIC_RELAXED);
+    }
+    return u16Value;
+}
+
+/*
+ * Undoes itcom_u16AllocWrapped of u16Value if nothing was allocated after it.
+ * The raw counter after that allocation is u16Value + 1 (65535 when u16Value
+ * is 65534, skipped by the next allocation).
+ */
+static bool itcom_bReleaseWrapped(uint16_t* pu16Counter, uint16_t u16Value) {
+    uint16_t u16Expected = (uint16_t)(u16Value + 1U);
+
+    return __atomic_compare_exchange_n(pu16Counter, &u16Expected, u16Value, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+/* Next value itcom_u16AllocWrapped will hand out */
+static uint16_t itcom_u16PeekWrapped(const uint16_t* pu16Counter) {
+    uint16_t u16Value = __atomic_load_n(pu16Counter, __ATOMIC_RELAXED);
+
+    return (u16Value == (uint16_t)UINT16_MAX_VALUE) ? (uint16_t)ITCOM_ZERO_INIT_U : u16Value;
+}
+
+/*
+ * Fills itcom_astTypeLengthIndex from stMsgTypeDictionary (linear probing).
+ * Zero entries of au8AssociatedLengths are padding, not a legal length.
+ */
+static void itcom_vBuildTypeLengthIndex(void) {
+    const uint8_t u8DictionarySize = (uint8_t)(sizeof(stMsgTypeDictionary) / sizeof(stMsgTypeDictionary[0]));
+    uint8_t i;
+    uint8_t j;
+
+    (void)memset(itcom_astTypeLengthIndex, 0, sizeof(itcom_astTypeLengthIndex));
+    for (i = ITCOM_ZERO_INIT_U; i < u8DictionarySize; i++) {
+        uint32_t u32Slot = ITCOM_TYPE_INDEX_HASH(stMsgTypeDictionary[i].u16MessageTypeID);
+        ItcomTypeLengthEntry_t* pstEntry = &itcom_astTypeLengthIndex[u32Slot];
+
+        while ((pstEntry->u8Used != ITCOM_ZERO_INIT_U) &&
+               (pstEntry->u16MessageTypeID != stMsgTypeDictionary[i].u16MessageTypeID)) {
+            u32Slot = (u32Slot + ITCOM_ONE_INIT_U) & (ITCOM_TYPE_INDEX_SIZE - 1U);
+            pstEntry = &itcom_astTypeLengthIndex[u32Slot];
+        }
+        pstEntry->u16MessageTypeID = stMsgTypeDictionary[i].u16MessageTypeID;
+        pstEntry->u8Used = ITCOM_ONE_INIT_U;
+        pstEntry->u16MaxLength = stMsgTypeDictionary[i].u16MaxLength;
+
+        for (j = ITCOM_ZERO_INIT_U; j < (uint8_t)NUM_ASSOCIATED_LENGHTS; j++) {
+            uint8_t u8Length = stMsgTypeDictionary[i].au8AssociatedLengths[j];
+            if (u8Length != ITCOM_ZERO_INIT_U) {
+                pstEntry->au32LengthBitmap[u8Length / ITCOM_BITMAP_WORD_BITS] |= (1UL << (u8Length % ITCOM_BITMAP_WORD_BITS));
+            }
+        }
+    }
+}
+
+/* Returns the type/length index slot of u16MsgType, NULL if the type is unknown */
+static const ItcomTypeLengthEntry_t* itcom_pstFindTypeLength(uint16_t u16MsgType) {
+    uint32_t u32Slot = ITCOM_TYPE_INDEX_HASH(u16MsgType);
+    uint32_t u32Probe;
+
+    for (u32Probe = ITCOM_ZERO_INIT_U; u32Probe < ITCOM_TYPE_INDEX_SIZE; u32Probe++) {
+        const ItcomTypeLengthEntry_t* pstEntry = &itcom_astTypeLengthIndex[(u32Slot + u32Probe) & (ITCOM_TYPE_INDEX_SIZE - 1U)];
+        if (pstEntry->u8Used == ITCOM_ZERO_INIT_U) {
+            break;
+        }
+        if (pstEntry->u16MessageTypeID == u16MsgType) {
+            return pstEntry;
+        }
+    }
+    return NULL;
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static void itcom_vRecordRCLocked(uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction) {
+    /* Record the rolling counter if the message instance is valid */
+    if (u8MsgInstance < enTotalMessagesASI) {
+        if (u8Direction == (uint8_t)ROLLING_COUNT_RX) {
+            pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountRX = u16RollingCounter;
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountRX);
+        } else if (u8Direction == (uint8_t)ROLLING_COUNT_TX) {
+            __atomic_store_n(&pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX,
+                             (uint16_t)(u16RollingCounter % UINT16_MAX_VALUE), __ATOMIC_RELAXED);
+            FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stRollingCounterRegister[u8MsgInstance].u16RollingCountTX);
+        } else {
+            /* Intentionally empty else block */
+        }
+    }
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static void itcom_vSetMsgCycleCountLocked(const stMsgIntegrityData* pstTempMsgTracker, uint8_t u8Action) {
+    int16_t s16Indx = ITCOM_ZERO_INIT_U;
+    stMsgIntegrityData stFoundInstance;
+
+    /* Process based on action type */
+    if(u8Action == (uint8_t)ADD_ELEMENT) {
+        InstanceManager_vAddElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, pstTempMsgTracker);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCycleSeqTrack);
+        (void)log_message(global_log_file, LOG_DEBUG, "MESSAGE STARTED TRACKING, MSG: 0x%04X, Sequence Num: 0x%04X", 
+                   pstTempMsgTracker->stMsgPairData.u16MsgId, 
+                   pstTempMsgTracker->stMsgPairData.u16SequenceNum);
+    } else {
+        s16Indx = InstanceManager_s8FindElement(
+            (generic_ptr_t)&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, 
+            (const_generic_ptr_t)pstTempMsgTracker, 
+            (ElementCompareFn)&itcom_u8CompareMsgIdAndSequence, 
+            (generic_ptr_t)&stFoundInstance);
+        
+        if (s16Indx >= (int16_t)ITCOM_ZERO_INIT_U) {
+            if (u8Action == (uint8_t)UPDATE_ELEMENT) {
+                InstanceManager_vUpdateElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, 
+                                            s16Indx, 
+                                            pstTempMsgTracker);
+                FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCycleSeqTrack);
+                (void)log_message(global_log_file, LOG_DEBUG, 
+                          "MESSAGE UPDATED, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d, Response Cycle: %d", 
+                          pstTempMsgTracker->u16Type, 
+                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
+                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
+                          pstTempMsgTracker->u8ClearCondition,
+                          pstTempMsgTracker->u8ResponseCycleCount);
+            } else if (u8Action == (uint8_t)REMOVE_ELEMENT) {
+                InstanceManager_vRemoveElement(&pstSharedMemData->stThreadsCommonData.stCycleSeqTrack, s16Indx);
+                FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stCycleSeqTrack);
+                (void)log_message(global_log_file, LOG_DEBUG, 
+                          "REMOVE FROM TRACKING, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d, Response Cycle: %d", 
+                          pstTempMsgTracker->u16Type, 
+                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
+                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
+                          pstTempMsgTracker->u8ClearCondition,
+                          pstTempMsgTracker->u8ResponseCycleCount);
+            } else {
+                (void)log_message(global_log_file, LOG_DEBUG, 
+                          "INVALID ACTION, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d", 
+                          pstTempMsgTracker->u16Type, 
+                          pstTempMsgTracker->stMsgPairData.u16MsgId, 
+                          pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
+                          pstTempMsgTracker->u8ClearCondition);
+            }
+        } else {
+            (void)log_message(global_log_file, LOG_DEBUG, 
+                      "ELEMENT NOT FOUND, TYPE: 0x%04X, MSG: 0x%04X, SEQ NUM: 0x%04X, Clear Condition: %d", 
+                      pstTempMsgTracker->u16Type, 
+                      pstTempMsgTracker->stMsgPairData.u16MsgId, 
+                      pstTempMsgTracker->stMsgPairData.u16SequenceNum, 
+                      pstTempMsgTracker->u8ClearCondition);
+        }
+    }
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetTCPConnectionState
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vSetTCPConnectionState(enTCPConnectionsASI enConnection, TCPConnectionState_t enState) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+/* Caller must hold stThreadsCommonData.mutex */
+static int8_t itcom_s8SaveMsgDataLocked(uint16_t u16Handle, int16_t s16Indx) {
+    /* Enqueue the handle of the message data and update sequence number */
+    int8_t s8Return = DataQueue_s8Enqueue(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, (uint8_t *)&u16Handle, sizeof(u16Handle));
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stActionReqQueue);
+    if (s8Return == QUEUE_ACTION_SUCCESS) {
+        ITCOM_NOTE_MSG_COPY(sizeof(u16Handle));
+    }
+    itcom_vCountQueueOverflow((uint8_t)DATA_INTEGRITY_QUEUE, s8Return);
+    pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[s16Indx].u16SeqNumberSender = ITCOM_pstPoolBlock(u16Handle)->stMsgPairData.u16SequenceNum;
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[s16Indx].u16SeqNumberSender);
+    return s8Return;
+}
 
-    /* Validate connection index */
-    if (enConnection >= (enTCPConnectionsASI)enTotalTCPConnections) {
-        log_message(global_log_file, LOG_ERROR, "Invalid connection index %d", enConnection);
-    } else {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Set the TCP connection state */
-            pstSharedMemData->stThreadsCommonData.enTCPConnectionState[enConnection] = enState;
+/* Caller must hold stThreadsCommonData.mutex */
+static RecentRequestEntry_t* itcom_pstFindRecentRequestLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint32_t u32Now_ms) {
+    RecentRequestSet_t* pstSet = &pstSharedMemData->stThreadsCommonData.stRecentRequests;
+    uint32_t u32Home = ITCOM_RECENT_REQ_HASH(u8Connection, u16MsgId, u16SequenceNum);
+    uint32_t u32Probe;
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vSetTCPConnectionState: Failed to unlock mutex: error %d", mutex_unlock_status);
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetTCPConnectionState: Failed to lock mutex: error %d", mutex_lock_status);
+    for (u32Probe = ITCOM_ZERO_INIT_U; u32Probe < ITCOM_RECENT_REQ_PROBES; u32Probe++) {
+        RecentRequestEntry_t* pstEntry = &pstSet->astEntries[(u32Home + u32Probe) & (ITCOM_RECENT_REQ_SLOTS - 1U)];
+
+        if ((pstEntry->u8State != (uint8_t)enRecentReqFree) &&
+            ((u32Now_ms - pstEntry->u32Seen_ms) < ITCOM_RECENT_REQ_AGE_MS) &&
+            (pstEntry->u16MsgId == u16MsgId) && (pstEntry->u16SequenceNum == u16SequenceNum) &&
+            (pstEntry->u8Connection == u8Connection)) {
+            return pstEntry;
         }
     }
+    return NULL;
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_enGetTCPConnectionState
-//*****************************************************************************
-/**
- *
- *
-*/
-TCPConnectionState_t ITCOM_enGetTCPConnectionState(enTCPConnectionsASI enConnection) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    TCPConnectionState_t enState = CONNECTION_STATE_DISCONNECTED;
-
-    /* Validate connection index */
-    if (enConnection >= (enTCPConnectionsASI)enTotalTCPConnections) {
-        log_message(global_log_file, LOG_ERROR, "Invalid connection index %d", enConnection);
+/*
+ * Looks the action request up in the recent request set. A new request is
+ * recorded as pending in the first free or aged slot of its probe window, or
+ * over the oldest entry when the window is full. A repeat of a decided
+ * request gets the cached notification queued again; the start time its
+ * retransmission staged is discarded since no approval will consume it.
+ * Entries age from the first arrival, a repeat does not extend them: a peer
+ * retrying a request that never got an answer is served again after
+ * ITCOM_RECENT_REQ_AGE_MS.
+ * Caller must hold stThreadsCommonData.mutex.
+ */
+static int8_t itcom_s8AdmitActionRequestLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum) {
+    RecentRequestSet_t* pstSet = &pstSharedMemData->stThreadsCommonData.stRecentRequests;
+    uint32_t u32Now_ms = UT_u32GetCurrentTime_ms();
+    RecentRequestEntry_t* pstEntry = itcom_pstFindRecentRequestLocked(u8Connection, u16MsgId, u16SequenceNum, u32Now_ms);
+    int8_t s8Return = QUEUE_ACTION_SUCCESS;
+
+    pstSet->stStats.u32Requests++;
+    if (pstEntry != NULL) {
+        if (pstEntry->u8State == (uint8_t)enRecentReqDecided) {
+            (void)itcom_s8LogActionNotificationLocked(u8Connection, u16MsgId, u16SequenceNum, pstEntry->u8Decision);
+            itcom_vRemoveActionRequestTiming(u16MsgId, u16SequenceNum);
+            pstSet->stStats.u32Replayed++;
+            s8Return = ACTION_REQUEST_DUPLICATE_REPLAYED;
+        } else {
+            pstSet->stStats.u32Dropped++;
+            s8Return = ACTION_REQUEST_DUPLICATE_DROPPED;
+        }
     } else {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Retrieve the TCP connection state */
-            enState = pstSharedMemData->stThreadsCommonData.enTCPConnectionState[enConnection];
+        uint32_t u32Home = ITCOM_RECENT_REQ_HASH(u8Connection, u16MsgId, u16SequenceNum);
+        uint32_t u32Probe;
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_enGetTCPConnectionState: Failed to unlock mutex: error %d", mutex_unlock_status);
-                enState = CONNECTION_STATE_ERROR;  /* Set error state on unlock failure */
+        for (u32Probe = ITCOM_ZERO_INIT_U; u32Probe < ITCOM_RECENT_REQ_PROBES; u32Probe++) {
+            RecentRequestEntry_t* pstSlot = &pstSet->astEntries[(u32Home + u32Probe) & (ITCOM_RECENT_REQ_SLOTS - 1U)];
+
+            if ((pstSlot->u8State == (uint8_t)enRecentReqFree) ||
+                ((u32Now_ms - pstSlot->u32Seen_ms) >= ITCOM_RECENT_REQ_AGE_MS)) {
+                pstEntry = pstSlot;
+                break;
+            }
+            if ((pstEntry == NULL) || ((u32Now_ms - pstSlot->u32Seen_ms) > (u32Now_ms - pstEntry->u32Seen_ms))) {
+                pstEntry = pstSlot;
             }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_enGetTCPConnectionState: Failed to lock mutex: error %d", mutex_lock_status);
         }
+        if (u32Probe == ITCOM_RECENT_REQ_PROBES) {
+            pstSet->stStats.u32Evicted++;
+        }
+
+        pstEntry->u16MsgId = u16MsgId;
+        pstEntry->u16SequenceNum = u16SequenceNum;
+        pstEntry->u8Connection = u8Connection;
+        pstEntry->u8State = (uint8_t)enRecentReqPending;
+        pstEntry->u8Decision = ITCOM_ZERO_INIT_U;
+        pstEntry->u32Seen_ms = u32Now_ms;
     }
-    return enState;
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stRecentRequests);
+    return s8Return;
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vSetStateMonitorTestData
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vSetStateMonitorTestData(StateMonitor_t stStateMonitorData) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+/*
+ * Caches the final notification of a recent action request. Rate limiter
+ * drops, timeouts, failed transmissions and busy replies are not final: the entry is
+ * forgotten so that a retransmission is processed again. Callers that do not
+ * know the connection of the request pass ITCOM_RECENT_REQ_ANY_CONNECTION.
+ * Caller must hold stThreadsCommonData.mutex.
+ */
+static void itcom_vRecordRecentDecisionLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Decision) {
+    uint32_t u32Now_ms = UT_u32GetCurrentTime_ms();
+    uint8_t u8First = (u8Connection == ITCOM_RECENT_REQ_ANY_CONNECTION) ? (uint8_t)ITCOM_ZERO_INIT_U : u8Connection;
+    uint8_t u8Last = (u8Connection == ITCOM_RECENT_REQ_ANY_CONNECTION) ? (uint8_t)(ITCOM_RECENT_REQ_ANY_CONNECTION - 1U) : u8Connection;
+    uint8_t u8Conn;
+
+    for (u8Conn = u8First; u8Conn <= u8Last; u8Conn++) {
+        RecentRequestEntry_t* pstEntry = itcom_pstFindRecentRequestLocked(u8Conn, u16MsgId, u16SequenceNum, u32Now_ms);
+
+        if (pstEntry != NULL) {
+            if ((u8Decision == (uint8_t)enRateLimiterDrop) || (u8Decision == (uint8_t)enTimeoutLimit) ||
+                (u8Decision == (uint8_t)enTransmissionFailed) || (u8Decision == (uint8_t)enBusyRetryLater)) {
+                pstEntry->u8State = (uint8_t)enRecentReqFree;
+            } else {
+                pstEntry->u8State = (uint8_t)enRecentReqDecided;
+                pstEntry->u8Decision = u8Decision;
+            }
+            FALSE_SHARING_NOTE_WRITE(*pstEntry);
+        }
+    }
+}
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        /* Set the state monitor data */
-        pstSharedMemData->stThreadsCommonData.stStateMonitorData.stCurrentState = stStateMonitorData.stCurrentState;
-        pstSharedMemData->stThreadsCommonData.stStateMonitorData.u8StateError = stStateMonitorData.u8StateError;
+/*
+ * Queues an action notification and records it in the recent request set
+ * for the connection the request was received on.
+ * Caller must hold stThreadsCommonData.mutex.
+ */
+static int8_t itcom_s8LogActionNotificationLocked(uint8_t u8Connection, uint16_t u16MsgId, uint16_t u16SequenceNum, uint8_t u8Data) {
+    stProcessMsgData stTempMsgData = {ITCOM_ZERO_INIT_U};
+    int8_t s8QueueStatus;
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetStateMonitorTestData: Failed to unlock mutex: error %d", mutex_unlock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetStateMonitorTestData: Failed to lock mutex: error %d", mutex_lock_status);
+    itcom_vInitNotificationLocked(&stTempMsgData, u8Data);
+    stTempMsgData.stMsgPairData.u16MsgId = u16MsgId;
+    stTempMsgData.stMsgPairData.u16SequenceNum = u16SequenceNum;
+    pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[enActionNotification].u16SeqNumberSender = u16SequenceNum;
+    FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stSeqNumberRegister[enActionNotification].u16SeqNumberSender);
+    s8QueueStatus = itcom_s8EnqueueTxLocked((uint8_t)enTxClassNotification, &stTempMsgData);
+    itcom_vCountQueueOverflow((uint8_t)NOTIFICATION_QUEUE, s8QueueStatus);
+
+    itcom_vRecordRecentDecisionLocked(u8Connection, u16MsgId, u16SequenceNum, u8Data);
+    return s8QueueStatus;
+}
+
+/*
+ * Type, length and payload of a notification sent by ASI. Besides the code the
+ * payload reports how full stActionReqQueue is and, above the low water mark,
+ * how long a peer should wait before sending more action requests: the time
+ * ARA needs to bring the queue back to ITCOM_ADMISSION_LOW_WATER.
+ * Caller must hold stThreadsCommonData.mutex.
+ */
+static void itcom_vInitNotificationLocked(stProcessMsgData* pstMsgData, uint8_t u8Data) {
+    const data_queue_t* pstQueue = &pstSharedMemData->stThreadsCommonData.stActionReqQueue;
+    uint32_t u32Occupancy = (uint32_t)pstQueue->u16_qSize;
+    uint32_t u32RetryAfter = ITCOM_ZERO_INIT_U;
+
+    if (u32Occupancy > ITCOM_ADMISSION_LOW_WATER) {
+        u32RetryAfter = ((u32Occupancy - ITCOM_ADMISSION_LOW_WATER) * ITCOM_RETRY_AFTER_PER_REQUEST_MS) / ITCOM_RETRY_AFTER_UNIT_MS;
+        u32RetryAfter = (u32RetryAfter > (uint32_t)UINT8_MAX) ? (uint32_t)UINT8_MAX : u32RetryAfter;
     }
+
+    pstMsgData->u16Type = stMsgTypeDictionary[enNotificationMessage].u16MessageTypeID;
+    pstMsgData->u16Length = stMsgTypeDictionary[enNotificationMessage].au8AssociatedLengths[ITCOM_NOTIFY_LENGTH_INDEX];
+    pstMsgData->au8MsgData[ITCOM_NOTIFY_BYTE_CODE] = u8Data;
+    pstMsgData->au8MsgData[ITCOM_NOTIFY_BYTE_OCCUPANCY] = (pstQueue->u16_qMaxSize > ITCOM_ZERO_INIT_U) ?
+        (uint8_t)((u32Occupancy * ITCOM_PERCENT) / (uint32_t)pstQueue->u16_qMaxSize) : (uint8_t)ITCOM_ZERO_INIT_U;
+    pstMsgData->au8MsgData[ITCOM_NOTIFY_BYTE_RETRY_AFTER] = (uint8_t)u32RetryAfter;
 }
 
-//*****************************************************************************
-// FUNCTION NAME : ITCOM_vGetStateMonitorTestData
-//*****************************************************************************
-/**
- *
- *
-*/
-void ITCOM_vGetStateMonitorTestData(StateMonitor_t* pstStateMonitorData) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
+/* Chains every block of the message and payload pools into their free lists. Called by ITCOM_vInit on zeroed memory. */
+static void itcom_vPoolInit(void) {
+    itcom_vFreeListInit(&pstSharedMemData->stMsgPool.stFreeList, pstSharedMemData->stMsgPool.au16Next,
+                        (uint16_t)ITCOM_MSG_POOL_BLOCKS);
+    itcom_vFreeListInit(&pstSharedMemData->stPayloadPool.stFreeList, pstSharedMemData->stPayloadPool.au16Next,
+                        (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS);
+}
 
-    /* Check if the pointer is valid */
-    if (VALID_PTR(pstStateMonitorData)) {
-        /* Attempt to lock the mutex */
-        mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_lock_status == E_OK) {
-            /* Retrieve the state monitor data */
-            pstStateMonitorData->stCurrentState = pstSharedMemData->stThreadsCommonData.stStateMonitorData.stCurrentState;
-            pstStateMonitorData->u8StateError = pstSharedMemData->stThreadsCommonData.stStateMonitorData.u8StateError;
+static void itcom_vFreeListInit(PoolFreeList_t* pstList, uint16_t* pu16Next, uint16_t u16Blocks) {
+    uint16_t u16Block;
 
-            /* Attempt to unlock the mutex */
-            mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-            if (mutex_unlock_status != E_OK) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Failed to unlock mutex: error %d", mutex_unlock_status);
-            }
-        } else {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Failed to lock mutex: error %d", mutex_lock_status);
-        }
-    } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vGetStateMonitorTestData: Invalid pointer for pstStateMonitorData");
+    for (u16Block = ITCOM_ZERO_INIT_U; u16Block < u16Blocks; u16Block++) {
+        pu16Next[u16Block] = ((u16Block + 1U) < u16Blocks) ? (uint16_t)(u16Block + 1U) : ITCOM_POOL_HANDLE_NONE;
     }
+    __atomic_store_n(&pstList->u32FreeHead, ITCOM_ZERO_INIT_U, __ATOMIC_RELEASE);
 }
 
+/*
+ * Rebuilds the free lists of both pools at soft restart, before the threads
+ * start. The pools come back from storage, but a queue region stored with
+ * another layout comes back empty and the blocks held by the threads of the
+ * previous child are gone with them: every block that no surviving queue or
+ * receive ring refers to is returned to its free list.
+ */
+static void itcom_vPoolRebuild(void) {
+    const data_queue_t* pstActionReqQueue = &pstSharedMemData->stThreadsCommonData.stActionReqQueue;
+    uint8_t au8MsgUsed[ITCOM_MSG_POOL_BLOCKS] = {ITCOM_ZERO_INIT_U};
+    uint8_t au8PayloadUsed[ITCOM_PAYLOAD_POOL_BLOCKS] = {ITCOM_ZERO_INIT_U};
+    queue_size_t u32Entry;
+    uint16_t u16Handle;
+    uint16_t u16Payload;
+    uint8_t u8Conn;
+    uint32_t u32Slot;
+
+    for (u32Entry = ITCOM_ZERO_INIT_U; u32Entry < pstActionReqQueue->u16_qSize; u32Entry++) {
+        queue_index_t u32Index = (pstActionReqQueue->u16_qHead + u32Entry) % pstActionReqQueue->u16_qMaxSize;
+        (void)memcpy(&u16Handle, &pstActionReqQueue->pu8_qData[u32Index * pstActionReqQueue->u16_BuffSize], sizeof(u16Handle));
+        if (u16Handle < (uint16_t)ITCOM_MSG_POOL_BLOCKS) {
+            au8MsgUsed[u16Handle] = ITCOM_ONE_INIT_U;
+            u16Payload = pstSharedMemData->stMsgPool.astBlocks[u16Handle].u16PayloadHandle;
+            if (u16Payload < (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS) {
+                au8PayloadUsed[u16Payload] = ITCOM_ONE_INIT_U;
+            }
+        }
+    }
+    itcom_vMarkTxQueuePayloads(&pstSharedMemData->stThreadsCommonData.stMsgQueueSS, au8PayloadUsed);
+    itcom_vMarkTxQueuePayloads(&pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue, au8PayloadUsed);
+    itcom_vMarkTxQueuePayloads(&pstSharedMemData->stThreadsCommonData.stNotificationQueue, au8PayloadUsed);
+
+    /* Frames still in a receive ring are released by ITCOM_vRxRingReset from ICM_vInit */
+    for (u8Conn = ITCOM_ZERO_INIT_U; u8Conn < (uint8_t)enTotalTCPConnections; u8Conn++) {
+        const RxRing_t* pstRing = &pstSharedMemData->stThread_ICM_RX.astRxRing[u8Conn];
+
+        for (u32Slot = pstRing->u32Tail; u32Slot != pstRing->u32Head; u32Slot++) {
+            u16Payload = pstRing->au16Payload[u32Slot & (ITCOM_RX_RING_DEPTH - 1U)];
+            if (u16Payload < (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS) {
+                au8PayloadUsed[u16Payload] = ITCOM_ONE_INIT_U;
+            }
+        }
+    }
 
-/*** Private Functions ***/
+    itcom_vFreeListRebuild(&pstSharedMemData->stMsgPool.stFreeList, pstSharedMemData->stMsgPool.au16Next,
+                           au8MsgUsed, (uint16_t)ITCOM_MSG_POOL_BLOCKS);
+    itcom_vFreeListRebuild(&pstSharedMemData->stPayloadPool.stFreeList, pstSharedMemData->stPayloadPool.au16Next,
+                           au8PayloadUsed, (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS);
+}
 
-static uint8_t itcom_u8CompareMsgIdAndSequence(const_generic_ptr_t a, const_generic_ptr_t b) {
-    const stMsgIntegrityData* const element = (const stMsgIntegrityData* const)a;
-    const stMsgIntegrityData* const criteria = (const stMsgIntegrityData* const)b;
-    uint8_t result = ITCOM_ONE_INIT_U;
+/* Marks the payload blocks carried by the entries of a transmit queue */
+static void itcom_vMarkTxQueuePayloads(const data_queue_t* pstQueue, uint8_t* pu8PayloadUsed) {
+    TxQueueEntry_t stEntry;
+    queue_size_t u32Entry;
 
-    if ((bool)(element != (stMsgIntegrityData*)NULL) && (bool)(criteria != (stMsgIntegrityData*)NULL)) {
-        if (((uint16_t)element->stMsgPairData.u16MsgId == (uint16_t)criteria->stMsgPairData.u16MsgId) && 
-            ((uint16_t)element->stMsgPairData.u16SequenceNum == (uint16_t)criteria->stMsgPairData.u16SequenceNum) && 
-            ((uint8_t)element->u8ClearCondition == (uint8_t)criteria->u8ClearCondition)) {
-            result = ITCOM_ZERO_INIT_U;
+    for (u32Entry = ITCOM_ZERO_INIT_U; u32Entry < pstQueue->u16_qSize; u32Entry++) {
+        queue_index_t u32Index = (pstQueue->u16_qHead + u32Entry) % pstQueue->u16_qMaxSize;
+        (void)memcpy(&stEntry, &pstQueue->pu8_qData[u32Index * pstQueue->u16_BuffSize], sizeof(stEntry));
+        if (stEntry.stMsg.u16PayloadHandle < (uint16_t)ITCOM_PAYLOAD_POOL_BLOCKS) {
+            pu8PayloadUsed[stEntry.stMsg.u16PayloadHandle] = ITCOM_ONE_INIT_U;
         }
     }
-    return result;
 }
 
-static uint8_t itcom_u8CompareCalibData(const_generic_ptr_t a, const_generic_ptr_t b) {
-    const stProcessMsgData* const element = (const stProcessMsgData* const)a;
-    const stProcessMsgData* const criteria = (const stProcessMsgData* const)b;
-    uint8_t result = ITCOM_ONE_INIT_U;
+/* Chains the unused blocks into the free list, the statistics keep counting from the stored values */
+static void itcom_vFreeListRebuild(PoolFreeList_t* pstList, uint16_t* pu16Next, const uint8_t* pu8Used, uint16_t u16Blocks) {
+    uint16_t u16Head = ITCOM_POOL_HANDLE_NONE;
+    uint32_t u32InUse = ITCOM_ZERO_INIT_U;
+    uint16_t u16Block;
 
-    if ((element != (stProcessMsgData*)NULL) && (criteria != (stProcessMsgData*)NULL)) {
-        if (((uint16_t)element->stMsgPairData.u16MsgId == (uint16_t)criteria->stMsgPairData.u16MsgId) && 
-            ((uint16_t)element->stMsgPairData.u16SequenceNum == (uint16_t)criteria->stMsgPairData.u16SequenceNum)) {
-            result = ITCOM_ZERO_INIT_U;
+    for (u16Block = u16Blocks; u16Block > ITCOM_ZERO_INIT_U; u16Block--) {
+        if (pu8Used[u16Block - 1U] != ITCOM_ZERO_INIT_U) {
+            u32InUse++;
+        } else {
+            pu16Next[u16Block - 1U] = u16Head;
+            u16Head = (uint16_t)(u16Block - 1U);
         }
     }
-    return result;
+    pstList->stStats.u32Frees = pstList->stStats.u32Allocs - u32InUse;
+    __atomic_store_n(&pstList->u32FreeHead, (uint32_t)u16Head, __ATOMIC_RELEASE);
 }
 
-static void itcom_vRemoveActionRequestTiming(uint16_t u16MsgId, uint16_t u16SequenceNum) {
-    uint8_t actionRequestCount = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
-    uint8_t i;
-    for (i = ITCOM_ZERO_INIT_U; i < actionRequestCount; i++) {
-        if (pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16MsgId == u16MsgId &&
-            pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16SequenceNum == u16SequenceNum) {
-            // Remove this entry by shifting the remaining entries
-            uint8_t j;
-            for (j = i; j < actionRequestCount - 1; j++) {
-                pstSharedMemData->stThreadsCommonData.astActionRequestTiming[j] = pstSharedMemData->stThreadsCommonData.astActionRequestTiming[j+1];
-            }
-            pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount--;
-            break;
+/*
+ * Lock-free pop. The head carries a tag that is bumped on every update, so a
+ * block freed and reallocated between the load and the compare-and-swap of
+ * another thread cannot be mistaken for an unchanged head (ABA).
+ */
+static uint16_t itcom_u16FreeListPop(PoolFreeList_t* pstList, uint16_t* pu16Next) {
+    uint32_t u32Head = __atomic_load_n(&pstList->u32FreeHead, __ATOMIC_ACQUIRE);
+    uint32_t u32New;
+    uint16_t u16Handle;
+
+    do {
+        u16Handle = (uint16_t)(u32Head & ITCOM_POOL_HANDLE_MASK);
+        if (u16Handle == ITCOM_POOL_HANDLE_NONE) {
+            (void)__atomic_fetch_add(&pstList->stStats.u32Exhausted, 1U, __ATOMIC_RELAXED);
+            return ITCOM_POOL_HANDLE_NONE;
         }
+        u32New = ((((u32Head >> ITCOM_POOL_TAG_SHIFT) + 1U) & ITCOM_POOL_HANDLE_MASK) << ITCOM_POOL_TAG_SHIFT) |
+                 (uint32_t)__atomic_load_n(&pu16Next[u16Handle], __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(&pstList->u32FreeHead, &u32Head, u32New, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+    uint32_t u32InUse = (__atomic_add_fetch(&pstList->stStats.u32Allocs, 1U, __ATOMIC_RELAXED) -
+                         __atomic_load_n(&pstList->stStats.u32Frees, __ATOMIC_RELAXED));
+    uint32_t u32High = __atomic_load_n(&pstList->stStats.u32InUseHigh, __ATOMIC_RELAXED);
+    while ((u32InUse > u32High) &&
+           !__atomic_compare_exchange_n(&pstList->stStats.u32InUseHigh, &u32High, u32InUse, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        /* u32High reloaded by the failed exchange */
     }
+    return u16Handle;
 }
 
-void ITCOM_vSetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum) {
-    mutex_status_t mutex_lock_status;
-    mutex_status_t mutex_unlock_status;
-    int32_t time_status;
-    generic_ptr_t move_result = NULL;
-    uint8_t operation_status = ITCOM_OP_FAILURE;
+/* Lock-free push of a valid handle */
+static void itcom_vFreeListPush(PoolFreeList_t* pstList, uint16_t* pu16Next, uint16_t u16Handle) {
+    uint32_t u32Head = __atomic_load_n(&pstList->u32FreeHead, __ATOMIC_RELAXED);
+    uint32_t u32New;
 
-    /* Attempt to lock the mutex */
-    mutex_lock_status = (mutex_status_t)pthread_mutex_lock(&pstSharedMemData->stThreadsCommonData.mutex);
-    if (mutex_lock_status == E_OK) {
-        uint8_t index = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
+    do {
+        __atomic_store_n(&pu16Next[u16Handle], (uint16_t)(u32Head & ITCOM_POOL_HANDLE_MASK), __ATOMIC_RELAXED);
+        u32New = ((((u32Head >> ITCOM_POOL_TAG_SHIFT) + 1U) & ITCOM_POOL_HANDLE_MASK) << ITCOM_POOL_TAG_SHIFT) | (uint32_t)u16Handle;
+    } while (!__atomic_compare_exchange_n(&pstList->u32FreeHead, &u32Head, u32New, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
 
-        /* Check if the timing count exceeds the limit */
-        if (index >= (uint8_t)MAX_PENDING_ACTION_REQUESTS) {
-            move_result = memmove(&pstSharedMemData->stThreadsCommonData.astActionRequestTiming[0],
-                                  &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[1],
-                                  sizeof(ActionRequestTiming_t) * (MAX_PENDING_ACTION_REQUESTS - 1));
+    (void)__atomic_fetch_add(&pstList->stStats.u32Frees, 1U, __ATOMIC_RELAXED);
+}
 
-            /* Check if the memmove operation was successful */
-            if ((move_result != NULL) && (move_result == &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[0])) {
-                index = MAX_PENDING_ACTION_REQUESTS - 1;
-                operation_status = ITCOM_OP_SUCCESS;
-            } else {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Memory move operation failed");
-            }
-        } else {
-            pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount++;
-            operation_status = ITCOM_OP_SUCCESS;
+static void itcom_vCopyPoolStats(const MsgPoolStats_t* pstPoolStats, MsgPoolStats_t* pstStats) {
+    if (VALID_PTR(pstStats)) {
+        pstStats->u32Allocs = __atomic_load_n(&pstPoolStats->u32Allocs, __ATOMIC_RELAXED);
+        pstStats->u32Frees = __atomic_load_n(&pstPoolStats->u32Frees, __ATOMIC_RELAXED);
+        pstStats->u32Exhausted = __atomic_load_n(&pstPoolStats->u32Exhausted, __ATOMIC_RELAXED);
+        pstStats->u32InUseHigh = __atomic_load_n(&pstPoolStats->u32InUseHigh, __ATOMIC_RELAXED);
+    }
+}
+
+/* Drops the queued action requests, forgets them in the recent request set and returns their blocks. Caller must hold stThreadsCommonData.mutex */
+static void itcom_vClearActionReqQueueLocked(void) {
+    uint16_t u16Handle = ITCOM_POOL_HANDLE_NONE;
+
+    while (DataQueue_s8Dequeue(&pstSharedMemData->stThreadsCommonData.stActionReqQueue, (uint8_t *)&u16Handle, sizeof(u16Handle)) == QUEUE_ACTION_SUCCESS) {
+        const stProcessMsgData* pstMsg = ITCOM_pstPoolBlock(u16Handle);
+
+        /* Never decided: forget it so a retransmission is processed again */
+        itcom_vRecordRecentDecisionLocked(ITCOM_RECENT_REQ_ANY_CONNECTION, pstMsg->stMsgPairData.u16MsgId,
+                                          pstMsg->stMsgPairData.u16SequenceNum, (uint8_t)enBusyRetryLater);
+        ITCOM_vReleaseMsgPayload(ITCOM_pstPoolBlock(u16Handle));
+        ITCOM_vPoolFree(u16Handle);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.stActionReqQueue);
+    }
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static void itcom_vRecordApprovalLatency(int64_t s64Latency_ms) {
+    SloMetrics_t* pstSlo = pstSharedMemData->stThreadsCommonData.pstSloMetrics;
+    uint32_t u32Latency_ms = (s64Latency_ms > (int64_t)ITCOM_ZERO_INIT_U) ? (uint32_t)s64Latency_ms : ITCOM_ZERO_INIT_U;
+    uint32_t u32Bucket = u32Latency_ms / SLO_LATENCY_BUCKET_WIDTH_MS;
+
+    if (u32Bucket >= SLO_LATENCY_HIST_BUCKETS) {
+        u32Bucket = SLO_LATENCY_HIST_BUCKETS - ITCOM_ONE_INIT_U;
+    }
+    /* Atomic stores: the parent reads the metrics without the lock (ITCOM_vGetSloMetrics) */
+    (void)__atomic_fetch_add(&pstSlo->au32ApprovalLatencyHist[u32Bucket], ITCOM_ONE_INIT_U, __ATOMIC_RELAXED);
+    (void)__atomic_fetch_add(&pstSlo->u32ApprovalCount, ITCOM_ONE_INIT_U, __ATOMIC_RELAXED);
+    if (u32Latency_ms > pstSlo->u32ApprovalLatencyMax_ms) {
+        __atomic_store_n(&pstSlo->u32ApprovalLatencyMax_ms, u32Latency_ms, __ATOMIC_RELAXED);
+    }
+    FALSE_SHARING_NOTE_WRITE(*pstSlo);
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static data_queue_t* itcom_pstTxQueue(uint8_t u8Class) {
+    data_queue_t* pstQueue = NULL;
+
+    if (u8Class == (uint8_t)enTxClassSafeState) {
+        pstQueue = &pstSharedMemData->stThreadsCommonData.stMsgQueueSS;
+    } else if (u8Class == (uint8_t)enTxClassApproval) {
+        pstQueue = &pstSharedMemData->stThreadsCommonData.stApprovedActionsQueue;
+    } else if (u8Class == (uint8_t)enTxClassNotification) {
+        pstQueue = &pstSharedMemData->stThreadsCommonData.stNotificationQueue;
+    } else {
+        /* Intentionally empty else block */
+    }
+    return pstQueue;
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static int8_t itcom_s8EnqueueTxLocked(uint8_t u8Class, const stProcessMsgData* pstMsgData) {
+    TxQueueEntry_t stEntry;
+    data_queue_t* pstQueue = itcom_pstTxQueue(u8Class);
+    int8_t s8Return = QUEUE_ACTION_FAILURE_DATAQUEUE_INVALID_INPUT;
+
+    if (pstQueue != NULL) {
+        stEntry.stMsg = *pstMsgData;
+        stEntry.u32Enqueued_ms = UT_u32GetCurrentTime_ms();
+        s8Return = DataQueue_s8Enqueue(pstQueue, (uint8_t *)&stEntry, sizeof(stEntry));
+        ITCOM_NOTE_MSG_COPY(sizeof(stProcessMsgData));
+        if (s8Return == QUEUE_ACTION_SUCCESS) {
+            ITCOM_NOTE_MSG_COPY(sizeof(stEntry));
         }
+        FALSE_SHARING_NOTE_OBJECT(pstQueue, sizeof(*pstQueue), "pstSharedMemData->stThreadsCommonData.TxQueue");
+    }
+    return s8Return;
+}
 
-        /* Proceed if memory operation or index update was successful */
-        if (operation_status == (uint8_t)ITCOM_ONE_INIT_U) {
-            pstSharedMemData->stThreadsCommonData.astActionRequestTiming[index].u16MsgId = u16MsgId;
-            pstSharedMemData->stThreadsCommonData.astActionRequestTiming[index].u16SequenceNum = u16SequenceNum;
+/*
+ * Dequeues the oldest message of a transmit class that is still within its
+ * deadline; stale messages in front of it are dropped and counted.
+ * Caller must hold stThreadsCommonData.mutex.
+ */
+static int8_t itcom_s8DequeueTxClassLocked(uint8_t u8Class, stProcessMsgData* pstMsgData, uint32_t u32Now_ms) {
+    static const uint32_t au32Deadline_ms[enTotalTxClasses] = {
+        ITCOM_TX_DEADLINE_SAFE_STATE_MS, ITCOM_TX_DEADLINE_APPROVAL_MS, ITCOM_TX_DEADLINE_NOTIFICATION_MS
+    };
+    TxQueueEntry_t stEntry;
+    data_queue_t* pstQueue = itcom_pstTxQueue(u8Class);
+    TxClassStats_t* pstStats;
+    int8_t s8Return = QUEUE_ACTION_FAILURE_DATAQUEUE_INVALID_INPUT;
+
+    if (pstQueue == NULL) {
+        return s8Return;
+    }
+    pstStats = &pstSharedMemData->stThread_ICM_TX.astTxClassStats[u8Class];
 
-            /* Attempt to set the start time */
-            time_status = clock_gettime(CLOCK_MONOTONIC, &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[index].start_time);
-            if (time_status != (int32_t)ITCOM_ZERO_INIT_U) {
-                log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to get time: error %d", time_status);
-                operation_status = ITCOM_OP_FAILURE;
+    while (DataQueue_u8IsEmpty(pstQueue) == (uint8_t)ITCOM_ZERO_INIT_U) {
+        s8Return = DataQueue_s8Dequeue(pstQueue, (uint8_t *)&stEntry, sizeof(stEntry));
+        FALSE_SHARING_NOTE_OBJECT(pstQueue, sizeof(*pstQueue), "pstSharedMemData->stThreadsCommonData.TxQueue");
+        if (s8Return != QUEUE_ACTION_SUCCESS) {
+            break;
+        }
+        ITCOM_NOTE_MSG_COPY(sizeof(stEntry));
+
+        uint32_t u32Delay_ms = u32Now_ms - stEntry.u32Enqueued_ms;
+        if ((au32Deadline_ms[u8Class] != ITCOM_TX_DEADLINE_NONE) && (u32Delay_ms > au32Deadline_ms[u8Class])) {
+            pstStats->u32Dropped++;
+            log_message(global_log_file, LOG_WARNING, "TX class %u: message 0x%04X seq %u dropped after %u ms (deadline %u ms)",
+                        u8Class, stEntry.stMsg.stMsgPairData.u16MsgId, stEntry.stMsg.stMsgPairData.u16SequenceNum,
+                        u32Delay_ms, au32Deadline_ms[u8Class]);
+            if (u8Class == (uint8_t)enTxClassApproval) {
+                /* The approval never reached CM: forget the request so a retransmission is processed again */
+                itcom_vRecordRecentDecisionLocked(ITCOM_RECENT_REQ_ANY_CONNECTION, stEntry.stMsg.stMsgPairData.u16MsgId,
+                                                  stEntry.stMsg.stMsgPairData.u16SequenceNum, (uint8_t)enTimeoutLimit);
             }
+            ITCOM_vReleaseMsgPayload(&stEntry.stMsg);
+            s8Return = QUEUE_ACTION_FAILURE_DATAQUEUE_QUEUE_EMPTY;
+            continue;
         }
 
-        /* Attempt to unlock the mutex */
-        mutex_unlock_status = (mutex_status_t)pthread_mutex_unlock(&pstSharedMemData->stThreadsCommonData.mutex);
-        if (mutex_unlock_status != E_OK) {
-            log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to unlock mutex: error %d", mutex_unlock_status);
+        pstStats->u32Sent++;
+        pstStats->u64DelayTotal_ms += u32Delay_ms;
+        if (u32Delay_ms > pstStats->u32DelayMax_ms) {
+            pstStats->u32DelayMax_ms = u32Delay_ms;
         }
+        *pstMsgData = stEntry.stMsg;
+        ITCOM_NOTE_MSG_COPY(sizeof(stProcessMsgData));
+        break;
+    }
+    if (DataQueue_u8IsEmpty(pstQueue) && (s8Return != QUEUE_ACTION_SUCCESS)) {
+        s8Return = QUEUE_ACTION_FAILURE_DATAQUEUE_QUEUE_EMPTY;
+    }
+    FALSE_SHARING_NOTE_WRITE(*pstStats);
+    return s8Return;
+}
+
+/* Starts a write guarded by a sequence counter (single writer). A counter left
+   odd by a writer that died is taken over: the write makes it even again */
+static uint32_t itcom_u32SeqWriteBegin(uint32_t* pu32Seq) {
+    uint32_t u32Seq = __atomic_load_n(pu32Seq, __ATOMIC_RELAXED) | ITCOM_ONE_INIT_U;
+
+    __atomic_store_n(pu32Seq, u32Seq, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return u32Seq;
+}
+
+static void itcom_vSeqWriteEnd(uint32_t* pu32Seq, uint32_t u32Seq) {
+    __atomic_store_n(pu32Seq, u32Seq + ITCOM_ONE_INIT_U, __ATOMIC_RELEASE);
+}
+
+/* True when the data read after loading u32Seq (acquire) did not overlap a write */
+static bool itcom_bSeqReadValid(const uint32_t* pu32Seq, uint32_t u32Seq) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return ((u32Seq & ITCOM_ONE_INIT_U) == ITCOM_ZERO_INIT_U) && (__atomic_load_n(pu32Seq, __ATOMIC_RELAXED) == u32Seq);
+}
+
+/* Caller must hold stThreadsCommonData.mutex */
+static void itcom_vCountQueueOverflow(uint8_t u8SelectQueue, int8_t s8EnqueueStatus) {
+    if ((s8EnqueueStatus == QUEUE_ACTION_FAILURE_DATAQUEUE_QUEUE_FULL) && (u8SelectQueue < SLO_TOTAL_QUEUES)) {
+        (void)__atomic_fetch_add(&pstSharedMemData->stThreadsCommonData.pstSloMetrics->au32QueueOverflowCount[u8SelectQueue],
+                                 ITCOM_ONE_INIT_U, __ATOMIC_RELAXED);
+        FALSE_SHARING_NOTE_WRITE(pstSharedMemData->stThreadsCommonData.pstSloMetrics->au32QueueOverflowCount[u8SelectQueue]);
+    }
+}
+
+/* Builds itcom_stRegionLayout from SHM_LAYOUT_CONFIG_PATH, falling back to the default capacities */
+static void itcom_vBuildRegionLayout(FILE* itcom_log_file) {
+    ItcomRegionConfig_t stConfig;
+    uint32_t u32BadLine = ITCOM_ZERO_INIT_U;
+    uint8_t u8BadRegion = ITCOM_ZERO_INIT_U;
+    int8_t s8Status;
+
+    s8Status = ITCOM_s8LoadRegionConfig(SHM_LAYOUT_CONFIG_PATH, &stConfig, &u32BadLine);
+    if (s8Status == ITCOM_REGION_NO_CONFIG) {
+        log_message(itcom_log_file, LOG_INFO, "No %s, default shared memory layout", SHM_LAYOUT_CONFIG_PATH);
+    } else if (s8Status == ITCOM_REGION_INVALID) {
+        log_message(itcom_log_file, LOG_WARNING, "%s: line %u rejected, default shared memory layout",
+                    SHM_LAYOUT_CONFIG_PATH, u32BadLine);
     } else {
-        log_message(global_log_file, LOG_ERROR, "ITCOM_vSetActionRequestStartTime: Failed to lock mutex: error %d", mutex_lock_status);
+        log_message(itcom_log_file, LOG_INFO, "Shared memory layout read from %s", SHM_LAYOUT_CONFIG_PATH);
+    }
+
+    if (ITCOM_s8BuildRegionLayout(&stConfig, &itcom_stRegionLayout, &u8BadRegion) != ITCOM_REGION_OK) {
+        log_message(itcom_log_file, LOG_WARNING, "Capacity %u of region %s out of range, default shared memory layout",
+                    stConfig.au32Capacity[u8BadRegion], ITCOM_pcRegionName(u8BadRegion));
+        ITCOM_vDefaultRegionConfig(&stConfig);
+        (void)ITCOM_s8BuildRegionLayout(&stConfig, &itcom_stRegionLayout, NULL);
     }
 }
 
-static struct timespec* ITCOM_pstGetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum) {
-    struct timespec* pstStartTime = NULL;
-    uint8_t maxTimingCount = pstSharedMemData->stThreadsCommonData.u8ActionRequestTimingCount;
+/* Maps itcom_stRegionLayout.u32MappingSize bytes; a huge page mapping that fails is retried with normal pages */
+static DataOnSharedMemory* itcom_pstMapSharedMemory(FILE* itcom_log_file) {
+    void* pvMapping = MAP_FAILED;
+    uint32_t u32PageSize;
+
+    if (itcom_stRegionLayout.u8HugePages != ITCOM_ZERO_INIT_U) {
+        pvMapping = mmap(NULL, itcom_stRegionLayout.u32MappingSize, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pvMapping == MAP_FAILED) {
+            log_message(itcom_log_file, LOG_WARNING, "Huge page mapping of %u bytes failed: %s, using normal pages",
+                        itcom_stRegionLayout.u32MappingSize, strerror(errno));
+            u32PageSize = (uint32_t)sysconf(_SC_PAGESIZE);
+            itcom_stRegionLayout.u8HugePages = ITCOM_ZERO_INIT_U;
+            itcom_stRegionLayout.u32MappingSize = ((itcom_stRegionLayout.u32DataSize + u32PageSize - ITCOM_ONE_INIT_U) / u32PageSize) * u32PageSize;
+        }
+    }
 
-    /* Iterate through the action request timing records */
+    if (pvMapping == MAP_FAILED) {
+        pvMapping = mmap(NULL, itcom_stRegionLayout.u32MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    }
+
+    return (DataOnSharedMemory*)pvMapping;
+}
+
+/*
+ * Points the queues, tracking buffers, event store and SLO metrics at their
+ * regions of the mapping. Regions in u32ResetMask are emptied as well, the
+ * others keep the contents and control data loaded from storage. Called on
+ * zeroed memory by ITCOM_vInit, or before the mutexes exist on a soft restart.
+ */
+static void itcom_vBindRegions(uint32_t u32ResetMask) {
+    SM_Common_Public_Data* pstCommon = &pstSharedMemData->stThreadsCommonData;
+    const ItcomRegionDesc_t* pastRegions = itcom_stRegionLayout.astRegions;
+    uint8_t* pu8Base = (uint8_t*)pstSharedMemData;
+    data_queue_t* const apstQueues[] = { &pstCommon->stActionReqQueue, &pstCommon->stApprovedActionsQueue,
+                                         &pstCommon->stMsgQueueSS, &pstCommon->stNotificationQueue };
+    stIMBuffer* const apstTracks[] = { &pstCommon->stCycleSeqTrack, &pstCommon->stCalibrationDataCopyTrack,
+                                       &pstCommon->stCalibrationReadbackTrack };
+    const ItcomRegionDesc_t* pstRegion;
     uint8_t i;
-    for (i = ITCOM_ZERO_INIT_U; i < maxTimingCount; i++) {
-        if ((pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16MsgId == u16MsgId) &&
-            (pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].u16SequenceNum == u16SequenceNum)) {
-            pstStartTime = &pstSharedMemData->stThreadsCommonData.astActionRequestTiming[i].start_time;
-            break;
+
+    for (i = ITCOM_ZERO_INIT_U; i < (uint8_t)(sizeof(apstQueues) / sizeof(apstQueues[0])); i++) {
+        pstRegion = &pastRegions[(uint8_t)enRegionActionReqQueue + i];
+        if ((u32ResetMask & ITCOM_REGION_BIT((uint8_t)enRegionActionReqQueue + i)) != ITCOM_ZERO_INIT_U) {
+            DataQueue_vInit(apstQueues[i], pu8Base + pstRegion->u32Offset, pstRegion->u32Capacity,
+                            pstRegion->u32ElementSize, CIRCULAR_BUFF_INACTIVE);
+        } else {
+            apstQueues[i]->pu8_qData = pu8Base + pstRegion->u32Offset;
         }
     }
 
-    return pstStartTime;
+    for (i = ITCOM_ZERO_INIT_U; i < (uint8_t)(sizeof(apstTracks) / sizeof(apstTracks[0])); i++) {
+        pstRegion = &pastRegions[(uint8_t)enRegionCycleSeqTrack + i];
+        if ((u32ResetMask & ITCOM_REGION_BIT((uint8_t)enRegionCycleSeqTrack + i)) != ITCOM_ZERO_INIT_U) {
+            InstanceManager_vInitialize(apstTracks[i], pu8Base + pstRegion->u32Offset,
+                                        pstRegion->u32ElementSize, (uint16_t)pstRegion->u32Capacity);
+        } else {
+            apstTracks[i]->pu8_Buffer = pu8Base + pstRegion->u32Offset;
+        }
+    }
+
+    pstRegion = &pastRegions[enRegionEventStore];
+    pstCommon->Event_Queue = pu8Base + pstRegion->u32Offset;
+    if ((u32ResetMask & ITCOM_REGION_BIT(enRegionEventStore)) != ITCOM_ZERO_INIT_U) {
+        (void)memset(pstCommon->Event_Queue, 0, pstRegion->u32Size);
+        pstCommon->Event_Queue_Index = ITCOM_ZERO_INIT_U;
+    }
+
+    pstRegion = &pastRegions[enRegionSloMetrics];
+    pstCommon->pstSloMetrics = (SloMetrics_t*)(void*)(pu8Base + pstRegion->u32Offset);
+    if ((u32ResetMask & ITCOM_REGION_BIT(enRegionSloMetrics)) != ITCOM_ZERO_INIT_U) {
+        (void)memset(pstCommon->pstSloMetrics, 0, pstRegion->u32Size);
+    }
 }
@@ -16,6 +16,28 @@
 * ----------|---|-----------
 * 08/08/2024|AT |Initial
 * 10/03/2024|TP |Refactored for Action Request Timeout
+* 10/18/2026|TP |Per-thread blocks and common mutex aligned to cache lines
+* 10/18/2026|TP |Owner-thread fields in private blocks, accessed without locks
+* 10/18/2026|TP |Transaction API: several updates committed under one lock
+* 10/18/2026|TP |Per-connection receive ring replaces the single RX message slot
+* 10/18/2026|TP |Atomic sequence number and TX rolling counter allocators
+* 10/18/2026|TP |Type/length validation takes the full 16-bit length
+* 10/18/2026|TP |Priority-classed TX queues with deadlines and per-class delay statistics
+* 10/18/2026|TP |Recent action request set suppresses duplicate (connection, ID, sequence) requests
+* 10/18/2026|TP |Overload fields in ASI notifications, action request admission thresholds
+* 10/18/2026|TP |Shared memory message pool, action request queue carries pool handles
+* 10/18/2026|TP |Payload pool for long message values, per-type maximum length
+* 10/18/2026|TP |Thread tuning block: runtime period, priority, CPU mask and budgets
+* 10/18/2026|TP |Lock-free pending work checks for the idle fast path
+* 10/18/2026|TP |Frame wrapper of the optional cyclic executive
+* 10/18/2026|TP |Per-thread stack size and high-water mark exported in shared memory
+* 10/18/2026|TP |Region layout descriptor: queues, trackers, event store and metrics sized at startup
+* 10/18/2026|TP |Recent requests aged from their first arrival
+* 10/18/2026|TP |ITCOM_vRxRingCountOverflow, called by the reader when data is left unread
+* 10/18/2026|TP |Release of unsent sequence numbers and TX rolling counters
+* 10/18/2026|TP |Sequence counters of the thread tuning block, lock-free active tuning copy for the parent
+* 10/18/2026|TP |Recent request set sized for the request rate over the aging window
+* 10/18/2026|TP |Message copy counting for the copy benchmark (ITCOM_COPY_COUNTING)
 *
 */
 //*****************************************************************************
@@ -43,7 +65,13 @@
 
 /*** Definitions Provided to other modules ***/
 
-#define SHARED_BUFFER_SIZE (64 * 1024)
+#define ITCOM_CACHE_LINE_SIZE 64
+/* Starts a member on its own cache line so writers of different domains do not share one */
+#define ITCOM_CACHE_ALIGNED __attribute__((aligned(ITCOM_CACHE_LINE_SIZE)))
+/* Access to owner-thread fields of a private block: the owning thread is the
+ * only writer, so relaxed atomics are enough and no mutex is taken */
+#define ITCOM_OWNER_STORE(lvalue, value) __atomic_store_n(&(lvalue), (value), __ATOMIC_RELAXED)
+#define ITCOM_OWNER_LOAD(lvalue) __atomic_load_n(&(lvalue), __ATOMIC_RELAXED)
 #define THREAD_MAX_RESTART_THRESOLD 5
 #define THREAD_CRASH_MONITORING_INTERVAL 5
 #define STORAGE_WRITE_INTERVAL 2
@@ -60,6 +88,7 @@
 #define DATA_INTEGRITY_QUEUE	(0)
 #define APPROVED_ACTIONS_QUEUE	(1)
 #define SAFE_STATE_QUEUE		(2)
+#define NOTIFICATION_QUEUE		(3)
 
 #define NUM_ASSOCIATED_LENGHTS  (3)
 
@@ -81,6 +110,68 @@
 #define ENQUEUE_OPERATION_SUCCESS             ((int8_t)1)      /**< Enqueue operation is successful*/
 #define ENQUEUE_OPERATION_FAILURE             ((int8_t)0)      /**< Enqueue operation is failed*/
 
+#define SLO_LATENCY_BUCKET_WIDTH_MS           (5U)             /**< Width of one approval latency histogram bucket */
+#define SLO_LATENCY_HIST_BUCKETS              (12U)            /**< Last bucket collects everything >= 55ms */
+#define SLO_TOTAL_QUEUES                      (4U)             /**< DATA_INTEGRITY, APPROVED_ACTIONS, SAFE_STATE and NOTIFICATION queues */
+
+#define ITCOM_TXN_MAX_OPS                     (8U)             /**< Updates one transaction can stage */
+#define ITCOM_TXN_FULL                        ((int8_t)-1)     /**< Staging rejected, transaction is full */
+#define ACTION_REQUEST_DUPLICATE_REPLAYED     ((int8_t)-8)     /**< enTxnSaveMsgData: repeat of a decided request, decision sent again */
+#define ACTION_REQUEST_DUPLICATE_DROPPED      ((int8_t)-9)     /**< enTxnSaveMsgData: repeat of a request still in progress */
+
+#define ITCOM_RECENT_REQ_RATE_PER_S           (100U)           /**< Peak action request rate the set is sized for (one per 10ms) */
+#define ITCOM_RECENT_REQ_AGE_MS               (2000U)          /**< Requests first seen this long ago are forgotten */
+#define ITCOM_RECENT_REQ_LIVE                 ((ITCOM_RECENT_REQ_RATE_PER_S * ITCOM_RECENT_REQ_AGE_MS) / 1000U)  /**< Entries live at the peak rate */
+#define ITCOM_RECENT_REQ_SLOTS                (512U)           /**< Recent action request set size, power of two, at most half full at the peak rate */
+#define ITCOM_RECENT_REQ_PROBES               (8U)             /**< Slots examined per lookup (linear probing) */
+
+#define ITCOM_ADMISSION_HIGH_WATER            (15U)            /**< stActionReqQueue entries at which ICM_RX starts shedding requests */
+#define ITCOM_ADMISSION_LOW_WATER             (10U)            /**< Entries at which shedding stops and the busy hint starts */
+#define ITCOM_RETRY_AFTER_PER_REQUEST_MS      (50U)            /**< ARA approves one queued request per cycle */
+#define ITCOM_RETRY_AFTER_UNIT_MS             (10U)            /**< Resolution of the retry-after byte */
+#define ITCOM_NOTIFY_BYTE_CODE                (0U)             /**< Notification payload: state or enNotificationActions code */
+#define ITCOM_NOTIFY_BYTE_OCCUPANCY           (1U)             /**< Notification payload: stActionReqQueue occupancy in percent */
+#define ITCOM_NOTIFY_BYTE_RETRY_AFTER         (2U)             /**< Notification payload: retry-after hint, 0 when not busy */
+
+#define ITCOM_MSG_POOL_BLOCKS                 (32U)            /**< stProcessMsgData blocks in the shared message pool */
+#define ITCOM_POOL_HANDLE_NONE                ((uint16_t)0xFFFFU) /**< No block (pool exhausted, end of free list) */
+#define ITCOM_PAYLOAD_POOL_BLOCKS             (8U)             /**< TLV_MAX_VALUE_SIZE blocks for long message values */
+
+/**
+ * @brief Counts the copies of message data between the pipeline stages.
+ *
+ * When ITCOM_COPY_COUNTING is defined (rx-check) every copy of a message,
+ * a queue entry or a pool handle on its way from ICM_RX to ICM_TX is counted
+ * with its size. In production builds the macro is a no-op.
+ */
+#ifdef ITCOM_COPY_COUNTING
+#define ITCOM_NOTE_MSG_COPY(szBytes)          ITCOM_vNoteMsgCopy((size_t)(szBytes))
+#else
+#define ITCOM_NOTE_MSG_COPY(szBytes)          ((void)0)
+#endif
+
+#define ITCOM_RX_RING_DEPTH                   (8U)             /**< Frames buffered per connection, power of two */
+
+#define ITCOM_TUNING_THREADS                  (8U)             /**< Periodic threads covered by the tuning block */
+#define ITCOM_TUNING_NONE                     (0U)             /**< Generation of a block never tuned */
+#define ITCOM_STACK_THREADS                   (8U)             /**< Periodic threads covered by the stack usage block */
+
+#define ITCOM_TX_WEIGHT_APPROVAL              (2U)             /**< Approvals sent per weighted round */
+#define ITCOM_TX_WEIGHT_NOTIFICATION          (1U)             /**< Notifications sent per weighted round */
+#define ITCOM_TX_DEADLINE_NONE                (0U)             /**< Class without deadline */
+#define ITCOM_TX_DEADLINE_SAFE_STATE_MS       (ITCOM_TX_DEADLINE_NONE)
+#define ITCOM_TX_DEADLINE_APPROVAL_MS         (200U)           /**< Queued approvals older than this are dropped */
+#define ITCOM_TX_DEADLINE_NOTIFICATION_MS     (500U)           /**< Queued notifications older than this are dropped */
+
+#define ITCOM_REGION_LAYOUT_MAGIC             (0x41534952U)    /**< "RISA", first word of the shared memory and of the storage files */
+#define ITCOM_REGION_LAYOUT_VERSION           (1U)
+#define ITCOM_HUGE_PAGE_SIZE                  (2U * 1024U * 1024U) /**< Mapping size granularity with huge_pages=1 */
+#define ITCOM_REGION_BIT(region)              (1U << (uint32_t)(region)) /**< Region mask bit of one ItcomRegion_t */
+#define ITCOM_REGION_ALL                      (ITCOM_REGION_BIT(enTotalRegions) - 1U) /**< Region mask selecting every region */
+#define ITCOM_REGION_OK                       ((int8_t)0)
+#define ITCOM_REGION_NO_CONFIG                ((int8_t)-1)     /**< No configuration file, defaults kept */
+#define ITCOM_REGION_INVALID                  ((int8_t)-2)     /**< Malformed line or capacity out of range */
+
 /*** Type Definitions ***/
 
 /**
@@ -92,6 +183,293 @@ typedef struct {
     struct timespec start_time;
 } ActionRequestTiming_t;
 
+/**
+ * @brief Transmit classes served by ITCOM_s8DequeueTxMessage, in priority order.
+ */
+typedef enum {
+    enTxClassSafeState = 0,     /**< stMsgQueueSS, strict priority, sent in every state */
+    enTxClassApproval,          /**< stApprovedActionsQueue, weighted */
+    enTxClassNotification,      /**< stNotificationQueue (action, SUT and ASI status notifications), weighted */
+    enTotalTxClasses
+} TxClass_t;
+
+/**
+ * @brief Element of the transmit queues: the message and its enqueue time.
+ */
+typedef struct {
+    stProcessMsgData stMsg;     /**< First member, so the entry can be dequeued as a plain stProcessMsgData */
+    uint32_t u32Enqueued_ms;    /**< UT_u32GetCurrentTime_ms() at enqueue */
+} TxQueueEntry_t;
+
+/**
+ * @brief Queueing delay and deadline drops of one transmit class.
+ */
+typedef struct {
+    uint32_t u32Sent;           /**< Messages handed to ICM_TX */
+    uint32_t u32Dropped;        /**< Messages dropped past their deadline */
+    uint32_t u32DelayMax_ms;
+    uint64_t u64DelayTotal_ms;  /**< Sum over sent messages */
+} TxClassStats_t;
+
+/**
+ * @brief State of a slot of the recent action request set.
+ */
+typedef enum {
+    enRecentReqFree = 0,        /**< Slot unused (or forgotten) */
+    enRecentReqPending,         /**< Request accepted, no final notification yet */
+    enRecentReqDecided,         /**< Final notification sent, u8Decision holds it */
+    enTotalRecentReqStates
+} RecentRequestState_t;
+
+/**
+ * @brief One action request seen recently, keyed by (connection, ID, sequence number).
+ */
+typedef struct {
+    uint16_t u16MsgId;
+    uint16_t u16SequenceNum;
+    uint8_t u8Connection;
+    uint8_t u8State;            /**< RecentRequestState_t */
+    uint8_t u8Decision;         /**< enNotificationActions sent for the request */
+    uint32_t u32Seen_ms;        /**< UT_u32GetCurrentTime_ms() of the first arrival */
+} RecentRequestEntry_t;
+
+/**
+ * @brief Counters of the recent action request set.
+ */
+typedef struct {
+    uint32_t u32Requests;       /**< Action requests looked up */
+    uint32_t u32Replayed;       /**< Duplicates answered with the cached decision */
+    uint32_t u32Dropped;        /**< Duplicates of requests still in progress */
+    uint32_t u32Evicted;        /**< Live entries overwritten because their probe window was full */
+} RecentRequestStats_t;
+
+/**
+ * @brief Fixed hash of recently accepted action requests. A repeated request
+ *        (a peer retransmission) is answered from the cached decision or
+ *        dropped instead of being approved a second time.
+ */
+typedef struct {
+    RecentRequestEntry_t astEntries[ITCOM_RECENT_REQ_SLOTS];
+    RecentRequestStats_t stStats;
+} RecentRequestSet_t;
+
+/**
+ * @brief Service level metrics accumulated by the child and evaluated by the parent.
+ */
+typedef struct {
+    uint32_t au32ApprovalLatencyHist[SLO_LATENCY_HIST_BUCKETS];  /**< Request received to approval queued */
+    uint32_t u32ApprovalCount;
+    uint32_t u32ApprovalLatencyMax_ms;
+    uint32_t au32QueueOverflowCount[SLO_TOTAL_QUEUES];           /**< Enqueue attempts rejected with queue full */
+    uint32_t u32ChildRestartCount;
+    uint32_t u32LastRestartTime_ms;                              /**< Restart request to threads running */
+    uint32_t u32MaxRestartTime_ms;
+} SloMetrics_t;
+
+/**
+ * @brief Scheduling parameters of one periodic thread.
+ */
+typedef struct {
+    uint32_t u32Period_ms;
+    uint32_t u32Priority;                               /**< SCHED_FIFO priority, unused under SCHED_DEADLINE */
+    uint64_t u64CpuMask;                                /**< CPUs 0..63 the thread may run on, 0 for any CPU */
+    uint32_t u32Budget_us;                              /**< Work budget per job, 0 derives it from the WCET */
+    uint32_t u32OverrunPct;                             /**< Overrun threshold in percent of the period */
+} ThreadTuning_t;
+
+/**
+ * @brief Runtime tuning of the periodic threads.
+ *
+ * A writer fills astRequested and bumps u32Requested. The child validates
+ * the set against the utilization bound and either copies it to astActive
+ * and publishes the generation in u32Applied, or records it in u32Rejected.
+ * Each thread compares u32Applied with the generation it runs with at its
+ * cycle boundary and picks up its astActive entry when they differ.
+ * The parent never takes a mutex of the child: both arrays are also guarded
+ * by a sequence counter, odd while the array is written, and the parent
+ * writes astRequested and reads astActive through them only.
+ */
+typedef struct {
+    uint32_t u32RequestSeq;                             /**< Odd while astRequested is written */
+    uint32_t u32ActiveSeq;                              /**< Odd while astActive is written */
+    uint32_t u32Requested;                              /**< Generation of astRequested (writer) */
+    uint32_t u32Applied;                                /**< Generation of astActive (child) */
+    uint32_t u32Rejected;                               /**< Last generation that failed validation (child) */
+    uint32_t u32UtilizationPct;                         /**< Highest per-CPU utilization of astActive */
+    ThreadTuning_t astRequested[ITCOM_TUNING_THREADS];
+    ThreadTuning_t astActive[ITCOM_TUNING_THREADS];
+} ThreadTuningBlock_t;
+
+/**
+ * @brief Stack usage of one periodic thread, published by the child.
+ */
+typedef struct {
+    uint32_t u32Size;                                   /**< Stack bytes, guard page excluded, 0 before the thread started */
+    uint32_t u32HighWaterMark;                          /**< Most stack bytes used since the thread started */
+} ThreadStackUsage_t;
+
+/**
+ * @brief Bounded single-producer/single-consumer ring of received frames for
+ *        one TCP connection.
+ *
+ * The socket reader fills slots in place and publishes them by advancing
+ * u32Head; the validation stage consumes them in place and releases them by
+ * advancing u32Tail. Both indices run freely and are masked with
+ * ITCOM_RX_RING_DEPTH - 1. Both stages currently run on the ICM_RX thread,
+ * one after the other, so the ring batches the validation of a cycle; the
+ * acquire/release indices keep it correct if the reader gets its own thread.
+ */
+typedef struct {
+    uint32_t u32Head;                                   /**< Written by the reader only */
+    uint32_t u32Tail;                                   /**< Written by the validation stage only */
+    uint32_t u32HighWater;                              /**< Highest occupancy seen (reader) */
+    uint32_t u32Overflows;                              /**< Reads deferred with data waiting because the ring was full (reader) */
+    uint32_t u32Frames;                                 /**< Frames published (reader) */
+    uint16_t au16Received[ITCOM_RX_RING_DEPTH];         /**< Bytes received into each slot */
+    uint16_t au16Payload[ITCOM_RX_RING_DEPTH];          /**< Payload pool block holding a long value */
+    TLVMessage_t astFrames[ITCOM_RX_RING_DEPTH];
+} RxRing_t;
+
+/**
+ * @brief Snapshot of the counters of one receive ring.
+ */
+typedef struct {
+    uint32_t u32Occupancy;
+    uint32_t u32HighWater;
+    uint32_t u32Overflows;
+    uint32_t u32Frames;
+} RxRingStats_t;
+
+/**
+ * @brief Allocation counters of the shared message pool.
+ */
+typedef struct {
+    uint32_t u32Allocs;
+    uint32_t u32Frees;
+    uint32_t u32Exhausted;          /**< Allocations refused, every block in use */
+    uint32_t u32InUseHigh;          /**< Most blocks in use at once */
+} MsgPoolStats_t;
+
+/**
+ * @brief Lock-free free list of a fixed-block pool. Block i is linked to
+ *        the next free block through the pool's au16Next[i].
+ */
+typedef struct {
+    uint32_t u32FreeHead;           /**< ABA tag (high 16 bits) and first free handle (low 16 bits) */
+    MsgPoolStats_t stStats;
+} PoolFreeList_t;
+
+/**
+ * @brief Fixed-block pool of messages shared by all threads. Blocks are
+ *        taken and returned with a lock-free free list, queues between
+ *        stages carry 16-bit block handles instead of the payload.
+ */
+typedef struct {
+    PoolFreeList_t stFreeList;
+    uint16_t au16Next[ITCOM_MSG_POOL_BLOCKS];
+    stProcessMsgData astBlocks[ITCOM_MSG_POOL_BLOCKS] ITCOM_CACHE_ALIGNED;
+} MsgPool_t;
+
+/**
+ * @brief Pool of message values longer than the inline MSG_PAYLOAD_SIZE
+ *        bytes. A block is held by exactly one stage at a time: the receive
+ *        ring slot, then the message that carries its handle.
+ */
+typedef struct {
+    PoolFreeList_t stFreeList;
+    uint16_t au16Next[ITCOM_PAYLOAD_POOL_BLOCKS];
+    uint8_t aau8Blocks[ITCOM_PAYLOAD_POOL_BLOCKS][TLV_MAX_VALUE_SIZE] ITCOM_CACHE_ALIGNED;
+} PayloadPool_t;
+
+/**
+ * @brief Variable-size regions placed after DataOnSharedMemory by the
+ *        region layout descriptor.
+ */
+typedef enum {
+    enRegionActionReqQueue = 0,     /**< stActionReqQueue: uint16_t pool handles */
+    enRegionApprovedQueue,          /**< stApprovedActionsQueue: TxQueueEntry_t */
+    enRegionSafeStateQueue,         /**< stMsgQueueSS: TxQueueEntry_t */
+    enRegionNotificationQueue,      /**< stNotificationQueue: TxQueueEntry_t */
+    enRegionCycleSeqTrack,          /**< stCycleSeqTrack: stMsgIntegrityData */
+    enRegionCalibDataCopyTrack,     /**< stCalibrationDataCopyTrack: stProcessMsgData */
+    enRegionCalibReadbackTrack,     /**< stCalibrationReadbackTrack: stProcessMsgData */
+    enRegionEventStore,             /**< Event_Queue: event IDs */
+    enRegionSloMetrics,             /**< pstSloMetrics: one SloMetrics_t */
+    enTotalRegions
+} ItcomRegion_t;
+
+/**
+ * @brief Placement of one region, offsets are from the start of the mapping.
+ */
+typedef struct {
+    uint32_t u32Offset;             /**< Cache line aligned */
+    uint32_t u32Capacity;           /**< Elements */
+    uint32_t u32ElementSize;
+    uint32_t u32Size;               /**< u32Capacity * u32ElementSize */
+} ItcomRegionDesc_t;
+
+/**
+ * @brief Region layout descriptor, built at startup from the configuration
+ *        and stored at offset 0 of the mapping. The storage files carry it
+ *        too, so a file written with another layout can still be reloaded.
+ */
+typedef struct {
+    uint32_t u32Magic;              /**< ITCOM_REGION_LAYOUT_MAGIC */
+    uint32_t u32Version;            /**< ITCOM_REGION_LAYOUT_VERSION */
+    uint32_t u32HeaderSize;         /**< sizeof(DataOnSharedMemory), start of the first region */
+    uint32_t u32DataSize;           /**< End of the last region, bytes persisted to storage */
+    uint32_t u32MappingSize;        /**< u32DataSize rounded up to the page size in use */
+    uint8_t u8HugePages;            /**< Mapping requested with huge pages */
+    ItcomRegionDesc_t astRegions[enTotalRegions];
+} ItcomRegionLayout_t;
+
+/**
+ * @brief Region capacities read from the layout configuration file.
+ */
+typedef struct {
+    uint32_t au32Capacity[enTotalRegions];
+    bool bHugePages;
+} ItcomRegionConfig_t;
+
+/**
+ * @brief Updates that can be staged in an ITCOM transaction.
+ */
+typedef enum {
+    enTxnRecordRC = 0,
+    enTxnSetMsgCycleCount,
+    enTxnSaveMsgData,
+    enTxnActionRequestStartTime,
+    enTotalTxnOps
+} ItcomTxnOpType_t;
+
+/**
+ * @brief One staged update; s8Result is filled in by the commit.
+ */
+typedef struct {
+    ItcomTxnOpType_t enType;
+    uint8_t u8Arg;                    /**< RC direction, cycle count action or receiving connection */
+    int16_t s16Indx;                  /**< Message instance */
+    int8_t s8Result;                  /**< Result of the update (enTxnSaveMsgData: enqueue status) */
+    union {
+        uint16_t u16RollingCounter;
+        stMsgIntegrityData stMsgTracker;
+        struct {
+            uint16_t u16Handle;       /**< Pool block holding the payload, ITCOM_POOL_HANDLE_NONE if exhausted */
+            stIdSequencePair stMsgPair;
+        } stPooledMsg;
+        ActionRequestTiming_t stTiming;
+    } uData;
+} ItcomTxnOp_t;
+
+/**
+ * @brief Batch of ITCOM updates staged locally and applied under a single
+ *        acquisition of the common mutex (ITCOM_s8TxnCommit).
+ */
+typedef struct {
+    uint8_t u8OpCount;
+    ItcomTxnOp_t astOps[ITCOM_TXN_MAX_OPS];
+} ItcomTransaction_t;
+
 /**
  * @brief Structure defining the private data for Thread CCU.
  */
@@ -110,9 +488,14 @@ typedef struct {
 
 /**
  * @brief Structure defining the private data for Thread ICM_RX.
+ *
+ * The error counters are owned by ICM_RX: only that thread writes them
+ * (ITCOM_OWNER_STORE), other threads read them with
+ * ITCOM_vGetRxErrorCountSnapshot. The receive rings are accessed through
+ * the ITCOM_*RxRing* functions only.
  */
 typedef struct {
-	TLVMessage_t stReceivedTCPMsg;
+	RxRing_t astRxRing[enTotalTCPConnections];
 	uint8_t u8CrcErrorCounter[enTotalMessagesASI];
 	uint8_t u8RollingCounterError[enTotalMessagesASI];
     pthread_mutex_t mutex;
@@ -129,9 +512,16 @@ typedef struct {
 
 /**
  * @brief Structure defining the private data for Thread ICM_TX.
+ *
+ * The rate limiter is owned by ICM_TX (set once by ICM_vInit before the
+ * threads start, then only by ICM_TX) and accessed without the mutex.
+ * The TX scheduler credits and class statistics are only written by
+ * ITCOM_s8DequeueTxMessage on behalf of ICM_TX, under the common mutex.
  */
 typedef struct {
 	RateLimiter_t stRateLimiter;
+	uint8_t au8TxCredits[enTotalTxClasses];
+	TxClassStats_t astTxClassStats[enTotalTxClasses];
     pthread_mutex_t mutex;
     sem_t sem;
 } SM_THRD_ICM_TX_Private_Data_t;
@@ -184,21 +574,20 @@ typedef struct {
     uint16_t u16GnrlCycleCount;
     stRollingCountData_t stRollingCounterRegister[enTotalMessagesASI];
     stSequenceNumberData_t stSeqNumberRegister[enTotalMessagesASI];
-    stIMBuffer stCycleSeqTrack;
-    stIMBuffer stCalibrationDataCopyTrack;
-    stIMBuffer stCalibrationReadbackTrack;
-    stProcessMsgData astDataIntegrityMsgBuffer[MSG_QUEUE_BUFFER_SIZE]; //Arbitrarily selected buffer size
-    data_queue_t stActionReqQueue;
-    stProcessMsgData astApprovedMsgBuffer[MSG_QUEUE_BUFFER_SIZE]; //Arbitrarily selected buffer size
-    data_queue_t stApprovedActionsQueue;
-    stProcessMsgData astSSMsgBuffer[MSG_QUEUE_BUFFER_SIZE]; //Arbitrarily selected buffer size
-    data_queue_t stMsgQueueSS;
+    stIMBuffer stCycleSeqTrack;             /* Elements in enRegionCycleSeqTrack */
+    stIMBuffer stCalibrationDataCopyTrack;  /* Elements in enRegionCalibDataCopyTrack */
+    stIMBuffer stCalibrationReadbackTrack;  /* Elements in enRegionCalibReadbackTrack */
+    data_queue_t stActionReqQueue;          /* stMsgPool handles in enRegionActionReqQueue, payload stays in the pool */
+    data_queue_t stApprovedActionsQueue;    /* Entries in enRegionApprovedQueue */
+    data_queue_t stMsgQueueSS;              /* Entries in enRegionSafeStateQueue */
+    data_queue_t stNotificationQueue;       /* Entries in enRegionNotificationQueue */
+    RecentRequestSet_t stRecentRequests;
     /// ARA
     stVehicleStatusInfo_t stVehicleStatus;
     ActionRequestTiming_t astActionRequestTiming[MAX_PENDING_ACTION_REQUESTS];
     uint8_t u8ActionRequestTimingCount; // To keep track of the number of entries
     /// FM
-    uint8_t Event_Queue[DATA_QUEUE_MAX_SIZE];
+    uint8_t* Event_Queue;                   /* enRegionEventStore */
     int8_t Event_Queue_Index;
     SystemSnapshot_t SystemSnapshotData;
     /// SD
@@ -206,25 +595,33 @@ typedef struct {
     TCPConnectionState_t enTCPConnectionState[enTotalTCPConnections];
     /// CRV
     uint8_t u8CalibComparisonResult;
+    /// SLO MONITOR
+    SloMetrics_t* pstSloMetrics;            /* enRegionSloMetrics */
     /// POSIX HANDLER
-    pthread_mutex_t mutex;
+    pthread_mutex_t mutex ITCOM_CACHE_ALIGNED; /* Taken by every thread, kept off the data lines */
 } SM_Common_Public_Data;
 
 /**
  * @brief Main structure defining all data shared in the application.
- * It includes private data for each thread and common public data.
- */
-typedef struct {
-    SM_THRD_CCU_Private_Data_t stThread_CCU;
-    SM_THRD_STM_Private_Data_t stThread_STM;
-    SM_THRD_ICM_RX_Private_Data_t stThread_ICM_RX;
-    SM_THRD_ARA_Private_Data_t stThread_ARA;
-    SM_THRD_ICM_TX_Private_Data_t stThread_ICM_TX;
-    SM_THRD_FM_Private_Data stThread_FM;
-    SM_THRD_SD_Private_Data_t stThread_SD;
-    SM_THRD_CRV_Private_Data_t stThread_CRV;
-    SM_Common_Public_Data stThreadsCommonData;
-    volatile sig_atomic_t parent_initiated_termination;
+ * It includes private data for each thread and common public data. The
+ * regions listed in stRegionLayout follow it in the same mapping.
+ */
+typedef struct {
+    ItcomRegionLayout_t stRegionLayout ITCOM_CACHE_ALIGNED;
+    SM_THRD_CCU_Private_Data_t stThread_CCU ITCOM_CACHE_ALIGNED;
+    SM_THRD_STM_Private_Data_t stThread_STM ITCOM_CACHE_ALIGNED;
+    SM_THRD_ICM_RX_Private_Data_t stThread_ICM_RX ITCOM_CACHE_ALIGNED;
+    SM_THRD_ARA_Private_Data_t stThread_ARA ITCOM_CACHE_ALIGNED;
+    SM_THRD_ICM_TX_Private_Data_t stThread_ICM_TX ITCOM_CACHE_ALIGNED;
+    SM_THRD_FM_Private_Data stThread_FM ITCOM_CACHE_ALIGNED;
+    SM_THRD_SD_Private_Data_t stThread_SD ITCOM_CACHE_ALIGNED;
+    SM_THRD_CRV_Private_Data_t stThread_CRV ITCOM_CACHE_ALIGNED;
+    MsgPool_t stMsgPool ITCOM_CACHE_ALIGNED;
+    PayloadPool_t stPayloadPool ITCOM_CACHE_ALIGNED;
+    ThreadTuningBlock_t stThreadTuning ITCOM_CACHE_ALIGNED;
+    ThreadStackUsage_t astThreadStack[ITCOM_STACK_THREADS] ITCOM_CACHE_ALIGNED;
+    SM_Common_Public_Data stThreadsCommonData ITCOM_CACHE_ALIGNED;
+    volatile sig_atomic_t parent_initiated_termination ITCOM_CACHE_ALIGNED;
 } DataOnSharedMemory;
 
 
@@ -254,6 +651,7 @@ typedef struct {
     uint16_t u16MessageTypeID;
     uint8_t u8MessageTypeEnum;
     uint8_t au8AssociatedLengths[NUM_ASSOCIATED_LENGHTS];
+    uint16_t u16MaxLength;          /**< Every length above TLV_VALUE_SIZE up to this one is accepted, 0 for none */
 } MessageTypeDictionary_t;
 
 
@@ -271,6 +669,9 @@ extern void ITCOM_vWrapperThread_ICM_TX(void);
 extern void ITCOM_vWrapperThread_FM(void);
 extern void ITCOM_vWrapperThread_SD(void);
 extern void ITCOM_vWrapperThread_CRV(void);
+#ifdef THRD_CYCLIC_EXECUTIVE
+extern void ITCOM_vWrapperFrame_50ms(void);
+#endif
 extern void ITCOM_vChildProcessWrapper(FILE* itcom_log_file, enRestartReason start_reason);
 extern void ITCOM_vParentdProcessWrapper(FILE* itcom_log_file);
 extern void ITCOM_vSetParentTerminationFlag(uint8_t u8Value);
@@ -291,9 +692,31 @@ extern int8_t ITCOM_s8SaveMsgData(stProcessMsgData* pstMsgPayload, int16_t s16In
 extern int8_t ITCOM_s8QueueActionReq(stProcessMsgData* pstMsgInfo);
 extern int8_t ITCOM_s8DequeueActionReq(stProcessMsgData* pstActionReqData, uint8_t u8SelectQueue);
 extern int8_t ITCOM_s8LogSSMessage(void);
+extern int8_t ITCOM_s8DequeueTxMessage(stProcessMsgData* pstMsgData, uint8_t u8ASIState, uint8_t* pu8Class);
+extern void ITCOM_vGetTxClassStats(TxClassStats_t* pastStats);
+extern void ITCOM_vGetRecentRequestStats(RecentRequestStats_t* pstStats);
+extern uint8_t ITCOM_u8GetActionReqOccupancy(void);
+extern uint16_t ITCOM_u16PoolAlloc(void);
+extern void ITCOM_vPoolFree(uint16_t u16Handle);
+extern stProcessMsgData* ITCOM_pstPoolBlock(uint16_t u16Handle);
+extern void ITCOM_vGetPoolStats(MsgPoolStats_t* pstStats);
+extern uint16_t ITCOM_u16PayloadAlloc(void);
+extern void ITCOM_vPayloadFree(uint16_t u16Handle);
+extern uint8_t* ITCOM_pu8PayloadBlock(uint16_t u16Handle);
+extern void ITCOM_vGetPayloadPoolStats(MsgPoolStats_t* pstStats);
+extern uint8_t* ITCOM_pu8MsgPayload(stProcessMsgData* pstMsgData);
+extern void ITCOM_vReleaseMsgPayload(stProcessMsgData* pstMsgData);
+#ifdef ITCOM_COPY_COUNTING
+extern void ITCOM_vNoteMsgCopy(size_t szBytes);
+extern void ITCOM_vGetMsgCopyCount(uint32_t* pu32Copies, uint64_t* pu64Bytes);
+#endif
 extern int8_t ITCOM_s8LogNotificationMessage(uint16_t u16MsgId, uint16_t u16SequenceNum , uint8_t u8Data, uint8_t u8SelectNotification);
 extern void ITCOM_vSetSeqNumASIRecord(uint16_t u16SequenceNum, uint8_t u8Indx);
 extern uint16_t ITCOM_u16GetSeqNumASIRecord(uint8_t u8Indx);
+extern uint16_t ITCOM_u16AllocSeqNumASI(uint8_t u8Indx);
+extern uint16_t ITCOM_u16AllocTxRollingCounter(uint8_t u8MsgInstance);
+extern bool ITCOM_bReleaseSeqNumASI(uint8_t u8Indx, uint16_t u16SequenceNum);
+extern bool ITCOM_bReleaseTxRollingCounter(uint8_t u8MsgInstance, uint16_t u16RollingCounter);
 extern void ITCOM_vRecordRC(uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction);
 extern int16_t ITCOM_u16GetRCData(uint8_t u8MsgInstance, uint8_t u8Direction);
 extern void ITCOM_vSetParkStatus(uint8_t u8ParkStatus, uint8_t u8Status);
@@ -310,13 +733,17 @@ extern int16_t ITCOM_s16GetMessageEnumById(uint16_t u16MsgId);
 extern int16_t ITCOM_s16GetMessageEnumFromTypeAndId(uint16_t u16MsgType, uint16_t u16MsgId, enTCPConnectionsASI enTCPConn);
 extern void ITCOM_vGetMsgTypeDictionaryEntryAtIndex(MessageTypeDictionary_t* pstDictionaryTypeData, uint16_t u16MsgId);
 extern void ITCOM_vGetMsgDictionaryEntryAtIndex(MessageDictionary_t* pstDictionaryData, uint16_t u16MsgId);
-extern int8_t ITCOM_s8ValidateMessageTypeLength(uint16_t u16MsgType, uint8_t u8Length);
+extern int8_t ITCOM_s8ValidateMessageTypeLength(uint16_t u16MsgType, uint16_t u16Length);
 extern uint16_t ITCOM_u16GetTrackBufferSize(uint8_t u8SelectBuffer);
+extern bool ITCOM_bTrackBufferHasData(uint8_t u8SelectBuffer);
+extern bool ITCOM_bQueueHasData(uint8_t u8SelectQueue);
+extern bool ITCOM_bErrorEventPending(void);
 extern void ITCOM_vGetCycleSeqElementAtIndex(uint16_t u16Indx, generic_ptr_t pvElement, uint8_t u8SelectBuffer);
 extern void ITCOM_vSetCrcErrorCount(uint8_t u8Indx, uint8_t u8Value);
 extern uint8_t ITCOM_u8GetCrcErrorCount(uint8_t u8Indx);
 extern void ITCOM_vSetRollingCountError(uint8_t u8Indx, uint8_t u8Value);
 extern uint8_t ITCOM_u8GetRollingCountError(uint8_t u8Indx);
+extern void ITCOM_vGetRxErrorCountSnapshot(uint8_t* pau8CrcErrors, uint8_t* pau8RcErrors);
 extern void ITCOM_vSetMsgRateLimiter(RateLimiter_t* pstRateLimiter);
 extern void ITCOM_vGetMsgRateLimiter(RateLimiter_t* pstRateLimiter);
 extern void ITCOM_vSetErrorProcessingFlag(int16_t s16Value);
@@ -341,4 +768,42 @@ extern void ITCOM_vSetCalibComparisonResult(uint8_t u8Result);
 
 extern void ITCOM_vSetActionRequestStartTime(uint16_t u16MsgId, uint16_t u16SequenceNum);
 
+extern void ITCOM_vTxnBegin(ItcomTransaction_t* pstTxn);
+extern int8_t ITCOM_s8TxnRecordRC(ItcomTransaction_t* pstTxn, uint8_t u8MsgInstance, uint16_t u16RollingCounter, uint8_t u8Direction);
+extern int8_t ITCOM_s8TxnSetMsgCycleCount(ItcomTransaction_t* pstTxn, const stMsgIntegrityData* pstTempMsgTracker, uint8_t u8Action);
+extern int8_t ITCOM_s8TxnSaveMsgData(ItcomTransaction_t* pstTxn, const stProcessMsgData* pstMsgPayload, int16_t s16Indx, uint8_t u8Connection);
+extern int8_t ITCOM_s8TxnSetActionRequestStartTime(ItcomTransaction_t* pstTxn, uint16_t u16MsgId, uint16_t u16SequenceNum);
+extern int8_t ITCOM_s8TxnCommit(ItcomTransaction_t* pstTxn);
+extern int8_t ITCOM_s8TxnGetResult(const ItcomTransaction_t* pstTxn, int8_t s8Op);
+
+extern void ITCOM_vRxRingReset(void);
+extern TLVMessage_t* ITCOM_pstRxRingGetWriteSlot(uint8_t u8Connection);
+extern void ITCOM_vRxRingCountOverflow(uint8_t u8Connection);
+extern void ITCOM_vRxRingCommitWrite(uint8_t u8Connection, uint16_t u16Received, uint16_t u16Payload);
+extern TLVMessage_t* ITCOM_pstRxRingGetReadSlot(uint8_t u8Connection, uint16_t* pu16Received, uint16_t* pu16Payload);
+extern void ITCOM_vRxRingCommitRead(uint8_t u8Connection);
+extern void ITCOM_vGetRxRingStats(uint8_t u8Connection, RxRingStats_t* pstStats);
+
+extern void ITCOM_vRecordChildRestartTime(uint32_t u32RestartTime_ms);
+extern void ITCOM_vGetSloMetrics(SloMetrics_t* pstSloMetrics);
+extern void ITCOM_vRequestThreadTuning(const ThreadTuning_t* pastTuning);
+extern uint32_t ITCOM_u32GetThreadTuningPending(void);
+extern uint32_t ITCOM_u32GetThreadTuningRequest(ThreadTuning_t* pastTuning);
+extern void ITCOM_vPublishThreadTuning(uint32_t u32Generation, const ThreadTuning_t* pastTuning, uint32_t u32UtilizationPct);
+extern void ITCOM_vRejectThreadTuning(uint32_t u32Generation);
+extern uint32_t ITCOM_u32GetThreadTuningApplied(void);
+extern uint32_t ITCOM_u32GetThreadTuningRejected(void);
+extern void ITCOM_vGetActiveThreadTuning(uint8_t u8Thread, ThreadTuning_t* pstTuning);
+extern bool ITCOM_bGetActiveThreadTuningSet(ThreadTuning_t* pastTuning);
+extern void ITCOM_vSetThreadStackUsage(uint8_t u8Thread, uint32_t u32Size, uint32_t u32HighWaterMark);
+extern void ITCOM_vGetThreadStackUsage(uint8_t u8Thread, ThreadStackUsage_t* pstUsage);
+extern uint32_t ITCOM_u32GetEventStoreCapacity(void);
+extern void ITCOM_vDefaultRegionConfig(ItcomRegionConfig_t* pstConfig);
+extern int8_t ITCOM_s8LoadRegionConfig(const char* pcPath, ItcomRegionConfig_t* pstConfig, uint32_t* pu32BadLine);
+extern int8_t ITCOM_s8BuildRegionLayout(const ItcomRegionConfig_t* pstConfig, ItcomRegionLayout_t* pstLayout, uint8_t* pu8BadRegion);
+extern bool ITCOM_bRegionLayoutValid(const ItcomRegionLayout_t* pstLayout, size_t szFileSize);
+extern const char* ITCOM_pcRegionName(uint8_t u8Region);
+extern void ITCOM_vReportSharedMemoryLayout(FILE* pFile, const ItcomRegionLayout_t* pstLayout);
+extern void ITCOM_vLogSharedMemoryUsage(FILE* itcom_log_file, const ItcomRegionLayout_t* pstLayout);
+
 #endif // ITCOM_H
@@ -0,0 +1,589 @@
+//*****************************************************************************
+/**
+* @file itcom_layout.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+*
+* @brief footprint and cache line layout report for DataOnSharedMemory,
+*        region layout descriptor of the shared memory mapping
+*
+* @details The report is generated from offsetof/sizeof, so it always
+*          matches the compiled structure. It is available both at runtime
+*          (ITCOM_vReportSharedMemoryLayout) and as a host tool built with
+*          "make layout-report" from test/itcom_layout_report.c. The tool
+*          reports the default region layout, or the one of the
+*          configuration file given as its argument.
+*
+*          The queues, tracking buffers, event store and SLO metrics live
+*          in regions placed after DataOnSharedMemory. Their capacities
+*          come from a key = value configuration file read at startup:
+*
+*              # capacities in elements, '#' starts a comment
+*              action_request_queue = 24
+*              event_store = 64
+*              huge_pages = 1
+*
+*          Keys left out keep their default capacity.
+*
+* @authors Tusar Palauri
+*
+* @date October 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+* 10/18/2026|TP |Notification queue
+* 10/18/2026|TP |Recent action request set
+* 10/18/2026|TP |Message pool
+* 10/18/2026|TP |Payload pool
+* 10/18/2026|TP |Thread tuning block
+* 10/18/2026|TP |Thread stack usage
+* 10/18/2026|TP |Region layout descriptor, configuration file and region report
+* 10/18/2026|TP |Layout report main moved to test/itcom_layout_report.c
+*
+*/
+//*****************************************************************************
+
+
+/*** Include Files ***/
+#include <stddef.h>
+#include <ctype.h>
+
+#include "itcom.h"
+#include "storage_handler.h"
+
+
+
+/*** Module Definitions ***/
+#define LAYOUT_LEVEL_DOMAIN                   (0U)        /**< Member of DataOnSharedMemory */
+#define LAYOUT_LEVEL_COMMON                   (1U)        /**< Member of SM_Common_Public_Data */
+
+#define LAYOUT_DOMAIN(member) \
+    { #member, offsetof(DataOnSharedMemory, member), sizeof(((DataOnSharedMemory*)0)->member), LAYOUT_LEVEL_DOMAIN }
+#define LAYOUT_COMMON(member) \
+    { #member, offsetof(DataOnSharedMemory, stThreadsCommonData.member), \
+      sizeof(((DataOnSharedMemory*)0)->stThreadsCommonData.member), LAYOUT_LEVEL_COMMON }
+
+#define LAYOUT_LINE(offset)                   ((offset) / (size_t)ITCOM_CACHE_LINE_SIZE)
+#define LAYOUT_ALIGN(value, align)            ((((value) + (align)) - 1U) / (align) * (align))
+
+#define REGION_CONFIG_LINE_SIZE               (128U)
+#define REGION_CONFIG_HUGE_PAGES              "huge_pages"
+
+_Static_assert(offsetof(DataOnSharedMemory, stRegionLayout) == 0U,
+               "The region layout descriptor must start the mapping and the storage files");
+_Static_assert((sizeof(DataOnSharedMemory) % ITCOM_CACHE_LINE_SIZE) == 0U,
+               "The first region must start on a cache line");
+_Static_assert((sizeof(stProcessMsgData) <= MAX_ELEMENT_SIZE) && (sizeof(stMsgIntegrityData) <= MAX_ELEMENT_SIZE),
+               "Tracking buffer elements must fit MAX_ELEMENT_SIZE");
+_Static_assert(enTotalRegions <= 32U, "Region masks are 32-bit");
+
+
+/*** Internal Types ***/
+typedef struct {
+    const char* pcName;
+    size_t szOffset;
+    size_t szSize;
+    uint8_t u8Level;
+} ItcomLayoutEntry_t;
+
+typedef struct {
+    const char* pcKey;              /**< Configuration key, also the name in reports */
+    uint32_t u32ElementSize;
+    uint32_t u32Default;
+    uint32_t u32Min;
+    uint32_t u32Max;
+} ItcomRegionInfo_t;
+
+
+/*** Local Function Prototypes ***/
+static size_t itcom_szLayoutPadding(uint8_t u8Level, size_t szStart, size_t szEnd);
+static char* itcom_pcTrim(char* pcText);
+static int8_t itcom_s8ParseConfigLine(char* pcLine, ItcomRegionConfig_t* pstConfig);
+
+
+/*** External Variables ***/
+
+
+/*** Internal Variables ***/
+static const ItcomLayoutEntry_t itcom_astLayout[] = {
+    LAYOUT_DOMAIN(stRegionLayout),
+    LAYOUT_DOMAIN(stThread_CCU),
+    LAYOUT_DOMAIN(stThread_STM),
+    LAYOUT_DOMAIN(stThread_ICM_RX),
+    LAYOUT_DOMAIN(stThread_ARA),
+    LAYOUT_DOMAIN(stThread_ICM_TX),
+    LAYOUT_DOMAIN(stThread_FM),
+    LAYOUT_DOMAIN(stThread_SD),
+    LAYOUT_DOMAIN(stThread_CRV),
+    LAYOUT_DOMAIN(stMsgPool),
+    LAYOUT_DOMAIN(stPayloadPool),
+    LAYOUT_DOMAIN(stThreadTuning),
+    LAYOUT_DOMAIN(astThreadStack),
+    LAYOUT_DOMAIN(stThreadsCommonData),
+    /* STATE MACHINE */
+    LAYOUT_COMMON(u8ASI_State),
+    LAYOUT_COMMON(u8CriticalFaultFlag),
+    LAYOUT_COMMON(u8InitFinishFlag),
+    /* START-UP TEST */
+    LAYOUT_COMMON(stSUTResults),
+    LAYOUT_COMMON(stSutTimeRegister),
+    LAYOUT_COMMON(stActionListTestResults),
+    LAYOUT_COMMON(stPrecondTestResults),
+    LAYOUT_COMMON(stMemoryTestResults),
+    /* ICM */
+    LAYOUT_COMMON(u16GnrlCycleCount),
+    LAYOUT_COMMON(stRollingCounterRegister),
+    LAYOUT_COMMON(stSeqNumberRegister),
+    LAYOUT_COMMON(stCycleSeqTrack),
+    LAYOUT_COMMON(stCalibrationDataCopyTrack),
+    LAYOUT_COMMON(stCalibrationReadbackTrack),
+    LAYOUT_COMMON(stActionReqQueue),
+    LAYOUT_COMMON(stApprovedActionsQueue),
+    LAYOUT_COMMON(stMsgQueueSS),
+    LAYOUT_COMMON(stNotificationQueue),
+    LAYOUT_COMMON(stRecentRequests),
+    /* ARA */
+    LAYOUT_COMMON(stVehicleStatus),
+    LAYOUT_COMMON(astActionRequestTiming),
+    LAYOUT_COMMON(u8ActionRequestTimingCount),
+    /* FM */
+    LAYOUT_COMMON(Event_Queue),
+    LAYOUT_COMMON(Event_Queue_Index),
+    LAYOUT_COMMON(SystemSnapshotData),
+    /* SD */
+    LAYOUT_COMMON(stStateMonitorData),
+    LAYOUT_COMMON(enTCPConnectionState),
+    /* CRV */
+    LAYOUT_COMMON(u8CalibComparisonResult),
+    /* SLO MONITOR */
+    LAYOUT_COMMON(pstSloMetrics),
+    /* POSIX HANDLER */
+    LAYOUT_COMMON(mutex),
+    LAYOUT_DOMAIN(parent_initiated_termination)
+};
+
+/* Indexed by ItcomRegion_t. The action request queue stays above the admission
+ * high water mark and below the message pool size, the event store index is an
+ * int8_t, the SLO metrics area is a single structure placed by the descriptor */
+static const ItcomRegionInfo_t itcom_astRegionInfo[enTotalRegions] = {
+    { "action_request_queue",  sizeof(uint16_t),           MSG_QUEUE_BUFFER_SIZE, ITCOM_ADMISSION_HIGH_WATER + 1U, ITCOM_MSG_POOL_BLOCKS - 1U },
+    { "approved_actions_queue", sizeof(TxQueueEntry_t),    MSG_QUEUE_BUFFER_SIZE, 1U,                  UINT8_MAX },
+    { "safe_state_queue",      sizeof(TxQueueEntry_t),     MSG_QUEUE_BUFFER_SIZE, 1U,                  UINT8_MAX },
+    { "notification_queue",    sizeof(TxQueueEntry_t),     MSG_QUEUE_BUFFER_SIZE, 1U,                  UINT8_MAX },
+    { "cycle_seq_track",       sizeof(stMsgIntegrityData), NUM_TRACKED_ELEMENTS,  MIN_BUFFER_CAPACITY, MAX_BUFFER_CAPACITY },
+    { "calib_data_copy_track", sizeof(stProcessMsgData),   NUM_TRACKED_ELEMENTS,  MIN_BUFFER_CAPACITY, MAX_BUFFER_CAPACITY },
+    { "calib_readback_track",  sizeof(stProcessMsgData),   NUM_TRACKED_ELEMENTS,  MIN_BUFFER_CAPACITY, MAX_BUFFER_CAPACITY },
+    { "event_store",           sizeof(uint8_t),            DATA_QUEUE_MAX_SIZE,   1U,                  INT8_MAX },
+    { "slo_metrics",           sizeof(SloMetrics_t),       1U,                    1U,                  1U }
+};
+
+
+/*** External Functions ***/
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vDefaultRegionConfig
+//*****************************************************************************
+/**
+*
+* @brief Fills a region configuration with the compile-time default capacities.
+*
+* @param [out] pstConfig Configuration to fill
+*
+* @return none
+*/
+void ITCOM_vDefaultRegionConfig(ItcomRegionConfig_t* pstConfig) {
+    uint8_t i;
+
+    if (pstConfig != NULL) {
+        for (i = 0U; i < (uint8_t)enTotalRegions; i++) {
+            pstConfig->au32Capacity[i] = itcom_astRegionInfo[i].u32Default;
+        }
+        pstConfig->bHugePages = false;
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s8LoadRegionConfig
+//*****************************************************************************
+/**
+*
+* @brief Reads region capacities from a key = value configuration file.
+*
+* @details Keys are the region names of ITCOM_pcRegionName and "huge_pages"
+*          (0 or 1). Capacities are range checked by ITCOM_s8BuildRegionLayout.
+*          On any error the configuration is left at the defaults, so a bad
+*          file never yields a half-applied layout.
+*
+* @param [in] pcPath Configuration file
+* @param [out] pstConfig Configuration read, defaults for keys left out
+* @param [out] pu32BadLine First rejected line on ITCOM_REGION_INVALID
+*
+* @return ITCOM_REGION_OK, ITCOM_REGION_NO_CONFIG or ITCOM_REGION_INVALID
+*/
+int8_t ITCOM_s8LoadRegionConfig(const char* pcPath, ItcomRegionConfig_t* pstConfig, uint32_t* pu32BadLine) {
+    char acLine[REGION_CONFIG_LINE_SIZE];
+    uint32_t u32Line = 0U;
+    int8_t s8Result = ITCOM_REGION_OK;
+    FILE* pFile;
+
+    ITCOM_vDefaultRegionConfig(pstConfig);
+    if ((pcPath == NULL) || (pstConfig == NULL)) {
+        return ITCOM_REGION_NO_CONFIG;
+    }
+
+    pFile = fopen(pcPath, "r");
+    if (pFile == NULL) {
+        return ITCOM_REGION_NO_CONFIG;
+    }
+
+    while ((s8Result == ITCOM_REGION_OK) && (fgets(acLine, (int)sizeof(acLine), pFile) != NULL)) {
+        u32Line++;
+        if ((strchr(acLine, '\n') == NULL) && (feof(pFile) == 0)) {
+            s8Result = ITCOM_REGION_INVALID;    /* Line longer than the buffer */
+        } else {
+            s8Result = itcom_s8ParseConfigLine(acLine, pstConfig);
+        }
+    }
+    (void)fclose(pFile);
+
+    if (s8Result != ITCOM_REGION_OK) {
+        ITCOM_vDefaultRegionConfig(pstConfig);
+        if (pu32BadLine != NULL) {
+            *pu32BadLine = u32Line;
+        }
+    }
+
+    return s8Result;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_s8BuildRegionLayout
+//*****************************************************************************
+/**
+*
+* @brief Places the regions of a configuration after DataOnSharedMemory.
+*
+* @details Every region starts on its own cache line, in ItcomRegion_t order.
+*          The mapping size is the end of the last region rounded up to the
+*          page size, or to ITCOM_HUGE_PAGE_SIZE when huge pages are asked for.
+*
+* @param [in] pstConfig Region capacities
+* @param [out] pstLayout Descriptor built
+* @param [out] pu8BadRegion Region whose capacity is out of range on ITCOM_REGION_INVALID
+*
+* @return ITCOM_REGION_OK or ITCOM_REGION_INVALID
+*/
+int8_t ITCOM_s8BuildRegionLayout(const ItcomRegionConfig_t* pstConfig, ItcomRegionLayout_t* pstLayout, uint8_t* pu8BadRegion) {
+    uint32_t u32Cursor = (uint32_t)sizeof(DataOnSharedMemory);
+    uint32_t u32PageSize;
+    uint8_t i;
+
+    if ((pstConfig == NULL) || (pstLayout == NULL)) {
+        return ITCOM_REGION_INVALID;
+    }
+
+    (void)memset(pstLayout, 0, sizeof(*pstLayout));
+    for (i = 0U; i < (uint8_t)enTotalRegions; i++) {
+        const ItcomRegionInfo_t* pstInfo = &itcom_astRegionInfo[i];
+        ItcomRegionDesc_t* pstRegion = &pstLayout->astRegions[i];
+
+        if ((pstConfig->au32Capacity[i] < pstInfo->u32Min) || (pstConfig->au32Capacity[i] > pstInfo->u32Max)) {
+            if (pu8BadRegion != NULL) {
+                *pu8BadRegion = i;
+            }
+            return ITCOM_REGION_INVALID;
+        }
+
+        pstRegion->u32Offset = u32Cursor;
+        pstRegion->u32Capacity = pstConfig->au32Capacity[i];
+        pstRegion->u32ElementSize = pstInfo->u32ElementSize;
+        pstRegion->u32Size = pstRegion->u32Capacity * pstRegion->u32ElementSize;
+        u32Cursor = LAYOUT_ALIGN(u32Cursor + pstRegion->u32Size, (uint32_t)ITCOM_CACHE_LINE_SIZE);
+    }
+
+    u32PageSize = pstConfig->bHugePages ? ITCOM_HUGE_PAGE_SIZE : (uint32_t)sysconf(_SC_PAGESIZE);
+    pstLayout->u32Magic = ITCOM_REGION_LAYOUT_MAGIC;
+    pstLayout->u32Version = ITCOM_REGION_LAYOUT_VERSION;
+    pstLayout->u32HeaderSize = (uint32_t)sizeof(DataOnSharedMemory);
+    pstLayout->u32DataSize = u32Cursor;
+    pstLayout->u32MappingSize = LAYOUT_ALIGN(u32Cursor, u32PageSize);
+    pstLayout->u8HugePages = pstConfig->bHugePages ? 1U : 0U;
+
+    return ITCOM_REGION_OK;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_bRegionLayoutValid
+//*****************************************************************************
+/**
+*
+* @brief Checks a descriptor read back from a storage file.
+*
+* @details The descriptor must come from a build with the same
+*          DataOnSharedMemory, describe exactly szFileSize bytes and hold
+*          ordered, non-overlapping regions. Capacities may differ from the
+*          running layout; storage reload matches regions one by one.
+*
+* @param [in] pstLayout Descriptor to check
+* @param [in] szFileSize Size of the file holding it
+*
+* @return true when the descriptor can be used to read the file
+*/
+bool ITCOM_bRegionLayoutValid(const ItcomRegionLayout_t* pstLayout, size_t szFileSize) {
+    uint32_t u32End;
+    bool bValid;
+    uint8_t i;
+
+    if (pstLayout == NULL) {
+        return false;
+    }
+
+    bValid = (pstLayout->u32Magic == ITCOM_REGION_LAYOUT_MAGIC) &&
+             (pstLayout->u32Version == ITCOM_REGION_LAYOUT_VERSION) &&
+             (pstLayout->u32HeaderSize == (uint32_t)sizeof(DataOnSharedMemory)) &&
+             ((size_t)pstLayout->u32DataSize == szFileSize);
+    u32End = pstLayout->u32HeaderSize;
+
+    for (i = 0U; (i < (uint8_t)enTotalRegions) && bValid; i++) {
+        const ItcomRegionDesc_t* pstRegion = &pstLayout->astRegions[i];
+
+        bValid = (pstRegion->u32ElementSize != 0U) &&
+                 (pstRegion->u32Capacity <= (pstLayout->u32DataSize / pstRegion->u32ElementSize)) &&
+                 (pstRegion->u32Size == (pstRegion->u32Capacity * pstRegion->u32ElementSize)) &&
+                 (pstRegion->u32Offset >= u32End) &&
+                 (pstRegion->u32Offset <= pstLayout->u32DataSize) &&
+                 (pstRegion->u32Size <= (pstLayout->u32DataSize - pstRegion->u32Offset));
+        u32End = pstRegion->u32Offset + pstRegion->u32Size;
+    }
+
+    return bValid;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_pcRegionName
+//*****************************************************************************
+/**
+*
+* @brief Name of a region, as used in the configuration file and the reports.
+*
+* @param [in] u8Region ItcomRegion_t value
+*
+* @return Region name, "unknown" when out of range
+*/
+const char* ITCOM_pcRegionName(uint8_t u8Region) {
+    return (u8Region < (uint8_t)enTotalRegions) ? itcom_astRegionInfo[u8Region].pcKey : "unknown";
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vReportSharedMemoryLayout
+//*****************************************************************************
+/**
+*
+* @brief Writes one row per ITCOM domain (and per common field) with its
+*        offset, size and cache line span, then one row per region of the
+*        layout, followed by the footprint summary.
+*
+* @details A '*' in the "shared" column marks a member whose first cache line
+*          is also the last line of the previous member at the same level,
+*          i.e. a candidate for false sharing if different threads write them.
+*
+* @param [in] pFile Output stream
+* @param [in] pstLayout Region layout
+*
+* @return none
+*/
+void ITCOM_vReportSharedMemoryLayout(FILE* pFile, const ItcomRegionLayout_t* pstLayout) {
+    const size_t szEntries = sizeof(itcom_astLayout) / sizeof(itcom_astLayout[0]);
+    size_t aszPrevLastLine[LAYOUT_LEVEL_COMMON + 1U] = { (size_t)-1, (size_t)-1 };
+    size_t i;
+
+    (void)fprintf(pFile, "%-32s %8s %8s %6s %6s %6s %6s\n",
+                  "member", "offset", "size", "line0", "lineN", "lines", "shared");
+
+    for (i = 0U; i < szEntries; i++) {
+        const ItcomLayoutEntry_t* pstEntry = &itcom_astLayout[i];
+        size_t szFirstLine = LAYOUT_LINE(pstEntry->szOffset);
+        size_t szLastLine = LAYOUT_LINE(pstEntry->szOffset + pstEntry->szSize - 1U);
+
+        (void)fprintf(pFile, "%s%-*s %8zu %8zu %6zu %6zu %6zu %6s\n",
+                      (pstEntry->u8Level == LAYOUT_LEVEL_COMMON) ? "  " : "",
+                      (pstEntry->u8Level == LAYOUT_LEVEL_COMMON) ? 30 : 32, pstEntry->pcName,
+                      pstEntry->szOffset, pstEntry->szSize, szFirstLine, szLastLine,
+                      (szLastLine - szFirstLine) + 1U,
+                      (szFirstLine == aszPrevLastLine[pstEntry->u8Level]) ? "*" : "");
+
+        aszPrevLastLine[pstEntry->u8Level] = szLastLine;
+    }
+
+    (void)fprintf(pFile, "DataOnSharedMemory: %zu bytes, %zu bytes padding (%zu in common data), %d byte cache lines\n",
+                  sizeof(DataOnSharedMemory),
+                  itcom_szLayoutPadding(LAYOUT_LEVEL_DOMAIN, 0U, sizeof(DataOnSharedMemory)),
+                  itcom_szLayoutPadding(LAYOUT_LEVEL_COMMON, offsetof(DataOnSharedMemory, stThreadsCommonData),
+                                        offsetof(DataOnSharedMemory, stThreadsCommonData) + sizeof(SM_Common_Public_Data)),
+                  ITCOM_CACHE_LINE_SIZE);
+
+    if (pstLayout != NULL) {
+        (void)fprintf(pFile, "%-32s %8s %8s %8s %8s\n", "region", "offset", "size", "capacity", "element");
+        for (i = 0U; i < (size_t)enTotalRegions; i++) {
+            const ItcomRegionDesc_t* pstRegion = &pstLayout->astRegions[i];
+
+            (void)fprintf(pFile, "%-32s %8u %8u %8u %8u\n", ITCOM_pcRegionName((uint8_t)i),
+                          pstRegion->u32Offset, pstRegion->u32Size, pstRegion->u32Capacity, pstRegion->u32ElementSize);
+        }
+        (void)fprintf(pFile, "Mapping: %u of %u bytes used, %u bytes slack, %s pages\n",
+                      pstLayout->u32DataSize, pstLayout->u32MappingSize,
+                      pstLayout->u32MappingSize - pstLayout->u32DataSize,
+                      (pstLayout->u8HugePages != 0U) ? "huge" : "normal");
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : ITCOM_vLogSharedMemoryUsage
+//*****************************************************************************
+/**
+*
+* @brief Logs the footprint summary of the shared memory mapping and the
+*        placement of each region.
+*
+* @param [in] itcom_log_file Log file
+* @param [in] pstLayout Region layout of the mapping
+*
+* @return none
+*/
+void ITCOM_vLogSharedMemoryUsage(FILE* itcom_log_file, const ItcomRegionLayout_t* pstLayout) {
+    uint8_t i;
+
+    log_message(itcom_log_file, LOG_INFO, "Shared memory: %zu header + %u region bytes, %u of %u mapped bytes used (%zu padding, %s pages)",
+                sizeof(DataOnSharedMemory), pstLayout->u32DataSize - pstLayout->u32HeaderSize,
+                pstLayout->u32DataSize, pstLayout->u32MappingSize,
+                itcom_szLayoutPadding(LAYOUT_LEVEL_DOMAIN, 0U, sizeof(DataOnSharedMemory)),
+                (pstLayout->u8HugePages != 0U) ? "huge" : "normal");
+    for (i = 0U; i < (uint8_t)enTotalRegions; i++) {
+        log_message(itcom_log_file, LOG_INFO, "Shared memory region %s: %u x %u bytes at offset %u",
+                    ITCOM_pcRegionName(i), pstLayout->astRegions[i].u32Capacity,
+                    pstLayout->astRegions[i].u32ElementSize, pstLayout->astRegions[i].u32Offset);
+    }
+}
+
+
+/*** Local Function Implementations ***/
+
+//*****************************************************************************
+// FUNCTION NAME : itcom_szLayoutPadding
+//*****************************************************************************
+/**
+*
+* @brief Sums the gaps between consecutive members of one level.
+*
+* @param [in] u8Level Level of the members to consider
+* @param [in] szStart Offset at which the first member may start
+* @param [in] szEnd Offset of the end of the enclosing structure
+*
+* @return Number of padding bytes
+*/
+static size_t itcom_szLayoutPadding(uint8_t u8Level, size_t szStart, size_t szEnd) {
+    const size_t szEntries = sizeof(itcom_astLayout) / sizeof(itcom_astLayout[0]);
+    size_t szCursor = szStart;
+    size_t szPadding = 0U;
+    size_t i;
+
+    for (i = 0U; i < szEntries; i++) {
+        if (itcom_astLayout[i].u8Level == u8Level) {
+            szPadding += itcom_astLayout[i].szOffset - szCursor;
+            szCursor = itcom_astLayout[i].szOffset + itcom_astLayout[i].szSize;
+        }
+    }
+
+    return szPadding + (szEnd - szCursor);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : itcom_pcTrim
+//*****************************************************************************
+/**
+*
+* @brief Strips leading and trailing white space in place.
+*
+* @param [in,out] pcText Text to trim
+*
+* @return First non blank character of pcText
+*/
+static char* itcom_pcTrim(char* pcText) {
+    char* pcEnd;
+
+    while ((*pcText != '\0') && (isspace((unsigned char)*pcText) != 0)) {
+        pcText++;
+    }
+    pcEnd = pcText + strlen(pcText);
+    while ((pcEnd > pcText) && (isspace((unsigned char)pcEnd[-1]) != 0)) {
+        pcEnd--;
+    }
+    *pcEnd = '\0';
+
+    return pcText;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : itcom_s8ParseConfigLine
+//*****************************************************************************
+/**
+*
+* @brief Applies one line of the region layout configuration.
+*
+* @param [in,out] pcLine Line read, modified while parsing
+* @param [in,out] pstConfig Configuration being built
+*
+* @return ITCOM_REGION_OK for a setting, comment or blank line,
+*         ITCOM_REGION_INVALID otherwise
+*/
+static int8_t itcom_s8ParseConfigLine(char* pcLine, ItcomRegionConfig_t* pstConfig) {
+    char* pcComment = strchr(pcLine, '#');
+    char* pcSeparator;
+    char* pcKey;
+    char* pcValue;
+    char* pcParsed = NULL;
+    unsigned long ulValue;
+    uint8_t i;
+
+    if (pcComment != NULL) {
+        *pcComment = '\0';
+    }
+    pcKey = itcom_pcTrim(pcLine);
+    if (*pcKey == '\0') {
+        return ITCOM_REGION_OK;
+    }
+
+    pcSeparator = strchr(pcKey, '=');
+    if (pcSeparator == NULL) {
+        return ITCOM_REGION_INVALID;
+    }
+    *pcSeparator = '\0';
+    pcKey = itcom_pcTrim(pcKey);
+    pcValue = itcom_pcTrim(pcSeparator + 1);
+
+    errno = 0;
+    ulValue = strtoul(pcValue, &pcParsed, 10);
+    if ((*pcValue == '\0') || (*pcValue == '-') || (*pcParsed != '\0') || (errno != 0) || (ulValue > UINT32_MAX)) {
+        return ITCOM_REGION_INVALID;
+    }
+
+    if (strcmp(pcKey, REGION_CONFIG_HUGE_PAGES) == 0) {
+        if (ulValue > 1UL) {
+            return ITCOM_REGION_INVALID;
+        }
+        pstConfig->bHugePages = (ulValue == 1UL);
+        return ITCOM_REGION_OK;
+    }
+
+    for (i = 0U; i < (uint8_t)enTotalRegions; i++) {
+        if (strcmp(pcKey, itcom_astRegionInfo[i].pcKey) == 0) {
+            pstConfig->au32Capacity[i] = (uint32_t)ulValue;
+            return ITCOM_REGION_OK;
+        }
+    }
+
+    return ITCOM_REGION_INVALID;
+}
@@ -44,6 +44,18 @@
  * 10/09/2024 | TP     | Multiple ASI_APP restart issues fixed
  * 11/15/2024 | TP     | MISRA & LHP compliance fixes
  * 11/22/2024 | TP     | Cleanup v1.0
+ * 10/18/2026 | TP     | Parent evaluates child SLOs, restart time measured
+ * 10/18/2026 | TP     | Periodic storage/SLO scheduling uses the UT time source
+ * 10/18/2026 | TP     | Bounded child exit wait, shared data flushed once on shutdown
+ * 10/18/2026 | TP     | Faults of periodic threads recovered in place, reset hooks registered at init
+ * 10/18/2026 | TP     | Optional signalfd mode, signal interruption counts reported on exit
+ * 10/18/2026 | TP     | Child exits at once on a critical signal not recovered in place, reset hooks for every module
+ * 10/18/2026 | TP     | Parent skips its final save only when the child exited with status 0
+ * 10/18/2026 | TP     | Child handlers run on the alternate signal stack of a periodic thread
+ * 10/18/2026 | TP     | SIGHUP makes the parent request the thread tuning file instead of shutting down
+ * 10/18/2026 | TP     | SLO baseline loaded from storage before the first evaluation
+ * 10/18/2026 | TP     | Held ITCOM locks read from lock_owner
+ * 10/18/2026 | TP     | Child killed before the parent's final save if it outlives the shutdown timeout
  */
 
 /*** Include Files ***/
@@ -54,10 +66,28 @@
 #include "fault_manager.h"
 
 #include "process_management.h"
+#include "slo_monitor.h"
+#include "lock_owner.h"
+#include "worker_pool.h"
+
+#ifdef PROC_SIGNALFD
+#include <poll.h>
+#include <sys/signalfd.h>
+#endif
 
 /*** Module Definitions ***/
 #define PROCESS_SLEEP_TIME_US         (100000U)    /* 100ms sleep time in microseconds */
-#define MAX_CHILD_RESTART_RETRIES     (5U)         /* Maximum number of retries to restart the child process */
+#define CHILD_EXIT_TIMEOUT_MS         (5000U)      /* Parent wait for the child on shutdown */
+#define CHILD_EXIT_POLL_US            (1000U)      /* 1ms poll, cut short by SIGCHLD */
+#define CHILD_EXIT_FAULT              (3)          /* Child exit status after a fault not recovered in place */
+#define CHILD_EXIT_NOT_SAVED          (4)          /* Child exit status when it could not save the shared data */
+#define PROCESS_SLEEP_TIME_MS         (PROCESS_SLEEP_TIME_US / 1000U)
+
+#ifdef PROC_SIGNALFD
+#define PROC_SIGNAL_MODE_NAME         "signalfd"
+#else
+#define PROC_SIGNAL_MODE_NAME         "async handlers"
+#endif
 
 /*** Internal Types ***/
 
@@ -66,8 +96,21 @@ static void procmanagement_vInitModules(void);
 static void restart_child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file);
 static void handle_child_termination(status_code_t status);
 static void handle_termination_signal(sig_num_t signum, siginfo_t *info, generic_ptr_t context);
+static void process_termination_signal(sig_num_t signum);
+#ifndef PROC_SIGNALFD
 static void sigchld_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t context);
+#endif
+static void reap_child_processes(void);
 static void child_signal_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t context);
+static void process_child_signal(sig_num_t signum);
+static void exit_faulted_child(sig_num_t signum);
+static void count_signal_interruption(void);
+static void report_signal_interruptions(FILE *report_file, const char *process_name);
+#ifdef PROC_SIGNALFD
+static int open_signal_fd(bool with_sigchld);
+static void wait_for_signals(uint32_t timeout_ms, void (*dispatch)(sig_num_t signum));
+static void dispatch_parent_signal(sig_num_t signum);
+#endif
 
 /*** External Variables ***/
 
@@ -77,6 +120,19 @@ static volatile sig_atomic_t keep_running = 1;
 static volatile sig_atomic_t shutdown_initiated = 0;
 static volatile sig_atomic_t received_signal = 0;
 static volatile sig_atomic_t child_exiting = 0;
+static volatile sig_atomic_t child_saved_on_exit = 0; /* Shutdown reap saw exit status 0 */
+static volatile sig_atomic_t tuning_requested = 0;    /* SIGHUP seen, tuning file not read yet */
+static uint32_t signal_handler_runs = 0U;          /* Asynchronous handler runs, any thread */
+static uint32_t periodic_signal_handler_runs = 0U; /* Of which on a periodic thread */
+static uint32_t interrupted_calls = 0U;            /* Sleeps and waits of the main loops cut short (EINTR) */
+static uint32_t signals_read = 0U;                 /* Signals consumed from the signalfd */
+#ifdef PROC_SIGNALFD
+static int signal_fd = -1;
+
+/* Blocked in every thread and read from the signalfd; the synchronous faults keep their handler */
+static const sig_num_t queued_signals[] = {SIGTERM, SIGINT, SIGQUIT, SIGXCPU, SIGXFSZ, SIGPIPE,
+                                           SIGALRM, SIGHUP, SIGPWR, SIGPOLL, SIGSTKFLT};
+#endif
 
 /*** Functions Provided to other modules ***/
 
@@ -142,7 +198,9 @@ static sig_atomic_t get_received_signal(void)
  *    - Termination: SIGTERM, SIGINT
  *    - Crash: SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT
  *    - System: SIGSYS, SIGQUIT, SIGXCPU, SIGXFSZ
- *    - Other: SIGPIPE, SIGTRAP, SIGALRM, SIGHUP, SIGPWR, SIGPOLL, SIGSTKFLT
+ *    - Other: SIGPIPE, SIGTRAP, SIGALRM, SIGPWR, SIGPOLL, SIGSTKFLT
+ *    - SIGHUP does not shut down: the parent loop then requests the tuning
+ *      in THREAD_TUNING_CONFIG_PATH from the child
  *
  * 3. Sets up dedicated SIGCHLD handler:
  *    - Uses sigchld_handler function
@@ -154,6 +212,10 @@ static sig_atomic_t get_received_signal(void)
  *    - Logs detailed error messages on failure
  *    - Terminates program if critical setup fails
  *
+ * In signalfd mode (PROC_SIGNALFD) only the synchronous faults get a handler;
+ * the other signals and SIGCHLD are blocked and read by the parent loop from
+ * a signalfd, so no handler interrupts the parent.
+ *
  * @note This function is critical for process reliability as it ensures appropriate
  * handling of all system signals that could affect process operation
  *
@@ -172,8 +234,12 @@ void PROCMANAGEMENT_vSignalHandlerInit(FILE *proc_log_file)
         exit(1);
     }
 
+#ifdef PROC_SIGNALFD
+    sig_num_t signals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, SIGSYS, SIGTRAP};
+#else
     sig_num_t signals[] = {SIGTERM, SIGINT, SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, SIGSYS, SIGQUIT,
                            SIGXCPU, SIGXFSZ, SIGPIPE, SIGTRAP, SIGALRM, SIGHUP, SIGPWR, SIGPOLL, SIGSTKFLT};
+#endif
 
     for (i = 0; i < sizeof(signals) / sizeof(signals[0]); i++)
     {
@@ -194,6 +260,13 @@ void PROCMANAGEMENT_vSignalHandlerInit(FILE *proc_log_file)
         }
     }
 
+#ifdef PROC_SIGNALFD
+    if (open_signal_fd(true) != 0)
+    {
+        (void)log_message(proc_log_file, LOG_ERROR, "Failed to set up the signalfd: %s", strerror(errno));
+        exit(1);
+    }
+#else
     /* Set up SIGCHLD handler separately */
     struct sigaction sa_chld;
     sa_chld.sa_sigaction = &sigchld_handler;
@@ -210,8 +283,9 @@ void PROCMANAGEMENT_vSignalHandlerInit(FILE *proc_log_file)
         (void)log_message(proc_log_file, LOG_ERROR, "Failed to set up SIGCHLD handler: %s", strerror(errno));
         exit(1);
     }
+#endif
 
-    log_message(proc_log_file, LOG_INFO, "Signal handlers initialized for parent process");
+    log_message(proc_log_file, LOG_INFO, "Signal handlers initialized for parent process (%s)", PROC_SIGNAL_MODE_NAME);
 }
 
 /**
@@ -238,15 +312,33 @@ pid_t PROCMANAGEMENT_stCreateChildProcess(void)
     return child_pid;
 }
 
+#ifndef PROC_SIGNALFD
 /**
  * @brief Handles SIGCHLD signals for child process termination monitoring
  *
- * This function processes child process termination events and manages system response,
- * including restart decisions and logging.
+ * Counts the interruption and reaps the terminated children.
  *
  * @param signum Signal number (SIGCHLD)
  * @param info Additional signal information (unused)
  * @param context User context information (unused)
+ */
+static void sigchld_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t context)
+{
+    (void)signum;  /* Explicitly cast to void to indicate unused / suppress warning */
+    (void)info;    /* Explicitly cast to void to indicate unused / suppress warning */
+    (void)context; /* Explicitly cast to void to indicate unused / suppress warning */
+
+    count_signal_interruption();
+    reap_child_processes();
+}
+#endif
+
+/**
+ * @brief Reaps terminated child processes after a SIGCHLD
+ *
+ * This function processes child process termination events and manages system response,
+ * including restart decisions and logging. Runs in the SIGCHLD handler, or in the
+ * parent loop in signalfd mode.
  *
  * The function performs:
  * 1. Non-blocking checks for terminated child processes using waitpid with WNOHANG
@@ -261,11 +353,8 @@ pid_t PROCMANAGEMENT_stCreateChildProcess(void)
  * @note Essential for maintaining system reliability through automated child process
  * monitoring and recovery
  */
-static void sigchld_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t context)
+static void reap_child_processes(void)
 {
-    (void)signum;  /* Explicitly cast to void to indicate unused / suppress warning */
-    (void)info;    /* Explicitly cast to void to indicate unused / suppress warning */
-    (void)context; /* Explicitly cast to void to indicate unused / suppress warning */
     status_code_t status;
     pid_t pid;
 
@@ -279,6 +368,8 @@ static void sigchld_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t con
                 if (WIFEXITED(status))
                 {
                     log_message(global_log_file, LOG_INFO, "Child process exited with status %d during shutdown", WEXITSTATUS(status));
+                    /* Only a graceful shutdown of the child exits with 0, after saving the shared data */
+                    child_saved_on_exit = (WEXITSTATUS(status) == 0) ? 1 : 0;
                 }
                 else if (WIFSIGNALED(status))
                 {
@@ -345,7 +436,13 @@ static void sigchld_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t con
  * 3. Shutdown Sequence:
  *    - Logs remaining events
  *    - Saves shared data
- *    - Performs graceful shutdown
+ *    - Performs graceful shutdown, exits with CHILD_EXIT_NOT_SAVED if a thread
+ *      was left running and the data could not be saved
+ *    - Reports the signal interruptions
+ *
+ * In signalfd mode the main loop waits on the signalfd instead of sleeping and
+ * handles SIGTERM/SIGINT there; the periodic threads keep only the synchronous
+ * faults unblocked.
  *
  * @note Critical for maintaining system reliability through comprehensive monitoring
  * and automated recovery mechanisms
@@ -372,9 +469,12 @@ void child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file, enResta
     if (start_threads(shared_data, proc_log_file) != 0)
     {
         log_message(proc_log_file, LOG_ERROR, "Failed to start threads");
-        return;
+        _exit(CHILD_EXIT_NOT_SAVED);
     }
 
+    /* Publish the restart time if this child replaces a terminated one */
+    SLOMONITOR_vMarkChildReady();
+
     /* Main loop of the child process */
     while (!get_thread_exit() && !child_exiting)
     {
@@ -390,7 +490,7 @@ void child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file, enResta
         }
 
         /* Write to child_storage.bin every STORAGE_WRITE_INTERVAL seconds */
-        time_t current_time = time(NULL);
+        time_t current_time = UT_tGetWallTime_s();
         static time_t last_write_time = 0;
         if (current_time - last_write_time >= STORAGE_WRITE_INTERVAL)
         {
@@ -405,21 +505,29 @@ void child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file, enResta
             break;
         }
 
+#ifdef PROC_SIGNALFD
+        /* The main thread is the signal thread of the child: SIGTERM ends this wait at once */
+        wait_for_signals(PROCESS_SLEEP_TIME_MS, &process_child_signal);
+#else
         if (usleep(PROCESS_SLEEP_TIME_US) != 0)
         {
+            interrupted_calls++;
             (void)log_message(proc_log_file, LOG_WARNING, "Sleep interrupted: %s", strerror(errno));
         }
+#endif
     }
 
     /* Before exiting, log remaining events if any */
     log_message(proc_log_file, LOG_INFO, "Child process ending. Logging any remaining events.");
     FM_vLogRemainingEvents(proc_log_file);
 
-    /* Save all shared data before exiting */
-    save_all_shared_data_to_storage(shared_data);
-
-    /* Perform graceful shutdown when exiting */
-    initiate_graceful_shutdown(shared_data);
+    /* Perform graceful shutdown when exiting, shared data is saved once the threads stopped */
+    if (!initiate_graceful_shutdown(shared_data))
+    {
+        /* A thread left running may hold an ITCOM lock: no exit handlers, the parent saves */
+        _exit(CHILD_EXIT_NOT_SAVED);
+    }
+    report_signal_interruptions(proc_log_file, "Child");
     log_message(proc_log_file, LOG_INFO, "Child process ending...");
     log_message(proc_log_file, LOG_INFO, "Child process exited successfully");
 }
@@ -445,9 +553,14 @@ void child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file, enResta
  *
  * 2. Shutdown Sequence:
  *    - Initiates graceful shutdown
- *    - Waits for child process termination
- *    - Saves final shared data state
- *    - Logs shutdown completion
+ *    - Waits for child process termination (CHILD_EXIT_TIMEOUT_MS), kills
+ *      and reaps a child still running after it
+ *    - Saves final shared data state unless the child exited with status 0,
+ *      which only its graceful shutdown does after saving
+ *    - Reports the signal interruptions and logs shutdown completion
+ *
+ * In signalfd mode the loop and the child exit wait block on the signalfd and
+ * handle SIGCHLD and the termination signals there instead of in handlers.
  *
  * @note Critical for system reliability through continuous monitoring and
  * automated recovery of child process
@@ -458,13 +571,15 @@ void parent_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
     (void)log_message(proc_log_file, LOG_INFO, "Parent process started. PID: %d", getpid());
 
     /* Track last time data was written to storage */
-    time_t last_write_time = time(NULL);
+    time_t last_write_time = UT_tGetWallTime_s();
+    time_t last_slo_time = last_write_time;
+    SLOMONITOR_vLoadBaseline(SLO_BASELINE_PATH, proc_log_file);
 
     /* Main loop of the parent process */
     while (keep_running)
     {
         /* Periodically write shared data to storage file */
-        time_t current_time = time(NULL);
+        time_t current_time = UT_tGetWallTime_s();
         if (current_time - last_write_time >= STORAGE_WRITE_INTERVAL)
         {
             write_shared_data_to_file(PARENT_STORAGE_PATH, shared_data);
@@ -472,6 +587,13 @@ void parent_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
             log_message(proc_log_file, LOG_INFO, "Parent: Written data to storage file");
         }
 
+        /* Periodically evaluate the child's service level objectives */
+        if (current_time - last_slo_time >= SLO_EVALUATION_INTERVAL_S)
+        {
+            SLOMONITOR_vEvaluate(child_pid, proc_log_file);
+            last_slo_time = current_time;
+        }
+
         /* Check if child process has terminated */
         status_code_t status;
         pid_t terminated_pid = waitpid(child_pid, &status, WNOHANG);
@@ -536,6 +658,7 @@ void parent_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
             else
             {
                 /* EINTR case - system call was interrupted */
+                interrupted_calls++;
                 log_message(proc_log_file, LOG_INFO, "Child process check was interrupted");
             }
         }
@@ -545,6 +668,13 @@ void parent_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
             /* No action needed - child is still running */
         }
 
+        /* Forward the tuning file to the child after a SIGHUP */
+        if (tuning_requested != 0)
+        {
+            tuning_requested = 0;
+            (void)request_thread_tuning_from_file(THREAD_TUNING_CONFIG_PATH);
+        }
+
         /* Check if shutdown has been initiated */
         if (shutdown_initiated)
         {
@@ -552,30 +682,67 @@ void parent_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
             break; /* Exit the loop if shutdown has been initiated */
         }
 
-        (void)usleep(PROCESS_SLEEP_TIME_US); /* Sleep for 100ms to prevent CPU hogging */
+#ifdef PROC_SIGNALFD
+        wait_for_signals(PROCESS_SLEEP_TIME_MS, &dispatch_parent_signal); /* 100ms, cut short by a signal */
+#else
+        if (usleep(PROCESS_SLEEP_TIME_US) != 0) /* Sleep for 100ms to prevent CPU hogging */
+        {
+            interrupted_calls++;
+        }
+#endif
     }
 
-    /* Final save of shared data before exiting */
-    save_all_shared_data_to_storage(shared_data);
-
     /* Initiate graceful shutdown procedure */
     log_message(proc_log_file, LOG_INFO, "Parent process initiating graceful shutdown...");
 
-    /* Wait for child process to terminate if it hasn't already */
+    /* Wait for child process to terminate if it hasn't already; it saves the shared data itself */
+    bool child_saved_data = (child_pid <= 0) && (child_saved_on_exit != 0);
     if (child_pid > 0)
     {
-        retry_count_t retries = MAX_CHILD_RESTART_RETRIES;
-        while (retries > 0 && child_pid > 0)
+        uint32_t wait_start_ms = UT_u32GetCurrentTime_ms();
+        uint32_t waited_ms = 0U;
+        while ((child_pid > 0) && (waited_ms < CHILD_EXIT_TIMEOUT_MS))
         {
-            (void)sleep(1); /* Wait for 1 second */
-            retries--;
+#ifdef PROC_SIGNALFD
+            wait_for_signals(CHILD_EXIT_TIMEOUT_MS - waited_ms, &dispatch_parent_signal);
+#else
+            if (usleep(CHILD_EXIT_POLL_US) != 0)
+            {
+                interrupted_calls++;
+            }
+#endif
+            waited_ms = UT_u32GetCurrentTime_ms() - wait_start_ms;
         }
         if (child_pid > 0)
         {
-            log_message(proc_log_file, LOG_WARNING, "Child process did not terminate within the expected time");
+            /* A stuck thread may hold an ITCOM lock the save below needs: only a dead owner hands it over */
+            pid_t stuck_child = child_pid;
+            log_message(proc_log_file, LOG_WARNING, "Child process did not terminate within the expected time, killing it");
+            (void)kill(stuck_child, SIGKILL);
+            (void)waitpid(stuck_child, NULL, 0);
+            child_pid = -1;
+        }
+        else
+        {
+            log_message(proc_log_file, LOG_INFO, "Child process terminated %u ms after the shutdown request", waited_ms);
+            child_saved_data = (child_saved_on_exit != 0);
         }
     }
 
+    /* Final save of shared data before exiting, unless the child already did it. The child is gone
+       by now, locks it left held are taken over through the robust mutexes (LockOwner_s32NoteLocked) */
+    if (!child_saved_data)
+    {
+        save_all_shared_data_to_storage(shared_data);
+        if (LockOwner_u32DeadOwnerCount() != 0U)
+        {
+            log_message(proc_log_file, LOG_WARNING, "Parent saved data behind %u ITCOM lock(s) the child held when it ended",
+                        LockOwner_u32DeadOwnerCount());
+        }
+    }
+
+    report_signal_interruptions(proc_log_file, "Parent");
+
     /* Log the end of the parent process */
     log_message(proc_log_file, LOG_INFO, "Parent process ending...");
 }
@@ -615,6 +782,26 @@ static void handle_termination_signal(sig_num_t signum, siginfo_t *info, generic
 {
     (void)info;    /* Explicitly cast to void to indicate unused / suppress warning */
     (void)context; /* Explicitly cast to void to indicate unused / suppress warning */
+
+    count_signal_interruption();
+    if (signum == SIGHUP)
+    {
+        tuning_requested = 1;
+        return;
+    }
+    process_termination_signal(signum);
+}
+
+/**
+ * @brief Starts the parent shutdown for a termination signal
+ *
+ * Runs in handle_termination_signal(), or in the parent loop for the signals
+ * read from the signalfd.
+ *
+ * @param signum Signal number received that triggered termination
+ */
+static void process_termination_signal(sig_num_t signum)
+{
     received_signal = signum;
     if (!shutdown_initiated)
     {
@@ -646,6 +833,7 @@ static void handle_termination_signal(sig_num_t signum, siginfo_t *info, generic
  * 2. Interface Communication Manager (ICM_vInit)
  * 3. TCP Connections for System Diagnostics (SD_vTCPConnectionsInit)
  * 4. CRC Table Creation (CRC_vCreateTable)
+ * 5. Reset hooks run on a periodic thread after a faulted cycle
  *
  * @note This function is critical for system safety and must complete successfully
  *       before any other operations can proceed. All module initializations are
@@ -662,6 +850,13 @@ static void procmanagement_vInitModules(void)
     ICM_vInit();
     SD_vTCPConnectionsInit();
     CRC_vCreateTable();
+    /* CCU and CRV keep no state outside shared memory and need no hook */
+    register_thread_reset_hook(enThread_FM, &FM_vResetAfterFault);
+    register_thread_reset_hook(enThread_STM, &STM_vResyncState);
+    register_thread_reset_hook(enThread_ICM_RX, &ICM_vResetRxAfterFault);
+    register_thread_reset_hook(enThread_ICM_TX, &ICM_vResetTxAfterFault);
+    register_thread_reset_hook(enThread_ARA, &ARA_vResetAfterFault);
+    register_thread_reset_hook(enThread_SD, &SD_vResetAfterFault);
     log_message(global_log_file, LOG_INFO, "INITIALIZATION PROCESS COMPLETED");
 }
 
@@ -673,7 +868,9 @@ static void procmanagement_vInitModules(void)
  *
  * Signal handling behavior:
  * - SIGTERM/SIGINT: Initiates graceful shutdown, distinguishing between parent-initiated and external termination
- * - SIGSEGV/SIGBUS/SIGFPE/SIGILL/SIGABRT: Logs critical signal and initiates crash recovery
+ * - SIGSEGV/SIGBUS/SIGFPE/SIGILL: Recovered in place when raised by a periodic thread
+ *   holding no ITCOM lock (recover_faulted_thread() does not return), otherwise handled as SIGABRT
+ * - SIGABRT: Logs critical signal and exits the child at once for a restart (exit_faulted_child())
  * - SIGSYS/SIGQUIT/SIGXCPU/SIGXFSZ/SIGPIPE/SIGTRAP/SIGALRM/SIGHUP/SIGPWR/SIGPOLL/SIGSTKFLT: Logs warning
  *
  * @param signum Signal number received
@@ -686,13 +883,32 @@ static void procmanagement_vInitModules(void)
  *
  * State effects:
  * - Sets child_exiting flag for termination signals
- * - Sets thread_crashed flag for critical signals
+ * - Exits the child with CHILD_EXIT_FAULT for critical signals not recovered in place
  * - Sets thread_exit flag for all signals
  */
 static void child_signal_handler(sig_num_t signum, siginfo_t *info, generic_ptr_t context)
 {
     (void)info;    /* Explicitly cast to void to indicate unused / suppress warning */
     (void)context; /* Explicitly cast to void to indicate unused / suppress warning */
+
+    /* Synchronous faults are raised by the thread itself, they do not interrupt it */
+    if ((signum != SIGSEGV) && (signum != SIGBUS) && (signum != SIGFPE) && (signum != SIGILL))
+    {
+        count_signal_interruption();
+    }
+    process_child_signal(signum);
+}
+
+/**
+ * @brief Handles a signal of the child process.
+ *
+ * Runs in child_signal_handler(), or in the child main loop for the signals
+ * read from the signalfd. See child_signal_handler() for the behavior per signal.
+ *
+ * @param signum Signal number received
+ */
+static void process_child_signal(sig_num_t signum)
+{
     ErrorEvent stCurrentEvent;
     sig_name_t signal_name = get_signal_name(signum);
 
@@ -719,10 +935,11 @@ static void child_signal_handler(sig_num_t signum, siginfo_t *info, generic_ptr_
     case SIGFPE:
     case SIGILL:
     case SIGABRT:
-        log_message(global_log_file, LOG_ERROR, "Child process received critical signal: %s. Initiating crash recovery...", signal_name);
-        ITCOM_vGetErrorEvent(&stCurrentEvent);
-        FM_vLogSpecialEvent(global_log_file, "CRITICAL SIGNAL", stCurrentEvent.Error_Event_ID);
-        set_thread_crashed(1);
+        if (signum != SIGABRT)
+        {
+            recover_faulted_thread(signum);
+        }
+        exit_faulted_child(signum);
         break;
     case SIGSYS:
     case SIGQUIT:
@@ -747,6 +964,35 @@ static void child_signal_handler(sig_num_t signum, siginfo_t *info, generic_ptr_
     SD_vCloseTCPConnection(enCMConnectionTCP);
 }
 
+/**
+ * @brief Ends the child after a critical signal that was not recovered in place.
+ *
+ * Returning from the handler would run the faulting instruction again, and the
+ * other threads could block for good on a lock the faulted thread holds. The
+ * child leaves at once with CHILD_EXIT_FAULT, without the graceful shutdown
+ * and without saving its shared data; the parent restarts it and the new
+ * child re-initializes the mutexes and reloads the last stored data.
+ *
+ * @param signum Critical signal received
+ */
+static void exit_faulted_child(sig_num_t signum)
+{
+    ErrorEvent stCurrentEvent;
+    uint32_t held_locks = LockOwner_u32HeldCount();
+
+    /* Nothing left to write the lines queued to the worker pool: write them inline */
+    WORKERPOOL_vSetLogDeferral(false);
+    log_message(global_log_file, LOG_ERROR, "Child process received critical signal: %s with %u ITCOM lock(s) held. Exiting for a restart...",
+                get_signal_name(signum), held_locks);
+    /* The error event mutex may be one of the locks held */
+    if (held_locks == 0U)
+    {
+        ITCOM_vGetErrorEvent(&stCurrentEvent);
+        FM_vLogSpecialEvent(global_log_file, "CRITICAL SIGNAL", stCurrentEvent.Error_Event_ID);
+    }
+    _exit(CHILD_EXIT_FAULT);
+}
+
 /**
  * @brief Configures signal handlers for the child process.
  *
@@ -761,7 +1007,12 @@ static void child_signal_handler(sig_num_t signum, siginfo_t *info, generic_ptr_
  * - Resource signals: SIGPIPE, SIGTRAP, SIGALRM
  * - Other signals: SIGHUP, SIGPWR, SIGPOLL, SIGSTKFLT
  *
- * @note All signals use the child_signal_handler() callback function
+ * @note All signals use the child_signal_handler() callback function, with
+ *       SA_ONSTACK: on a periodic thread it runs on the thread's alternate
+ *       signal stack, installed when the thread starts
+ * @note In signalfd mode only the synchronous faults get the handler; the other
+ *       signals are blocked before any thread is created and read by the main
+ *       loop. Called again after a fork, it replaces the inherited signalfd.
  *
  * @warning Failure to set up any signal handler results in process termination
  *
@@ -774,7 +1025,14 @@ void setup_child_signal_handlers(void)
     size_t i;
     struct sigaction sa;
     sa.sa_sigaction = &child_signal_handler;
-    sa.sa_flags = SA_SIGINFO;
+    /* On a periodic thread the handler runs on its alternate stack, a stack overflow still reaches it */
+    sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+
+    /* Counts inherited from the parent on the fork are not the child's */
+    signal_handler_runs = 0U;
+    periodic_signal_handler_runs = 0U;
+    interrupted_calls = 0U;
+    signals_read = 0U;
 
     if (sigemptyset(&sa.sa_mask) == -1)
     {
@@ -782,8 +1040,12 @@ void setup_child_signal_handlers(void)
         exit(1);
     }
 
+#ifdef PROC_SIGNALFD
+    sig_num_t signals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, SIGSYS, SIGTRAP};
+#else
     sig_num_t signals[] = {SIGTERM, SIGINT, SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT, SIGSYS, SIGQUIT,
                            SIGXCPU, SIGXFSZ, SIGPIPE, SIGTRAP, SIGALRM, SIGHUP, SIGPWR, SIGPOLL, SIGSTKFLT};
+#endif
 
     for (i = 0; i < sizeof(signals) / sizeof(signals[0]); i++)
     {
@@ -794,7 +1056,15 @@ void setup_child_signal_handlers(void)
         }
     }
 
-    log_message(global_log_file, LOG_INFO, "Signal handlers initialized for child process");
+#ifdef PROC_SIGNALFD
+    if (open_signal_fd(false) != 0)
+    {
+        (void)log_message(global_log_file, LOG_ERROR, "Failed to set up the signalfd in child process: %s", strerror(errno));
+        exit(1);
+    }
+#endif
+
+    log_message(global_log_file, LOG_INFO, "Signal handlers initialized for child process (%s)", PROC_SIGNAL_MODE_NAME);
 }
 
 /**
@@ -826,6 +1096,8 @@ void setup_child_signal_handlers(void)
  */
 static void restart_child_process(DataOnSharedMemory *shared_data, FILE *proc_log_file)
 {
+    SLOMONITOR_vMarkRestartRequest();
+    SLOMONITOR_vResetChildBaseline();
     child_pid = fork();
     if (child_pid == 0)
     {
@@ -913,6 +1185,8 @@ static void handle_child_termination(status_code_t status)
     }
 
     /* Restart child process */
+    SLOMONITOR_vMarkRestartRequest();
+    SLOMONITOR_vResetChildBaseline();
     child_pid = fork();
     if (child_pid == -1)
     {
@@ -950,3 +1224,140 @@ static void handle_child_termination(status_code_t status)
         log_message(global_log_file, LOG_INFO, "Child process restarted with PID: %d", child_pid);
     }
 }
+
+/**
+ * @brief Counts an asynchronous signal handler run.
+ *
+ * Async-signal-safe. Runs on whichever thread the signal was delivered to;
+ * runs on a periodic thread are counted separately since they preempt a job
+ * or cut its release wait short.
+ */
+static void count_signal_interruption(void)
+{
+    (void)__atomic_fetch_add(&signal_handler_runs, 1U, __ATOMIC_RELAXED);
+    if (is_periodic_thread())
+    {
+        (void)__atomic_fetch_add(&periodic_signal_handler_runs, 1U, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Logs the signal interruptions of the calling process.
+ *
+ * @param report_file Log stream of the report
+ * @param process_name "Parent" or "Child"
+ */
+static void report_signal_interruptions(FILE *report_file, const char *process_name)
+{
+    log_message(report_file, LOG_INFO,
+                "%s signal interruptions (%s): handler runs %u, on periodic threads %u, interrupted calls %u, signals read %u",
+                process_name, PROC_SIGNAL_MODE_NAME,
+                __atomic_load_n(&signal_handler_runs, __ATOMIC_RELAXED),
+                __atomic_load_n(&periodic_signal_handler_runs, __ATOMIC_RELAXED),
+                interrupted_calls, signals_read);
+}
+
+#ifdef PROC_SIGNALFD
+/**
+ * @brief Blocks the queued signals in the calling thread and opens the signalfd.
+ *
+ * Must run before any thread is created so that every thread inherits the
+ * mask and the signals stay pending on the process until read. Replaces the
+ * signalfd inherited from the parent on a fork.
+ *
+ * @param with_sigchld Also queue SIGCHLD (parent process)
+ *
+ * @return int 0 on success, -1 with errno set otherwise
+ */
+static int open_signal_fd(bool with_sigchld)
+{
+    sigset_t queued_set;
+    size_t i;
+    int new_fd;
+
+    if (sigemptyset(&queued_set) != 0)
+    {
+        return -1;
+    }
+    for (i = 0; i < sizeof(queued_signals) / sizeof(queued_signals[0]); i++)
+    {
+        if (sigaddset(&queued_set, queued_signals[i]) != 0)
+        {
+            return -1;
+        }
+    }
+    if (with_sigchld && (sigaddset(&queued_set, SIGCHLD) != 0))
+    {
+        return -1;
+    }
+
+    errno = pthread_sigmask(SIG_BLOCK, &queued_set, NULL);
+    if (errno != 0)
+    {
+        return -1;
+    }
+
+    new_fd = signalfd(-1, &queued_set, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (new_fd == -1)
+    {
+        return -1;
+    }
+    if (signal_fd >= 0)
+    {
+        (void)close(signal_fd);
+    }
+    signal_fd = new_fd;
+    return 0;
+}
+
+/**
+ * @brief Waits up to timeout_ms for queued signals and handles them.
+ *
+ * Every signal pending on the signalfd is read and passed to dispatch, in
+ * the calling thread and outside signal context.
+ *
+ * @param timeout_ms Longest wait in milliseconds
+ * @param dispatch Handling of one signal
+ */
+static void wait_for_signals(uint32_t timeout_ms, void (*dispatch)(sig_num_t signum))
+{
+    struct pollfd signal_poll = {.fd = signal_fd, .events = POLLIN, .revents = 0};
+    struct signalfd_siginfo signal_info;
+
+    if (poll(&signal_poll, 1, (int)timeout_ms) == -1)
+    {
+        if (errno == EINTR)
+        {
+            interrupted_calls++;
+        }
+        return;
+    }
+
+    while (read(signal_fd, &signal_info, sizeof(signal_info)) == (ssize_t)sizeof(signal_info))
+    {
+        signals_read++;
+        dispatch((sig_num_t)signal_info.ssi_signo);
+    }
+}
+
+/**
+ * @brief Handles a signal read by the parent loop.
+ *
+ * @param signum SIGCHLD or a termination signal
+ */
+static void dispatch_parent_signal(sig_num_t signum)
+{
+    if (signum == SIGCHLD)
+    {
+        reap_child_processes();
+    }
+    else if (signum == SIGHUP)
+    {
+        tuning_requested = 1;
+    }
+    else
+    {
+        process_termination_signal(signum);
+    }
+}
+#endif
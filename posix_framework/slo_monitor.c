@@ -0,0 +1,454 @@
+/*****************************************************************************
+ * @file slo_monitor.c
+ *****************************************************************************
+ * Project Name: Sonatus Automator Safety Interlock(ASI)
+ *
+ * @brief Service level objective (SLO) monitor run by the parent process.
+ *
+ * @details
+ * The child accumulates SLO metrics in shared memory (see SloMetrics_t). The
+ * parent evaluates them periodically together with resource usage of the
+ * child read from /proc, and logs every breached objective:
+ * - Approval latency p99 (from the latency histogram)
+ * - Queue overflow (any rejected enqueue since the previous evaluation)
+ * - Child restart time
+ * - RSS and open file descriptor growth against the stored baseline
+ * - Approval latency p99 and restart time growth against the stored baseline
+ *
+ * The baseline is read from SLO_BASELINE_PATH when the parent starts, so
+ * every child (restarted ones included) and every run is compared with the
+ * same reference. Without the file the first sample of the first child
+ * becomes the baseline and is written there; delete it to take a new one.
+ * Approval latency and restart time join the baseline with the first
+ * evaluation that has approvals and a restart respectively.
+ *
+ * Restart time is measured from the moment the parent decides to fork a new
+ * child until the new child has its threads running. The request timestamp
+ * is a process-local variable that the child inherits through fork().
+ *
+ * @authors Tusar Palauri (TP)
+ * @date October 18, 2026
+ *
+ * Version History:
+ * ---------------
+ * Date       | Author | Description
+ * -----------|--------|-------------
+ * 10/18/2026 | TP     | Initial
+ * 10/18/2026 | TP     | Notification queue overflows reported
+ * 10/18/2026 | TP     | RSS/fd baseline stored in a file, soak and fault injection driver (make soak-check)
+ * 10/18/2026 | TP     | Soak driver moved to test/slo_soak_check.c
+ * 10/18/2026 | TP     | Approval latency p99 and restart time in the baseline
+ */
+
+/*** Include Files ***/
+#include <dirent.h>
+
+#include "slo_monitor.h"
+
+/*** Module Definitions ***/
+#define SLO_PERCENTILE                   (99U)
+#define SLO_PERCENT                      (100U)
+#define SLO_BYTES_TO_KB                  (1024U)
+#define SLO_PROC_PATH_LEN                (64U)
+#define SLO_NO_PENDING_RESTART           (0U)
+#define SLO_BASELINE_LINE_SIZE           (128U)
+#define SLO_BASELINE_KEY_SIZE            (32U)
+#define SLO_BASELINE_RSS_KEY             "rss_kb"
+#define SLO_BASELINE_FD_KEY              "fd_count"
+#define SLO_BASELINE_APPROVAL_KEY        "approval_p99_ms"
+#define SLO_BASELINE_RESTART_KEY         "restart_ms"
+
+/*** Internal Types ***/
+
+/*** Local Function Prototypes ***/
+static uint32_t slo_u32ApprovalLatencyP99(const SloMetrics_t *metrics);
+static ret_status_t slo_s32ReadChildRss(pid_t child, uint32_t *rss_kb);
+static ret_status_t slo_s32CountChildFds(pid_t child, uint32_t *fd_count);
+static ret_status_t slo_s32StoreBaseline(FILE *slo_log_file);
+static void slo_vLogBaseline(FILE *slo_log_file, const char *action);
+
+/*** External Variables ***/
+
+/*** Internal Variables ***/
+static uint32_t slo_restart_request_ms = SLO_NO_PENDING_RESTART;
+static bool slo_baseline_valid = false;
+static uint32_t slo_baseline_rss_kb = 0U;
+static uint32_t slo_baseline_fd_count = 0U;
+static bool slo_baseline_have_approval = false;
+static uint32_t slo_baseline_approval_p99_ms = 0U;
+static bool slo_baseline_have_restart = false;
+static uint32_t slo_baseline_restart_ms = 0U;
+static bool slo_baseline_stored = false;      /* Baseline read from or written to slo_baseline_path */
+static const char *slo_baseline_path = NULL;
+static uint32_t slo_last_overflow_total = 0U;
+
+/*** Functions Provided to other modules ***/
+
+/**
+ * @brief Records the time at which the parent requested a child restart.
+ *
+ * Must be called in the parent immediately before fork() so that the child
+ * inherits the timestamp.
+ */
+void SLOMONITOR_vMarkRestartRequest(void)
+{
+    slo_restart_request_ms = UT_u32GetCurrentTime_ms();
+    if (slo_restart_request_ms == SLO_NO_PENDING_RESTART)
+    {
+        slo_restart_request_ms++; /* Keep 0 reserved for "no restart pending" */
+    }
+}
+
+/**
+ * @brief Called by a child once its threads are running; publishes the restart
+ *        time if this child was started by a restart request.
+ */
+void SLOMONITOR_vMarkChildReady(void)
+{
+    if (slo_restart_request_ms != SLO_NO_PENDING_RESTART)
+    {
+        uint32_t restart_time_ms = UT_u32GetCurrentTime_ms() - slo_restart_request_ms;
+        ITCOM_vRecordChildRestartTime(restart_time_ms);
+        log_message(global_log_file, LOG_INFO, "Child restart completed in %u ms", restart_time_ms);
+        slo_restart_request_ms = SLO_NO_PENDING_RESTART;
+    }
+}
+
+/**
+ * @brief Drops the RSS/fd baseline so that the next evaluation samples a new
+ *        child from scratch. A stored baseline is kept: a restarted child is
+ *        held to the same reference.
+ */
+void SLOMONITOR_vResetChildBaseline(void)
+{
+    if (!slo_baseline_stored)
+    {
+        slo_baseline_valid = false;
+    }
+}
+
+/**
+ * @brief Reads the baseline from a key = value file.
+ *
+ * Called once by the parent before the first evaluation. A missing or bad
+ * file leaves the baseline to the first sample of the child, which is then
+ * written to baseline_path. rss_kb and fd_count are required, a missing
+ * approval_p99_ms or restart_ms is sampled and added later.
+ *
+ * @param baseline_path Baseline file, normally SLO_BASELINE_PATH
+ * @param slo_log_file  Log file for the outcome
+ */
+void SLOMONITOR_vLoadBaseline(const char *baseline_path, FILE *slo_log_file)
+{
+    char line[SLO_BASELINE_LINE_SIZE];
+    char key[SLO_BASELINE_KEY_SIZE];
+    uint32_t value = 0U;
+    char extra = '\0';
+    bool have_rss = false;
+    bool have_fds = false;
+    bool valid = true;
+
+    slo_baseline_path = baseline_path;
+    FILE *baseline_file = fopen(baseline_path, "r");
+    if (baseline_file == NULL)
+    {
+        log_message(slo_log_file, LOG_INFO, "SLO: no baseline in %s, the first child sample is stored there", baseline_path);
+        return;
+    }
+
+    while (valid && (fgets(line, (int)sizeof(line), baseline_file) != NULL))
+    {
+        char *comment = strchr(line, '#');
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        int fields = sscanf(line, " %31[a-z0-9_] = %u %c", key, &value, &extra); /* 31 = SLO_BASELINE_KEY_SIZE - 1 */
+        if (fields == EOF)
+        {
+            continue; /* Blank or comment line */
+        }
+        if ((fields == 2) && (strcmp(key, SLO_BASELINE_RSS_KEY) == 0))
+        {
+            slo_baseline_rss_kb = value;
+            have_rss = true;
+        }
+        else if ((fields == 2) && (strcmp(key, SLO_BASELINE_FD_KEY) == 0))
+        {
+            slo_baseline_fd_count = value;
+            have_fds = true;
+        }
+        else if ((fields == 2) && (strcmp(key, SLO_BASELINE_APPROVAL_KEY) == 0))
+        {
+            slo_baseline_approval_p99_ms = value;
+            slo_baseline_have_approval = true;
+        }
+        else if ((fields == 2) && (strcmp(key, SLO_BASELINE_RESTART_KEY) == 0))
+        {
+            slo_baseline_restart_ms = value;
+            slo_baseline_have_restart = true;
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    (void)fclose(baseline_file);
+
+    if (!valid || !have_rss || !have_fds)
+    {
+        slo_baseline_have_approval = false;
+        slo_baseline_have_restart = false;
+        log_message(slo_log_file, LOG_WARNING, "SLO: baseline %s unusable, replaced by the first child sample", baseline_path);
+        return;
+    }
+
+    slo_baseline_valid = true;
+    slo_baseline_stored = true;
+    slo_vLogBaseline(slo_log_file, "read from");
+}
+
+/**
+ * @brief Evaluates all SLOs for the given child and logs the outcome.
+ *
+ * @param child        PID of the running child process
+ * @param slo_log_file Log file for the evaluation summary and breaches
+ */
+void SLOMONITOR_vEvaluate(pid_t child, FILE *slo_log_file)
+{
+    SloMetrics_t metrics = {0};
+    uint32_t p99_ms;
+    uint32_t overflow_total = 0U;
+    uint32_t rss_kb = 0U;
+    uint32_t fd_count = 0U;
+    uint32_t queue;
+    bool store = false;
+
+    ITCOM_vGetSloMetrics(&metrics);
+
+    p99_ms = slo_u32ApprovalLatencyP99(&metrics);
+    if ((metrics.u32ApprovalCount > 0U) && (p99_ms > (uint32_t)SLO_APPROVAL_LATENCY_P99_MS))
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO breach: approval latency p99 <= %u ms (limit %u ms, max %u ms)",
+                    p99_ms, (uint32_t)SLO_APPROVAL_LATENCY_P99_MS, metrics.u32ApprovalLatencyMax_ms);
+    }
+    if ((metrics.u32ApprovalCount > 0U) && !slo_baseline_have_approval)
+    {
+        slo_baseline_approval_p99_ms = p99_ms;
+        slo_baseline_have_approval = true;
+        store = true;
+    }
+    else if ((metrics.u32ApprovalCount > 0U) && (p99_ms > (slo_baseline_approval_p99_ms + SLO_MAX_APPROVAL_P99_GROWTH_MS)))
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO breach: approval latency p99 grew from %u ms to %u ms",
+                    slo_baseline_approval_p99_ms, p99_ms);
+    }
+
+    for (queue = 0U; queue < SLO_TOTAL_QUEUES; queue++)
+    {
+        overflow_total += metrics.au32QueueOverflowCount[queue];
+    }
+    if (overflow_total != slo_last_overflow_total)
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO breach: queue overflow (integrity %u, approved %u, safe state %u, notification %u)",
+                    metrics.au32QueueOverflowCount[DATA_INTEGRITY_QUEUE],
+                    metrics.au32QueueOverflowCount[APPROVED_ACTIONS_QUEUE],
+                    metrics.au32QueueOverflowCount[SAFE_STATE_QUEUE],
+                    metrics.au32QueueOverflowCount[NOTIFICATION_QUEUE]);
+        slo_last_overflow_total = overflow_total;
+    }
+
+    if (metrics.u32MaxRestartTime_ms > SLO_MAX_RESTART_TIME_MS)
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO breach: child restart time %u ms (limit %u ms, last %u ms)",
+                    metrics.u32MaxRestartTime_ms, SLO_MAX_RESTART_TIME_MS, metrics.u32LastRestartTime_ms);
+    }
+    if ((metrics.u32ChildRestartCount > 0U) && !slo_baseline_have_restart)
+    {
+        slo_baseline_restart_ms = metrics.u32MaxRestartTime_ms;
+        slo_baseline_have_restart = true;
+        store = true;
+    }
+    else if ((metrics.u32ChildRestartCount > 0U) &&
+             (metrics.u32MaxRestartTime_ms > (slo_baseline_restart_ms + SLO_MAX_RESTART_TIME_GROWTH_MS)))
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO breach: child restart time grew from %u ms to %u ms",
+                    slo_baseline_restart_ms, metrics.u32MaxRestartTime_ms);
+    }
+
+    if ((child > 0) &&
+        (slo_s32ReadChildRss(child, &rss_kb) == STORAGE_SUCCESS) &&
+        (slo_s32CountChildFds(child, &fd_count) == STORAGE_SUCCESS))
+    {
+        if (!slo_baseline_valid)
+        {
+            slo_baseline_rss_kb = rss_kb;
+            slo_baseline_fd_count = fd_count;
+            slo_baseline_valid = true;
+            store = true;
+        }
+        else
+        {
+            if (rss_kb > (slo_baseline_rss_kb + SLO_MAX_RSS_GROWTH_KB))
+            {
+                log_message(slo_log_file, LOG_WARNING, "SLO breach: child RSS grew from %u kB to %u kB",
+                            slo_baseline_rss_kb, rss_kb);
+            }
+            if (fd_count > (slo_baseline_fd_count + SLO_MAX_FD_GROWTH))
+            {
+                log_message(slo_log_file, LOG_WARNING, "SLO breach: child open fds grew from %u to %u",
+                            slo_baseline_fd_count, fd_count);
+            }
+        }
+    }
+
+    /* Without an RSS/fd sample the new entries wait for the next evaluation that has one */
+    if (store && slo_baseline_valid && (slo_baseline_path != NULL) &&
+        (slo_s32StoreBaseline(slo_log_file) == STORAGE_SUCCESS))
+    {
+        slo_baseline_stored = true;
+    }
+
+    log_message(slo_log_file, LOG_INFO,
+                "SLO: approvals %u, latency p99 <= %u ms, max %u ms, overflows %u, restarts %u (last %u ms), rss %u kB, fds %u",
+                metrics.u32ApprovalCount, p99_ms, metrics.u32ApprovalLatencyMax_ms, overflow_total,
+                metrics.u32ChildRestartCount, metrics.u32LastRestartTime_ms, rss_kb, fd_count);
+}
+
+/*** Local Function Implementations ***/
+
+/**
+ * @brief Returns the upper bound of the histogram bucket holding the 99th
+ *        percentile approval latency.
+ */
+static uint32_t slo_u32ApprovalLatencyP99(const SloMetrics_t *metrics)
+{
+    uint32_t target = ((metrics->u32ApprovalCount * SLO_PERCENTILE) + (SLO_PERCENT - 1U)) / SLO_PERCENT;
+    uint32_t cumulative = 0U;
+    uint32_t bucket;
+
+    for (bucket = 0U; bucket < SLO_LATENCY_HIST_BUCKETS; bucket++)
+    {
+        cumulative += metrics->au32ApprovalLatencyHist[bucket];
+        if ((target > 0U) && (cumulative >= target))
+        {
+            break;
+        }
+    }
+
+    if (bucket >= (SLO_LATENCY_HIST_BUCKETS - 1U))
+    {
+        /* Open-ended last bucket, the maximum is the only reliable bound */
+        return metrics->u32ApprovalLatencyMax_ms;
+    }
+
+    return (bucket + 1U) * SLO_LATENCY_BUCKET_WIDTH_MS;
+}
+
+/**
+ * @brief Reads the resident set size of the child from /proc/<pid>/statm.
+ */
+static ret_status_t slo_s32ReadChildRss(pid_t child, uint32_t *rss_kb)
+{
+    char path[SLO_PROC_PATH_LEN];
+    unsigned long size_pages = 0UL;
+    unsigned long resident_pages = 0UL;
+    long page_size = sysconf(_SC_PAGESIZE);
+    ret_status_t status = STORAGE_ERROR;
+
+    (void)snprintf(path, sizeof(path), "/proc/%d/statm", (int)child);
+    FILE *statm = fopen(path, "r");
+    if (statm != NULL)
+    {
+        if ((fscanf(statm, "%lu %lu", &size_pages, &resident_pages) == 2) && (page_size > 0))
+        {
+            *rss_kb = (uint32_t)((resident_pages * (unsigned long)page_size) / SLO_BYTES_TO_KB);
+            status = STORAGE_SUCCESS;
+        }
+        (void)fclose(statm);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Counts the open file descriptors of the child in /proc/<pid>/fd.
+ */
+static ret_status_t slo_s32CountChildFds(pid_t child, uint32_t *fd_count)
+{
+    char path[SLO_PROC_PATH_LEN];
+    struct dirent *entry;
+    uint32_t count = 0U;
+
+    (void)snprintf(path, sizeof(path), "/proc/%d/fd", (int)child);
+    DIR *fd_dir = opendir(path);
+    if (fd_dir == NULL)
+    {
+        return STORAGE_ERROR;
+    }
+
+    while ((entry = readdir(fd_dir)) != NULL)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            count++;
+        }
+    }
+    (void)closedir(fd_dir);
+
+    *fd_count = count;
+    return STORAGE_SUCCESS;
+}
+
+/**
+ * @brief Writes the baseline to slo_baseline_path, the approval latency and
+ *        restart time entries once sampled.
+ */
+static ret_status_t slo_s32StoreBaseline(FILE *slo_log_file)
+{
+    FILE *baseline_file = fopen(slo_baseline_path, "w");
+    if (baseline_file == NULL)
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO: cannot store the baseline in %s: %s", slo_baseline_path, strerror(errno));
+        return STORAGE_ERROR;
+    }
+
+    (void)fprintf(baseline_file, "# SLO baseline of the child, delete to take a new sample\n%s = %u\n%s = %u\n",
+                  SLO_BASELINE_RSS_KEY, slo_baseline_rss_kb, SLO_BASELINE_FD_KEY, slo_baseline_fd_count);
+    if (slo_baseline_have_approval)
+    {
+        (void)fprintf(baseline_file, "%s = %u\n", SLO_BASELINE_APPROVAL_KEY, slo_baseline_approval_p99_ms);
+    }
+    if (slo_baseline_have_restart)
+    {
+        (void)fprintf(baseline_file, "%s = %u\n", SLO_BASELINE_RESTART_KEY, slo_baseline_restart_ms);
+    }
+    if (fclose(baseline_file) != 0)
+    {
+        log_message(slo_log_file, LOG_WARNING, "SLO: cannot store the baseline in %s: %s", slo_baseline_path, strerror(errno));
+        return STORAGE_ERROR;
+    }
+
+    slo_vLogBaseline(slo_log_file, "stored in");
+    return STORAGE_SUCCESS;
+}
+
+/**
+ * @brief Logs the baseline together with what was done with slo_baseline_path.
+ */
+static void slo_vLogBaseline(FILE *slo_log_file, const char *action)
+{
+    char approval[SLO_BASELINE_KEY_SIZE] = "not sampled";
+    char restart[SLO_BASELINE_KEY_SIZE] = "not sampled";
+
+    if (slo_baseline_have_approval)
+    {
+        (void)snprintf(approval, sizeof(approval), "<= %u ms", slo_baseline_approval_p99_ms);
+    }
+    if (slo_baseline_have_restart)
+    {
+        (void)snprintf(restart, sizeof(restart), "%u ms", slo_baseline_restart_ms);
+    }
+    log_message(slo_log_file, LOG_INFO, "SLO: baseline rss %u kB, fds %u, approval p99 %s, restart %s %s %s",
+                slo_baseline_rss_kb, slo_baseline_fd_count, approval, restart, action, slo_baseline_path);
+}
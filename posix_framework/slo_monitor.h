@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * @file slo_monitor.h
+ *****************************************************************************
+ * Project Name: Sonatus Automator Safety Interlock(ASI)
+ *
+ * @brief Header file for the service level objective (SLO) monitor run by the
+ *        parent process against the child process.
+ *
+ * @details
+ * Defines external interfaces for:
+ * - Restart time measurement across a child restart
+ * - Periodic SLO evaluation (approval latency p99, queue overflows,
+ *   restart time, growth of RSS, file descriptors, approval latency p99
+ *   and restart time against a stored baseline)
+ *
+ * @authors Tusar Palauri (TP)
+ * @date October 18, 2026
+ *
+ * Version History:
+ * ---------------
+ * Date       | Author | Description
+ * -----------|--------|-------------
+ * 10/18/2026 | TP     | Initial
+ * 10/18/2026 | TP     | RSS/fd baseline read from a stored file
+ * 10/18/2026 | TP     | Approval latency and restart time growth limits
+ */
+
+#ifndef SLO_MONITOR_H
+#define SLO_MONITOR_H
+
+/*** Include Files ***/
+#include "gen_std_types.h"
+#include "itcom.h"
+#include "storage_handler.h"
+
+/*** Definitions Provided to other modules ***/
+#define SLO_EVALUATION_INTERVAL_S        (10)                                         /* Parent evaluation period */
+#define SLO_APPROVAL_LATENCY_P99_MS      (ACTION_REQUEST_PROCESS_TIMEOUT_THRESHOLD)   /* p99 approval latency bound */
+#define SLO_MAX_RESTART_TIME_MS          (1000U)                                      /* Restart request to threads running */
+#define SLO_MAX_RSS_GROWTH_KB            (1024U)                                      /* RSS growth over child baseline */
+#define SLO_MAX_FD_GROWTH                (8U)                                         /* Open fd growth over child baseline */
+#define SLO_MAX_APPROVAL_P99_GROWTH_MS   (2U * SLO_LATENCY_BUCKET_WIDTH_MS)           /* Approval latency p99 growth over baseline */
+#define SLO_MAX_RESTART_TIME_GROWTH_MS   (100U)                                       /* Restart time growth over baseline */
+
+/*** Type Definitions ***/
+
+/*** Functions Provided to other modules ***/
+extern void SLOMONITOR_vMarkRestartRequest(void);
+extern void SLOMONITOR_vMarkChildReady(void);
+extern void SLOMONITOR_vResetChildBaseline(void);
+extern void SLOMONITOR_vLoadBaseline(const char *baseline_path, FILE *slo_log_file);
+extern void SLOMONITOR_vEvaluate(pid_t child, FILE *slo_log_file);
+
+/*** Variables Provided to other modules ***/
+
+#endif /* SLO_MONITOR_H */
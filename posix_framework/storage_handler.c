@@ -44,25 +44,57 @@ File Operations:
  * 10/04/2024 | TP     | Added save_all_shared_data_to_storage function
  * 11/15/2024 | TP     | MISRA & LHP compliance fixes
  * 11/22/2024 | TP     | Cleanup v1.0
+ * 10/18/2026 | TP     | log_message reports calls made under a profiled lock
+ * 10/18/2026 | TP     | log_message hands the write to the worker pool for periodic threads
+ * 10/18/2026 | TP     | Storage comparison buffers moved off the stack
+ * 10/18/2026 | TP     | Storage files carry the region layout, regions reloaded one by one
+ * 10/18/2026 | TP     | Deferred ERROR and WARNING lines flushed as soon as they are written
+ * 10/18/2026 | TP     | Log timestamps taken from the UT time source
+ * 10/18/2026 | TP     | Deferred lines dropped and counted when the worker queue is full, count logged by the worker
+ * 10/18/2026 | TP     | log_message marks its libc section so a fault inside it is not recovered in place
  *
  */
 
 /*** Include Files ***/
+#include <stddef.h>
+
 #include "storage_handler.h"
+#include "lock_owner.h"
+#include "worker_pool.h"
 
 /*** Module Definitions ***/
+#define LOG_LINE_SIZE                    (WORKERPOOL_JOB_ARG_SIZE - sizeof(FILE *) - sizeof(bool))
+#define STORAGE_COMPARE_CHUNK_SIZE       (4096U)
 
 /*** Internal Types ***/
+/* Argument of a deferred log write */
+typedef struct
+{
+    FILE *file;
+    bool flush;                          /* ERROR/WARNING line, flushed at once */
+    str_t line[LOG_LINE_SIZE];
+} deferred_log_t;
 
 /*** Local Function Prototypes ***/
 static ret_status_t create_storage_file(str_const_t const filepath);
 static valid_status_t is_file_valid(str_const_t const filepath);
-static void read_shared_data_from_file(str_const_t const filename, DataOnSharedMemory *const data);
+static ret_status_t read_shared_data_from_file(str_const_t const filename, DataOnSharedMemory *const data);
+static valid_status_t storage_files_identical(str_const_t const filepath_a, str_const_t const filepath_b);
+static ret_status_t load_storage_file(str_const_t const filename, DataOnSharedMemory *const shared_data,
+                                      uint32_t *const reset_regions);
+static void write_deferred_log(const void *arg, size_t arg_size);
+static void flush_deferred_logs(const void *arg, size_t arg_size);
 
 /*** External Variables ***/
 FILE *global_log_file = NULL;
 
 /*** Internal Variables ***/
+/* Storage file read by compare_and_load_storage() and the chunks compared between the two files;
+ * static so the caller's stack stays small */
+static DataOnSharedMemory storage_file_data;
+static uint8_t storage_compare_chunks[2][STORAGE_COMPARE_CHUNK_SIZE];
+/* Deferred log lines dropped with the worker queue full, not reported yet */
+static uint32_t deferred_log_dropped = 0U;
 
 /*** Functions Provided to other modules ***/
 
@@ -92,7 +124,18 @@ FILE *global_log_file = NULL;
  * - Thread Safety: This function is thread-safe through the use of flockfile/funlockfile
  * - Buffer Limits: Message buffer is limited to 1024 bytes
  * - Timestamp buffer is limited to 20 bytes
- * - The function performs immediate flush after writing
+ * - The function performs immediate flush after writing, except for threads that
+ *   set WORKERPOOL_vSetLogDeferral(): the formatted line is queued to the worker
+ *   pool, which writes it and then flushes once per burst of lines. ERROR and
+ *   WARNING lines (faults included) are flushed as soon as the worker writes
+ *   them. A deferring thread never writes the file itself: with the worker
+ *   queue full the line is dropped and counted, and the worker logs the count
+ *   after the next line it writes. The line is written inline only if the
+ *   pool is stopped (no worker left to write it)
+ * - Everything after the NULL check runs between LockOwner_vEnterLibc() and
+ *   LockOwner_vLeaveLibc(): localtime_r, vsnprintf and the stdio calls take
+ *   libc internal locks, and a thread faulting in here is never resumed by
+ *   recover_faulted_thread()
  *
  * @warning
  * - The function assumes the log file has been properly opened with write permissions
@@ -113,20 +156,26 @@ void log_message(FILE *storage_log_file, const log_level_t level, const str_cons
         return;
     }
 
+    /* Profiling builds only: charge this call to any lock the caller holds */
+    LOCK_PROFILER_NOTE_LOG_CALL();
+    LockOwner_vEnterLibc();
+
     va_list args;
     str_t buffer[1024];
     str_t timestamp[20];
-    time_t now = time(NULL);
+    time_t now = UT_tGetWallTime_s();
     struct tm time_struct;
 
     /* Use thread-safe localtime_r instead of localtime */
     if (localtime_r(&now, &time_struct) == NULL)
     {
+        LockOwner_vLeaveLibc();
         return;
     }
 
     if (strftime((char *)timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &time_struct) == 0)
     {
+        LockOwner_vLeaveLibc();
         return;
     }
 
@@ -136,17 +185,51 @@ void log_message(FILE *storage_log_file, const log_level_t level, const str_cons
     /* Bounds checking for level parameter */
     const str_const_t level_str = (level >= 0 && level <= LOG_DEBUG) ? level_strings[level] : level_strings[4];
 
-    /* Thread-safe file operations */
-    flockfile(storage_log_file);
-
     va_start(args, format);
     (void)vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
 
+    if (WORKERPOOL_bLogDeferred())
+    {
+        deferred_log_t entry;
+        int32_t submit_result = WORKERPOOL_INVALID;
+        int length;
+
+        entry.file = storage_log_file;
+        entry.flush = (level == LOG_ERROR) || (level == LOG_WARNING);
+        length = snprintf(entry.line, sizeof(entry.line), "[%s] [%s] %s\n", timestamp, level_str, buffer);
+        if (length >= (int)sizeof(entry.line))
+        {
+            length = (int)sizeof(entry.line) - 1;
+        }
+        if (length > 0)
+        {
+            submit_result = WORKERPOOL_s32Submit(&write_deferred_log, &entry, offsetof(deferred_log_t, line) + (size_t)length + 1U,
+                                                 enWorkerPrioNormal, WORKERPOOL_KEY_NONE);
+        }
+        if (submit_result == WORKERPOOL_SUBMITTED)
+        {
+            (void)WORKERPOOL_s32Submit(&flush_deferred_logs, NULL, 0U, enWorkerPrioLow, WORKERPOOL_KEY_LOG_FLUSH);
+            LockOwner_vLeaveLibc();
+            return;
+        }
+        if (submit_result == WORKERPOOL_QUEUE_FULL)
+        {
+            /* Never wait on the file from a real-time thread */
+            (void)__atomic_add_fetch(&deferred_log_dropped, 1U, __ATOMIC_RELAXED);
+            LockOwner_vLeaveLibc();
+            return;
+        }
+    }
+
+    /* Thread-safe file operations */
+    flockfile(storage_log_file);
+
     (void)fprintf(storage_log_file, "[%s] [%s] %s\n", timestamp, level_str, buffer);
     (void)fflush(storage_log_file);
 
     funlockfile(storage_log_file);
+    LockOwner_vLeaveLibc();
 }
 
 /**
@@ -268,10 +351,15 @@ ret_status_t create_storage_directory(void)
  *  - Explicit fsync() call to ensure data is written to disk
  *  - Atomic file operation using O_TRUNC
  *
+ * @par File Layout:
+ * The file holds the first stRegionLayout.u32DataSize bytes of the mapping:
+ * DataOnSharedMemory, starting with the region layout descriptor, followed
+ * by the regions it places.
+ *
  * @par Implementation Details:
  * 1. Parameter validation
  * 2. File creation/opening with proper flags
- * 3. Single write operation for entire data structure
+ * 3. Single write operation for the structure and its regions
  * 4. Synchronization to disk
  * 5. File closure
  * 6. Permission setting
@@ -319,8 +407,9 @@ void write_shared_data_to_file(str_const_t filename, DataOnSharedMemory *data)
         return;
     }
 
-    ssize_t const write_result = write(fd, data, sizeof(DataOnSharedMemory));
-    if (write_result != sizeof(DataOnSharedMemory))
+    size_t const data_size = (size_t)data->stRegionLayout.u32DataSize;
+    ssize_t const write_result = write(fd, data, data_size);
+    if (write_result != (ssize_t)data_size)
     {
         (void)log_message(global_log_file, LOG_ERROR, "Failed to write data to file: %s", (write_result == -1) ? strerror(errno) : "Incomplete write");
         (void)close(fd);
@@ -353,12 +442,15 @@ void write_shared_data_to_file(str_const_t filename, DataOnSharedMemory *data)
  *
  * This static function safely reads a DataOnSharedMemory structure from a specified file,
  * with comprehensive error handling and data validation. If reading fails, the output
- * structure is zeroed to ensure defined state.
+ * structure is zeroed to ensure defined state. The regions stored after the
+ * structure are read by load_storage_file().
  *
  * @param[in]  filename    Path to the storage file to read. Must be non-NULL.
  * @param[out] data        Pointer to DataOnSharedMemory structure where read data
  *                         will be stored. Must be non-NULL. Will be zeroed on read failure.
  *
+ * @return ret_status_t STORAGE_SUCCESS when the whole structure was read, STORAGE_ERROR otherwise
+ *
  * @pre
  *  - filename must be a valid, null-terminated string
  *  - data must point to an allocated DataOnSharedMemory structure
@@ -424,24 +516,27 @@ void write_shared_data_to_file(str_const_t filename, DataOnSharedMemory *data)
  *  - memset() for structure clearing
  *
  */
-static void read_shared_data_from_file(str_const_t const filename, DataOnSharedMemory *const data)
+static ret_status_t read_shared_data_from_file(str_const_t const filename, DataOnSharedMemory *const data)
 {
+    ret_status_t status = STORAGE_SUCCESS;
+
     if ((filename == NULL) || (data == NULL))
     {
-        return;
+        return STORAGE_ERROR;
     }
 
     file_desc_t const fd = open((const char *)filename, O_RDONLY);
     if (fd == -1)
     {
         (void)log_message(global_log_file, LOG_ERROR, "Failed to open file for reading: %s", strerror(errno));
-        return;
+        return STORAGE_ERROR;
     }
 
     ssize_t const read_result = read(fd, data, sizeof(DataOnSharedMemory));
     if (read_result != sizeof(DataOnSharedMemory))
     {
         (void)log_message(global_log_file, LOG_ERROR, "Failed to read data from file: %s", (read_result == -1) ? strerror(errno) : "Incomplete read");
+        status = STORAGE_ERROR;
 
         /* Clear the data structure to ensure it's initialized */
         void *const memset_result = memset(data, 0, sizeof(DataOnSharedMemory));
@@ -449,7 +544,7 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
         {
             (void)log_message(global_log_file, LOG_ERROR, "Memory clear operation failed");
             (void)close(fd);
-            return;
+            return STORAGE_ERROR;
         }
     }
 
@@ -458,6 +553,178 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
     {
         (void)log_message(global_log_file, LOG_ERROR, "Failed to close file: %s", strerror(errno));
     }
+
+    return status;
+}
+
+/**
+ * @brief Compares two storage files chunk by chunk.
+ *
+ * @param[in] filepath_a First file
+ * @param[in] filepath_b Second file
+ *
+ * @return valid_status_t 1 when both files hold the same bytes, 0 otherwise
+ *         or when either file cannot be read
+ */
+static valid_status_t storage_files_identical(str_const_t const filepath_a, str_const_t const filepath_b)
+{
+    valid_status_t identical = 1;
+    ssize_t read_a;
+    ssize_t read_b;
+
+    file_desc_t const fd_a = open((const char *)filepath_a, O_RDONLY);
+    file_desc_t const fd_b = open((const char *)filepath_b, O_RDONLY);
+
+    if ((fd_a == -1) || (fd_b == -1))
+    {
+        identical = 0;
+    }
+
+    while (identical != 0)
+    {
+        read_a = read(fd_a, storage_compare_chunks[0], STORAGE_COMPARE_CHUNK_SIZE);
+        read_b = read(fd_b, storage_compare_chunks[1], STORAGE_COMPARE_CHUNK_SIZE);
+        if ((read_a != read_b) || (read_a < 0) ||
+            (memcmp(storage_compare_chunks[0], storage_compare_chunks[1], (size_t)read_a) != 0))
+        {
+            identical = 0;
+        }
+        else if (read_a == 0)
+        {
+            break;
+        }
+        else
+        {
+            /* Intentionally empty else block */
+        }
+    }
+
+    if (fd_a != -1)
+    {
+        (void)close(fd_a);
+    }
+    if (fd_b != -1)
+    {
+        (void)close(fd_b);
+    }
+
+    return identical;
+}
+
+/**
+ * @brief Loads one storage file into the shared memory mapping.
+ *
+ * DataOnSharedMemory is copied whole except for the region layout
+ * descriptor, which keeps describing the running mapping. Each region is
+ * then read from its offset in the file when the file stored it with the
+ * same capacity and element size; any other region is flagged in
+ * reset_regions for the caller to reinitialize.
+ *
+ * @param[in]  filename      Storage file, already checked by is_file_valid()
+ * @param[out] shared_data   Mapping to fill
+ * @param[out] reset_regions ITCOM_REGION_BIT() mask of the regions not loaded
+ *
+ * @return ret_status_t STORAGE_SUCCESS, or STORAGE_ERROR when DataOnSharedMemory
+ *         could not be read (shared_data is then left untouched)
+ */
+static ret_status_t load_storage_file(str_const_t const filename, DataOnSharedMemory *const shared_data,
+                                      uint32_t *const reset_regions)
+{
+    ItcomRegionLayout_t const current = shared_data->stRegionLayout;
+    ItcomRegionLayout_t stored;
+    uint8_t *const base = (uint8_t *)shared_data;
+    uint8_t region;
+
+    if (read_shared_data_from_file(filename, &storage_file_data) != STORAGE_SUCCESS)
+    {
+        return STORAGE_ERROR;
+    }
+    stored = storage_file_data.stRegionLayout;
+
+    if (memcpy(shared_data, &storage_file_data, sizeof(DataOnSharedMemory)) != shared_data)
+    {
+        (void)log_message(global_log_file, LOG_ERROR, "Memory copy operation failed");
+        return STORAGE_ERROR;
+    }
+    shared_data->stRegionLayout = current;
+    *reset_regions = 0U;
+
+    file_desc_t const fd = open((const char *)filename, O_RDONLY);
+    for (region = 0U; region < (uint8_t)enTotalRegions; region++)
+    {
+        const ItcomRegionDesc_t *const now = &current.astRegions[region];
+        const ItcomRegionDesc_t *const then = &stored.astRegions[region];
+
+        if ((fd == -1) || (now->u32Capacity != then->u32Capacity) || (now->u32ElementSize != then->u32ElementSize) ||
+            (pread(fd, base + now->u32Offset, now->u32Size, (off_t)then->u32Offset) != (ssize_t)now->u32Size))
+        {
+            *reset_regions |= ITCOM_REGION_BIT(region);
+        }
+    }
+
+    if (fd == -1)
+    {
+        (void)log_message(global_log_file, LOG_ERROR, "Failed to open file for reading: %s", strerror(errno));
+    }
+    else if (close(fd) != 0)
+    {
+        (void)log_message(global_log_file, LOG_ERROR, "Failed to close file: %s", strerror(errno));
+    }
+    else
+    {
+        /* Intentionally empty else block */
+    }
+
+    return STORAGE_SUCCESS;
+}
+
+/**
+ * @brief Worker pool job writing one log line queued by log_message().
+ *
+ * The line is written under the stream lock so that it is not interleaved
+ * with lines written inline by other threads. An ERROR or WARNING line is
+ * flushed at once, so that it reaches the file even if the child dies right
+ * after; the flush of the other lines is left to flush_deferred_logs().
+ * Lines dropped with the queue full since the last report are then counted
+ * in a warning of their own, written by this (non deferring) worker thread.
+ *
+ * @param[in] arg      deferred_log_t holding the stream and the formatted line
+ * @param[in] arg_size Bytes of arg in use
+ */
+static void write_deferred_log(const void *arg, size_t arg_size)
+{
+    const deferred_log_t *const entry = (const deferred_log_t *)arg;
+    uint32_t dropped;
+
+    (void)arg_size;
+
+    flockfile(entry->file);
+    (void)fputs(entry->line, entry->file);
+    if (entry->flush)
+    {
+        (void)fflush(entry->file);
+    }
+    funlockfile(entry->file);
+
+    dropped = __atomic_exchange_n(&deferred_log_dropped, 0U, __ATOMIC_RELAXED);
+    if (dropped != 0U)
+    {
+        log_message(entry->file, LOG_WARNING, "%u log line(s) dropped with the worker queue full", dropped);
+    }
+}
+
+/**
+ * @brief Worker pool job flushing the log streams after deferred writes.
+ *
+ * Submitted with WORKERPOOL_KEY_LOG_FLUSH after every deferred line, so a
+ * burst of lines ends in a single flush.
+ */
+static void flush_deferred_logs(const void *arg, size_t arg_size)
+{
+    (void)arg;
+    (void)arg_size;
+
+    (void)fflush(NULL);
 }
 
 /**
@@ -470,6 +737,10 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
  *
  * @param[out] shared_data Pointer to shared data structure where the loaded data
  *                        will be stored. Must be non-NULL.
+ * @param[out] reset_regions ITCOM_REGION_BIT() mask of the regions the selected
+ *                          file stored with another capacity or element size.
+ *                          Their contents were not loaded; the caller reinitializes
+ *                          them and rebinds the region pointers of shared_data.
  *
  * @return ret_status_t Status of the operation:
  *         - STORAGE_SUCCESS (0): Data successfully loaded from at least one valid source
@@ -487,7 +758,7 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
  * @par Validation Steps:
  * For each storage file:
  * 1. Check file existence
- * 2. Verify file size matches DataOnSharedMemory structure
+ * 2. Verify the stored region layout descriptor matches the file and this build
  * 3. Validate read operations
  * 4. Compare data when both files are valid
  *
@@ -515,23 +786,22 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
  * 6. Selected data copying to output structure
  *
  * @par Memory Management:
- * The function uses stack-allocated structures for temporary storage:
- *  - parent_data: Holds data read from parent storage
- *  - child_data: Holds data read from child storage
- * These are zero-initialized at declaration
+ * The function uses static buffers for temporary storage, so that it
+ * does not put DataOnSharedMemory copies on the caller's stack:
+ *  - storage_compare_chunks: Chunks of both files while they are compared
+ *  - storage_file_data: DataOnSharedMemory read from the selected file
  *
  * @warning
  *  - Function assumes parent and child storage paths are defined (PARENT_STORAGE_PATH, CHILD_STORAGE_PATH)
  *  - No file locking mechanism is implemented - concurrent access must be handled by caller
- *  - Memory copying uses memcpy() - structures must not contain pointers
+ *  - Pointers into the regions are copied from the file as stored - the caller rebinds them
  *  - The function assumes global_log_file is properly initialized
  *
  * @par Performance Considerations:
  * The function may perform:
- *  - Up to two file existence checks
- *  - Up to two complete file reads
- *  - One memory comparison (if both files valid)
- *  - One memory copy operation
+ *  - Up to two file header checks
+ *  - One chunked comparison of both files (if both files valid)
+ *  - One read of DataOnSharedMemory and one read per region
  *
  * @par Thread Safety:
  * This function is not thread-safe. Caller must ensure:
@@ -540,19 +810,20 @@ static void read_shared_data_from_file(str_const_t const filename, DataOnSharedM
  *
  * @par Dependencies:
  *  - is_file_valid() for file validation
- *  - read_shared_data_from_file() for data reading
+ *  - storage_files_identical() for data comparison
+ *  - load_storage_file() for data reading
  *  - log_message() for status logging
- *  - memcpy() for data copying
- *  - memcmp() for data comparison
  *
  * The function does not implement internal synchronization. The caller must ensure:
  *  - Atomic access to storage files
  *  - Atomic access to shared_data structure
  *  - Proper initialization of global resources
  */
-ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data)
+ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data, uint32_t *const reset_regions)
 {
-    if (shared_data == NULL)
+    str_const_t source = NULL;
+
+    if ((shared_data == NULL) || (reset_regions == NULL))
     {
         return STORAGE_ERROR;
     }
@@ -563,63 +834,38 @@ ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data)
     /* Check if child storage file exists and is valid */
     valid_status_t const child_valid = is_file_valid(CHILD_STORAGE_PATH);
 
-    /* Declare structures to hold data from storage files */
-    DataOnSharedMemory parent_data = {0};
-    DataOnSharedMemory child_data = {0};
-
-    /* If parent storage file is valid, read its contents */
     if (parent_valid != 0)
     {
-        read_shared_data_from_file(PARENT_STORAGE_PATH, &parent_data);
         (void)log_message(global_log_file, LOG_INFO, "Parent storage file is valid");
     }
 
-    /* If child storage file is valid, read its contents */
     if (child_valid != 0)
     {
-        read_shared_data_from_file(CHILD_STORAGE_PATH, &child_data);
         (void)log_message(global_log_file, LOG_INFO, "Child storage file is valid");
     }
 
     /* If both files are valid, compare their contents */
     if ((parent_valid != 0) && (child_valid != 0))
     {
-        if (memcmp(&parent_data, &child_data, sizeof(DataOnSharedMemory)) == 0)
+        if (storage_files_identical(PARENT_STORAGE_PATH, CHILD_STORAGE_PATH) != 0)
         {
             (void)log_message(global_log_file, LOG_INFO, "Parent & Child storage files are identical");
-            if (memcpy(shared_data, &child_data, sizeof(DataOnSharedMemory)) != shared_data)
-            {
-                (void)log_message(global_log_file, LOG_ERROR, "Memory copy operation failed");
-                return STORAGE_ERROR;
-            }
         }
         else
         {
-            if (memcpy(shared_data, &child_data, sizeof(DataOnSharedMemory)) != shared_data)
-            {
-                (void)log_message(global_log_file, LOG_ERROR, "Memory copy operation failed");
-                return STORAGE_ERROR;
-            }
             (void)log_message(global_log_file, LOG_INFO, "Parent & Child storage files content differ");
         }
+        source = CHILD_STORAGE_PATH;
     }
     else if (child_valid != 0)
     {
-        if (memcpy(shared_data, &child_data, sizeof(DataOnSharedMemory)) != shared_data)
-        {
-            (void)log_message(global_log_file, LOG_ERROR, "Memory copy operation failed");
-            return STORAGE_ERROR;
-        }
         (void)log_message(global_log_file, LOG_INFO, "Only Child storage file is valid, using it for SharedMemory");
+        source = CHILD_STORAGE_PATH;
     }
     else if (parent_valid != 0)
     {
-        if (memcpy(shared_data, &parent_data, sizeof(DataOnSharedMemory)) != shared_data)
-        {
-            (void)log_message(global_log_file, LOG_ERROR, "Memory copy operation failed");
-            return STORAGE_ERROR;
-        }
         (void)log_message(global_log_file, LOG_INFO, "Only Parent storage file is valid, using it for SharedMemory");
+        source = PARENT_STORAGE_PATH;
     }
     else
     {
@@ -627,7 +873,7 @@ ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data)
         return STORAGE_ERROR;
     }
 
-    return STORAGE_SUCCESS;
+    return load_storage_file(source, shared_data, reset_regions);
 }
 
 /**
@@ -937,16 +1183,18 @@ static ret_status_t create_storage_file(str_const_t const filepath)
 }
 
 /**
- * @brief Validates storage file existence and size.
+ * @brief Validates storage file existence, size and region layout.
  *
- * Checks if a file exists and has the exact size of DataOnSharedMemory structure.
- * Logs non-existence errors via log_message().
+ * Checks if a file exists and starts with a region layout descriptor that
+ * ITCOM_bRegionLayoutValid() accepts for the file size, i.e. written by a
+ * build with the same DataOnSharedMemory. Its regions may have any capacity.
+ * Logs access errors other than non-existence via log_message().
  *
  * @param[in] filepath Path to the file to validate. Must be non-NULL.
  *
  * @return valid_status_t Status of validation:
- *         - 1: File exists and has correct size
- *         - 0: File invalid (doesn't exist, wrong size, or NULL filepath)
+ *         - 1: File exists and its descriptor describes it
+ *         - 0: File invalid (doesn't exist, bad descriptor, or NULL filepath)
  *
  * @note Thread-unsafe. Caller must handle synchronization.
  *
@@ -968,7 +1216,23 @@ static valid_status_t is_file_valid(str_const_t const filepath)
         return 0;
     }
 
-    return (valid_status_t)(st.st_size == sizeof(DataOnSharedMemory));
+    if (st.st_size < (off_t)sizeof(DataOnSharedMemory))
+    {
+        return 0;
+    }
+
+    ItcomRegionLayout_t stored;
+    file_desc_t const fd = open((const char *)filepath, O_RDONLY);
+    if (fd == -1)
+    {
+        (void)log_message(global_log_file, LOG_INFO, "File access error: %s", strerror(errno));
+        return 0;
+    }
+    ssize_t const read_result = read(fd, &stored, sizeof(stored));
+    (void)close(fd);
+
+    return (valid_status_t)((read_result == (ssize_t)sizeof(stored)) &&
+                            ITCOM_bRegionLayoutValid(&stored, (size_t)st.st_size));
 }
 
 /**
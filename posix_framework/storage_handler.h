@@ -34,6 +34,9 @@
  * 10/04/2024 | TP     | Added save_all_shared_data_to_storage function
  * 11/15/2024 | TP     | MISRA & LHP compliance fixes
  * 11/22/2024 | TP     | Cleanup v1.0
+ * 10/18/2026 | TP     | Storage files sized by the region layout descriptor, layout configuration path
+ * 10/18/2026 | TP     | Thread tuning configuration path
+ * 10/18/2026 | TP     | SLO baseline path
  *
  */
 
@@ -88,6 +91,28 @@
 #define STORAGE_DIR_PATH "ASI_DATA/STORAGE"
 #define PARENT_STORAGE_PATH "ASI_DATA/STORAGE/parent_storage.bin"
 #define CHILD_STORAGE_PATH "ASI_DATA/STORAGE/child_storage.bin"
+#define SLO_BASELINE_PATH "ASI_DATA/STORAGE/slo_baseline.cfg"
+
+/**
+ * @def SHM_LAYOUT_CONFIG_PATH
+ * @brief Region layout configuration read at startup.
+ *
+ * Optional key = value file giving the capacities of the shared memory
+ * queues, tracking buffers and event store (see itcom_layout.c). Without
+ * it the compile-time defaults are used.
+ *
+ */
+#define SHM_LAYOUT_CONFIG_PATH "ASI_DATA/CONFIG/shm_layout.cfg"
+
+/**
+ * @def THREAD_TUNING_CONFIG_PATH
+ * @brief Thread tuning read by the parent on SIGHUP.
+ *
+ * One "<thread> = <period ms> <priority> <CPU mask> <budget us> <overrun %>"
+ * line per thread to retune (see request_thread_tuning_from_file()).
+ *
+ */
+#define THREAD_TUNING_CONFIG_PATH "ASI_DATA/CONFIG/thread_tuning.cfg"
 
 #define STORAGE_FILE_PARENT          (1)
 #define STORAGE_FILE_CHILD           (2)
@@ -110,7 +135,7 @@ typedef char          str_t;                /* String type */
 extern void log_message(FILE *storage_log_file, const log_level_t level, const str_const_t format, ...);
 extern ret_status_t create_storage_directory(void);
 extern void write_shared_data_to_file(str_const_t filename, DataOnSharedMemory *data);
-extern ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data);
+extern ret_status_t compare_and_load_storage(DataOnSharedMemory *const shared_data, uint32_t *const reset_regions);
 extern ret_status_t initialize_storage_files(const storage_flags_t storage_flags);
 extern void save_all_shared_data_to_storage(DataOnSharedMemory *shared_data);
 
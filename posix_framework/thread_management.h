@@ -42,6 +42,15 @@
 * 10/09/2024 | TP     | Multiple ASI_APP restart issues fixed
 * 11/15/2024 | TP     | MISRA & LHP compliance fixes
 * 11/22/2024 | TP     | Cleanup v1.0
+* 10/18/2026 | TP     | Per job CPU time, deadline miss and budget accounting
+* 10/18/2026 | TP     | Faulted cycles recovered in place through per-thread reset hooks
+* 10/18/2026 | TP     | CPU mask, tuned budget and overrun threshold for runtime tuning
+* 10/18/2026 | TP     | Optional cyclic executive: frame steps of the 50 ms modules
+* 10/18/2026 | TP     | Per-thread stack size in the thread table
+* 10/18/2026 | TP     | Periodic thread check for the signal interruption count
+* 10/18/2026 | TP     | initiate_graceful_shutdown reports a thread left running
+* 10/18/2026 | TP     | Tuning request read from a configuration file
+* 10/18/2026 | TP     | Frame step table owned by run_cyclic_frame
 */
 
 #ifndef THREAD_MANAGEMENT_H
@@ -83,6 +92,8 @@ typedef struct {
     thread_priority_t priority;
     thread_period_t periodicity;
     sem_t *thread_sem; 
+    size_t stack_size;               /* Bytes of the thread stack, guard page excluded */
+    uint64_t cpu_mask;               /* CPUs 0..63 the thread may run on, 0 for any CPU */
 } thread_info_t;
 
 typedef struct {
@@ -115,8 +126,21 @@ typedef struct {
     uint32_t overrun_count;
     bool is_executing;
     sem_t *thread_sem;
+    struct timespec cpu_start;       /* Thread CPU time at the start of the current job */
+    struct timespec release;         /* Release time of the current job (SCHED_DEADLINE mode) */
+    uint64_t wcet_ns;                /* Longest job in thread CPU time */
+    uint64_t window_wcet_ns;         /* Longest job of the current budget window */
+    uint64_t budget_ns;              /* Runtime per period derived from the period and WCET */
+    uint32_t job_count;
+    uint32_t deadline_misses;        /* Jobs completed after the next release, releases skipped */
+    uint32_t budget_overruns;        /* Jobs that used up their budget (throttled under SCHED_DEADLINE) */
+    uint64_t tuned_budget_ns;        /* Budget set through the tuning block, 0 derives it from the WCET */
+    uint32_t overrun_pct;            /* Overrun threshold in percent of the period */
 } thread_timing_t;
 
+/* Resets the module state of a thread after a faulted cycle, runs on that thread */
+typedef void (*thread_reset_hook_t)(void);
+
 /*** Functions Provided to other modules ***/
 extern void set_thread_exit(sig_atomic_t value);
 extern sig_atomic_t get_thread_exit(void);
@@ -128,10 +152,18 @@ extern void destroy_timers(void);
 extern thread_status_code_t start_threads(DataOnSharedMemory *shared_data, FILE *thread_mgmt_log_file);
 extern void monitor_threads(DataOnSharedMemory *shared_data);
 extern void handle_thread_termination(DataOnSharedMemory *shared_data);
-extern void initiate_graceful_shutdown(DataOnSharedMemory *shared_data);
+extern bool initiate_graceful_shutdown(DataOnSharedMemory *shared_data);
 extern thread_name_t get_current_thread_name(void);
+extern bool is_periodic_thread(void);
 extern void restore_main_thread_sigmask(void);
 extern sig_name_t get_signal_name(sig_num_t sig_number);
+extern int wait_for_thread_release(sem_t *sem);
+extern void register_thread_reset_hook(thread_label_t thread_id, thread_reset_hook_t reset_hook);
+extern void recover_faulted_thread(sig_num_t signal_number);
+extern bool request_thread_tuning_from_file(const char *config_path);
+#ifdef THRD_CYCLIC_EXECUTIVE
+extern void run_cyclic_frame(void);
+#endif
 
 /*** Variables Provided to other modules ***/
 
@@ -0,0 +1,512 @@
+/*****************************************************************************
+ * @file worker_pool.c
+ *****************************************************************************
+ * Project Name: Sonatus Automator Safety Interlock(ASI)
+ *
+ * @brief Low priority worker pool running the non real-time work of the
+ *        periodic threads (log and event file writes, log rotation).
+ *
+ * @details
+ * Each priority has a bounded lock-free multi-producer/multi-consumer queue
+ * (one sequence number per cell). Submitting copies the argument into a
+ * free cell, publishes it and posts the pool semaphore; a submitter never
+ * waits for a worker or a lock and a full queue drops the job.
+ *
+ * Workers run SCHED_OTHER and take the highest priority job first. A job
+ * with a coalescing key is skipped when a newer job with the same key was
+ * submitted before it started, so a burst of identical requests (e.g. a
+ * log flush) runs once.
+ *
+ * Per priority the pool counts submitted, run, coalesced and dropped jobs,
+ * the queue depth high water and the submission to start latency.
+ *
+ * @authors Tusar Palauri (TP)
+ * @date October 18, 2026
+ *
+ * Version History:
+ * ---------------
+ * Date       | Author | Description
+ * -----------|--------|-------------
+ * 10/18/2026 | TP     | Initial
+ * 10/18/2026 | TP     | Workers run on a WORKERPOOL_STACK_SIZE stack
+ * 10/18/2026 | TP     | Timed worker join on stop, no in-place fault recovery inside an enqueue
+ */
+
+/*** Include Files ***/
+#define _GNU_SOURCE /* pthread_clockjoin_np */
+#include "worker_pool.h"
+#include "storage_handler.h"
+
+/*** Module Definitions ***/
+#define WP_QUEUE_MASK                    (WORKERPOOL_QUEUE_DEPTH - 1U)
+#define WP_SEC_TO_NS                     (1000000000LL)
+#define WP_NSEC_TO_US                    (1000U)
+#define WP_NSEC_TO_MS                    (1000000LL)
+#define WP_STOP_TIMEOUT_MS               (1000U)    /* Stop request to all workers joined */
+
+_Static_assert((WORKERPOOL_QUEUE_DEPTH & WP_QUEUE_MASK) == 0U, "WORKERPOOL_QUEUE_DEPTH must be a power of two");
+
+/*** Internal Types ***/
+typedef struct {
+    uint32_t sequence;                   /* Cell state, see wp_s32Enqueue/wp_bDequeue */
+    worker_job_fn_t job;
+    uint32_t arg_size;
+    uint32_t coalesce_generation;
+    uint8_t coalesce_key;
+    struct timespec submitted;
+    uint8_t arg[WORKERPOOL_JOB_ARG_SIZE];
+} wp_cell_t;
+
+typedef struct {
+    uint32_t submitted;
+    uint32_t run;
+    uint32_t coalesced;
+    uint32_t dropped;
+    uint32_t depth_high_water;
+    uint64_t latency_total_us;
+    uint32_t latency_max_us;
+    uint32_t run_time_max_us;
+} wp_stats_t;
+
+typedef struct {
+    uint32_t enqueue_pos;
+    uint32_t dequeue_pos;
+    wp_cell_t cells[WORKERPOOL_QUEUE_DEPTH];
+    wp_stats_t stats;
+} wp_queue_t;
+
+/*** Local Function Prototypes ***/
+static generic_ptr_t wp_worker(generic_ptr_t arg);
+static int32_t wp_s32Enqueue(wp_queue_t *queue, worker_job_fn_t job, const void *arg, size_t arg_size, uint8_t coalesce_key);
+static bool wp_bDequeue(wp_queue_t *queue, wp_cell_t *out);
+static void wp_vRunJob(wp_queue_t *queue, const wp_cell_t *cell);
+static uint32_t wp_u32ElapsedUs(const struct timespec *start, const struct timespec *end);
+
+/*** External Variables ***/
+
+/*** Internal Variables ***/
+static wp_queue_t wp_queues[enTotalWorkerPrios];
+static uint32_t wp_coalesce_generation[WORKERPOOL_COALESCE_KEYS];
+static pthread_t wp_threads[WORKERPOOL_THREADS];
+static uint32_t wp_thread_count = 0U;
+static sem_t wp_sem;
+static volatile sig_atomic_t wp_running = 0;
+static volatile sig_atomic_t wp_stopping = 0;
+static __thread bool wp_log_deferred = false;
+static __thread volatile sig_atomic_t wp_claimed_cells = 0; /* Claimed, not yet published; a handler may nest */
+
+static const char *const wp_prio_names[enTotalWorkerPrios] = {"high", "normal", "low"};
+
+/*** Functions Provided to other modules ***/
+
+/**
+ * @brief Starts the worker threads.
+ *
+ * Workers are created SCHED_OTHER whatever the policy of the caller, and
+ * inherit its signal mask.
+ *
+ * @param pool_log_file Log file for start-up errors
+ *
+ * @return int32_t 0 on success, -1 if no worker could be started
+ */
+int32_t WORKERPOOL_s32Start(FILE *pool_log_file)
+{
+    pthread_attr_t attr;
+    struct sched_param param = {0};
+    uint32_t prio;
+    uint32_t i;
+
+    if (wp_running)
+    {
+        return 0;
+    }
+
+    for (prio = 0U; prio < (uint32_t)enTotalWorkerPrios; prio++)
+    {
+        (void)memset(&wp_queues[prio], 0, sizeof(wp_queues[prio]));
+        for (i = 0U; i < WORKERPOOL_QUEUE_DEPTH; i++)
+        {
+            wp_queues[prio].cells[i].sequence = i;
+        }
+    }
+    (void)memset(wp_coalesce_generation, 0, sizeof(wp_coalesce_generation));
+
+    if (sem_init(&wp_sem, 0, 0U) != 0)
+    {
+        log_message(pool_log_file, LOG_ERROR, "Worker pool: sem_init failed: %s", strerror(errno));
+        return -1;
+    }
+
+    if ((pthread_attr_init(&attr) != 0) ||
+        (pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED) != 0) ||
+        (pthread_attr_setschedpolicy(&attr, SCHED_OTHER) != 0) ||
+        (pthread_attr_setschedparam(&attr, &param) != 0) ||
+        (pthread_attr_setstacksize(&attr, WORKERPOOL_STACK_SIZE) != 0))
+    {
+        log_message(pool_log_file, LOG_ERROR, "Worker pool: failed to set up SCHED_OTHER thread attributes");
+        (void)sem_destroy(&wp_sem);
+        return -1;
+    }
+
+    wp_stopping = 0;
+    wp_thread_count = 0U;
+    for (i = 0U; i < WORKERPOOL_THREADS; i++)
+    {
+        int ret_val = pthread_create(&wp_threads[wp_thread_count], &attr, &wp_worker, NULL);
+        if (ret_val != 0)
+        {
+            log_message(pool_log_file, LOG_ERROR, "Worker pool: failed to create worker %u: %s", i, strerror(ret_val));
+            continue;
+        }
+        wp_thread_count++;
+    }
+    (void)pthread_attr_destroy(&attr);
+
+    if (wp_thread_count == 0U)
+    {
+        (void)sem_destroy(&wp_sem);
+        return -1;
+    }
+
+    wp_running = 1;
+    log_message(pool_log_file, LOG_INFO, "Worker pool started: %u SCHED_OTHER worker(s), %u jobs per priority",
+                wp_thread_count, WORKERPOOL_QUEUE_DEPTH);
+    return 0;
+}
+
+/**
+ * @brief Stops accepting jobs, lets the workers drain the queues and joins them.
+ *
+ * The workers are joined against a common deadline, WP_STOP_TIMEOUT_MS after
+ * the stop request. A worker still running then (e.g. blocked in a write) is
+ * left behind and logged; its remaining jobs are lost.
+ *
+ * @pre The periodic threads are joined, nothing submits any more
+ */
+void WORKERPOOL_vStop(void)
+{
+    struct timespec deadline;
+    long long deadline_ns;
+    uint32_t i;
+
+    if (!wp_running)
+    {
+        return;
+    }
+
+    wp_running = 0;
+    wp_stopping = 1;
+    for (i = 0U; i < wp_thread_count; i++)
+    {
+        (void)sem_post(&wp_sem);
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline_ns = ((long long)deadline.tv_sec * WP_SEC_TO_NS) + deadline.tv_nsec +
+                  ((long long)WP_STOP_TIMEOUT_MS * WP_NSEC_TO_MS);
+    deadline.tv_sec = (time_t)(deadline_ns / WP_SEC_TO_NS);
+    deadline.tv_nsec = (long)(deadline_ns % WP_SEC_TO_NS);
+    for (i = 0U; i < wp_thread_count; i++)
+    {
+        int join_result = pthread_clockjoin_np(wp_threads[i], NULL, CLOCK_MONOTONIC, &deadline);
+        if (join_result != 0)
+        {
+            log_message(global_log_file, LOG_ERROR, "Worker pool: worker %u left running: %s", i, strerror(join_result));
+        }
+    }
+    /* The semaphore is kept: a thread that missed the shutdown join may still post it */
+    wp_thread_count = 0U;
+}
+
+/**
+ * @brief Queues a job for the workers without blocking.
+ *
+ * @param job Function run on a worker
+ * @param arg Argument copied into the job, may be NULL when arg_size is 0
+ * @param arg_size Argument size, at most WORKERPOOL_JOB_ARG_SIZE
+ * @param prio Queue of the job
+ * @param coalesce_key WORKERPOOL_KEY_NONE, or a key whose older pending jobs
+ *                     are skipped once this one is queued
+ *
+ * @return int32_t WORKERPOOL_SUBMITTED, WORKERPOOL_NOT_RUNNING (the caller
+ *         does the work itself), WORKERPOOL_QUEUE_FULL or WORKERPOOL_INVALID
+ */
+int32_t WORKERPOOL_s32Submit(worker_job_fn_t job, const void *arg, size_t arg_size,
+                             worker_prio_t prio, uint8_t coalesce_key)
+{
+    int32_t result;
+
+    if ((job == NULL) || (arg_size > WORKERPOOL_JOB_ARG_SIZE) || ((arg == NULL) && (arg_size != 0U)) ||
+        ((uint32_t)prio >= (uint32_t)enTotalWorkerPrios) || (coalesce_key >= WORKERPOOL_COALESCE_KEYS))
+    {
+        return WORKERPOOL_INVALID;
+    }
+    if (!wp_running)
+    {
+        return WORKERPOOL_NOT_RUNNING;
+    }
+
+    result = wp_s32Enqueue(&wp_queues[prio], job, arg, arg_size, coalesce_key);
+    if (result == WORKERPOOL_SUBMITTED)
+    {
+        (void)sem_post(&wp_sem);
+    }
+    return result;
+}
+
+/**
+ * @brief Makes log_message() calls of the calling thread hand the write
+ *        to the worker pool. Set by the periodic threads.
+ *
+ * @param defer true to defer the writes of the calling thread
+ */
+void WORKERPOOL_vSetLogDeferral(bool defer)
+{
+    wp_log_deferred = defer;
+}
+
+/**
+ * @brief Tells whether log writes of the calling thread go through the pool.
+ *
+ * @return bool true when deferred and the pool runs
+ */
+bool WORKERPOOL_bLogDeferred(void)
+{
+    return wp_log_deferred && (wp_running != 0);
+}
+
+/**
+ * @brief Tells whether the calling thread is between claiming and publishing
+ *        a queue cell. Safe in a signal handler.
+ *
+ * A thread abandoned there by a siglongjmp would leave the cell claimed for
+ * good and stall its queue, so recover_faulted_thread() does not recover a
+ * fault raised in that window.
+ *
+ * @return bool true inside the window
+ */
+bool WORKERPOOL_bEnqueueInProgress(void)
+{
+    return wp_claimed_cells != 0;
+}
+
+/**
+ * @brief Logs the queue depth, job count and job latency metrics per priority.
+ *
+ * @param report_file Log file for the report
+ */
+void WORKERPOOL_vReport(FILE *report_file)
+{
+    uint32_t prio;
+
+    for (prio = 0U; prio < (uint32_t)enTotalWorkerPrios; prio++)
+    {
+        const wp_queue_t *queue = &wp_queues[prio];
+        uint32_t run = __atomic_load_n(&queue->stats.run, __ATOMIC_RELAXED);
+
+        log_message(report_file, LOG_INFO,
+                    "Worker queue [%s]: submitted %u, run %u, coalesced %u, dropped %u, depth %u, high water %u/%u, "
+                    "latency avg %llu us, max %u us, longest job %u us",
+                    wp_prio_names[prio], __atomic_load_n(&queue->stats.submitted, __ATOMIC_RELAXED), run,
+                    __atomic_load_n(&queue->stats.coalesced, __ATOMIC_RELAXED),
+                    __atomic_load_n(&queue->stats.dropped, __ATOMIC_RELAXED),
+                    __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED) - __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED),
+                    __atomic_load_n(&queue->stats.depth_high_water, __ATOMIC_RELAXED), WORKERPOOL_QUEUE_DEPTH,
+                    (run > 0U) ? (unsigned long long)(queue->stats.latency_total_us / run) : 0ULL,
+                    queue->stats.latency_max_us, queue->stats.run_time_max_us);
+    }
+}
+
+/*** Local Function Implementations ***/
+
+/**
+ * @brief Worker thread: runs the highest priority job available, exits once
+ *        the pool is stopping and every queue is empty.
+ */
+static generic_ptr_t wp_worker(generic_ptr_t arg)
+{
+    static __thread wp_cell_t cell; /* Too large for a comfortable stack frame */
+    uint32_t prio;
+    bool found;
+
+    (void)arg;
+
+    for (;;)
+    {
+        if ((sem_wait(&wp_sem) != 0) && (errno == EINTR))
+        {
+            continue;
+        }
+
+        found = false;
+        for (prio = 0U; (prio < (uint32_t)enTotalWorkerPrios) && !found; prio++)
+        {
+            if (wp_bDequeue(&wp_queues[prio], &cell))
+            {
+                wp_vRunJob(&wp_queues[prio], &cell);
+                found = true;
+            }
+        }
+
+        if (!found && wp_stopping)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Copies a job into the next free cell of a queue.
+ *
+ * A cell is free for position pos when its sequence equals pos; the
+ * producer that wins the CAS on enqueue_pos fills it and publishes it by
+ * setting the sequence to pos + 1. Claim to publish is counted in
+ * wp_claimed_cells, see WORKERPOOL_bEnqueueInProgress().
+ */
+static int32_t wp_s32Enqueue(wp_queue_t *queue, worker_job_fn_t job, const void *arg, size_t arg_size, uint8_t coalesce_key)
+{
+    uint32_t pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+    uint32_t depth;
+    uint32_t high_water;
+    wp_cell_t *cell;
+
+    for (;;)
+    {
+        cell = &queue->cells[pos & WP_QUEUE_MASK];
+        int32_t diff = (int32_t)(__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            /* Raised before the CAS so that no fault handler sees a claimed cell without it */
+            wp_claimed_cells++;
+            __atomic_signal_fence(__ATOMIC_SEQ_CST);
+            if (__atomic_compare_exchange_n(&queue->enqueue_pos, &pos, pos + 1U, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+            wp_claimed_cells--;
+        }
+        else if (diff < 0)
+        {
+            (void)__atomic_add_fetch(&queue->stats.dropped, 1U, __ATOMIC_RELAXED);
+            return WORKERPOOL_QUEUE_FULL;
+        }
+        else
+        {
+            pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->job = job;
+    cell->arg_size = (uint32_t)arg_size;
+    if (arg_size != 0U)
+    {
+        (void)memcpy(cell->arg, arg, arg_size);
+    }
+    cell->coalesce_key = coalesce_key;
+    cell->coalesce_generation = (coalesce_key != WORKERPOOL_KEY_NONE)
+                                    ? __atomic_add_fetch(&wp_coalesce_generation[coalesce_key], 1U, __ATOMIC_RELAXED)
+                                    : 0U;
+    (void)clock_gettime(CLOCK_MONOTONIC, &cell->submitted);
+    __atomic_store_n(&cell->sequence, pos + 1U, __ATOMIC_RELEASE);
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    wp_claimed_cells--;
+
+    (void)__atomic_add_fetch(&queue->stats.submitted, 1U, __ATOMIC_RELAXED);
+    depth = (pos + 1U) - __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+    high_water = __atomic_load_n(&queue->stats.depth_high_water, __ATOMIC_RELAXED);
+    while ((depth > high_water) &&
+           !__atomic_compare_exchange_n(&queue->stats.depth_high_water, &high_water, depth, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+    return WORKERPOOL_SUBMITTED;
+}
+
+/**
+ * @brief Copies the oldest published job out of a queue and frees its cell.
+ *
+ * A cell holds the job for position pos when its sequence equals pos + 1;
+ * it is freed for position pos + WORKERPOOL_QUEUE_DEPTH.
+ */
+static bool wp_bDequeue(wp_queue_t *queue, wp_cell_t *out)
+{
+    uint32_t pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+    wp_cell_t *cell;
+
+    for (;;)
+    {
+        cell = &queue->cells[pos & WP_QUEUE_MASK];
+        int32_t diff = (int32_t)(__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - (pos + 1U));
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&queue->dequeue_pos, &pos, pos + 1U, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    out->job = cell->job;
+    out->arg_size = cell->arg_size;
+    (void)memcpy(out->arg, cell->arg, cell->arg_size);
+    out->coalesce_key = cell->coalesce_key;
+    out->coalesce_generation = cell->coalesce_generation;
+    out->submitted = cell->submitted;
+    __atomic_store_n(&cell->sequence, pos + WORKERPOOL_QUEUE_DEPTH, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Runs a dequeued job unless a newer job with its coalescing key
+ *        exists, and accounts its latency and run time.
+ */
+static void wp_vRunJob(wp_queue_t *queue, const wp_cell_t *cell)
+{
+    struct timespec started;
+    struct timespec finished;
+    uint32_t latency_us;
+    uint32_t run_time_us;
+
+    if ((cell->coalesce_key != WORKERPOOL_KEY_NONE) &&
+        (__atomic_load_n(&wp_coalesce_generation[cell->coalesce_key], __ATOMIC_RELAXED) != cell->coalesce_generation))
+    {
+        (void)__atomic_add_fetch(&queue->stats.coalesced, 1U, __ATOMIC_RELAXED);
+        return;
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &started);
+    cell->job(cell->arg, cell->arg_size);
+    (void)clock_gettime(CLOCK_MONOTONIC, &finished);
+
+    latency_us = wp_u32ElapsedUs(&cell->submitted, &started);
+    run_time_us = wp_u32ElapsedUs(&started, &finished);
+    queue->stats.latency_total_us += latency_us;
+    if (latency_us > queue->stats.latency_max_us)
+    {
+        queue->stats.latency_max_us = latency_us;
+    }
+    if (run_time_us > queue->stats.run_time_max_us)
+    {
+        queue->stats.run_time_max_us = run_time_us;
+    }
+    (void)__atomic_add_fetch(&queue->stats.run, 1U, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Microseconds between two CLOCK_MONOTONIC times.
+ */
+static uint32_t wp_u32ElapsedUs(const struct timespec *start, const struct timespec *end)
+{
+    int64_t elapsed_ns = (((int64_t)end->tv_sec - start->tv_sec) * WP_SEC_TO_NS) + (end->tv_nsec - start->tv_nsec);
+
+    return (elapsed_ns > 0) ? (uint32_t)(elapsed_ns / WP_NSEC_TO_US) : 0U;
+}
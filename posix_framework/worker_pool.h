@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * @file worker_pool.h
+ *****************************************************************************
+ * Project Name: Sonatus Automator Safety Interlock(ASI)
+ *
+ * @brief Header file for the low priority worker pool that runs the non
+ *        real-time work of the periodic threads.
+ *
+ * @details
+ * Defines external interfaces for:
+ * - Starting and stopping the SCHED_OTHER worker threads of the child
+ * - Submitting jobs from any thread without blocking
+ * - Job priorities and coalescing keys
+ * - Queue depth and job latency report
+ *
+ * @authors Tusar Palauri (TP)
+ * @date October 18, 2026
+ *
+ * Version History:
+ * ---------------
+ * Date       | Author | Description
+ * -----------|--------|-------------
+ * 10/18/2026 | TP     | Initial
+ * 10/18/2026 | TP     | Worker stack size
+ * 10/18/2026 | TP     | WORKERPOOL_bEnqueueInProgress for the fault recovery
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+/*** Include Files ***/
+#include "gen_std_types.h"
+
+/*** Definitions Provided to other modules ***/
+#define WORKERPOOL_THREADS               (1U)       /* Workers; with one, jobs of a priority run in submission order */
+#define WORKERPOOL_QUEUE_DEPTH           (64U)      /* Jobs per priority queue, power of two */
+#define WORKERPOOL_JOB_ARG_SIZE          (1152U)    /* Argument bytes copied into a job, one formatted log line */
+#define WORKERPOOL_COALESCE_KEYS         (8U)       /* Coalescing keys 1..WORKERPOOL_COALESCE_KEYS - 1 */
+#define WORKERPOOL_STACK_SIZE            (64U * 1024U)  /* Worker stack instead of the default pthread stack */
+
+#define WORKERPOOL_KEY_NONE              (0U)       /* Job never coalesced */
+#define WORKERPOOL_KEY_LOG_FLUSH         (1U)       /* Flush of the buffered log streams */
+
+#define WORKERPOOL_SUBMITTED             (0)
+#define WORKERPOOL_NOT_RUNNING           (-1)       /* Pool stopped, caller does the work itself */
+#define WORKERPOOL_QUEUE_FULL            (-2)       /* Job dropped, counted in the report */
+#define WORKERPOOL_INVALID               (-3)
+
+/*** Type Definitions ***/
+typedef enum {
+    enWorkerPrioHigh = 0,
+    enWorkerPrioNormal,
+    enWorkerPrioLow,
+    enTotalWorkerPrios
+} worker_prio_t;
+
+/* Runs on a worker thread with a copy of the submitted argument */
+typedef void (*worker_job_fn_t)(const void *arg, size_t arg_size);
+
+/*** Functions Provided to other modules ***/
+extern int32_t WORKERPOOL_s32Start(FILE *pool_log_file);
+extern void WORKERPOOL_vStop(void);
+extern int32_t WORKERPOOL_s32Submit(worker_job_fn_t job, const void *arg, size_t arg_size,
+                                    worker_prio_t prio, uint8_t coalesce_key);
+extern void WORKERPOOL_vSetLogDeferral(bool defer);
+extern bool WORKERPOOL_bLogDeferred(void);
+extern bool WORKERPOOL_bEnqueueInProgress(void);
+extern void WORKERPOOL_vReport(FILE *report_file);
+
+/*** Variables Provided to other modules ***/
+
+#endif /* WORKER_POOL_H */
@@ -15,10 +15,16 @@
  * date      |IN |Description
  * ----------|---|-----------
  * 09/13/2024|TP |Initial Implementation
+ * 10/18/2026|TP |Socket waits and reconnect delay interrupted by a shutdown wake-up eventfd
+ * 10/18/2026|TP |THRD_SD reset hook: a connection attempt cut short by a fault is retried
+ * 10/18/2026|TP |Server addresses read from NETWORK_CONFIG_FILE
+ * 10/18/2026|TP |SD_vDropTCPConnection: a dropped connection no longer stops reconnects
  *
  */
 //*****************************************************************************
 
+#include <sys/eventfd.h>
+
 #include "system_diagnostics.h"
 #include "storage_handler.h"
 
@@ -29,9 +35,15 @@
  *
  * Specifies the location and name of the network configuration file.
  * This file is used to indicate the ip addresses and ports to which the
- * ASI connects.
+ * ASI connects: one "<VAM|CM> = <IPv4 address> <port>" line per server,
+ * '#' starts a comment. Servers left out keep VAM_IP_ADDR/CM_IP_ADDR and
+ * the default ports. Read by every child before it connects.
  *
  */
+#define NETWORK_CONFIG_FILE               "ASI_DATA/CONFIG/network.cfg"
+#define NETWORK_CONFIG_LINE_SIZE          ((uint32_t)128U)
+#define NETWORK_CONFIG_NAME_SIZE          ((uint32_t)8U)
+
 #define TEST_TIMEOUT_MS                   ((uint32_t)100U)
 #define MAX_LATENCY_MS                    ((uint32_t)500U)
 
@@ -41,6 +53,7 @@
 #define MAX_CONNECTED_CYCLES_BEFORE_CHECK ((uint8_t)25U)
 
 #define MS_TO_USEC                        ((uint32_t)1000U)
+#define MS_PER_SEC                        ((uint32_t)1000U)
 #define SEC_TO_MS                         ((float32_t)1000.0f)
 #define NSEC_TO_MS                        ((float32_t)1000000.0f)
 
@@ -49,6 +62,7 @@
 #define DEFAULT_VAM_PORT_NUMBER           ((uint16_t)8080U)
 #define DEFAULT_CM_PORT_NUMBER            ((uint16_t)9090U)
 #define INVALID_SOCKET                    ((sd_socket_t) - 1)
+#define SD_WAKE_EVENT                     ((uint64_t)1U)
 #define DEFAULT_CYCLE_COUNT               ((uint8_t)0U)
 
 #define STATE_MONITOR_INIT_VALUE          ((uint8_t)0U)
@@ -63,6 +77,8 @@ static int8_t sd_s8TCPConnectionTest(enTCPConnectionsASI enConnection);
 static void sd_EvaluateConnectionStatus(enTCPConnectionsASI enConnection, TCPConnectionState_t connectionState);
 static void sd_vEvaluateStateTransitions(StateMonitor_t *pstStateMonitor, states_t stASIState);
 static void sd_vEvaluateStateFaultMismatch(StateMonitor_t *pstStateMonitor, states_t stASIState);
+static int32_t sd_s32WaitForSocket(sd_socket_t sockfd, uint32_t u32TimeoutMs);
+static void sd_vLoadNetworkConfig(void);
 
 /*** External Variables ***/
 volatile sig_atomic_t sd_shutdown_initiated = 0;
@@ -71,6 +87,8 @@ volatile sig_atomic_t sd_shutdown_initiated = 0;
 static TCPConnectionConfig_t stTCPConnectionConfigs[enTotalTCPConnections] = {
     {VAM_IP_ADDR, DEFAULT_VAM_PORT_NUMBER, INVALID_SOCKET, CONNECTION_STATE_DISCONNECTED, CONNECTION_STATE_DISCONNECTED, DEFAULT_CYCLE_COUNT},
     {CM_IP_ADDR, DEFAULT_CM_PORT_NUMBER, INVALID_SOCKET, CONNECTION_STATE_DISCONNECTED, CONNECTION_STATE_DISCONNECTED, DEFAULT_CYCLE_COUNT}};
+static sd_socket_t sd_wake_fd = INVALID_SOCKET; /* eventfd written by SD_vWakeForShutdown() */
+static sd_char_t sd_server_ip[enTotalTCPConnections][INET_ADDRSTRLEN]; /* Addresses read from NETWORK_CONFIG_FILE */
 
 /*** External Functions ***/
 
@@ -113,10 +131,35 @@ void SD_vMainFunction(void)
     }
 }
 
+/**
+ * @brief Reset hook of THRD_SD, run after a faulted cycle
+ *
+ * @details A fault during a connection attempt leaves the connection in
+ *          CONNECTING, a state sd_ManageConnection() never leaves on its
+ *          own. Such a connection is set to ERROR, so the next cycle
+ *          connects again.
+ */
+void SD_vResetAfterFault(void)
+{
+    enTCPConnectionsASI enConnection;
+
+    for (enConnection = 0; enConnection < enTotalTCPConnections; enConnection++)
+    {
+        if (stTCPConnectionConfigs[enConnection].enState == CONNECTION_STATE_CONNECTING)
+        {
+            stTCPConnectionConfigs[enConnection].enState = CONNECTION_STATE_ERROR;
+            ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_ERROR);
+            log_message(global_log_file, LOG_WARNING, "THRD_SD: connection attempt to %s cut short by a faulted cycle, retried",
+                        (enConnection == enVAMConnectionTCP) ? "VAM" : "CM");
+        }
+    }
+}
+
 /**
  * @brief Initializes TCP connections for the System Diagnostics module
  *
  * @details
+ * - Reads the server addresses from NETWORK_CONFIG_FILE when present
  * - Iterates through all defined TCP connections (VAM and CM)
  * - Attempts to establish each connection using sd_InitClientConnection()
  * - Sets connection state based on the result of the connection attempt
@@ -131,6 +174,18 @@ void SD_vTCPConnectionsInit(void)
     uint8_t u8InitFlagStatus = INACTIVE_FLAG;
     log_message(global_log_file, LOG_INFO, "Initializing TCP Connections...");
 
+    if (sd_wake_fd == INVALID_SOCKET)
+    {
+        sd_wake_fd = (sd_socket_t)eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (sd_wake_fd == INVALID_SOCKET)
+        {
+            (void)log_message(global_log_file, LOG_WARNING,
+                              "Shutdown wake-up eventfd unavailable, socket waits run to their timeout: %s", strerror(errno));
+        }
+    }
+
+    sd_vLoadNetworkConfig();
+
     enTCPConnectionsASI enConnection;
     for (enConnection = 0; enConnection < enTotalTCPConnections; enConnection++)
     {
@@ -168,7 +223,23 @@ void SD_vTCPConnectionsInit(void)
 }
 
 /**
- * @brief Closes a specific TCP connection in the System Diagnostics module
+ * @brief Closes a specific TCP connection for shutdown
+ *
+ * @param enConnection The connection to be closed (enTCPConnectionsASI type)
+ *
+ * @details
+ * - Sets sd_shutdown_initiated so that THRD_SD does not reconnect
+ * - Closes the connection through SD_vDropTCPConnection()
+ *
+ */
+void SD_vCloseTCPConnection(enTCPConnectionsASI enConnection)
+{
+    sd_shutdown_initiated = 1;
+    SD_vDropTCPConnection(enConnection);
+}
+
+/**
+ * @brief Closes a specific TCP connection the peer dropped or that failed
  *
  * @param enConnection The connection to be closed (enTCPConnectionsASI type)
  *
@@ -179,13 +250,12 @@ void SD_vTCPConnectionsInit(void)
  * - Updates global connection state via ITCOM_vSetTCPConnectionState()
  * - Logs the closure or attempts to close an already closed connection
  *
- * @note Handles invalid connection indices and already closed connections
+ * @note Handles invalid connection indices and already closed connections.
+ *       The next SD_vMainFunction() cycle connects again.
  *
  */
-void SD_vCloseTCPConnection(enTCPConnectionsASI enConnection)
+void SD_vDropTCPConnection(enTCPConnectionsASI enConnection)
 {
-    sd_shutdown_initiated = 1;
-
     if ((enTCPConnectionsASI)enConnection < (enTCPConnectionsASI)enTotalTCPConnections)
     {
         log_message(global_log_file, LOG_INFO, "Initiating TCP Connection close down for : %s",
@@ -216,6 +286,28 @@ void SD_vCloseTCPConnection(enTCPConnectionsASI enConnection)
     }
 }
 
+/**
+ * @brief Aborts any connect, health check or reconnect delay in progress
+ *
+ * @details
+ * - Sets sd_shutdown_initiated so that no further connection attempt starts
+ * - Signals the wake-up eventfd watched by every socket wait of THRD_SD;
+ *   the eventfd is never drained, so later waits return at once as well
+ *
+ * @note Only async-signal-safe operations, may be called from a signal handler
+ *
+ */
+void SD_vWakeForShutdown(void)
+{
+    uint64_t u64Event = SD_WAKE_EVENT;
+
+    sd_shutdown_initiated = 1;
+    if (sd_wake_fd != INVALID_SOCKET)
+    {
+        (void)write(sd_wake_fd, &u64Event, sizeof(u64Event));
+    }
+}
+
 /**
  * @brief Retrieves the configuration of a specific TCP connection
  *
@@ -293,7 +385,7 @@ static void SD_vStateMonitorTest(StateMonitor_t *pstStateMonitor, states_t stASI
  * - Creates a new socket
  * - Sets the socket to non-blocking mode
  * - Attempts to connect to the specified server
- * - Uses select() to wait for connection with a timeout
+ * - Waits for the connection with a timeout, abandoned on a shutdown wake-up
  * - Checks for successful connection or errors
  *
  */
@@ -322,14 +414,7 @@ static sd_socket_t sd_InitClientConnection(const sd_char_t *s8ServerIP, uint16_t
 
             if ((connection_status < 0) && (errno == EINPROGRESS))
             {
-                fd_set write_fds;
-                struct timeval tv;
-                FD_ZERO(&write_fds);
-                FD_SET((uint32_t)sockfd, &write_fds);
-                tv.tv_sec = (time_t)CONNECTION_TIMEOUT_SEC;
-                tv.tv_usec = 0;
-
-                if (select(sockfd + 1, NULL, &write_fds, NULL, &tv) == 1)
+                if (sd_s32WaitForSocket(sockfd, CONNECTION_TIMEOUT_SEC * MS_PER_SEC) > 0)
                 {
                     sd_result_t socketErrorStatus = 0;
                     socklen_t len = sizeof(socketErrorStatus);
@@ -406,7 +491,7 @@ static int8_t sd_ManageConnection(enTCPConnectionsASI enConnection)
                 ITCOM_vSetTCPConnectionState(enConnection, CONNECTION_STATE_CONNECTING);
                 sd_EvaluateConnectionStatus(enConnection, CONNECTION_STATE_CONNECTING);
 
-                for (attempt = 1U; (attempt <= MAX_RECONNECT_ATTEMPTS) && (connected == 0U); attempt++)
+                for (attempt = 1U; (attempt <= MAX_RECONNECT_ATTEMPTS) && (connected == 0U) && (sd_shutdown_initiated == 0); attempt++)
                 {
                     sd_socket_t sockfd = sd_InitClientConnection(config->pchServerIp, config->u16Port);
 
@@ -425,7 +510,7 @@ static int8_t sd_ManageConnection(enTCPConnectionsASI enConnection)
                     {
                         log_message(global_log_file, LOG_WARNING,
                                     "Reconnect attempt %u for %s failed.", attempt, connectionName);
-                        (void)usleep(RECONNECT_DELAY_MS * MS_TO_USEC);
+                        (void)sd_s32WaitForSocket(INVALID_SOCKET, RECONNECT_DELAY_MS);
                     }
                 }
 
@@ -539,14 +624,9 @@ static int8_t sd_s8TCPConnectionTest(enTCPConnectionsASI enConnection)
 
         if (config->s16Socket >= 0)
         {
-            fd_set write_fds;
-            struct timeval timeout = {0, (suseconds_t)(TEST_TIMEOUT_MS * MS_TO_USEC)};
-            FD_ZERO(&write_fds);
-            FD_SET((uint32_t)config->s16Socket, &write_fds);
-
-            int32_t select_result = select(config->s16Socket + 1, NULL, &write_fds, NULL, &timeout);
+            int32_t select_result = sd_s32WaitForSocket(config->s16Socket, TEST_TIMEOUT_MS);
 
-            if ((select_result > 0) && (FD_ISSET((uint32_t)config->s16Socket, &write_fds) != 0))
+            if (select_result > 0)
             {
                 struct timespec start, end;
                 (void)clock_gettime(CLOCK_MONOTONIC, &start);
@@ -720,4 +800,106 @@ static void sd_vEvaluateStateFaultMismatch(StateMonitor_t *pstStateMonitor, stat
             log_message(global_log_file, LOG_DEBUG, "State-Fault Mismatch.");
         }
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief Waits until a socket is writable, the timeout expires or shutdown wakes THRD_SD
+ *
+ * @param sockfd Socket to wait for, INVALID_SOCKET for a plain interruptible delay
+ * @param u32TimeoutMs Timeout in milliseconds
+ *
+ * @return int32_t >0 socket writable, 0 timeout, -1 on error (errno ECANCELED on a shutdown wake-up)
+ *
+ */
+static int32_t sd_s32WaitForSocket(sd_socket_t sockfd, uint32_t u32TimeoutMs)
+{
+    fd_set read_fds;
+    fd_set write_fds;
+    struct timeval tv;
+    sd_socket_t maxfd = sockfd;
+    int32_t select_result;
+
+    FD_ZERO(&read_fds);
+    FD_ZERO(&write_fds);
+    if (sockfd != INVALID_SOCKET)
+    {
+        FD_SET((uint32_t)sockfd, &write_fds);
+    }
+    if (sd_wake_fd != INVALID_SOCKET)
+    {
+        FD_SET((uint32_t)sd_wake_fd, &read_fds);
+        maxfd = (sd_wake_fd > maxfd) ? sd_wake_fd : maxfd;
+    }
+    tv.tv_sec = (time_t)(u32TimeoutMs / MS_PER_SEC);
+    tv.tv_usec = (suseconds_t)((u32TimeoutMs % MS_PER_SEC) * MS_TO_USEC);
+
+    select_result = select(maxfd + 1, &read_fds, &write_fds, NULL, &tv);
+    if ((select_result > 0) && (sd_wake_fd != INVALID_SOCKET) && (FD_ISSET((uint32_t)sd_wake_fd, &read_fds) != 0))
+    {
+        errno = ECANCELED;
+        select_result = -1;
+    }
+
+    return select_result;
+}
+
+/**
+ * @brief Reads the server addresses and ports from NETWORK_CONFIG_FILE
+ *
+ * @details
+ * - A missing file keeps the compiled-in servers
+ * - A line that does not name VAM or CM with a valid IPv4 address and a
+ *   non-zero port is logged and skipped; that server keeps its address
+ *
+ */
+static void sd_vLoadNetworkConfig(void)
+{
+    sd_char_t line[NETWORK_CONFIG_LINE_SIZE];
+    sd_char_t name[NETWORK_CONFIG_NAME_SIZE];
+    sd_char_t address[INET_ADDRSTRLEN];
+    struct in_addr parsed_addr;
+    unsigned int port = 0U;
+    uint32_t line_number = 0U;
+    FILE *config_file = fopen(NETWORK_CONFIG_FILE, "r");
+
+    if (config_file == NULL)
+    {
+        log_message(global_log_file, LOG_INFO, "No %s, default VAM and CM servers", NETWORK_CONFIG_FILE);
+        return;
+    }
+
+    while (fgets(line, (int)sizeof(line), config_file) != NULL)
+    {
+        sd_char_t *comment = strchr(line, '#');
+        enTCPConnectionsASI enConnection = enTotalTCPConnections;
+        int fields;
+
+        line_number++;
+        if (comment != NULL)
+        {
+            *comment = '\0';
+        }
+        fields = sscanf(line, " %7[A-Z] = %15s %u", name, address, &port); /* 7, 15 = NETWORK_CONFIG_NAME_SIZE, INET_ADDRSTRLEN - 1 */
+        if (fields == EOF)
+        {
+            continue; /* Blank or comment line */
+        }
+        if (fields == 3)
+        {
+            enConnection = (strcmp(name, "VAM") == 0) ? enVAMConnectionTCP :
+                           ((strcmp(name, "CM") == 0) ? enCMConnectionTCP : enTotalTCPConnections);
+        }
+        if ((enConnection == enTotalTCPConnections) || (inet_pton(AF_INET, address, &parsed_addr) != 1) ||
+            (port == 0U) || (port > UINT16_MAX))
+        {
+            log_message(global_log_file, LOG_WARNING, "%s line %u ignored", NETWORK_CONFIG_FILE, line_number);
+            continue;
+        }
+
+        (void)memcpy(sd_server_ip[enConnection], address, sizeof(sd_server_ip[enConnection]));
+        stTCPConnectionConfigs[enConnection].pchServerIp = sd_server_ip[enConnection];
+        stTCPConnectionConfigs[enConnection].u16Port = (uint16_t)port;
+        log_message(global_log_file, LOG_INFO, "%s server %s:%u read from %s", name,
+                    sd_server_ip[enConnection], port, NETWORK_CONFIG_FILE);
+    }
+    (void)fclose(config_file);
+}
@@ -15,6 +15,9 @@
 * date      |IN |Description
 * ----------|---|-----------
 * 09/13/2024|TP |Initial Implementation
+* 10/18/2026|TP |SD_vWakeForShutdown
+* 10/18/2026|TP |SD_vResetAfterFault
+* 10/18/2026|TP |SD_vDropTCPConnection
 *
 */
 //*****************************************************************************
@@ -69,6 +72,9 @@ typedef struct {
 extern void SD_vTCPConnectionsInit(void);
 extern void SD_vMainFunction(void);
 extern void SD_vCloseTCPConnection(enTCPConnectionsASI enConnection);
+extern void SD_vDropTCPConnection(enTCPConnectionsASI enConnection);
+extern void SD_vWakeForShutdown(void);
+extern void SD_vResetAfterFault(void);
 extern const TCPConnectionConfig_t* SD_GetTCPConnectionConfig(enTCPConnectionsASI enConnection);
 
 /*** Variables Provided to other modules ***/
@@ -18,6 +18,7 @@
 * 08/09/2024|BL |Change interface and var naming
 * 08/13/2024|BL |SUD baseline 0.4
 * 10/04/2024|TP |Update for consistent safe state handling across child process restarts
+* 10/18/2026|TP |STM_vResyncState reset hook
 *
 */
 //*****************************************************************************
@@ -92,6 +93,26 @@ void STM_vInit(void)
     ITCOM_vSetInitFlagStatus(u8InitFlagStatus);
 }
 
+//*****************************************************************************
+// FUNCTION NAME : STM_vResyncState
+//*****************************************************************************
+/**
+*
+* @brief Reset hook of the STM thread, run after a faulted cycle
+*
+* Reloads the local state from shared memory, which holds the last state
+* the state machine published before the fault.
+*
+* @global{out; m_enState)
+*
+* @return none
+*/
+//*****************************************************************************
+void STM_vResyncState(void)
+{
+    m_enState = ITCOM_u8GetASIState();
+}
+
 //*****************************************************************************
 // FUNCTION NAME : STM_vMainTask
 //*****************************************************************************
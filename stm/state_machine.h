@@ -18,6 +18,7 @@
 * 06/05/2024|BL |Initial
 * 08/13/2024|BL |SUD baseline 0.4
 * 10/04/2024|TP |Update for consistent safe state handling across child process restarts
+* 10/18/2026|TP |STM_vResyncState reset hook
 *
 */
 //*****************************************************************************
@@ -46,6 +47,7 @@ typedef uint8_t states_t;
 /*** Functions Provided to other modules ***/
 void STM_vInit(void);
 void STM_vMainTask(void);
+void STM_vResyncState(void);
 
 
 /*** Variables Provided to other modules ***/
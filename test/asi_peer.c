@@ -0,0 +1,613 @@
+/**
+* @file asi_peer.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief VAM and CM stand-in for the host checks that run the application
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+* 10/18/2026|TP |Request mix shared by the soak and latency checks, process set up once
+*
+*/
+
+/*
+ * Listens on two loopback ports and names them in NETWORK_CONFIG_FILE, so
+ * the application started in the current directory connects to this
+ * process as its VAM and CM servers. What the servers would send is
+ * injected through ICM_RX_INJECTION_SOCKET (application built with make
+ * RX_INJECTION=1) instead of the TCP sockets: the CM vehicle status every
+ * PEER_STATUS_PERIOD_MS (park, speed 0), an ACK for every frame the
+ * application sends, and the action requests of the caller. The TCP
+ * sockets carry what the application sends; an action request forwarded
+ * to CM is an approval, and the time from its injection is its approval
+ * latency. Dropping a connection closes its TCP socket, as a server would.
+ */
+
+/*** Include Files ***/
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+
+#include "itcom.h"
+#include "crc.h"
+#include "storage_handler.h"
+#include "asi_peer.h"
+
+#ifndef ICM_RX_INJECTION
+#error "the peer sends through ICM_RX_INJECTION_SOCKET, build with ICM_RX_INJECTION"
+#endif
+
+/*** Module Definitions ***/
+#define PEER_CONFIG_FILE                 "ASI_DATA/CONFIG/network.cfg"
+#define PEER_LOOPBACK                    "127.0.0.1"
+#define PEER_LISTEN_BACKLOG              (4)
+#define PEER_PING_TEXT                   "PING"
+#define PEER_PING_SIZE                   (4U)
+#define PEER_TYPE_ACTION_REQUEST         (0xFF11U)
+#define PEER_TYPE_STATUS_CM              (0xFF22U)
+#define PEER_TYPE_ACK                    (0xFF33U)
+#define PEER_TYPE_NOTIFICATION           (0xFF44U)
+#define PEER_ID_PRNDL                    (0x03E8U)
+#define PEER_ID_VEHICLE_SPEED            (0x03E9U)
+#define PEER_LENGTH_ACK                  (1U)
+#define PEER_LENGTH_STATUS               (2U)
+#define PEER_LENGTH_REQUEST              (2U)
+#define PEER_PRNDL_PARK                  (0U)
+#define PEER_BYTE_MASK                   (0xFFU)
+#define PEER_BYTE_SHIFT                  (8U)
+#define PEER_CRC_BREAK                   (0xFFFFU)
+#define PEER_PERCENT                     (100U)
+#define PEER_MS_PER_S                    (1000L)
+#define PEER_US_PER_MS                   (1000L)
+#define PEER_NS_PER_US                   (1000L)
+#define PEER_NS_PER_MS                   (1000000L)
+
+typedef struct
+{
+    uint16_t u16Id;
+    uint16_t u16Value;
+} PeerMixRequest_t;
+
+static const char *const peer_names[enTotalTCPConnections] = {"VAM", "CM"};
+
+/* Action list entries with a value in range; the vehicle is parked, so the park preconditions hold */
+static const PeerMixRequest_t peer_mix[] = {
+    {0x0000U, 2U}, {0x0002U, 1U}, {0x0003U, 40U}, {0x0005U, 3U}, {0x0007U, 1U}, {0x0008U, 2U}, {0x0009U, 500U}
+};
+
+static bool peer_bProcessReady = false;
+
+static int64_t peer_s64ElapsedUs(const struct timespec *pstFrom, const struct timespec *pstTo)
+{
+    return ((int64_t)(pstTo->tv_sec - pstFrom->tv_sec) * PEER_MS_PER_S * PEER_US_PER_MS) +
+           ((int64_t)(pstTo->tv_nsec - pstFrom->tv_nsec) / PEER_NS_PER_US);
+}
+
+static void peer_vAddMs(struct timespec *pstTime, uint32_t u32Ms)
+{
+    pstTime->tv_sec += (time_t)(u32Ms / (uint32_t)PEER_MS_PER_S);
+    pstTime->tv_nsec += (long)(u32Ms % (uint32_t)PEER_MS_PER_S) * PEER_NS_PER_MS;
+    if (pstTime->tv_nsec >= (PEER_MS_PER_S * PEER_NS_PER_MS))
+    {
+        pstTime->tv_sec++;
+        pstTime->tv_nsec -= PEER_MS_PER_S * PEER_NS_PER_MS;
+    }
+}
+
+static int peer_s32Listen(uint16_t *pu16Port)
+{
+    struct sockaddr_in stAddr;
+    socklen_t szAddr = sizeof(stAddr);
+    int s32Reuse = 1;
+    int s32Socket = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    if (s32Socket < 0)
+    {
+        return -1;
+    }
+    (void)memset(&stAddr, 0, sizeof(stAddr));
+    stAddr.sin_family = AF_INET;
+    stAddr.sin_port = 0U; /* Any free port, written to the network configuration */
+    (void)inet_pton(AF_INET, PEER_LOOPBACK, &stAddr.sin_addr);
+    (void)setsockopt(s32Socket, SOL_SOCKET, SO_REUSEADDR, &s32Reuse, sizeof(s32Reuse));
+    if ((bind(s32Socket, (struct sockaddr *)&stAddr, sizeof(stAddr)) != 0) ||
+        (listen(s32Socket, PEER_LISTEN_BACKLOG) != 0) ||
+        (getsockname(s32Socket, (struct sockaddr *)&stAddr, &szAddr) != 0))
+    {
+        (void)close(s32Socket);
+        return -1;
+    }
+    *pu16Port = ntohs(stAddr.sin_port);
+
+    return s32Socket;
+}
+
+/* Sends the backlog in order until the injection socket is full */
+static void peer_vFlush(AsiPeer_t *pstPeer)
+{
+    struct sockaddr_un stAddr;
+
+    (void)memset(&stAddr, 0, sizeof(stAddr));
+    stAddr.sun_family = AF_UNIX;
+    (void)strncpy(stAddr.sun_path, ICM_RX_INJECTION_SOCKET, sizeof(stAddr.sun_path) - 1U);
+    while (pstPeer->u32BacklogCount > 0U)
+    {
+        const uint8_t *pu8Datagram = pstPeer->au8Backlog[pstPeer->u32BacklogHead];
+
+        if (sendto(pstPeer->s32Inject, pu8Datagram, PEER_DATAGRAM_SIZE, MSG_DONTWAIT,
+                   (struct sockaddr *)&stAddr, sizeof(stAddr)) < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                break; /* The application reads it on its next ICM_RX cycle */
+            }
+            pstPeer->stStats.u32InjectLost++; /* No child bound to the socket */
+        }
+        pstPeer->u32BacklogHead = (pstPeer->u32BacklogHead + 1U) % PEER_TX_BACKLOG;
+        pstPeer->u32BacklogCount--;
+    }
+}
+
+/* Builds a frame as the server would send it and queues it for injection on enConnection */
+static void peer_vInject(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection, uint16_t u16Type, uint16_t u16Length,
+                         uint16_t u16Id, uint16_t u16Sequence, uint16_t u16Value, uint8_t u8MessageEnum, bool bBadCrc)
+{
+    TLVMessage_t stFrame;
+    uint8_t *pu8Datagram;
+
+    if (pstPeer->u32BacklogCount >= PEER_TX_BACKLOG)
+    {
+        pstPeer->stStats.u32InjectLost++;
+        return;
+    }
+    (void)memset(&stFrame, 0, sizeof(stFrame));
+    stFrame.u16Type = u16Type;
+    stFrame.u16Length = u16Length;
+    stFrame.u16RollingCounter = ++pstPeer->au16RollingCounter[u8MessageEnum];
+    stFrame.u32TimeStamp = (uint32_t)time(NULL);
+    stFrame.u16SequenceNumber = u16Sequence;
+    stFrame.u16ID = u16Id;
+    stFrame.au8Value[ICM_MSG_BYTE_0] = (uint8_t)(u16Value & PEER_BYTE_MASK);
+    stFrame.au8Value[ICM_MSG_BYTE_1] = (uint8_t)(u16Value >> PEER_BYTE_SHIFT);
+    stFrame.u16CRC = CRC_u16CalculateCrc((uint8_t *)&stFrame.u16SequenceNumber,
+                                         sizeof(stFrame.u16SequenceNumber) + sizeof(stFrame.u16ID) + sizeof(stFrame.au8Value));
+    if (bBadCrc)
+    {
+        stFrame.u16CRC ^= PEER_CRC_BREAK;
+    }
+
+    pu8Datagram = pstPeer->au8Backlog[(pstPeer->u32BacklogHead + pstPeer->u32BacklogCount) % PEER_TX_BACKLOG];
+    pu8Datagram[0] = (uint8_t)enConnection;
+    (void)memcpy(&pu8Datagram[1], &stFrame, sizeof(stFrame));
+    pstPeer->u32BacklogCount++;
+    peer_vFlush(pstPeer);
+}
+
+static PeerRequest_t *peer_pstFindPending(AsiPeer_t *pstPeer, uint16_t u16Id, uint16_t u16Sequence)
+{
+    uint32_t u32Index;
+
+    for (u32Index = 0U; u32Index < PEER_MAX_PENDING; u32Index++)
+    {
+        PeerRequest_t *pstRequest = &pstPeer->astPending[u32Index];
+        if (pstRequest->bUsed && (pstRequest->u16Id == u16Id) && (pstRequest->u16Sequence == u16Sequence))
+        {
+            return pstRequest;
+        }
+    }
+    return NULL;
+}
+
+/* A frame sent by the application: ACKed, and an action request decision matched with its request */
+static void peer_vHandleFrame(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection, const TLVMessage_t *pstFrame)
+{
+    PeerRequest_t *pstRequest = peer_pstFindPending(pstPeer, pstFrame->u16ID, pstFrame->u16SequenceNumber);
+    struct timespec stNow;
+
+    if (pstFrame->u16Type == PEER_TYPE_ACK)
+    {
+        return;
+    }
+    peer_vInject(pstPeer, enConnection, PEER_TYPE_ACK, PEER_LENGTH_ACK, pstFrame->u16ID, pstFrame->u16SequenceNumber, 0U,
+                 (uint8_t)((enConnection == enVAMConnectionTCP) ? enAckVAM : enAckCM), false);
+    pstPeer->stStats.u32Acks++;
+
+    if (pstRequest == NULL)
+    {
+        return;
+    }
+    if ((enConnection == enCMConnectionTCP) && (pstFrame->u16Type == PEER_TYPE_ACTION_REQUEST))
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &stNow);
+        if (pstPeer->stStats.u32Samples < PEER_MAX_SAMPLES)
+        {
+            pstPeer->stStats.au32Latency_us[pstPeer->stStats.u32Samples++] =
+                (uint32_t)peer_s64ElapsedUs(&pstRequest->stSent, &stNow);
+        }
+        pstPeer->stStats.u32Approved++;
+        pstRequest->bUsed = false;
+    }
+    else if ((enConnection == enVAMConnectionTCP) && (pstFrame->u16Type == PEER_TYPE_NOTIFICATION) &&
+             (pstFrame->au8Value[ICM_MSG_BYTE_0] != (uint8_t)enApprovedRequest))
+    {
+        pstPeer->stStats.u32NotApproved++;
+        pstRequest->bUsed = false;
+    }
+    else
+    {
+        /* The approval notification follows the forwarded request */
+    }
+}
+
+/* Splits what the application sent into frames; SD health check packets are skipped */
+static void peer_vParse(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection)
+{
+    uint8_t *pu8Buffer = pstPeer->au8Rx[enConnection];
+    size_t szOffset = 0U;
+    size_t szLength = pstPeer->aszRx[enConnection];
+
+    while ((szLength - szOffset) >= PEER_PING_SIZE)
+    {
+        TLVMessage_t stFrame;
+        size_t szFrame;
+
+        if (memcmp(&pu8Buffer[szOffset], PEER_PING_TEXT, PEER_PING_SIZE) == 0)
+        {
+            szOffset += PEER_PING_SIZE;
+            continue;
+        }
+        if ((szLength - szOffset) < sizeof(stFrame))
+        {
+            break;
+        }
+        (void)memcpy(&stFrame, &pu8Buffer[szOffset], sizeof(stFrame));
+        szFrame = sizeof(stFrame) + (size_t)TLV_WIRE_VALUE_SIZE(stFrame.u16Length) - TLV_VALUE_SIZE;
+        if ((szLength - szOffset) < szFrame)
+        {
+            break;
+        }
+        peer_vHandleFrame(pstPeer, enConnection, &stFrame);
+        szOffset += szFrame;
+    }
+
+    (void)memmove(pu8Buffer, &pu8Buffer[szOffset], szLength - szOffset);
+    pstPeer->aszRx[enConnection] = szLength - szOffset;
+    if (pstPeer->aszRx[enConnection] == PEER_RX_BUFFER_SIZE)
+    {
+        pstPeer->aszRx[enConnection] = 0U; /* Out of frame, start over */
+    }
+}
+
+static void peer_vReceive(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection)
+{
+    ssize_t sReceived = recv(pstPeer->as32Conn[enConnection], &pstPeer->au8Rx[enConnection][pstPeer->aszRx[enConnection]],
+                             PEER_RX_BUFFER_SIZE - pstPeer->aszRx[enConnection], MSG_DONTWAIT);
+
+    if (sReceived > 0)
+    {
+        pstPeer->aszRx[enConnection] += (size_t)sReceived;
+        peer_vParse(pstPeer, enConnection);
+    }
+    else if ((sReceived == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)))
+    {
+        (void)close(pstPeer->as32Conn[enConnection]); /* Closed by the application */
+        pstPeer->as32Conn[enConnection] = -1;
+        pstPeer->aszRx[enConnection] = 0U;
+    }
+    else
+    {
+        /* Nothing more to read */
+    }
+}
+
+static void peer_vAccept(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection)
+{
+    int s32Conn = accept(pstPeer->as32Listen[enConnection], NULL, NULL);
+
+    if (s32Conn < 0)
+    {
+        return;
+    }
+    (void)fcntl(s32Conn, F_SETFL, O_NONBLOCK);
+    (void)fcntl(s32Conn, F_SETFD, FD_CLOEXEC);
+    if (pstPeer->as32Conn[enConnection] >= 0)
+    {
+        (void)close(pstPeer->as32Conn[enConnection]); /* Left by a child that is gone */
+    }
+    pstPeer->as32Conn[enConnection] = s32Conn;
+    pstPeer->aszRx[enConnection] = 0U;
+    pstPeer->stStats.u32Accepts++;
+}
+
+static void peer_vSendStatus(AsiPeer_t *pstPeer)
+{
+    /* Skipped while injected frames wait: a stalled child catches up on the newest status */
+    if (pstPeer->u32BacklogCount == 0U)
+    {
+        peer_vInject(pstPeer, enCMConnectionTCP, PEER_TYPE_STATUS_CM, PEER_LENGTH_STATUS, PEER_ID_PRNDL,
+                     pstPeer->u16Sequence, PEER_PRNDL_PARK, (uint8_t)enPRNDL, false);
+        peer_vInject(pstPeer, enCMConnectionTCP, PEER_TYPE_STATUS_CM, PEER_LENGTH_STATUS, PEER_ID_VEHICLE_SPEED,
+                     pstPeer->u16Sequence, 0U, (uint8_t)enVehicleSpeed, false);
+    }
+}
+
+static int peer_s32CompareU32(const void *pvLeft, const void *pvRight)
+{
+    uint32_t u32Left = *(const uint32_t *)pvLeft;
+    uint32_t u32Right = *(const uint32_t *)pvRight;
+
+    return (u32Left > u32Right) - (u32Left < u32Right);
+}
+
+/**
+ * @brief Opens the listening sockets and the injection socket and writes
+ *        NETWORK_CONFIG_FILE for an application started in the current
+ *        directory
+ *
+ * @return 0 on success, -1 with errno set otherwise
+ */
+int32_t PEER_s32Open(AsiPeer_t *pstPeer)
+{
+    uint16_t au16Port[enTotalTCPConnections] = {0U};
+    FILE *pstConfig;
+    uint8_t u8Connection;
+
+    (void)memset(pstPeer, 0, sizeof(*pstPeer));
+    if (!peer_bProcessReady)
+    {
+        FILE *pstNull = fopen("/dev/null", "w");
+
+        if (pstNull == NULL)
+        {
+            return -1;
+        }
+        /* Process-local shared memory for the CRC table and the message dictionary lookups */
+        global_log_file = pstNull;
+        ITCOM_vSharedMemoryInit(pstNull, enHardRestart);
+        CRC_vCreateTable();
+        peer_bProcessReady = true;
+    }
+    pstPeer->s32Inject = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    for (u8Connection = 0U; u8Connection < (uint8_t)enTotalTCPConnections; u8Connection++)
+    {
+        pstPeer->as32Conn[u8Connection] = -1;
+        pstPeer->as32Listen[u8Connection] = peer_s32Listen(&au16Port[u8Connection]);
+        if (pstPeer->as32Listen[u8Connection] < 0)
+        {
+            return -1;
+        }
+    }
+    if (pstPeer->s32Inject < 0)
+    {
+        return -1;
+    }
+
+    pstConfig = fopen(PEER_CONFIG_FILE, "w");
+    if (pstConfig == NULL)
+    {
+        return -1;
+    }
+    (void)fprintf(pstConfig, "# Written by the host check, servers of this process\n");
+    for (u8Connection = 0U; u8Connection < (uint8_t)enTotalTCPConnections; u8Connection++)
+    {
+        (void)fprintf(pstConfig, "%s = %s %u\n", peer_names[u8Connection], PEER_LOOPBACK, au16Port[u8Connection]);
+    }
+    if (fclose(pstConfig) != 0)
+    {
+        return -1;
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &pstPeer->stNextStatus);
+
+    return 0;
+}
+
+/**
+ * @brief Serves both connections for u32Duration_ms: accepts, ACKs and
+ *        matches what the application sends and keeps the CM vehicle
+ *        status going
+ */
+void PEER_vRun(AsiPeer_t *pstPeer, uint32_t u32Duration_ms)
+{
+    struct timespec stEnd;
+    struct timespec stNow;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stNow);
+    stEnd = stNow;
+    peer_vAddMs(&stEnd, u32Duration_ms);
+
+    while (peer_s64ElapsedUs(&stNow, &stEnd) > 0)
+    {
+        struct pollfd astPoll[2U * (uint32_t)enTotalTCPConnections];
+        int64_t s64Wait_us = peer_s64ElapsedUs(&stNow, &pstPeer->stNextStatus);
+        uint8_t u8Connection;
+
+        if (s64Wait_us <= 0)
+        {
+            peer_vSendStatus(pstPeer);
+            peer_vAddMs(&pstPeer->stNextStatus, PEER_STATUS_PERIOD_MS);
+            if (peer_s64ElapsedUs(&stNow, &pstPeer->stNextStatus) <= 0)
+            {
+                /* Behind by more than a period, e.g. after a stop: restart the cycle from now */
+                pstPeer->stNextStatus = stNow;
+                peer_vAddMs(&pstPeer->stNextStatus, PEER_STATUS_PERIOD_MS);
+            }
+            s64Wait_us = peer_s64ElapsedUs(&stNow, &pstPeer->stNextStatus);
+        }
+        if (peer_s64ElapsedUs(&stNow, &stEnd) < s64Wait_us)
+        {
+            s64Wait_us = peer_s64ElapsedUs(&stNow, &stEnd);
+        }
+
+        for (u8Connection = 0U; u8Connection < (uint8_t)enTotalTCPConnections; u8Connection++)
+        {
+            astPoll[u8Connection].fd = pstPeer->as32Listen[u8Connection];
+            astPoll[u8Connection].events = POLLIN;
+            astPoll[(uint32_t)enTotalTCPConnections + u8Connection].fd = pstPeer->as32Conn[u8Connection]; /* -1 is ignored */
+            astPoll[(uint32_t)enTotalTCPConnections + u8Connection].events = POLLIN;
+        }
+        /* A waiting backlog is retried every millisecond */
+        if ((poll(astPoll, 2U * (uint32_t)enTotalTCPConnections,
+                  (pstPeer->u32BacklogCount > 0U) ? 1 : (int)((s64Wait_us + PEER_US_PER_MS - 1) / PEER_US_PER_MS)) > 0))
+        {
+            for (u8Connection = 0U; u8Connection < (uint8_t)enTotalTCPConnections; u8Connection++)
+            {
+                if ((astPoll[u8Connection].revents & POLLIN) != 0)
+                {
+                    peer_vAccept(pstPeer, (enTCPConnectionsASI)u8Connection);
+                }
+                if ((astPoll[(uint32_t)enTotalTCPConnections + u8Connection].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+                {
+                    peer_vReceive(pstPeer, (enTCPConnectionsASI)u8Connection);
+                }
+            }
+        }
+        peer_vFlush(pstPeer);
+        (void)clock_gettime(CLOCK_MONOTONIC, &stNow);
+    }
+}
+
+/**
+ * @brief Injects an action request from VAM with a value of u16Value; one
+ *        with a broken CRC is not expected to be approved
+ */
+void PEER_vSendRequest(AsiPeer_t *pstPeer, uint16_t u16Id, uint16_t u16Value, bool bBadCrc)
+{
+    int16_t s16Enum = ITCOM_s16GetMessageEnumById(u16Id);
+    uint16_t u16Sequence = ++pstPeer->u16Sequence;
+
+    if (s16Enum < 0)
+    {
+        return;
+    }
+    if (bBadCrc)
+    {
+        pstPeer->stStats.u32BadCrc++;
+    }
+    else
+    {
+        PeerRequest_t *pstRequest = &pstPeer->astPending[pstPeer->u32NextPending];
+
+        if (pstRequest->bUsed)
+        {
+            pstPeer->stStats.u32Unanswered++; /* Never decided, the slot is taken over */
+        }
+        pstRequest->bUsed = true;
+        pstRequest->u16Id = u16Id;
+        pstRequest->u16Sequence = u16Sequence;
+        (void)clock_gettime(CLOCK_MONOTONIC, &pstRequest->stSent);
+        pstPeer->u32NextPending = (pstPeer->u32NextPending + 1U) % PEER_MAX_PENDING;
+        pstPeer->stStats.u32Requests++;
+    }
+    peer_vInject(pstPeer, enVAMConnectionTCP, PEER_TYPE_ACTION_REQUEST, PEER_LENGTH_REQUEST, u16Id, u16Sequence, u16Value,
+                 (uint8_t)s16Enum, bBadCrc);
+}
+
+/**
+ * @brief Injects the next action request of peer_mix
+ */
+void PEER_vSendMixRequest(AsiPeer_t *pstPeer, bool bBadCrc)
+{
+    const PeerMixRequest_t *pstMix = &peer_mix[pstPeer->u32NextMixRequest];
+
+    pstPeer->u32NextMixRequest = (pstPeer->u32NextMixRequest + 1U) % (uint32_t)(sizeof(peer_mix) / sizeof(peer_mix[0]));
+    PEER_vSendRequest(pstPeer, pstMix->u16Id, pstMix->u16Value, bBadCrc);
+}
+
+/**
+ * @brief Closes the peer side of a connection; the application is expected
+ *        to connect again
+ */
+void PEER_vDrop(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection)
+{
+    if (pstPeer->as32Conn[enConnection] >= 0)
+    {
+        (void)close(pstPeer->as32Conn[enConnection]);
+        pstPeer->as32Conn[enConnection] = -1;
+        pstPeer->aszRx[enConnection] = 0U;
+        pstPeer->stStats.u32Drops++;
+    }
+}
+
+/**
+ * @brief Approval latency in us below which u32Percentile percent of the
+ *        approvals so far fall, 0 without approvals
+ */
+uint32_t PEER_u32Latency_us(AsiPeer_t *pstPeer, uint32_t u32Percentile)
+{
+    uint32_t u32Index;
+
+    if (pstPeer->stStats.u32Samples == 0U)
+    {
+        return 0U;
+    }
+    qsort(pstPeer->stStats.au32Latency_us, pstPeer->stStats.u32Samples, sizeof(uint32_t), peer_s32CompareU32);
+    u32Index = ((pstPeer->stStats.u32Samples * u32Percentile) + (PEER_PERCENT - 1U)) / PEER_PERCENT;
+
+    return pstPeer->stStats.au32Latency_us[(u32Index > 0U) ? (u32Index - 1U) : 0U];
+}
+
+/**
+ * @brief Prints the request counts and the approval latency, prefixed with
+ *        pchLabel; requests still pending count as unanswered from here on
+ */
+void PEER_vReport(AsiPeer_t *pstPeer, const char *pchLabel)
+{
+    PeerStats_t *pstStats = &pstPeer->stStats;
+    uint32_t u32Index;
+
+    for (u32Index = 0U; u32Index < PEER_MAX_PENDING; u32Index++)
+    {
+        if (pstPeer->astPending[u32Index].bUsed)
+        {
+            pstPeer->astPending[u32Index].bUsed = false;
+            pstStats->u32Unanswered++;
+        }
+    }
+    (void)printf("%s: requests %u (approved %u, not approved %u, unanswered %u), bad CRC %u, drops %u, connections %u, ACKs %u, injections lost %u\n",
+                 pchLabel, pstStats->u32Requests, pstStats->u32Approved, pstStats->u32NotApproved, pstStats->u32Unanswered,
+                 pstStats->u32BadCrc, pstStats->u32Drops, pstStats->u32Accepts, pstStats->u32Acks, pstStats->u32InjectLost);
+    (void)printf("%s: request to approval p50 %.1f ms, p99 %.1f ms, max %.1f ms\n", pchLabel,
+                 (double)PEER_u32Latency_us(pstPeer, 50U) / (double)PEER_US_PER_MS,
+                 (double)PEER_u32Latency_us(pstPeer, 99U) / (double)PEER_US_PER_MS,
+                 (double)PEER_u32Latency_us(pstPeer, PEER_PERCENT) / (double)PEER_US_PER_MS);
+}
+
+/**
+ * @brief Closes every socket of the peer
+ */
+void PEER_vClose(AsiPeer_t *pstPeer)
+{
+    uint8_t u8Connection;
+
+    for (u8Connection = 0U; u8Connection < (uint8_t)enTotalTCPConnections; u8Connection++)
+    {
+        if (pstPeer->as32Conn[u8Connection] >= 0)
+        {
+            (void)close(pstPeer->as32Conn[u8Connection]);
+            pstPeer->as32Conn[u8Connection] = -1;
+        }
+        if (pstPeer->as32Listen[u8Connection] >= 0)
+        {
+            (void)close(pstPeer->as32Listen[u8Connection]);
+            pstPeer->as32Listen[u8Connection] = -1;
+        }
+    }
+    if (pstPeer->s32Inject >= 0)
+    {
+        (void)close(pstPeer->s32Inject);
+        pstPeer->s32Inject = -1;
+    }
+}
@@ -0,0 +1,93 @@
+/**
+* @file asi_peer.h
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief VAM and CM stand-in for the host checks that run the application
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+* 10/18/2026|TP |Request mix shared by the soak and latency checks
+*
+*/
+
+#ifndef ASI_PEER_H
+#define ASI_PEER_H
+
+/*** Include Files ***/
+#include <time.h>
+
+#include "gen_std_types.h"
+#include "icm.h"
+#include "system_diagnostics.h"
+
+/*** Definitions Provided to other modules ***/
+#define PEER_STATUS_PERIOD_MS            (50U)     /* CM vehicle status cycle, well inside MSG_TIMEOUT_MAX_VALUE */
+#define PEER_MAX_PENDING                 (64U)     /* Requests waiting for their decision */
+#define PEER_MAX_SAMPLES                 (16384U)  /* Approval latencies kept for the percentiles */
+#define PEER_TX_BACKLOG                  (32U)     /* Injected frames waiting for room on the injection socket */
+#define PEER_RX_BUFFER_SIZE              (4096U)   /* Unparsed bytes per TCP connection */
+#define PEER_DATAGRAM_SIZE               (1U + sizeof(TLVMessage_t))
+
+/*** Type Definitions ***/
+typedef struct
+{
+    bool bUsed;
+    uint16_t u16Id;
+    uint16_t u16Sequence;
+    struct timespec stSent;
+} PeerRequest_t;
+
+typedef struct
+{
+    uint32_t u32Requests;       /* Valid action requests injected */
+    uint32_t u32Approved;       /* Forwarded to CM */
+    uint32_t u32NotApproved;    /* Answered with any other action notification */
+    uint32_t u32Unanswered;     /* Pending at the end, or pushed out by newer requests */
+    uint32_t u32BadCrc;         /* Action requests injected with a broken CRC */
+    uint32_t u32Drops;          /* Connections dropped by the peer */
+    uint32_t u32Accepts;        /* Connections accepted from the application */
+    uint32_t u32Acks;           /* ACKs injected */
+    uint32_t u32InjectLost;     /* Frames the injection socket refused (no child listening) */
+    uint32_t u32Samples;        /* Entries of au32Latency_us */
+    uint32_t au32Latency_us[PEER_MAX_SAMPLES];
+} PeerStats_t;
+
+typedef struct
+{
+    int as32Listen[enTotalTCPConnections];
+    int as32Conn[enTotalTCPConnections];
+    int s32Inject;
+    uint8_t au8Rx[enTotalTCPConnections][PEER_RX_BUFFER_SIZE];
+    size_t aszRx[enTotalTCPConnections];
+    uint8_t au8Backlog[PEER_TX_BACKLOG][PEER_DATAGRAM_SIZE];
+    uint32_t u32BacklogHead;
+    uint32_t u32BacklogCount;
+    uint16_t au16RollingCounter[enTotalMessagesASI];
+    uint16_t u16Sequence;
+    struct timespec stNextStatus;
+    PeerRequest_t astPending[PEER_MAX_PENDING];
+    uint32_t u32NextPending;
+    uint32_t u32NextMixRequest;
+    PeerStats_t stStats;
+} AsiPeer_t;
+
+/*** Functions Provided to other modules ***/
+extern int32_t PEER_s32Open(AsiPeer_t *pstPeer);
+extern void PEER_vRun(AsiPeer_t *pstPeer, uint32_t u32Duration_ms);
+extern void PEER_vSendRequest(AsiPeer_t *pstPeer, uint16_t u16Id, uint16_t u16Value, bool bBadCrc);
+extern void PEER_vSendMixRequest(AsiPeer_t *pstPeer, bool bBadCrc);
+extern void PEER_vDrop(AsiPeer_t *pstPeer, enTCPConnectionsASI enConnection);
+extern uint32_t PEER_u32Latency_us(AsiPeer_t *pstPeer, uint32_t u32Percentile);
+extern void PEER_vReport(AsiPeer_t *pstPeer, const char *pchLabel);
+extern void PEER_vClose(AsiPeer_t *pstPeer);
+
+#endif /* ASI_PEER_H */
@@ -0,0 +1,616 @@
+/**
+* @file icm_rx_check.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief receive path benchmark and fuzz check on the RX injection entry (make rx-check)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, moved out of icm.c (ICM_RX_CHECK_MAIN)
+*
+*/
+
+/*
+ * Benchmark: RX_CHECK_BENCH_FRAMES frames of each kind (valid action request,
+ * bad CRC, unknown type, rolling counter out of sequence, unknown ID,
+ * repeated request) are injected and the per class cost table is printed.
+ * Bookkeeping: the ITCOM updates of one accepted action request are made
+ * with the single-update calls (one lock each, the receive path before the
+ * transaction API) and as one transaction; lock operations and time per
+ * frame are printed for both. The target builds with ITCOM_LOCK_PROFILING so
+ * the lock operation counts are real.
+ * Overload: action requests are offered at 1x, 2x and 5x the rate ARA
+ * approves them (one per ITCOM_RETRY_AFTER_PER_REQUEST_MS cycle) for
+ * RX_CHECK_OVERLOAD_CYCLES cycles; goodput, busy replies and silent losses
+ * are printed for each load.
+ * Copies: the copies of message data ITCOM_NOTE_MSG_COPY counts while one
+ * action request goes from the RX ring to ARA, and while its approval goes
+ * from ARA to ICM_TX, are printed with their size.
+ * Payload: valid action requests with 8, 64 and 256 byte values (the
+ * latter two held in the payload pool) are injected and drained; the time
+ * per frame and the value bytes per second are printed for each size.
+ * Fuzz: RX_CHECK_FUZZ_FRAMES frames (or argv[1]) mutated from a valid action
+ * request with a fixed seed: random bytes, bit flips with and without a
+ * matching CRC, truncated frames and long values with random tails. Every
+ * frame must be classified exactly once and every pool block must be free
+ * again once the queues are drained.
+ * Simulated time moves RX_CHECK_STEP_MS per frame so the rate limits and the
+ * recent request cache see a realistic rate; the costs are real time.
+ */
+
+/*** Include Files ***/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "itcom.h"
+#include "crc.h"
+#include "storage_handler.h"
+#include "lock_profiler.h"
+#include "util_time.h"
+#include "icm.h"
+
+#ifndef ICM_RX_INJECTION
+#error "rx-check drives the receive path through ICM_vInjectReceivedFrame, build with ICM_RX_INJECTION"
+#endif
+
+/*** Module Definitions ***/
+#define RX_CHECK_BENCH_FRAMES                (10000U)
+#define RX_CHECK_FUZZ_FRAMES                 (200000U)
+#define RX_CHECK_STEP_MS                     (10U)
+#define RX_CHECK_SEED                        (0x2545F491U)
+#define RX_CHECK_OVERLOAD_CYCLES             (400U)
+#define RX_CHECK_REQUEST_ID                  (0x0000U)
+#define RX_CHECK_REQUEST_LENGTH              (2U)
+#define RX_CHECK_UNKNOWN                     (0x7E7EU)
+#define RX_CHECK_BUFFER_SIZE                 (sizeof(TLVMessage_t) + TLV_MAX_VALUE_SIZE)
+
+typedef enum
+{
+    enRxCheckValid = 0,
+    enRxCheckCrc,
+    enRxCheckType,
+    enRxCheckSequence,
+    enRxCheckUnknownId,
+    enRxCheckRepeat,
+    enTotalRxCheckKinds
+} RxCheckKind_t;
+
+static uint32_t icm_u32CheckRandom = RX_CHECK_SEED;
+static uint16_t icm_u16CheckRollingCounter = ICM_INIT_VAL_U16;
+
+/* xorshift32, the run is the same for every build */
+static uint32_t icm_u32CheckNextRandom(void)
+{
+    icm_u32CheckRandom ^= icm_u32CheckRandom << 13;
+    icm_u32CheckRandom ^= icm_u32CheckRandom >> 17;
+    icm_u32CheckRandom ^= icm_u32CheckRandom << 5;
+    return icm_u32CheckRandom;
+}
+
+static void icm_vCheckSealCrc(TLVMessage_t *pstFrame, const uint8_t *pu8Tail, uint16_t u16TailLength)
+{
+    pstFrame->u16CRC = CRC_u16CalculateCrc((uint8_t *)&pstFrame->u16SequenceNumber,
+                                           sizeof(pstFrame->u16SequenceNumber) + sizeof(pstFrame->u16ID) + sizeof(pstFrame->au8Value));
+    if (u16TailLength > 0U)
+    {
+        pstFrame->u16CRC = CRC_u16UpdateCrc(pstFrame->u16CRC, pu8Tail, u16TailLength);
+    }
+}
+
+static void icm_vCheckBuildRequest(TLVMessage_t *pstFrame, uint16_t u16Sequence)
+{
+    MessageTypeDictionary_t stActionReqDict = MESSAGE_TYPE_DICTIONARY_INIT;
+
+    ITCOM_vGetMsgTypeDictionaryEntryAtIndex(&stActionReqDict, enActionRequest);
+    (void)memset(pstFrame, 0, sizeof(*pstFrame));
+    pstFrame->u16Type = stActionReqDict.u16MessageTypeID;
+    pstFrame->u16Length = RX_CHECK_REQUEST_LENGTH;
+    pstFrame->u16ID = RX_CHECK_REQUEST_ID;
+    pstFrame->u16SequenceNumber = u16Sequence;
+    pstFrame->u16RollingCounter = ++icm_u16CheckRollingCounter;
+    pstFrame->au8Value[ICM_MSG_BYTE_0] = 1U;
+    icm_vCheckSealCrc(pstFrame, NULL, 0U);
+}
+
+/* What the ARA and ICM_TX threads would do with the queued messages: every request is approved */
+static void icm_vCheckDrainQueues(void)
+{
+    stProcessMsgData stMsg;
+    uint8_t u8Class;
+
+    while (ITCOM_s8DequeueActionReq(&stMsg, DATA_INTEGRITY_QUEUE) == QUEUE_ACTION_SUCCESS)
+    {
+        (void)ITCOM_s8LogNotificationMessage(stMsg.stMsgPairData.u16MsgId, stMsg.stMsgPairData.u16SequenceNum,
+                                             (uint8_t)enApprovedRequest, (uint8_t)enActionNotification);
+        ITCOM_vReleaseMsgPayload(&stMsg);
+    }
+    while (ITCOM_s8DequeueTxMessage(&stMsg, ICM_INIT_VAL_U8, &u8Class) == QUEUE_ACTION_SUCCESS)
+    {
+        ITCOM_vReleaseMsgPayload(&stMsg);
+    }
+}
+
+static uint32_t icm_u32CheckFramesClassified(void)
+{
+    RxFrameCost_t astCost[enTotalRxFrameClasses];
+    uint32_t u32Frames = ICM_INIT_VAL_U8;
+    uint8_t u8Class;
+
+    ICM_vGetRxFrameCost(astCost, NULL);
+    for (u8Class = ICM_INIT_VAL_U8; u8Class < (uint8_t)enTotalRxFrameClasses; u8Class++)
+    {
+        u32Frames += astCost[u8Class].u32FrameCount;
+    }
+    return u32Frames;
+}
+
+static double icm_dCheckElapsed_ns(const struct timespec *pstStart)
+{
+    struct timespec stNow;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stNow);
+    return ((double)(stNow.tv_sec - pstStart->tv_sec) * 1e9) + (double)(stNow.tv_nsec - pstStart->tv_nsec);
+}
+
+static void icm_vCheckBenchmark(void)
+{
+    static const char *const apcKindName[enTotalRxCheckKinds] = {
+        "valid", "bad crc", "unknown type", "sequence", "unknown id", "repeat"
+    };
+    TLVMessage_t stFrame;
+    struct timespec stStart;
+    uint16_t u16Sequence = ICM_INIT_VAL_U16;
+    uint32_t u32Frame;
+    uint8_t u8Kind;
+
+    for (u8Kind = ICM_INIT_VAL_U8; u8Kind < (uint8_t)enTotalRxCheckKinds; u8Kind++)
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+        for (u32Frame = ICM_INIT_VAL_U8; u32Frame < RX_CHECK_BENCH_FRAMES; u32Frame++)
+        {
+            icm_vCheckBuildRequest(&stFrame, ++u16Sequence);
+            switch ((RxCheckKind_t)u8Kind)
+            {
+            case enRxCheckCrc:
+                stFrame.u16CRC ^= 0xFFFFU;
+                break;
+            case enRxCheckType:
+                stFrame.u16Type = RX_CHECK_UNKNOWN;
+                break;
+            case enRxCheckSequence:
+                icm_u16CheckRollingCounter--;
+                stFrame.u16RollingCounter = icm_u16CheckRollingCounter;
+                break;
+            case enRxCheckUnknownId:
+                stFrame.u16ID = RX_CHECK_UNKNOWN;
+                icm_vCheckSealCrc(&stFrame, NULL, 0U);
+                break;
+            case enRxCheckRepeat:
+                ICM_vInjectReceivedFrame((const uint8_t *)&stFrame, sizeof(stFrame), (uint8_t)enVAMConnectionTCP);
+                icm_vCheckDrainQueues();
+                stFrame.u16RollingCounter = ++icm_u16CheckRollingCounter;
+                icm_vCheckSealCrc(&stFrame, NULL, 0U);
+                break;
+            default:
+                break;
+            }
+            ICM_vInjectReceivedFrame((const uint8_t *)&stFrame, sizeof(stFrame), (uint8_t)enVAMConnectionTCP);
+            icm_vCheckDrainQueues();
+            UT_vSimAdvanceTime_ms(RX_CHECK_STEP_MS);
+        }
+        (void)printf("%-12s %u frames, %.0f ns per frame including the queue drain\n", apcKindName[u8Kind],
+                     RX_CHECK_BENCH_FRAMES, icm_dCheckElapsed_ns(&stStart) / (double)RX_CHECK_BENCH_FRAMES);
+    }
+}
+
+/* The ITCOM updates icm_vHandleReceivedFrame makes for an accepted action request */
+static void icm_vCheckBookkeeping(void)
+{
+    static const char *const apcPathName[2] = {"single calls", "transaction"};
+    TLVMessage_t stFrame;
+    stMsgIntegrityData stTracker = MSG_INTEGRITY_DATA_INIT;
+    stProcessMsgData stMsg = {ICM_INIT_VAL_U16};
+    ItcomTransaction_t stTxn;
+    struct timespec stStart;
+    double dElapsed_ns;
+    uint64_t u64LockOps;
+    uint16_t u16Sequence = 0x8000U;
+    uint32_t u32Frame;
+    uint8_t u8Path;
+    int16_t s16Indx;
+
+    icm_vCheckBuildRequest(&stFrame, u16Sequence);
+    s16Indx = ITCOM_s16GetMessageEnumFromTypeAndId(stFrame.u16Type, stFrame.u16ID, enVAMConnectionTCP);
+    stTracker.stMsgPairData.u16MsgId = stFrame.u16ID;
+    stTracker.u16Type = stFrame.u16Type;
+    stMsg.stMsgPairData.u16MsgId = stFrame.u16ID;
+    stMsg.u16Type = stFrame.u16Type;
+    stMsg.u16Length = stFrame.u16Length;
+    stMsg.u16PayloadHandle = ITCOM_POOL_HANDLE_NONE;
+
+    for (u8Path = ICM_INIT_VAL_U8; u8Path < 2U; u8Path++)
+    {
+        dElapsed_ns = 0.0;
+        u64LockOps = 0U;
+        for (u32Frame = ICM_INIT_VAL_U8; u32Frame < RX_CHECK_BENCH_FRAMES; u32Frame++)
+        {
+            uint64_t u64Ops = LOCK_PROFILER_THREAD_LOCK_OPS();
+
+            stTracker.stMsgPairData.u16SequenceNum = ++u16Sequence;
+            stMsg.stMsgPairData.u16SequenceNum = u16Sequence;
+            (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+            if (u8Path == 0U)
+            {
+                ITCOM_vSetActionRequestStartTime(stFrame.u16ID, u16Sequence);
+                ITCOM_vSetMsgCycleCount(&stTracker, REMOVE_ELEMENT);
+                ITCOM_vRecordRC((uint8_t)s16Indx, ++icm_u16CheckRollingCounter, ROLLING_COUNT_RX);
+                if (ITCOM_u8GetRollingCountError((uint8_t)s16Indx) < ROLLINC_COUNTER_ERROR_LIMIT)
+                {
+                    (void)ITCOM_s8SaveMsgData(&stMsg, s16Indx);
+                }
+            }
+            else
+            {
+                int8_t s8SaveOp = ITCOM_TXN_FULL;
+
+                ITCOM_vTxnBegin(&stTxn);
+                (void)ITCOM_s8TxnSetActionRequestStartTime(&stTxn, stFrame.u16ID, u16Sequence);
+                (void)ITCOM_s8TxnSetMsgCycleCount(&stTxn, &stTracker, REMOVE_ELEMENT);
+                (void)ITCOM_s8TxnRecordRC(&stTxn, (uint8_t)s16Indx, ++icm_u16CheckRollingCounter, ROLLING_COUNT_RX);
+                if (ITCOM_u8GetRollingCountError((uint8_t)s16Indx) < ROLLINC_COUNTER_ERROR_LIMIT)
+                {
+                    s8SaveOp = ITCOM_s8TxnSaveMsgData(&stTxn, &stMsg, s16Indx, (uint8_t)enVAMConnectionTCP);
+                }
+                (void)ITCOM_s8TxnCommit(&stTxn);
+                (void)ITCOM_s8TxnGetResult(&stTxn, s8SaveOp);
+            }
+            dElapsed_ns += icm_dCheckElapsed_ns(&stStart);
+            u64LockOps += LOCK_PROFILER_THREAD_LOCK_OPS() - u64Ops;
+            icm_vCheckDrainQueues();
+            UT_vSimAdvanceTime_ms(RX_CHECK_STEP_MS);
+        }
+        (void)printf("bookkeeping, %-12s %u frames, %.2f lock ops and %.0f ns per frame\n", apcPathName[u8Path],
+                     RX_CHECK_BENCH_FRAMES, (double)u64LockOps / (double)RX_CHECK_BENCH_FRAMES,
+                     dElapsed_ns / (double)RX_CHECK_BENCH_FRAMES);
+    }
+}
+
+/* ICM_TX side of the overload run: tallies the action notifications by code */
+static void icm_vCheckDrainTx(uint32_t *pu32Codes)
+{
+    stProcessMsgData stMsg;
+    uint8_t u8Class;
+
+    while (ITCOM_s8DequeueTxMessage(&stMsg, ICM_INIT_VAL_U8, &u8Class) == QUEUE_ACTION_SUCCESS)
+    {
+        if ((u8Class == (uint8_t)enTxClassNotification) &&
+            (stMsg.au8MsgData[ITCOM_NOTIFY_BYTE_CODE] < (uint8_t)enTotalNotificationActions))
+        {
+            pu32Codes[stMsg.au8MsgData[ITCOM_NOTIFY_BYTE_CODE]]++;
+        }
+        ITCOM_vReleaseMsgPayload(&stMsg);
+    }
+}
+
+/* Peers sending faster than ARA approves; ARA modelled as one dequeue per cycle. False on a silent loss */
+static bool icm_bCheckOverload(void)
+{
+    static const uint8_t au8Factor[] = {1U, 2U, 5U};
+    TLVMessage_t stFrame;
+    stProcessMsgData stMsg;
+    uint32_t au32Codes[enTotalNotificationActions];
+    uint16_t u16Sequence = ICM_INIT_VAL_U16;
+    uint32_t u32Offered;
+    uint32_t u32Approved;
+    uint32_t u32Backlog;
+    uint32_t u32Cycle;
+    uint32_t u32Lost;
+    uint8_t u8PeakOccupancy;
+    bool bResult = true;
+    uint8_t u8Load;
+    uint8_t u8Frame;
+
+    for (u8Load = ICM_INIT_VAL_U8; u8Load < (uint8_t)(sizeof(au8Factor) / sizeof(au8Factor[0])); u8Load++)
+    {
+        (void)memset(au32Codes, 0, sizeof(au32Codes));
+        u32Offered = ICM_INIT_VAL_U8;
+        u32Approved = ICM_INIT_VAL_U8;
+        u32Backlog = ICM_INIT_VAL_U8;
+        u8PeakOccupancy = ICM_INIT_VAL_U8;
+        for (u32Cycle = ICM_INIT_VAL_U8; u32Cycle < RX_CHECK_OVERLOAD_CYCLES; u32Cycle++)
+        {
+            for (u8Frame = ICM_INIT_VAL_U8; u8Frame < au8Factor[u8Load]; u8Frame++)
+            {
+                icm_vCheckBuildRequest(&stFrame, ++u16Sequence);
+                ICM_vInjectReceivedFrame((const uint8_t *)&stFrame, sizeof(stFrame), (uint8_t)enVAMConnectionTCP);
+                u32Offered++;
+                UT_vSimAdvanceTime_ms(ITCOM_RETRY_AFTER_PER_REQUEST_MS / au8Factor[u8Load]);
+            }
+            if (ITCOM_u8GetActionReqOccupancy() > u8PeakOccupancy)
+            {
+                u8PeakOccupancy = ITCOM_u8GetActionReqOccupancy();
+            }
+            if (ITCOM_s8DequeueActionReq(&stMsg, DATA_INTEGRITY_QUEUE) == QUEUE_ACTION_SUCCESS)
+            {
+                (void)ITCOM_s8LogNotificationMessage(stMsg.stMsgPairData.u16MsgId, stMsg.stMsgPairData.u16SequenceNum,
+                                                     (uint8_t)enApprovedRequest, (uint8_t)enActionNotification);
+                ITCOM_vReleaseMsgPayload(&stMsg);
+                u32Approved++;
+            }
+            icm_vCheckDrainTx(au32Codes);
+        }
+        /* Still queued at the end of the run: approved later, not lost */
+        while (ITCOM_s8DequeueActionReq(&stMsg, DATA_INTEGRITY_QUEUE) == QUEUE_ACTION_SUCCESS)
+        {
+            (void)ITCOM_s8LogNotificationMessage(stMsg.stMsgPairData.u16MsgId, stMsg.stMsgPairData.u16SequenceNum,
+                                                 (uint8_t)enApprovedRequest, (uint8_t)enActionNotification);
+            ITCOM_vReleaseMsgPayload(&stMsg);
+            u32Backlog++;
+        }
+        icm_vCheckDrainTx(au32Codes);
+        u32Lost = u32Offered - u32Approved - u32Backlog - au32Codes[enBusyRetryLater] - au32Codes[enRateLimiterDrop];
+        (void)printf("overload %ux: %u offered, goodput %u approvals in %u cycles (%u queued at the end), %u busy replies, "
+                     "%u rate limited, %u silent losses, peak occupancy %u\n",
+                     au8Factor[u8Load], u32Offered, u32Approved, RX_CHECK_OVERLOAD_CYCLES, u32Backlog,
+                     au32Codes[enBusyRetryLater], au32Codes[enRateLimiterDrop], u32Lost, u8PeakOccupancy);
+        if (u32Lost != 0U)
+        {
+            bResult = false;
+        }
+        UT_vSimAdvanceTime_ms(ITCOM_RECENT_REQ_AGE_MS);
+    }
+    return bResult;
+}
+
+/* Value bytes per second through the receive path for short and long values. False if a frame was not accepted */
+static bool icm_bCheckPayloadThroughput(void)
+{
+    static const uint16_t au16Length[] = {TLV_VALUE_SIZE, 64U, 256U};
+    uint8_t au8Buffer[RX_CHECK_BUFFER_SIZE];
+    RxFrameCost_t astCost[enTotalRxFrameClasses];
+    TLVMessage_t stFrame;
+    struct timespec stStart;
+    double dElapsed_ns;
+    uint8_t *pu8Tail = &au8Buffer[sizeof(TLVMessage_t)];
+    uint32_t u32Valid;
+    uint32_t u32Frame;
+    uint32_t u32Index;
+    uint16_t u16Sequence = ICM_INIT_VAL_U16;
+    uint16_t u16Tail;
+    uint8_t u8Size;
+    bool bResult = true;
+
+    for (u8Size = ICM_INIT_VAL_U8; u8Size < (uint8_t)(sizeof(au16Length) / sizeof(au16Length[0])); u8Size++)
+    {
+        if (au16Length[u8Size] > TLV_MAX_VALUE_SIZE)
+        {
+            continue;
+        }
+        u16Tail = (uint16_t)(au16Length[u8Size] - TLV_VALUE_SIZE);
+        ICM_vGetRxFrameCost(astCost, NULL);
+        u32Valid = astCost[enRxFrameValid].u32FrameCount;
+        dElapsed_ns = 0.0;
+        for (u32Frame = ICM_INIT_VAL_U8; u32Frame < RX_CHECK_BENCH_FRAMES; u32Frame++)
+        {
+            icm_vCheckBuildRequest(&stFrame, ++u16Sequence);
+            stFrame.u16Length = au16Length[u8Size];
+            for (u32Index = ICM_INIT_VAL_U8; u32Index < TLV_VALUE_SIZE; u32Index++)
+            {
+                stFrame.au8Value[u32Index] = (uint8_t)(u32Index + 1U);
+            }
+            for (u32Index = ICM_INIT_VAL_U8; u32Index < u16Tail; u32Index++)
+            {
+                pu8Tail[u32Index] = (uint8_t)icm_u32CheckNextRandom();
+            }
+            icm_vCheckSealCrc(&stFrame, pu8Tail, u16Tail);
+            (void)memcpy(au8Buffer, &stFrame, sizeof(stFrame));
+
+            (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+            ICM_vInjectReceivedFrame(au8Buffer, sizeof(stFrame) + u16Tail, (uint8_t)enVAMConnectionTCP);
+            icm_vCheckDrainQueues();
+            dElapsed_ns += icm_dCheckElapsed_ns(&stStart);
+            UT_vSimAdvanceTime_ms(RX_CHECK_STEP_MS);
+        }
+        ICM_vGetRxFrameCost(astCost, NULL);
+        u32Valid = astCost[enRxFrameValid].u32FrameCount - u32Valid;
+        (void)printf("payload %3u bytes: %u of %u frames accepted, %.0f ns per frame, %.1f MB/s of value bytes\n",
+                     au16Length[u8Size], u32Valid, RX_CHECK_BENCH_FRAMES, dElapsed_ns / (double)RX_CHECK_BENCH_FRAMES,
+                     ((double)au16Length[u8Size] * (double)RX_CHECK_BENCH_FRAMES * 1e3) / dElapsed_ns);
+        if (u32Valid != RX_CHECK_BENCH_FRAMES)
+        {
+            bResult = false;
+        }
+    }
+    return bResult;
+}
+
+/* Copies of one action request and of its approval between the pipeline stages */
+static void icm_vCheckCopies(void)
+{
+    TLVMessage_t stFrame;
+    stProcessMsgData stMsg;
+    uint32_t au32Copies[3] = {0U, 0U, 0U};
+    uint64_t au64Bytes[3] = {0U, 0U, 0U};
+    uint32_t au32Total[2] = {0U, 0U};
+    uint64_t au64Total[2] = {0U, 0U};
+    uint32_t u32Requests = ICM_INIT_VAL_U8;
+    uint32_t u32Frame;
+    uint8_t u8Class;
+
+    for (u32Frame = ICM_INIT_VAL_U8; u32Frame < RX_CHECK_BENCH_FRAMES; u32Frame++)
+    {
+        icm_vCheckBuildRequest(&stFrame, (uint16_t)u32Frame);
+        ITCOM_vGetMsgCopyCount(&au32Copies[0], &au64Bytes[0]);
+        ICM_vInjectReceivedFrame((const uint8_t *)&stFrame, sizeof(stFrame), (uint8_t)enVAMConnectionTCP);
+        if (ITCOM_s8DequeueActionReq(&stMsg, DATA_INTEGRITY_QUEUE) == QUEUE_ACTION_SUCCESS)
+        {
+            ITCOM_vGetMsgCopyCount(&au32Copies[1], &au64Bytes[1]);
+            if ((ITCOM_s8QueueActionReq(&stMsg) == QUEUE_ACTION_SUCCESS) &&
+                (ITCOM_s8DequeueTxMessage(&stMsg, ICM_INIT_VAL_U8, &u8Class) == QUEUE_ACTION_SUCCESS) &&
+                (u8Class == (uint8_t)enTxClassApproval))
+            {
+                ITCOM_vGetMsgCopyCount(&au32Copies[2], &au64Bytes[2]);
+                au32Total[0] += au32Copies[1] - au32Copies[0];
+                au64Total[0] += au64Bytes[1] - au64Bytes[0];
+                au32Total[1] += au32Copies[2] - au32Copies[1];
+                au64Total[1] += au64Bytes[2] - au64Bytes[1];
+                u32Requests++;
+            }
+            ITCOM_vReleaseMsgPayload(&stMsg);
+        }
+        icm_vCheckDrainQueues();
+        UT_vSimAdvanceTime_ms(RX_CHECK_STEP_MS);
+    }
+    if (u32Requests > 0U)
+    {
+        (void)printf("copies: %u action requests, per request RX ring to ARA %.2f copies (%.1f bytes), ARA to ICM_TX %.2f copies (%.1f bytes)\n",
+                     u32Requests, (double)au32Total[0] / (double)u32Requests, (double)au64Total[0] / (double)u32Requests,
+                     (double)au32Total[1] / (double)u32Requests, (double)au64Total[1] / (double)u32Requests);
+    }
+}
+
+static uint32_t icm_u32CheckFuzz(uint32_t u32Frames)
+{
+    uint8_t au8Buffer[RX_CHECK_BUFFER_SIZE];
+    TLVMessage_t stFrame;
+    uint8_t *pu8Tail = &au8Buffer[sizeof(TLVMessage_t)];
+    uint32_t u32Frame;
+    uint32_t u32Index;
+    uint32_t u32Flips;
+    size_t szLength;
+
+    for (u32Frame = ICM_INIT_VAL_U8; u32Frame < u32Frames; u32Frame++)
+    {
+        uint32_t u32Random = icm_u32CheckNextRandom();
+
+        icm_vCheckBuildRequest(&stFrame, (uint16_t)u32Frame);
+        szLength = sizeof(stFrame);
+        switch (u32Random % 5U)
+        {
+        case 0U: /* Noise */
+            for (u32Index = ICM_INIT_VAL_U8; u32Index < sizeof(stFrame); u32Index++)
+            {
+                ((uint8_t *)&stFrame)[u32Index] = (uint8_t)icm_u32CheckNextRandom();
+            }
+            break;
+        case 1U: /* Bit flips anywhere, stale CRC */
+        case 2U: /* Bit flips past the CRC, CRC fixed so the deeper checks run */
+            for (u32Flips = (icm_u32CheckNextRandom() % 4U) + 1U; u32Flips > 0U; u32Flips--)
+            {
+                u32Index = icm_u32CheckNextRandom() % (uint32_t)(sizeof(stFrame) * 8U);
+                ((uint8_t *)&stFrame)[u32Index / 8U] ^= (uint8_t)(1U << (u32Index % 8U));
+            }
+            if ((u32Random % 5U) == 2U)
+            {
+                icm_vCheckSealCrc(&stFrame, NULL, 0U);
+            }
+            break;
+        case 3U: /* Truncated */
+            szLength = (size_t)(icm_u32CheckNextRandom() % (uint32_t)(sizeof(stFrame) - 1U)) + 1U;
+            break;
+        default: /* Long value, announced length up to past the maximum, tail possibly short */
+        {
+            uint16_t u16Tail;
+            stFrame.u16Length = (uint16_t)(TLV_VALUE_SIZE + 1U + (icm_u32CheckNextRandom() % (TLV_MAX_VALUE_SIZE - TLV_VALUE_SIZE + 16U)));
+            u16Tail = (stFrame.u16Length <= TLV_MAX_VALUE_SIZE) ? (uint16_t)(stFrame.u16Length - TLV_VALUE_SIZE) : 0U;
+            for (u32Index = ICM_INIT_VAL_U8; u32Index < u16Tail; u32Index++)
+            {
+                pu8Tail[u32Index] = (uint8_t)icm_u32CheckNextRandom();
+            }
+            icm_vCheckSealCrc(&stFrame, pu8Tail, u16Tail);
+            szLength += ((icm_u32CheckNextRandom() % 4U) == 0U) ? (icm_u32CheckNextRandom() % ((uint32_t)u16Tail + 1U)) : u16Tail;
+            break;
+        }
+        }
+        (void)memcpy(au8Buffer, &stFrame, sizeof(stFrame));
+        ICM_vInjectReceivedFrame(au8Buffer, szLength, (uint8_t)(u32Random >> 31));
+        icm_vCheckDrainQueues();
+        UT_vSimAdvanceTime_ms(RX_CHECK_STEP_MS);
+    }
+    return u32Frames;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *pstNull = fopen("/dev/null", "w");
+    struct timespec stStart;
+    MsgPoolStats_t stPool = {0};
+    MsgPoolStats_t stPayloadPool = {0};
+    RxRingStats_t stRing = {0};
+    uint32_t u32Overflows = ICM_INIT_VAL_U8;
+    uint32_t u32FuzzFrames = RX_CHECK_FUZZ_FRAMES;
+    uint32_t u32Classified;
+    uint32_t u32Truncated = ICM_INIT_VAL_U8;
+    uint8_t u8Conn;
+    int iResult = 0;
+
+    if (pstNull == NULL)
+    {
+        return 1;
+    }
+    if (argc > 1)
+    {
+        u32FuzzFrames = (uint32_t)strtoul(argv[1], NULL, 10);
+    }
+    global_log_file = pstNull;
+    ITCOM_vSharedMemoryInit(pstNull, enHardRestart);
+    CRC_vCreateTable();
+    UT_vSetTimeSource(enTimeSourceSimulated);
+    ICM_vInit();
+
+    icm_vCheckBenchmark();
+    ICM_vReportRxFrameCost(stdout);
+    icm_vCheckBookkeeping();
+    icm_vCheckCopies();
+    if (!icm_bCheckPayloadThroughput())
+    {
+        (void)printf("payload: valid frames rejected\n");
+        iResult = 1;
+    }
+    if (!icm_bCheckOverload())
+    {
+        (void)printf("overload: action requests lost without a reply\n");
+        iResult = 1;
+    }
+
+    u32Classified = icm_u32CheckFramesClassified();
+    (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+    (void)icm_u32CheckFuzz(u32FuzzFrames);
+    (void)printf("fuzz: %u frames in %.1f ms\n", u32FuzzFrames, icm_dCheckElapsed_ns(&stStart) / 1e6);
+    u32Classified = icm_u32CheckFramesClassified() - u32Classified;
+
+    for (u8Conn = ICM_INIT_VAL_U8; u8Conn < (uint8_t)enTotalTCPConnections; u8Conn++)
+    {
+        ITCOM_vGetRxRingStats(u8Conn, &stRing);
+        u32Overflows += stRing.u32Overflows;
+    }
+    ICM_vGetRxFrameCost(NULL, &u32Truncated);
+    ITCOM_vGetPoolStats(&stPool);
+    ITCOM_vGetPayloadPoolStats(&stPayloadPool);
+    (void)printf("fuzz: %u classified, %u ring overflows, %u truncated so far; message pool %u/%u, payload pool %u/%u allocs/frees\n",
+                 u32Classified, u32Overflows, u32Truncated, stPool.u32Allocs, stPool.u32Frees,
+                 stPayloadPool.u32Allocs, stPayloadPool.u32Frees);
+    if ((u32Classified != u32FuzzFrames) || (u32Overflows != 0U))
+    {
+        (void)printf("fuzz: frames lost or classified twice\n");
+        iResult = 1;
+    }
+    if ((stPool.u32Allocs != stPool.u32Frees) || (stPayloadPool.u32Allocs != stPayloadPool.u32Frees))
+    {
+        (void)printf("fuzz: pool blocks leaked\n");
+        iResult = 1;
+    }
+
+    (void)fclose(pstNull);
+    return iResult;
+}
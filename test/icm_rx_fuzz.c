@@ -0,0 +1,184 @@
+/**
+* @file icm_rx_fuzz.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief libFuzzer target on the RX injection entry (make rx-fuzz)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+*
+*/
+
+/*
+ * Every input is one received frame: the first byte picks the connection
+ * (bit 0) and whether the CRC is recomputed over the frame first (bit 1, so
+ * the checks behind the CRC are reached without the fuzzer having to find
+ * matching CRCs); the rest goes to ICM_vInjectReceivedFrame as it came off
+ * the socket, long value tail included. The queues are then drained the way
+ * ARA and ICM_TX would, so every input starts from empty queues. Besides
+ * what AddressSanitizer reports, an input fails when a frame is lost or
+ * classified twice, or when a message or payload pool block is still in use
+ * once the queues are drained.
+ * Simulated time moves RX_FUZZ_STEP_MS per input so the rate limits and the
+ * recent request cache behave as at a realistic frame rate.
+ */
+
+/*** Include Files ***/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "itcom.h"
+#include "crc.h"
+#include "storage_handler.h"
+#include "util_time.h"
+#include "icm.h"
+
+#ifndef ICM_RX_INJECTION
+#error "rx-fuzz drives the receive path through ICM_vInjectReceivedFrame, build with ICM_RX_INJECTION"
+#endif
+
+/*** Module Definitions ***/
+#define RX_FUZZ_STEP_MS                      (10U)
+#define RX_FUZZ_HEADER_SIZE                  (1U)
+#define RX_FUZZ_CONNECTION_BIT               (0x01U)
+#define RX_FUZZ_SEAL_CRC_BIT                 (0x02U)
+#define RX_FUZZ_BUFFER_SIZE                  (sizeof(TLVMessage_t) + TLV_MAX_VALUE_SIZE)
+
+extern int LLVMFuzzerTestOneInput(const uint8_t *pu8Data, size_t szSize);
+
+static bool icm_bFuzzReady = false;
+
+/* What the ARA and ICM_TX threads would do with the queued messages: every request is approved */
+static void icm_vFuzzDrainQueues(void)
+{
+    stProcessMsgData stMsg;
+    uint8_t u8Class;
+
+    while (ITCOM_s8DequeueActionReq(&stMsg, DATA_INTEGRITY_QUEUE) == QUEUE_ACTION_SUCCESS)
+    {
+        (void)ITCOM_s8LogNotificationMessage(stMsg.stMsgPairData.u16MsgId, stMsg.stMsgPairData.u16SequenceNum,
+                                             (uint8_t)enApprovedRequest, (uint8_t)enActionNotification);
+        ITCOM_vReleaseMsgPayload(&stMsg);
+    }
+    while (ITCOM_s8DequeueTxMessage(&stMsg, ICM_INIT_VAL_U8, &u8Class) == QUEUE_ACTION_SUCCESS)
+    {
+        ITCOM_vReleaseMsgPayload(&stMsg);
+    }
+}
+
+static uint32_t icm_u32FuzzFramesSeen(void)
+{
+    RxFrameCost_t astCost[enTotalRxFrameClasses];
+    RxRingStats_t stRing = {0};
+    uint32_t u32Frames = ICM_INIT_VAL_U8;
+    uint8_t u8Index;
+
+    ICM_vGetRxFrameCost(astCost, NULL);
+    for (u8Index = ICM_INIT_VAL_U8; u8Index < (uint8_t)enTotalRxFrameClasses; u8Index++)
+    {
+        u32Frames += astCost[u8Index].u32FrameCount;
+    }
+    for (u8Index = ICM_INIT_VAL_U8; u8Index < (uint8_t)enTotalTCPConnections; u8Index++)
+    {
+        ITCOM_vGetRxRingStats(u8Index, &stRing);
+        u32Frames += stRing.u32Overflows;
+    }
+    return u32Frames;
+}
+
+/* CRC over the frame as the peer computes it, announced value tail included as far as present */
+static void icm_vFuzzSealCrc(uint8_t *pu8Frame, size_t szFrameLength)
+{
+    TLVMessage_t stFrame;
+    size_t szTail = ICM_INIT_VAL_U8;
+
+    (void)memcpy(&stFrame, pu8Frame, sizeof(stFrame));
+    if ((stFrame.u16Length > TLV_VALUE_SIZE) && (stFrame.u16Length <= TLV_MAX_VALUE_SIZE))
+    {
+        szTail = (size_t)stFrame.u16Length - TLV_VALUE_SIZE;
+        szTail = ((szFrameLength - sizeof(stFrame)) < szTail) ? (szFrameLength - sizeof(stFrame)) : szTail;
+    }
+    stFrame.u16CRC = CRC_u16CalculateCrc((uint8_t *)&stFrame.u16SequenceNumber,
+                                         sizeof(stFrame.u16SequenceNumber) + sizeof(stFrame.u16ID) + sizeof(stFrame.au8Value));
+    if (szTail > 0U)
+    {
+        stFrame.u16CRC = CRC_u16UpdateCrc(stFrame.u16CRC, &pu8Frame[sizeof(stFrame)], (uint16_t)szTail);
+    }
+    (void)memcpy(pu8Frame, &stFrame, sizeof(stFrame));
+}
+
+/* Shared memory, CRC table, simulated time and ICM once per process, not per input */
+static void icm_vFuzzInit(void)
+{
+    FILE *pstNull = fopen("/dev/null", "w");
+
+    if (pstNull == NULL)
+    {
+        abort();
+    }
+    global_log_file = pstNull;
+    ITCOM_vSharedMemoryInit(pstNull, enHardRestart);
+    CRC_vCreateTable();
+    UT_vSetTimeSource(enTimeSourceSimulated);
+    ICM_vInit();
+    icm_bFuzzReady = true;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *pu8Data, size_t szSize)
+{
+    MsgPoolStats_t stPool = {0};
+    MsgPoolStats_t stPayloadPool = {0};
+    static uint8_t au8Buffer[RX_FUZZ_BUFFER_SIZE];
+    const uint8_t *pu8Frame = &pu8Data[RX_FUZZ_HEADER_SIZE];
+    size_t szFrameLength;
+    uint32_t u32Frames;
+
+    if (!icm_bFuzzReady)
+    {
+        icm_vFuzzInit();
+    }
+    if (szSize <= RX_FUZZ_HEADER_SIZE)
+    {
+        return 0;
+    }
+
+    szFrameLength = szSize - RX_FUZZ_HEADER_SIZE;
+    if (((pu8Data[0] & RX_FUZZ_SEAL_CRC_BIT) != 0U) && (szFrameLength >= sizeof(TLVMessage_t)))
+    {
+        /* Bytes past the longest frame are never read by the receive path */
+        szFrameLength = (szFrameLength < sizeof(au8Buffer)) ? szFrameLength : sizeof(au8Buffer);
+        (void)memcpy(au8Buffer, pu8Frame, szFrameLength);
+        icm_vFuzzSealCrc(au8Buffer, szFrameLength);
+        pu8Frame = au8Buffer;
+    }
+
+    u32Frames = icm_u32FuzzFramesSeen();
+    ICM_vInjectReceivedFrame(pu8Frame, szFrameLength, (uint8_t)(pu8Data[0] & RX_FUZZ_CONNECTION_BIT));
+    icm_vFuzzDrainQueues();
+    UT_vSimAdvanceTime_ms(RX_FUZZ_STEP_MS);
+
+    if (icm_u32FuzzFramesSeen() != (u32Frames + 1U))
+    {
+        (void)fprintf(stderr, "rx-fuzz: frame lost or classified twice\n");
+        abort();
+    }
+    ITCOM_vGetPoolStats(&stPool);
+    ITCOM_vGetPayloadPoolStats(&stPayloadPool);
+    if ((stPool.u32Allocs != stPool.u32Frees) || (stPayloadPool.u32Allocs != stPayloadPool.u32Frees))
+    {
+        (void)fprintf(stderr, "rx-fuzz: pool blocks leaked (message %u/%u, payload %u/%u allocs/frees)\n",
+                      stPool.u32Allocs, stPool.u32Frees, stPayloadPool.u32Allocs, stPayloadPool.u32Frees);
+        abort();
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+* @file itcom_alloc_check.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief concurrent sender check of the TX sequence number and rolling counter allocation (make alloc-check)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, moved out of itcom.c (ITCOM_ALLOC_CHECK_MAIN)
+*
+*/
+
+/*
+ * Each thread allocates from the same registers and gives back every
+ * fourth value, as a sender whose send failed. A release that loses its race leaves a used value (a gap on the
+ * wire), so those are kept too. The values kept must be 0, 1, ... 65534,
+ * 0, ... with no gap and no repeat, whatever the interleaving, and 65535
+ * must never be handed out.
+ */
+
+/*** Include Files ***/
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "storage_handler.h"
+#include "itcom.h"
+
+/*** Module Definitions ***/
+#define ALLOC_CHECK_THREADS                   (4U)
+#define ALLOC_CHECK_PER_THREAD                (100000U)
+#define ALLOC_CHECK_RELEASE_EVERY             (4U)
+
+typedef struct {
+    uint16_t au16Seq[ALLOC_CHECK_PER_THREAD];
+    uint16_t au16Rc[ALLOC_CHECK_PER_THREAD];
+    uint32_t u32SeqKept;
+    uint32_t u32RcKept;
+    uint32_t u32Released;
+} ItcomAllocCheckThread_t;
+
+static ItcomAllocCheckThread_t itcom_astAllocCheck[ALLOC_CHECK_THREADS];
+
+static void* itcom_pvAllocCheckThread(void* pvArg) {
+    ItcomAllocCheckThread_t* pstThread = (ItcomAllocCheckThread_t*)pvArg;
+    uint32_t i;
+
+    for (i = 0U; i < ALLOC_CHECK_PER_THREAD; i++) {
+        uint16_t u16Seq = ITCOM_u16AllocSeqNumASI(0U);
+        uint16_t u16Rc = ITCOM_u16AllocTxRollingCounter(0U);
+        bool bFailedSend = ((i % ALLOC_CHECK_RELEASE_EVERY) == 0U);
+
+        if (!bFailedSend || !ITCOM_bReleaseSeqNumASI(0U, u16Seq)) {
+            pstThread->au16Seq[pstThread->u32SeqKept++] = u16Seq;
+        } else {
+            pstThread->u32Released++;
+        }
+        if (!bFailedSend || !ITCOM_bReleaseTxRollingCounter(0U, u16Rc)) {
+            pstThread->au16Rc[pstThread->u32RcKept++] = u16Rc;
+        }
+    }
+    return NULL;
+}
+
+static int itcom_iAllocCheckCounts(const char* pcName, const uint32_t* pu32Counts, uint32_t u32Kept) {
+    uint32_t v;
+
+    if (pu32Counts[UINT16_MAX_VALUE] != 0U) {
+        (void)printf("%s: 65535 handed out %u times\n", pcName, pu32Counts[UINT16_MAX_VALUE]);
+        return 1;
+    }
+    for (v = 0U; v < UINT16_MAX_VALUE; v++) {
+        uint32_t u32Expected = (u32Kept / UINT16_MAX_VALUE) + ((v < (u32Kept % UINT16_MAX_VALUE)) ? 1U : 0U);
+
+        if (pu32Counts[v] != u32Expected) {
+            (void)printf("%s: value %u kept %u times, expected %u\n", pcName, v, pu32Counts[v], u32Expected);
+            return 1;
+        }
+    }
+    (void)printf("%s: %u values kept, no gap, no repeat, 65535 skipped\n", pcName, u32Kept);
+    return 0;
+}
+
+int main(void) {
+    static uint32_t au32SeqCounts[UINT16_MAX_VALUE + 1U];
+    static uint32_t au32RcCounts[UINT16_MAX_VALUE + 1U];
+    pthread_t astThreads[ALLOC_CHECK_THREADS];
+    struct timespec stStart;
+    struct timespec stEnd;
+    uint32_t u32SeqKept = 0U;
+    uint32_t u32RcKept = 0U;
+    uint32_t u32Released = 0U;
+    uint32_t t;
+    uint32_t i;
+    FILE* pstNull = fopen("/dev/null", "w");
+    double dElapsed_ns;
+    int iResult;
+
+    if (pstNull == NULL) {
+        return 1;
+    }
+    global_log_file = pstNull;
+    ITCOM_vSharedMemoryInit(pstNull, enHardRestart);
+    (void)clock_gettime(CLOCK_MONOTONIC, &stStart);
+    for (t = 0U; t < ALLOC_CHECK_THREADS; t++) {
+        if (pthread_create(&astThreads[t], NULL, itcom_pvAllocCheckThread, &itcom_astAllocCheck[t]) != 0) {
+            return 1;
+        }
+    }
+    for (t = 0U; t < ALLOC_CHECK_THREADS; t++) {
+        (void)pthread_join(astThreads[t], NULL);
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &stEnd);
+
+    for (t = 0U; t < ALLOC_CHECK_THREADS; t++) {
+        for (i = 0U; i < itcom_astAllocCheck[t].u32SeqKept; i++) {
+            au32SeqCounts[itcom_astAllocCheck[t].au16Seq[i]]++;
+        }
+        for (i = 0U; i < itcom_astAllocCheck[t].u32RcKept; i++) {
+            au32RcCounts[itcom_astAllocCheck[t].au16Rc[i]]++;
+        }
+        u32SeqKept += itcom_astAllocCheck[t].u32SeqKept;
+        u32RcKept += itcom_astAllocCheck[t].u32RcKept;
+        u32Released += itcom_astAllocCheck[t].u32Released;
+    }
+    iResult = itcom_iAllocCheckCounts("sequence number", au32SeqCounts, u32SeqKept);
+    iResult |= itcom_iAllocCheckCounts("rolling counter", au32RcCounts, u32RcKept);
+    (void)printf("%u of %u failed sends gave their sequence number back\n", u32Released,
+                 (ALLOC_CHECK_THREADS * ALLOC_CHECK_PER_THREAD) / ALLOC_CHECK_RELEASE_EVERY);
+
+    dElapsed_ns = ((double)(stEnd.tv_sec - stStart.tv_sec) * 1e9) + (double)(stEnd.tv_nsec - stStart.tv_nsec);
+    (void)printf("%u threads, %u sends each: %.1f ns per send (sequence number + rolling counter)\n",
+                 ALLOC_CHECK_THREADS, ALLOC_CHECK_PER_THREAD,
+                 dElapsed_ns / ((double)ALLOC_CHECK_THREADS * (double)ALLOC_CHECK_PER_THREAD));
+    (void)fclose(pstNull);
+    return iResult;
+}
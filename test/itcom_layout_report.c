@@ -0,0 +1,49 @@
+/**
+* @file itcom_layout_report.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief footprint and cache line layout report of the shared memory (make layout-report)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, moved out of itcom_layout.c (ITCOM_LAYOUT_REPORT_MAIN)
+*
+*/
+
+/*
+ * Reports the default region layout, or the one of the configuration file
+ * given as the argument.
+ */
+
+/*** Include Files ***/
+#include <stdio.h>
+
+#include "itcom.h"
+
+int main(int argc, char* argv[]) {
+    ItcomRegionConfig_t stConfig;
+    ItcomRegionLayout_t stLayout;
+    uint32_t u32BadLine = 0U;
+    uint8_t u8BadRegion = 0U;
+
+    ITCOM_vDefaultRegionConfig(&stConfig);
+    if ((argc > 1) && (ITCOM_s8LoadRegionConfig(argv[1], &stConfig, &u32BadLine) != ITCOM_REGION_OK)) {
+        (void)fprintf(stderr, "%s: cannot use line %u or file missing\n", argv[1], u32BadLine);
+        return 1;
+    }
+    if (ITCOM_s8BuildRegionLayout(&stConfig, &stLayout, &u8BadRegion) != ITCOM_REGION_OK) {
+        (void)fprintf(stderr, "capacity of %s out of range\n", ITCOM_pcRegionName(u8BadRegion));
+        return 1;
+    }
+
+    ITCOM_vReportSharedMemoryLayout(stdout, &stLayout);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+* @file itcom_time_check.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief simulated time check of the action request timeout (make time-check)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, moved out of itcom.c (ITCOM_TIME_CHECK_MAIN)
+*
+*/
+
+/*
+ * One simulated hour of requests, one every TIME_CHECK_STEP_MS: each is
+ * answered after 0 .. TIME_CHECK_STEP_MS - 1 simulated ms and must be
+ * approved exactly when that is within ACTION_REQUEST_PROCESS_TIMEOUT_THRESHOLD.
+ * The UT clocks must have moved by exactly the simulated hour.
+ */
+
+/*** Include Files ***/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "storage_handler.h"
+#include "util_time.h"
+#include "itcom.h"
+
+/*** Module Definitions ***/
+#define TIME_CHECK_SIM_MS                     (3600U * 1000U)
+#define TIME_CHECK_STEP_MS                    (100U)
+#define TIME_CHECK_MSG_ID                     (0x0100U)
+
+int main(void) {
+    FILE* pstNull = fopen("/dev/null", "w");
+    stProcessMsgData stMsg;
+    stProcessMsgData stOut;
+    struct timespec stRealStart;
+    struct timespec stRealEnd;
+    struct timespec stSimStart;
+    struct timespec stSimEnd;
+    uint32_t u32MsStart;
+    time_t tWallStart;
+    uint32_t u32Approved = 0U;
+    uint32_t u32TimedOut = 0U;
+    uint32_t u32Wrong = 0U;
+    uint32_t u32Sim_ms;
+    uint8_t u8Class;
+    int64_t s64SimElapsed_ms;
+    int iResult = 0;
+
+    if (pstNull == NULL) {
+        return 1;
+    }
+    global_log_file = pstNull;
+    ITCOM_vSharedMemoryInit(pstNull, enHardRestart);
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stRealStart);
+    UT_vSetTimeSource(enTimeSourceSimulated);
+    (void)UT_s32GetMonotonicTime(&stSimStart);
+    u32MsStart = UT_u32GetCurrentTime_ms();
+    tWallStart = UT_tGetWallTime_s();
+
+    (void)memset(&stMsg, 0, sizeof(stMsg));
+    stMsg.stMsgPairData.u16MsgId = TIME_CHECK_MSG_ID;
+    for (u32Sim_ms = 0U; u32Sim_ms < TIME_CHECK_SIM_MS; u32Sim_ms += TIME_CHECK_STEP_MS) {
+        uint32_t u32Answer_ms = (u32Sim_ms / TIME_CHECK_STEP_MS) % TIME_CHECK_STEP_MS;
+        bool bInTime = (u32Answer_ms <= (uint32_t)ACTION_REQUEST_PROCESS_TIMEOUT_THRESHOLD);
+        int8_t s8Result;
+
+        stMsg.stMsgPairData.u16SequenceNum = (uint16_t)(u32Sim_ms / TIME_CHECK_STEP_MS);
+        ITCOM_vSetActionRequestStartTime(stMsg.stMsgPairData.u16MsgId, stMsg.stMsgPairData.u16SequenceNum);
+        UT_vSimAdvanceTime_ms(u32Answer_ms);
+        s8Result = ITCOM_s8QueueActionReq(&stMsg);
+        UT_vSimAdvanceTime_ms(TIME_CHECK_STEP_MS - u32Answer_ms);
+
+        if (s8Result == QUEUE_ACTION_SUCCESS) {
+            u32Approved++;
+        } else if (s8Result == QUEUE_ACTION_TIMEOUT) {
+            u32TimedOut++;
+        }
+        if ((s8Result == QUEUE_ACTION_SUCCESS) != bInTime) {
+            u32Wrong++;
+        }
+        while (ITCOM_s8DequeueTxMessage(&stOut, 0U, &u8Class) == QUEUE_ACTION_SUCCESS) {
+        }
+    }
+
+    (void)UT_s32GetMonotonicTime(&stSimEnd);
+    (void)clock_gettime(CLOCK_MONOTONIC, &stRealEnd);
+    s64SimElapsed_ms = ((int64_t)(stSimEnd.tv_sec - stSimStart.tv_sec) * 1000) +
+                       ((int64_t)(stSimEnd.tv_nsec - stSimStart.tv_nsec) / 1000000);
+
+    (void)printf("%u requests: %u approved, %u timed out, %u decided against the %u ms threshold\n",
+                 TIME_CHECK_SIM_MS / TIME_CHECK_STEP_MS, u32Approved, u32TimedOut, u32Wrong,
+                 (uint32_t)ACTION_REQUEST_PROCESS_TIMEOUT_THRESHOLD);
+    if ((u32Wrong != 0U) || ((u32Approved + u32TimedOut) != (TIME_CHECK_SIM_MS / TIME_CHECK_STEP_MS))) {
+        iResult = 1;
+    }
+    if ((s64SimElapsed_ms != (int64_t)TIME_CHECK_SIM_MS) ||
+        ((UT_u32GetCurrentTime_ms() - u32MsStart) != TIME_CHECK_SIM_MS) ||
+        ((UT_tGetWallTime_s() - tWallStart) != (time_t)(TIME_CHECK_SIM_MS / 1000U))) {
+        (void)printf("UT clocks moved by %lld ms, %u ms and %lld s instead of %u ms\n", (long long)s64SimElapsed_ms,
+                     UT_u32GetCurrentTime_ms() - u32MsStart, (long long)(UT_tGetWallTime_s() - tWallStart),
+                     TIME_CHECK_SIM_MS);
+        iResult = 1;
+    }
+    (void)printf("%u simulated ms in %.1f real ms\n", TIME_CHECK_SIM_MS,
+                 ((double)(stRealEnd.tv_sec - stRealStart.tv_sec) * 1e3) +
+                 ((double)(stRealEnd.tv_nsec - stRealStart.tv_nsec) / 1e6));
+    (void)fclose(pstNull);
+    return iResult;
+}
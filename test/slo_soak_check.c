@@ -0,0 +1,321 @@
+/**
+* @file slo_soak_check.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief soak and fault injection driver of the application (make soak-check)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, moved out of slo_monitor.c (SLO_SOAK_MAIN)
+* 10/18/2026|TP |Request mix through the RX injection entry, VAM drops, every breach counted
+*
+*/
+
+/*
+ * Runs the application (an RX_INJECTION build) in a scratch directory for
+ * the soak time with this process as its VAM and CM servers (asi_peer.c).
+ * Every SOAK_REQUEST_PERIOD_MS an action request of the peer mix goes in
+ * through the RX injection entry, every SOAK_BAD_CRC_EVERY-th one with a
+ * broken CRC. Every SOAK_FAULT_INTERVAL_S a
+ * fault is injected, in turn: SIGSEGV to the child (recovered in place or
+ * ending the child), an external SIGTERM, SIGKILL, a SOAK_STALL_MS stall
+ * (SIGSTOP/SIGCONT) and a dropped VAM connection. SIGABRT is not used: the
+ * child blocks it in every thread, so only a raise() from the child itself
+ * ends it. Only VAM is dropped: CM silent for longer than the vehicle status
+ * timeout is a critical fault that puts the ASI in safe state for good.
+ * The parent must restart the child after every SIGTERM and SIGKILL, the
+ * requests must be approved and the parent must log no SLO breach, against
+ * the limits or the stored baseline; SIGTERM to the parent then has to end
+ * the run with exit status 0.
+ */
+
+/*** Include Files ***/
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "storage_handler.h"
+#include "slo_monitor.h"
+#include "asi_peer.h"
+
+/*** Module Definitions ***/
+#define SOAK_DEFAULT_S                   (60U)
+#define SOAK_FAULT_INTERVAL_S            (5U)
+#define SOAK_STALL_MS                    (200U)
+#define SOAK_STOP_TIMEOUT_MS             (5000U)
+#define SOAK_POLL_MS                     (10U)
+#define SOAK_LINE_SIZE                   (512U)
+#define SOAK_PROC_PATH_LEN               (64U)
+#define SOAK_REQUEST_PERIOD_MS           (100U)
+#define SOAK_BAD_CRC_EVERY               (7U)
+#define SOAK_RESTART_TEXT                "Child restart completed in "
+#define SOAK_BREACH_TEXT                 "SLO breach"
+#define SOAK_DIR_PERMISSIONS             (0755)
+#define SOAK_MS_PER_S                    (1000U)
+
+/*** Internal Types ***/
+typedef enum
+{
+    enSoakSegv = 0,
+    enSoakTerm,
+    enSoakKill,
+    enSoakStall,
+    enSoakDrop,
+    enTotalSoakFaults
+} SoakFault_t;
+
+static AsiPeer_t soak_peer;
+static uint32_t soak_request_count = 0U;
+
+/* The application has a single child: the process whose parent is app */
+static pid_t slo_soak_find_child(pid_t app)
+{
+    char path[SOAK_PROC_PATH_LEN];
+    struct dirent *entry;
+    pid_t child = -1;
+    DIR *proc_dir = opendir("/proc");
+
+    if (proc_dir == NULL)
+    {
+        return -1;
+    }
+    while ((child < 0) && ((entry = readdir(proc_dir)) != NULL))
+    {
+        int pid = 0;
+        int ppid = 0;
+        FILE *status_file;
+        char line[SOAK_LINE_SIZE];
+
+        if ((entry->d_name[0] < '1') || (entry->d_name[0] > '9'))
+        {
+            continue;
+        }
+        pid = atoi(entry->d_name);
+        (void)snprintf(path, sizeof(path), "/proc/%d/status", pid);
+        status_file = fopen(path, "r");
+        if (status_file == NULL)
+        {
+            continue;
+        }
+        while (fgets(line, (int)sizeof(line), status_file) != NULL)
+        {
+            if ((sscanf(line, "PPid: %d", &ppid) == 1) && (ppid == (int)app))
+            {
+                child = (pid_t)pid;
+                break;
+            }
+        }
+        (void)fclose(status_file);
+    }
+    (void)closedir(proc_dir);
+
+    return child;
+}
+
+/* Lines of path holding text; the number right after the text is tracked in max_value */
+static uint32_t slo_soak_count_lines(const char *path, const char *text, uint32_t *max_value)
+{
+    char line[SOAK_LINE_SIZE];
+    uint32_t count = 0U;
+    FILE *log_file = fopen(path, "r");
+
+    if (log_file == NULL)
+    {
+        return 0U;
+    }
+    while (fgets(line, (int)sizeof(line), log_file) != NULL)
+    {
+        const char *found = strstr(line, text);
+        unsigned int value = 0U;
+
+        if (found != NULL)
+        {
+            count++;
+            if ((max_value != NULL) && (sscanf(found + strlen(text), "%u", &value) == 1) && (value > *max_value))
+            {
+                *max_value = value;
+            }
+        }
+    }
+    (void)fclose(log_file);
+
+    return count;
+}
+
+/* Serves the peer for drive_ms with one request of the mix every SOAK_REQUEST_PERIOD_MS */
+static void slo_soak_drive(uint32_t drive_ms)
+{
+    uint32_t driven_ms;
+
+    for (driven_ms = 0U; driven_ms < drive_ms; driven_ms += SOAK_REQUEST_PERIOD_MS)
+    {
+        soak_request_count++;
+        PEER_vSendMixRequest(&soak_peer, (soak_request_count % SOAK_BAD_CRC_EVERY) == 0U);
+        PEER_vRun(&soak_peer, SOAK_REQUEST_PERIOD_MS);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static const char *const fault_name[enTotalSoakFaults] = {"SIGSEGV", "SIGTERM", "SIGKILL", "stall", "VAM drop"};
+    char app_path[PATH_MAX];
+    uint32_t soak_s = SOAK_DEFAULT_S;
+    uint32_t elapsed_s = 0U;
+    uint32_t faults[enTotalSoakFaults] = {0U};
+    uint32_t fault_count = 0U;
+    uint32_t restarts;
+    uint32_t max_restart_ms = 0U;
+    uint32_t breaches;
+    uint32_t waited_ms = 0U;
+    int status = 0;
+    int result = 0;
+    pid_t app;
+
+    if (argc < 3)
+    {
+        (void)fprintf(stderr, "usage: %s <APP_ASI> <run directory> [soak seconds]\n", argv[0]);
+        return 2;
+    }
+    if (argc > 3)
+    {
+        soak_s = (uint32_t)strtoul(argv[3], NULL, 10);
+    }
+    if (realpath(argv[1], app_path) == NULL)
+    {
+        (void)fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        return 2;
+    }
+    /* The application works relative to its directory; the stored baseline is kept between runs */
+    if (((mkdir(argv[2], SOAK_DIR_PERMISSIONS) != 0) && (errno != EEXIST)) || (chdir(argv[2]) != 0) ||
+        ((mkdir("ASI_DATA", SOAK_DIR_PERMISSIONS) != 0) && (errno != EEXIST)) ||
+        ((mkdir("ASI_DATA/LOG", SOAK_DIR_PERMISSIONS) != 0) && (errno != EEXIST)) ||
+        ((mkdir("ASI_DATA/CONFIG", SOAK_DIR_PERMISSIONS) != 0) && (errno != EEXIST)) ||
+        (PEER_s32Open(&soak_peer) != 0))
+    {
+        (void)fprintf(stderr, "%s: %s\n", argv[2], strerror(errno));
+        return 2;
+    }
+    (void)unlink(CHILD_LOG_FILE_PATH); /* Restarted children append to it */
+
+    app = fork();
+    if (app == 0)
+    {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0)
+        {
+            (void)dup2(null_fd, STDOUT_FILENO);
+            (void)dup2(null_fd, STDERR_FILENO);
+            (void)close(null_fd);
+        }
+        (void)execl(app_path, app_path, (char *)NULL);
+        _exit(127);
+    }
+    if (app < 0)
+    {
+        (void)fprintf(stderr, "fork: %s\n", strerror(errno));
+        return 2;
+    }
+    (void)printf("soak: %s for %u s, a fault every %u s\n", app_path, soak_s, SOAK_FAULT_INTERVAL_S);
+
+    while ((elapsed_s + SOAK_FAULT_INTERVAL_S) <= soak_s)
+    {
+        SoakFault_t fault = (SoakFault_t)(fault_count % enTotalSoakFaults);
+        pid_t child;
+
+        slo_soak_drive(SOAK_FAULT_INTERVAL_S * SOAK_MS_PER_S);
+        elapsed_s += SOAK_FAULT_INTERVAL_S;
+        if (waitpid(app, &status, WNOHANG) == app)
+        {
+            (void)printf("soak: application ended at %u s (status 0x%x)\n", elapsed_s, (unsigned int)status);
+            return 1;
+        }
+        if ((elapsed_s + SOAK_FAULT_INTERVAL_S) > soak_s)
+        {
+            break; /* Leave the last interval for the child to settle */
+        }
+        child = slo_soak_find_child(app);
+        if (child <= 0)
+        {
+            (void)printf("soak: %4u s no child to inject into\n", elapsed_s);
+            continue;
+        }
+
+        if (fault == enSoakStall)
+        {
+            (void)kill(child, SIGSTOP);
+            slo_soak_drive(SOAK_STALL_MS);
+            (void)kill(child, SIGCONT);
+        }
+        else if (fault == enSoakDrop)
+        {
+            PEER_vDrop(&soak_peer, enVAMConnectionTCP);
+        }
+        else
+        {
+            (void)kill(child, (fault == enSoakSegv) ? SIGSEGV : ((fault == enSoakTerm) ? SIGTERM : SIGKILL));
+        }
+        faults[fault]++;
+        fault_count++;
+        (void)printf("soak: %4u s %s to child %d\n", elapsed_s, fault_name[fault], (int)child);
+    }
+
+    (void)kill(app, SIGTERM);
+    while ((waitpid(app, &status, WNOHANG) != app) && (waited_ms < SOAK_STOP_TIMEOUT_MS))
+    {
+        PEER_vRun(&soak_peer, SOAK_POLL_MS);
+        waited_ms += SOAK_POLL_MS;
+    }
+    if (waited_ms >= SOAK_STOP_TIMEOUT_MS)
+    {
+        (void)printf("soak: application still running %u ms after SIGTERM\n", SOAK_STOP_TIMEOUT_MS);
+        (void)kill(app, SIGKILL);
+        (void)waitpid(app, &status, 0);
+        result = 1;
+    }
+    else if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+    {
+        (void)printf("soak: application ended with status 0x%x after SIGTERM\n", (unsigned int)status);
+        result = 1;
+    }
+
+    PEER_vReport(&soak_peer, "soak");
+    PEER_vClose(&soak_peer);
+    restarts = slo_soak_count_lines(CHILD_LOG_FILE_PATH, SOAK_RESTART_TEXT, &max_restart_ms);
+    breaches = slo_soak_count_lines(PARENT_LOG_FILE_PATH, SOAK_BREACH_TEXT, NULL);
+    (void)printf("soak: faults %u (SIGSEGV %u, SIGTERM %u, SIGKILL %u, stall %u, VAM drop %u), restarts %u (max %u ms), SLO breaches %u\n",
+                 fault_count, faults[enSoakSegv], faults[enSoakTerm], faults[enSoakKill], faults[enSoakStall],
+                 faults[enSoakDrop], restarts, max_restart_ms, breaches);
+    if (soak_peer.stStats.u32Approved == 0U)
+    {
+        (void)printf("soak: no action request approved\n");
+        result = 1;
+    }
+    if (restarts < (faults[enSoakTerm] + faults[enSoakKill]))
+    {
+        (void)printf("soak: fewer restarts than fatal faults\n");
+        result = 1;
+    }
+    if (breaches > 0U)
+    {
+        (void)printf("soak: SLO breaches logged in %s/%s\n", argv[2], PARENT_LOG_FILE_PATH);
+        result = 1;
+    }
+
+    return result;
+}
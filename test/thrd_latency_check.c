@@ -0,0 +1,231 @@
+/**
+* @file thrd_latency_check.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief request to approval latency of the threads and the cyclic executive build (make latency-check)
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+*
+*/
+
+/*
+ * Runs two RX_INJECTION builds of the application one after the other, the
+ * periodic threads build and the CYCLIC_EXECUTIVE build, each in its own
+ * scratch directory with this process as its VAM and CM servers
+ * (asi_peer.c). Once the application had LATENCY_WARMUP_MS to reach normal
+ * operation, an action request of the peer mix goes in through the RX
+ * injection entry every LATENCY_REQUEST_PERIOD_MS for the measured time.
+ * The latency of a request runs from its injection to the forwarded request
+ * arriving at CM, so it covers ICM_RX, ARA and ICM_TX. Both modes are
+ * reported side by side; a mode without approvals or with requests left
+ * unanswered fails the check.
+ */
+
+/*** Include Files ***/
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "storage_handler.h"
+#include "asi_peer.h"
+
+/*** Module Definitions ***/
+#define LATENCY_DEFAULT_S                (20U)
+#define LATENCY_WARMUP_MS                (3000U)
+#define LATENCY_SETTLE_MS                (1000U)
+#define LATENCY_REQUEST_PERIOD_MS        (100U)
+#define LATENCY_STOP_TIMEOUT_MS          (5000U)
+#define LATENCY_POLL_MS                  (10U)
+#define LATENCY_DIR_PERMISSIONS          (0755)
+#define LATENCY_MS_PER_S                 (1000U)
+#define LATENCY_US_PER_MS                (1000.0)
+
+/*** Internal Types ***/
+typedef enum
+{
+    enLatencyThreads = 0,
+    enLatencyCyclic,
+    enTotalLatencyModes
+} LatencyMode_t;
+
+typedef struct
+{
+    uint32_t u32Approved;
+    uint32_t u32Unanswered;
+    uint32_t u32P50_us;
+    uint32_t u32P99_us;
+    uint32_t u32Max_us;
+} LatencyResult_t;
+
+static const char *const latency_mode_name[enTotalLatencyModes] = {"threads", "cyclic"};
+
+static AsiPeer_t latency_peer;
+
+static int latency_mkdir(const char *path)
+{
+    return ((mkdir(path, LATENCY_DIR_PERMISSIONS) != 0) && (errno != EEXIST)) ? -1 : 0;
+}
+
+/* Runs app in dir for measure_s with requests injected; 0 on success, 1 on a failed run, 2 on a setup error */
+static int latency_run(const char *app, const char *dir, uint32_t measure_s, const char *label, LatencyResult_t *result)
+{
+    uint32_t driven_ms;
+    uint32_t waited_ms = 0U;
+    int status = 0;
+    int outcome = 0;
+    pid_t pid;
+
+    if ((latency_mkdir(dir) != 0) || (chdir(dir) != 0) || (latency_mkdir("ASI_DATA") != 0) ||
+        (latency_mkdir("ASI_DATA/LOG") != 0) || (latency_mkdir("ASI_DATA/CONFIG") != 0) ||
+        (PEER_s32Open(&latency_peer) != 0))
+    {
+        (void)fprintf(stderr, "%s: %s\n", dir, strerror(errno));
+        return 2;
+    }
+    (void)unlink(CHILD_LOG_FILE_PATH);
+    (void)unlink(SLO_BASELINE_PATH); /* Each run is measured on its own */
+
+    pid = fork();
+    if (pid == 0)
+    {
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0)
+        {
+            (void)dup2(null_fd, STDOUT_FILENO);
+            (void)dup2(null_fd, STDERR_FILENO);
+            (void)close(null_fd);
+        }
+        (void)execl(app, app, (char *)NULL);
+        _exit(127);
+    }
+    if (pid < 0)
+    {
+        (void)fprintf(stderr, "fork: %s\n", strerror(errno));
+        PEER_vClose(&latency_peer);
+        return 2;
+    }
+    (void)printf("%s: %s for %u s, a request every %u ms\n", label, app, measure_s, LATENCY_REQUEST_PERIOD_MS);
+
+    PEER_vRun(&latency_peer, LATENCY_WARMUP_MS);
+    for (driven_ms = 0U; driven_ms < (measure_s * LATENCY_MS_PER_S); driven_ms += LATENCY_REQUEST_PERIOD_MS)
+    {
+        PEER_vSendMixRequest(&latency_peer, false);
+        PEER_vRun(&latency_peer, LATENCY_REQUEST_PERIOD_MS);
+    }
+    PEER_vRun(&latency_peer, LATENCY_SETTLE_MS);
+
+    (void)kill(pid, SIGTERM);
+    while ((waitpid(pid, &status, WNOHANG) != pid) && (waited_ms < LATENCY_STOP_TIMEOUT_MS))
+    {
+        PEER_vRun(&latency_peer, LATENCY_POLL_MS);
+        waited_ms += LATENCY_POLL_MS;
+    }
+    if (waited_ms >= LATENCY_STOP_TIMEOUT_MS)
+    {
+        (void)printf("%s: application still running %u ms after SIGTERM\n", label, LATENCY_STOP_TIMEOUT_MS);
+        (void)kill(pid, SIGKILL);
+        (void)waitpid(pid, &status, 0);
+        outcome = 1;
+    }
+
+    PEER_vReport(&latency_peer, label);
+    result->u32Approved = latency_peer.stStats.u32Approved;
+    result->u32Unanswered = latency_peer.stStats.u32Unanswered;
+    result->u32P50_us = PEER_u32Latency_us(&latency_peer, 50U);
+    result->u32P99_us = PEER_u32Latency_us(&latency_peer, 99U);
+    result->u32Max_us = PEER_u32Latency_us(&latency_peer, 100U);
+    PEER_vClose(&latency_peer);
+
+    return outcome;
+}
+
+int main(int argc, char *argv[])
+{
+    char app_path[enTotalLatencyModes][PATH_MAX];
+    char run_path[PATH_MAX];
+    char mode_dir[PATH_MAX + 16];
+    char label[32];
+    LatencyResult_t results[enTotalLatencyModes];
+    uint32_t measure_s = LATENCY_DEFAULT_S;
+    int result = 0;
+    uint32_t mode;
+
+    if (argc < 4)
+    {
+        (void)fprintf(stderr, "usage: %s <threads APP_ASI> <cyclic APP_ASI> <run directory> [seconds]\n", argv[0]);
+        return 2;
+    }
+    if (argc > 4)
+    {
+        measure_s = (uint32_t)strtoul(argv[4], NULL, 10);
+    }
+    for (mode = 0U; mode < (uint32_t)enTotalLatencyModes; mode++)
+    {
+        if (realpath(argv[1U + mode], app_path[mode]) == NULL)
+        {
+            (void)fprintf(stderr, "%s: %s\n", argv[1U + mode], strerror(errno));
+            return 2;
+        }
+    }
+    if ((latency_mkdir(argv[3]) != 0) || (realpath(argv[3], run_path) == NULL))
+    {
+        (void)fprintf(stderr, "%s: %s\n", argv[3], strerror(errno));
+        return 2;
+    }
+
+    (void)memset(results, 0, sizeof(results));
+    for (mode = 0U; mode < (uint32_t)enTotalLatencyModes; mode++)
+    {
+        int outcome;
+
+        (void)snprintf(mode_dir, sizeof(mode_dir), "%s/%s", run_path, latency_mode_name[mode]);
+        (void)snprintf(label, sizeof(label), "latency %s", latency_mode_name[mode]);
+        outcome = latency_run(app_path[mode], mode_dir, measure_s, label, &results[mode]);
+        if (outcome == 2)
+        {
+            return 2;
+        }
+        if (outcome != 0)
+        {
+            result = 1;
+        }
+    }
+
+    (void)printf("latency: mode     approved  p50 ms  p99 ms  max ms\n");
+    for (mode = 0U; mode < (uint32_t)enTotalLatencyModes; mode++)
+    {
+        (void)printf("latency: %-8s %8u %7.1f %7.1f %7.1f\n", latency_mode_name[mode], results[mode].u32Approved,
+                     (double)results[mode].u32P50_us / LATENCY_US_PER_MS, (double)results[mode].u32P99_us / LATENCY_US_PER_MS,
+                     (double)results[mode].u32Max_us / LATENCY_US_PER_MS);
+        if (results[mode].u32Approved == 0U)
+        {
+            (void)printf("latency: no action request approved in %s mode\n", latency_mode_name[mode]);
+            result = 1;
+        }
+        if (results[mode].u32Unanswered > 0U)
+        {
+            (void)printf("latency: %u action requests unanswered in %s mode\n", results[mode].u32Unanswered,
+                         latency_mode_name[mode]);
+            result = 1;
+        }
+    }
+
+    return result;
+}
@@ -19,6 +19,7 @@
  * 06/10/2024 | BL     | Initial Implementation
  * 08/13/2024 | BL     | SUD baseline 0.4
  * 11/07/2024 | TP     | MISRA & LHP compliance fixes
+ * 10/18/2026 | TP     | Incremental CRC over scattered frame segments
  * 
  */
 
@@ -67,7 +68,25 @@ static uint16_t ms_au16CrcTable[CRC_TABLE_SIZE] = { CRC_ZERO_INIT };
  */
 uint16_t CRC_u16CalculateCrc(const uint8_t* const pu8Data, const uint16_t u16Size)
 {
-    uint16_t u16CrcValue = CRC_INITIAL_VALUE;
+    return CRC_u16UpdateCrc((uint16_t)CRC_INITIAL_VALUE, pu8Data, u16Size);
+}
+
+/**
+ * @brief Continues a CRC-16 CCITT calculation over the next segment of data.
+ *
+ * Used for frames whose bytes are not contiguous in memory (header in the
+ * receive slot, long value in a payload pool block). Feeding the segments in
+ * order gives the same result as CRC_u16CalculateCrc over the whole frame.
+ *
+ * @param[in] u16Crc     CRC of the preceding segments (CRC_u16CalculateCrc result)
+ * @param[in] pu8Data    Pointer to the next segment (MSB first)
+ * @param[in] u16Size    Number of bytes to process
+ *
+ * @return uint16_t      CRC over all segments so far
+ */
+uint16_t CRC_u16UpdateCrc(uint16_t u16Crc, const uint8_t* const pu8Data, const uint16_t u16Size)
+{
+    uint16_t u16CrcValue = u16Crc;
     uint16_t u16Index = CRC_ZERO_INIT;
     uint16_t u16TableIndex;
     uint16_t u16TempValue;
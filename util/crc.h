@@ -19,6 +19,7 @@
  * 06/10/2024 | BL     | Initial Implementation
  * 08/13/2024 | BL     | SUD baseline 0.4
  * 11/07/2024 | TP     | MISRA & LHP compliance fixes
+ * 10/18/2026 | TP     | Incremental CRC over scattered frame segments
  * 
  */
 
@@ -35,6 +36,7 @@
 
 /*** Functions Provided to other modules ***/
 extern uint16_t CRC_u16CalculateCrc(const uint8_t* const pu8Data, const uint16_t u16Size);
+extern uint16_t CRC_u16UpdateCrc(uint16_t u16Crc, const uint8_t* const pu8Data, const uint16_t u16Size);
 extern void CRC_vCreateTable(void);
 
 #endif /* CRC_H */
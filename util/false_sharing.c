@@ -0,0 +1,256 @@
+/**
+* @file false_sharing.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief write tracker used to detect false sharing in the shared memory block
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+*
+*/
+
+/*** Include Files ***/
+#include "storage_handler.h"
+
+#include "false_sharing.h"
+
+#ifdef ITCOM_FALSE_SHARING_CHECK
+
+/*** Module Definitions ***/
+#define FS_ZERO_INIT_U            (0U)
+#define FS_FIELD_PREFIX           "->"          /* Report strips "pstSharedMemData->" */
+
+
+/*** Internal Types ***/
+/**
+ * @brief One (field, thread) pair seen writing a cache line
+ */
+typedef struct
+{
+    const char* pcField;                          /**< Stringified lvalue of the write */
+    const char* pcThread;                         /**< Name of the writing thread */
+    uint64_t u64Writes;                           /**< Number of noted writes */
+} FalseSharingWriter_t;
+
+/**
+ * @brief Writers recorded for one cache line
+ */
+typedef struct
+{
+    uint32_t u32Writers;
+    uint32_t u32Dropped;                          /**< Writers that did not fit */
+    FalseSharingWriter_t astWriters[FALSE_SHARING_MAX_WRITERS];
+} FalseSharingLine_t;
+
+
+/*** Local Function Prototypes ***/
+static const char* fs_pcShortName(const char* pcField);
+
+
+/*** External Variables ***/
+
+
+/*** Internal Variables ***/
+static pthread_mutex_t fs_stMutex = PTHREAD_MUTEX_INITIALIZER;
+static uintptr_t fs_uBase = FS_ZERO_INIT_U;
+static size_t fs_szSize = FS_ZERO_INIT_U;
+static FalseSharingLine_t fs_astLines[FALSE_SHARING_MAX_LINES];
+
+static __thread const char* fs_pcThreadName = "main";
+
+
+/*** External Functions ***/
+
+//*****************************************************************************
+// FUNCTION NAME : FalseSharing_vRegister
+//*****************************************************************************
+/**
+*
+* @brief Registers the memory block to watch and clears previous records.
+*
+* @param [in] pvBase Start of the block (cache line aligned, e.g. mmap result)
+* @param [in] szSize Size of the block in bytes
+*
+* @return none
+*/
+void FalseSharing_vRegister(const void* pvBase, size_t szSize)
+{
+    (void)pthread_mutex_lock(&fs_stMutex);
+    fs_uBase = (uintptr_t)pvBase;
+    fs_szSize = szSize;
+    (void)memset(fs_astLines, 0, sizeof(fs_astLines));
+    (void)pthread_mutex_unlock(&fs_stMutex);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : FalseSharing_vSetThreadName
+//*****************************************************************************
+/**
+*
+* @brief Names the calling thread in subsequent write records.
+*
+* @param [in] pcName Thread name, must stay valid for the process lifetime
+*
+* @return none
+*/
+void FalseSharing_vSetThreadName(const char* pcName)
+{
+    if (pcName != NULL)
+    {
+        fs_pcThreadName = pcName;
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : FalseSharing_vNoteWrite
+//*****************************************************************************
+/**
+*
+* @brief Records a write of the calling thread to every cache line covered
+*        by [pvAddr, pvAddr + szSize).
+*
+* @param [in] pvAddr Address written
+* @param [in] szSize Number of bytes written
+* @param [in] pcField Field name used in the report
+*
+* @return none
+*/
+void FalseSharing_vNoteWrite(const void* pvAddr, size_t szSize, const char* pcField)
+{
+    uintptr_t uAddr = (uintptr_t)pvAddr;
+    size_t szFirst;
+    size_t szLast;
+    size_t szLine;
+    uint32_t u32W;
+
+    if ((fs_szSize == FS_ZERO_INIT_U) || (szSize == FS_ZERO_INIT_U) ||
+        (uAddr < fs_uBase) || ((uAddr + szSize) > (fs_uBase + fs_szSize)))
+    {
+        return;
+    }
+
+    szFirst = (uAddr - fs_uBase) / FALSE_SHARING_CACHE_LINE_SIZE;
+    szLast = ((uAddr + szSize - 1U) - fs_uBase) / FALSE_SHARING_CACHE_LINE_SIZE;
+
+    (void)pthread_mutex_lock(&fs_stMutex);
+    for (szLine = szFirst; (szLine <= szLast) && (szLine < FALSE_SHARING_MAX_LINES); szLine++)
+    {
+        FalseSharingLine_t* pstLine = &fs_astLines[szLine];
+
+        for (u32W = FS_ZERO_INIT_U; u32W < pstLine->u32Writers; u32W++)
+        {
+            if (((pstLine->astWriters[u32W].pcField == pcField) ||
+                 (strcmp(pstLine->astWriters[u32W].pcField, pcField) == 0)) &&
+                (pstLine->astWriters[u32W].pcThread == fs_pcThreadName))
+            {
+                break;
+            }
+        }
+
+        if (u32W < pstLine->u32Writers)
+        {
+            pstLine->astWriters[u32W].u64Writes++;
+        }
+        else if (pstLine->u32Writers < FALSE_SHARING_MAX_WRITERS)
+        {
+            pstLine->astWriters[u32W].pcField = pcField;
+            pstLine->astWriters[u32W].pcThread = fs_pcThreadName;
+            pstLine->astWriters[u32W].u64Writes = 1U;
+            pstLine->u32Writers++;
+        }
+        else
+        {
+            pstLine->u32Dropped++;
+        }
+    }
+    (void)pthread_mutex_unlock(&fs_stMutex);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : FalseSharing_vReport
+//*****************************************************************************
+/**
+*
+* @brief Writes every cache line on which two different fields were written
+*        by two different threads, one line per offending pair.
+*
+* @param [in] pFile Log file the report is written to
+*
+* @return none
+*/
+void FalseSharing_vReport(FILE* pFile)
+{
+    uint32_t u32Line;
+    uint32_t u32A;
+    uint32_t u32B;
+    uint32_t u32Pairs = FS_ZERO_INIT_U;
+
+    (void)pthread_mutex_lock(&fs_stMutex);
+    for (u32Line = FS_ZERO_INIT_U; u32Line < FALSE_SHARING_MAX_LINES; u32Line++)
+    {
+        const FalseSharingLine_t* pstLine = &fs_astLines[u32Line];
+
+        for (u32A = FS_ZERO_INIT_U; u32A < pstLine->u32Writers; u32A++)
+        {
+            for (u32B = u32A + 1U; u32B < pstLine->u32Writers; u32B++)
+            {
+                const FalseSharingWriter_t* pstA = &pstLine->astWriters[u32A];
+                const FalseSharingWriter_t* pstB = &pstLine->astWriters[u32B];
+
+                if ((strcmp(pstA->pcField, pstB->pcField) != 0) &&
+                    (strcmp(pstA->pcThread, pstB->pcThread) != 0))
+                {
+                    log_message(pFile, LOG_WARNING,
+                                "False sharing line %u (+0x%05x): %s [%s, %lu writes] <-> %s [%s, %lu writes]",
+                                u32Line, u32Line * FALSE_SHARING_CACHE_LINE_SIZE,
+                                fs_pcShortName(pstA->pcField), pstA->pcThread, (unsigned long)pstA->u64Writes,
+                                fs_pcShortName(pstB->pcField), pstB->pcThread, (unsigned long)pstB->u64Writes);
+                    u32Pairs++;
+                }
+            }
+        }
+
+        if (pstLine->u32Dropped > FS_ZERO_INIT_U)
+        {
+            log_message(pFile, LOG_INFO, "False sharing line %u: %u writers not tracked (table full)",
+                        u32Line, pstLine->u32Dropped);
+        }
+    }
+    (void)pthread_mutex_unlock(&fs_stMutex);
+
+    log_message(pFile, LOG_INFO, "False sharing check: %u field pairs written by different threads share a cache line",
+                u32Pairs);
+}
+
+
+/*** Local Function Implementations ***/
+
+//*****************************************************************************
+// FUNCTION NAME : fs_pcShortName
+//*****************************************************************************
+/**
+*
+* @brief Drops the base pointer part of a stringified lvalue
+*        ("&pstSharedMemData->stThread_FM.mutex" -> "stThread_FM.mutex").
+*
+* @param [in] pcField Stringified lvalue
+*
+* @return Pointer into pcField
+*/
+static const char* fs_pcShortName(const char* pcField)
+{
+    const char* pcArrow = strstr(pcField, FS_FIELD_PREFIX);
+
+    return (pcArrow != NULL) ? (pcArrow + strlen(FS_FIELD_PREFIX)) : pcField;
+}
+
+#endif /* ITCOM_FALSE_SHARING_CHECK */
@@ -0,0 +1,80 @@
+/**
+* @file false_sharing.h
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief write tracker used to detect false sharing in the shared memory block
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+*
+*/
+
+#ifndef FALSE_SHARING_H
+#define FALSE_SHARING_H
+
+/*** Include Files ***/
+#include "gen_std_types.h"
+
+/*** Definitions Provided to other modules ***/
+/**
+ * @def FALSE_SHARING_CACHE_LINE_SIZE
+ * @brief Cache line size assumed by the detector and the layout report.
+ */
+#define FALSE_SHARING_CACHE_LINE_SIZE    (64U)
+
+/**
+ * @def FALSE_SHARING_MAX_LINES
+ * @brief Number of cache lines tracked from the registered base (64KB).
+ */
+#define FALSE_SHARING_MAX_LINES          (1024U)
+
+/**
+ * @def FALSE_SHARING_MAX_WRITERS
+ * @brief Distinct (field, thread) writers remembered per cache line.
+ */
+#define FALSE_SHARING_MAX_WRITERS        (8U)
+
+/**
+ * @brief Write tracking entry points used by ITCOM.
+ *
+ * When ITCOM_FALSE_SHARING_CHECK is defined (make FALSE_SHARING=1) every
+ * noted write records which thread wrote which field into the cache line(s)
+ * the field occupies. The report lists lines where different fields are
+ * written by different threads. In production builds the macros are no-ops.
+ */
+#ifdef ITCOM_FALSE_SHARING_CHECK
+#define FALSE_SHARING_REGISTER(pBase, szSize)   FalseSharing_vRegister((pBase), (szSize))
+#define FALSE_SHARING_SET_THREAD(pcName)        FalseSharing_vSetThreadName((pcName))
+#define FALSE_SHARING_NOTE_WRITE(lvalue)        FalseSharing_vNoteWrite(&(lvalue), sizeof(lvalue), #lvalue)
+#define FALSE_SHARING_NOTE_OBJECT(pObj, szSize, pcName)  FalseSharing_vNoteWrite((pObj), (szSize), (pcName))
+#define FALSE_SHARING_REPORT(pFile)             FalseSharing_vReport((pFile))
+#else
+#define FALSE_SHARING_REGISTER(pBase, szSize)   ((void)0)
+#define FALSE_SHARING_SET_THREAD(pcName)        ((void)0)
+#define FALSE_SHARING_NOTE_WRITE(lvalue)        ((void)0)
+#define FALSE_SHARING_NOTE_OBJECT(pObj, szSize, pcName)  ((void)0)
+#define FALSE_SHARING_REPORT(pFile)             ((void)(pFile))
+#endif
+
+/*** Type Definitions ***/
+
+/*** Functions Provided to other modules ***/
+#ifdef ITCOM_FALSE_SHARING_CHECK
+extern void FalseSharing_vRegister(const void* pvBase, size_t szSize);
+extern void FalseSharing_vSetThreadName(const char* pcName);
+extern void FalseSharing_vNoteWrite(const void* pvAddr, size_t szSize, const char* pcField);
+extern void FalseSharing_vReport(FILE* pFile);
+#endif
+
+/*** Variables Provided to other modules ***/
+
+#endif /* FALSE_SHARING_H */
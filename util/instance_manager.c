@@ -15,6 +15,7 @@
 * ----------|---|-----------
 * 08/08/2024|AT |Initial
 * 09/22/2024|TP |Instance Manager Refactored
+* 10/18/2026|TP |Element storage supplied by the caller, capacity set at runtime
 *
 */
 //*****************************************************************************
@@ -61,6 +62,8 @@
  *
  * @param[out] cb Pointer to the stIMBuffer structure to be initialized.
  *                If NULL, the function returns without performing any operation.
+ * @param[in] pu8Buffer Element storage of at least capacity * elementSize bytes,
+ *                      zeroed here. If NULL, the function returns without initialization.
  * @param[in] elementSize Size of each element in the buffer, in bytes.
  *                        Must be non-zero, or the function will return without initialization.
  * @param[in] capacity Desired capacity of the buffer (number of elements).
@@ -72,16 +75,16 @@
  *       ensure the buffer capacity is within acceptable limits.
  *
  * @warning This function does not allocate memory for the buffer data.
- *          It only initializes the buffer control structure.
+ *          The caller sizes pu8Buffer for the clamped capacity.
  *
  * @return void This function does not return a value.
  *              It operates directly on the provided buffer structure.
  */
-void InstanceManager_vInitialize(stIMBuffer *cb, size_t elementSize, uint16_t capacity) {
+void InstanceManager_vInitialize(stIMBuffer *cb, uint8_t *pu8Buffer, size_t elementSize, uint16_t capacity) {
     uint8_t proceed = IM_INIT_TRUE;
     uint16_t safeCapacity = IM_ZERO;
 
-    if (!cb || elementSize == IM_ZERO) {
+    if (!cb || !pu8Buffer || elementSize == IM_ZERO) {
         proceed = IM_INIT_FALSE;
     }
 
@@ -91,6 +94,8 @@ void InstanceManager_vInitialize(stIMBuffer *cb, size_t elementSize, uint16_t ca
                       capacity;
 
         (void)memset(cb, IM_ZERO, sizeof(*cb));
+        (void)memset(pu8Buffer, IM_ZERO, (size_t)safeCapacity * elementSize);
+        cb->pu8_Buffer = pu8Buffer;
         cb->sz_ElementSize = elementSize;
         cb->u16Capacity = safeCapacity;
     }
@@ -153,7 +158,7 @@ void InstanceManager_vAddElement(stIMBuffer *cb, const_generic_ptr_t element) {
         
         /* Copy element to buffer */
         tempCalc = (uint32_t)insertIndex * (uint32_t)elementSize;
-        (void)memcpy(&cb->au8_Buffer[tempCalc], element, elementSize);
+        (void)memcpy(&cb->pu8_Buffer[tempCalc], element, elementSize);
         
         /* Update tail */
         tempCalc = (uint32_t)insertIndex + (uint32_t)IM_INCREMENT;
@@ -213,7 +218,7 @@ int16_t InstanceManager_s8FindElement(const stIMBuffer *cb, const_generic_ptr_t
             const uint8_t *currentElement;
             
             tempCalc = (uint32_t)index * (uint32_t)elementSize;
-            currentElement = &cb->au8_Buffer[tempCalc];
+            currentElement = &cb->pu8_Buffer[tempCalc];
 
             if (IM_ZERO == compareFunc(currentElement, criteria)) {
                 if (NULL != result) {
@@ -283,7 +288,7 @@ void InstanceManager_vUpdateElement(stIMBuffer *cb, uint16_t index, const_generi
         (void)memcpy(tempBuffer, 
                     newElement, 
                     (elementSize <= MAX_ELEMENT_SIZE) ? elementSize : MAX_ELEMENT_SIZE);
-        (void)memcpy(&cb->au8_Buffer[tempCalc], tempBuffer, elementSize);
+        (void)memcpy(&cb->pu8_Buffer[tempCalc], tempBuffer, elementSize);
     }
 }
 
@@ -322,7 +327,7 @@ void InstanceManager_vUpdateElement(stIMBuffer *cb, uint16_t index, const_generi
  *       overlapping memory regions that may occur due to the circular nature of the buffer.
  *
  * @warning This function does not perform any bounds checking on the buffer itself.
- *          It assumes that cb->au8_Buffer is large enough to hold cb->u16Capacity elements.
+ *          It assumes that cb->pu8_Buffer is large enough to hold cb->u16Capacity elements.
  *
  * Algorithm:
  * 1. Validate input parameters (cb, index, and buffer state).
@@ -343,7 +348,7 @@ void InstanceManager_vRemoveElement(stIMBuffer *cb, uint16_t index) {
     uint8_t proceed = IM_INIT_TRUE;
     size_t elementSize;
     uint32_t tempCalc;
-    uint8_t u8i;
+    uint16_t u16i;
     
     if (NULL == cb) {
         proceed = IM_INIT_FALSE;
@@ -356,10 +361,10 @@ void InstanceManager_vRemoveElement(stIMBuffer *cb, uint16_t index) {
 
     if (proceed == IM_INIT_TRUE) {
         // Shift elements back by one to fill the gap
-        for(u8i = index; u8i < cb->u16Count -1; u8i++) {
-            uint16_t src = (cb->u16Head + u8i +1) % cb->u16Capacity;
-            uint16_t dest = (cb->u16Head + u8i) % cb->u16Capacity;
-            (void)memcpy(&cb->au8_Buffer[dest * elementSize], &cb->au8_Buffer[src * elementSize], elementSize);
+        for(u16i = index; u16i < cb->u16Count -1; u16i++) {
+            uint16_t src = (cb->u16Head + u16i +1) % cb->u16Capacity;
+            uint16_t dest = (cb->u16Head + u16i) % cb->u16Capacity;
+            (void)memcpy(&cb->pu8_Buffer[dest * elementSize], &cb->pu8_Buffer[src * elementSize], elementSize);
         }
 
         // Update tail pointer
@@ -367,6 +372,6 @@ void InstanceManager_vRemoveElement(stIMBuffer *cb, uint16_t index) {
         cb->u16Tail = (uint16_t)tempCalc;
         tempCalc = (uint32_t)cb->u16Count - (uint32_t)IM_DECREMENT;
         cb->u16Count = (uint16_t)tempCalc;
-        (void)memset(&cb->au8_Buffer[cb->u16Tail * cb->sz_ElementSize], IM_ZERO, cb->sz_ElementSize);
+        (void)memset(&cb->pu8_Buffer[cb->u16Tail * cb->sz_ElementSize], IM_ZERO, cb->sz_ElementSize);
     }
 }
@@ -16,6 +16,7 @@
 * ----------|---|-----------
 * 08/08/2024|AT |Initial
 * 09/22/2024|TP |Instance Manager Refactored
+* 10/18/2026|TP |Element storage supplied by the caller, capacity set at runtime
 *
 */
 //*****************************************************************************
@@ -28,16 +29,16 @@
 
 
 /*** Definitions Provided to other modules ***/
-#define MAX_BUFFER_CAPACITY 50
+#define MAX_BUFFER_CAPACITY 255
 #define MIN_BUFFER_CAPACITY 1    // Arbitrary minimum buffer capacity chosen
-#define MAX_ELEMENT_SIZE 16
+#define MAX_ELEMENT_SIZE 32
 
 #define REMOVE_ELEMENT			(0)
 #define UPDATE_ELEMENT			(1)
 #define ADD_ELEMENT				(2)
 
 typedef struct {
-    uint8_t  au8_Buffer[MAX_BUFFER_CAPACITY * MAX_ELEMENT_SIZE];  /* Fixed-size buffer array */
+    uint8_t* pu8_Buffer;            /* Caller storage of u16Capacity * sz_ElementSize bytes */
     size_t   sz_ElementSize;        /* Size of each element in the buffer */
     uint16_t u16Head;               /* Start of valid data */
     uint16_t u16Tail;               /* End of valid data */
@@ -56,7 +57,7 @@ typedef uint8_t (*ElementCompareFn)(const_generic_ptr_t element1, const_generic_
 
 /*** External Functions ***/
 
-extern void InstanceManager_vInitialize(stIMBuffer *cb, size_t elementSize, uint16_t capacity);
+extern void InstanceManager_vInitialize(stIMBuffer *cb, uint8_t *pu8Buffer, size_t elementSize, uint16_t capacity);
 extern void InstanceManager_vAddElement(stIMBuffer *cb, const_generic_ptr_t element);
 extern int16_t InstanceManager_s8FindElement(const stIMBuffer *cb, const_generic_ptr_t criteria, ElementCompareFn compareFunc, generic_ptr_t result);
 extern void InstanceManager_vUpdateElement(stIMBuffer *cb, uint16_t index, const_generic_ptr_t newElement);
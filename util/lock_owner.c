@@ -0,0 +1,182 @@
+/**
+* @file lock_owner.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief tracking of the ITCOM locks held by the calling thread
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, held lock count moved out of the lock profiler
+* 10/18/2026|TP |Robust mutexes: a lock left by a dead owner is made consistent and taken over
+* 10/18/2026|TP |Depth of log_message calls, which hold libc internal locks
+*
+*/
+
+/*** Include Files ***/
+#include <signal.h>
+#include "lock_owner.h"
+
+/*** Module Definitions ***/
+#define LO_ZERO_INIT_U            (0U)
+
+
+/*** Internal Variables ***/
+/* Mutexes the calling thread took through LOCK_OWNER_MUTEX_LOCK and has not released yet */
+static __thread uint32_t lo_u32Held = LO_ZERO_INIT_U;
+/* Locks this process took over from an owner that died holding them */
+static uint32_t lo_u32DeadOwners = LO_ZERO_INIT_U;
+/* Nesting of code that may hold libc internal locks (log_message), read by the fault handler */
+static __thread volatile sig_atomic_t lo_s32LibcDepth = 0;
+
+
+/*** External Functions ***/
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_s32NoteLocked
+//*****************************************************************************
+/**
+*
+* @brief Counts a mutex as held by the calling thread if it was acquired.
+*
+* @details EOWNERDEAD means the lock was acquired but its previous owner
+*          died holding it. The data behind it may be half updated; it is
+*          taken over as it is (the restarted child reloads its data from
+*          storage anyway) and the mutex is marked consistent, so that it
+*          stays usable.
+*
+* @param [in] pstMutex Mutex just locked
+* @param [in] s32LockResult Result of the lock call
+*
+* @return s32LockResult, 0 for a lock taken over from a dead owner
+*/
+int LockOwner_s32NoteLocked(pthread_mutex_t* pstMutex, int s32LockResult)
+{
+    if (s32LockResult == EOWNERDEAD)
+    {
+        s32LockResult = pthread_mutex_consistent(pstMutex);
+        if (s32LockResult == 0)
+        {
+            (void)__atomic_fetch_add(&lo_u32DeadOwners, 1U, __ATOMIC_RELAXED);
+        }
+        else
+        {
+            (void)pthread_mutex_unlock(pstMutex);
+        }
+    }
+    if (s32LockResult == 0)
+    {
+        lo_u32Held++;
+    }
+
+    return s32LockResult;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_vNoteReleased
+//*****************************************************************************
+/**
+*
+* @brief Stops counting a mutex about to be unlocked as held by the calling
+*        thread.
+*
+* @param [in] pstMutex Mutex about to be unlocked
+*
+* @return none
+*/
+void LockOwner_vNoteReleased(const pthread_mutex_t* pstMutex)
+{
+    (void)pstMutex;
+    if (lo_u32Held > LO_ZERO_INIT_U)
+    {
+        lo_u32Held--;
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_u32HeldCount
+//*****************************************************************************
+/**
+*
+* @brief Returns the number of locks the calling thread holds.
+*
+* @return Locks held
+*/
+uint32_t LockOwner_u32HeldCount(void)
+{
+    return lo_u32Held;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_u32DeadOwnerCount
+//*****************************************************************************
+/**
+*
+* @brief Returns the number of locks this process took over from an owner
+*        that died holding them.
+*
+* @return Locks taken over
+*/
+uint32_t LockOwner_u32DeadOwnerCount(void)
+{
+    return __atomic_load_n(&lo_u32DeadOwners, __ATOMIC_RELAXED);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_vEnterLibc
+//*****************************************************************************
+/**
+*
+* @brief Marks the start of code that may hold locks internal to libc: the
+*        stdio stream lock, the time zone lock of localtime_r, the malloc
+*        arena lock of vsnprintf. They are not visible to the mutex tracking,
+*        a fault raised while one is held must not be recovered in place
+*        either (recover_faulted_thread).
+*
+* @return none
+*/
+void LockOwner_vEnterLibc(void)
+{
+    lo_s32LibcDepth = lo_s32LibcDepth + 1;
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_vLeaveLibc
+//*****************************************************************************
+/**
+*
+* @brief Marks the end of code entered with LockOwner_vEnterLibc.
+*
+* @return none
+*/
+void LockOwner_vLeaveLibc(void)
+{
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    if (lo_s32LibcDepth > 0)
+    {
+        lo_s32LibcDepth = lo_s32LibcDepth - 1;
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockOwner_u32LibcDepth
+//*****************************************************************************
+/**
+*
+* @brief Returns how deep the calling thread is in code entered with
+*        LockOwner_vEnterLibc. Async-signal-safe.
+*
+* @return Nesting depth, 0 outside such code
+*/
+uint32_t LockOwner_u32LibcDepth(void)
+{
+    return (uint32_t)lo_s32LibcDepth;
+}
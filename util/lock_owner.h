@@ -0,0 +1,60 @@
+/**
+* @file lock_owner.h
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief tracking of the ITCOM locks held by the calling thread
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial, held lock count moved out of the lock profiler
+* 10/18/2026|TP |Robust mutexes: a lock left by a dead owner is made consistent and taken over
+* 10/18/2026|TP |Depth of log_message calls, which hold libc internal locks
+*
+*/
+
+#ifndef LOCK_OWNER_H
+#define LOCK_OWNER_H
+
+/*** Include Files ***/
+#include "gen_std_types.h"
+#include "lock_profiler.h"
+
+/*** Definitions Provided to other modules ***/
+/**
+ * @brief Lock/unlock entry points used by ITCOM.
+ *
+ * Present in every build: the locks held by the calling thread are counted,
+ * so that a fault raised while one is held is not recovered in place
+ * (LockOwner_u32HeldCount, see recover_faulted_thread). The lock call itself
+ * is the profiled one under ITCOM_LOCK_PROFILING and pthread_mutex_lock
+ * otherwise (LOCK_PROFILER_LOCK).
+ *
+ * The ITCOM mutexes are robust (init_mutexes_and_sems): a lock call that
+ * finds the owner dead (EOWNERDEAD, a child killed or exited on a fault with
+ * the lock held) marks the mutex consistent and returns 0 with the lock held.
+ */
+#define LOCK_OWNER_MUTEX_LOCK(pMutex)     (LOCK_PROFILER_NOTE_MUTEX(pMutex), LockOwner_s32NoteLocked((pMutex), LOCK_PROFILER_LOCK(pMutex)))
+#define LOCK_OWNER_MUTEX_UNLOCK(pMutex)   (LockOwner_vNoteReleased((pMutex)), LOCK_PROFILER_UNLOCK(pMutex))
+
+/*** Type Definitions ***/
+
+/*** Functions Provided to other modules ***/
+extern int LockOwner_s32NoteLocked(pthread_mutex_t* pstMutex, int s32LockResult);
+extern void LockOwner_vNoteReleased(const pthread_mutex_t* pstMutex);
+extern uint32_t LockOwner_u32HeldCount(void);
+extern uint32_t LockOwner_u32DeadOwnerCount(void);
+extern void LockOwner_vEnterLibc(void);
+extern void LockOwner_vLeaveLibc(void);
+extern uint32_t LockOwner_u32LibcDepth(void);
+
+/*** Variables Provided to other modules ***/
+
+#endif /* LOCK_OWNER_H */
@@ -0,0 +1,436 @@
+/**
+* @file lock_profiler.c
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief instrumented mutex wrapper used to profile lock contention
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+* 10/18/2026|TP |Per-thread lock operation counter
+* 10/18/2026|TP |Locks held by the calling thread tracked in every build
+* 10/18/2026|TP |Held locks only counted, a faulted thread holding one is not recovered in place
+* 10/18/2026|TP |Held lock count moved to lock_owner, nothing compiled without ITCOM_LOCK_PROFILING
+* 10/18/2026|TP |A lock taken over from a dead owner (EOWNERDEAD) is profiled as acquired
+*
+*/
+
+/*** Include Files ***/
+#include "storage_handler.h"
+
+#include "lock_profiler.h"
+
+#ifdef ITCOM_LOCK_PROFILING
+
+/*** Module Definitions ***/
+#define LP_ZERO_INIT_U            (0U)
+#define LP_MAX_NESTING            (4U)          /* Locks one thread may hold at once */
+#define LP_SEC_TO_NSEC            (1000000000ULL)
+#define LP_NSEC_TO_USEC           (1000ULL)
+#define LP_HASH_SHIFT             (4U)          /* Drop alignment bits of the site pointer */
+
+
+/*** Internal Types ***/
+/**
+ * @brief Statistics gathered for one lock call site
+ */
+typedef struct
+{
+    const char* pcSite;                                 /**< Function name owning the call site */
+    uint64_t u64Acquisitions;                           /**< Total successful acquisitions */
+    uint64_t u64Contended;                              /**< Acquisitions that had to block */
+    uint64_t u64WaitNsTotal;                            /**< Sum of wait time in ns */
+    uint64_t u64HoldNsTotal;                            /**< Sum of hold time in ns */
+    uint64_t u64WaitNsMax;                              /**< Worst wait time in ns */
+    uint64_t u64HoldNsMax;                              /**< Worst hold time in ns */
+    uint64_t u64LogWhileHeld;                           /**< log_message calls made under this lock */
+    uint64_t au64WaitHist[LOCK_PROFILER_HIST_BUCKETS];  /**< log2(us) wait histogram */
+    uint64_t au64HoldHist[LOCK_PROFILER_HIST_BUCKETS];  /**< log2(us) hold histogram */
+} LockSiteStats_t;
+
+/**
+ * @brief One entry of the per-thread stack of held locks
+ */
+typedef struct
+{
+    pthread_mutex_t* pstMutex;
+    LockSiteStats_t* pstSite;
+    uint64_t u64AcquiredNs;
+} LockHeldEntry_t;
+
+
+/*** Local Function Prototypes ***/
+static uint64_t lp_u64NowNs(void);
+static uint32_t lp_u32Bucket(uint64_t u64Ns);
+static LockSiteStats_t* lp_pstFindSite(const char* pcSite);
+static void lp_vUpdateMax(uint64_t* pu64Max, uint64_t u64Value);
+
+
+/*** External Variables ***/
+
+
+/*** Internal Variables ***/
+static LockSiteStats_t lp_astSites[LOCK_PROFILER_MAX_SITES];
+static uint64_t lp_u64DroppedSites = LP_ZERO_INIT_U;
+
+static __thread LockHeldEntry_t lp_astHeld[LP_MAX_NESTING];
+static __thread uint32_t lp_u32HeldDepth = LP_ZERO_INIT_U;
+static __thread uint64_t lp_u64ThreadLockOps = LP_ZERO_INIT_U;
+
+
+/*** External Functions ***/
+
+//*****************************************************************************
+// FUNCTION NAME : LockProfiler_s32Lock
+//*****************************************************************************
+/**
+*
+* @brief Acquires a mutex and records acquisition, contention and wait time.
+*
+* @details A trylock is attempted first so uncontended acquisitions are
+*          cheap to classify. On EBUSY the call blocks on the mutex and the
+*          acquisition is counted as contended.
+*
+* @param [in] pstMutex Mutex to acquire
+* @param [in] pcSite Call site tag (function name of the caller)
+*
+* @return Same value pthread_mutex_lock would return, EOWNERDEAD included
+*/
+int LockProfiler_s32Lock(pthread_mutex_t* pstMutex, const char* pcSite)
+{
+    LockSiteStats_t* pstSite = lp_pstFindSite(pcSite);
+    uint64_t u64Start = lp_u64NowNs();
+    uint8_t u8Contended = FALSE;
+    uint64_t u64Acquired;
+    uint64_t u64Wait;
+    int s32Ret;
+
+    s32Ret = pthread_mutex_trylock(pstMutex);
+    if (s32Ret == EBUSY)
+    {
+        u8Contended = TRUE;
+        s32Ret = pthread_mutex_lock(pstMutex);
+    }
+
+    if ((s32Ret == 0) || (s32Ret == EOWNERDEAD))
+    {
+        u64Acquired = lp_u64NowNs();
+        u64Wait = u64Acquired - u64Start;
+        lp_u64ThreadLockOps++;
+
+        if (pstSite != NULL)
+        {
+            (void)__atomic_fetch_add(&pstSite->u64Acquisitions, 1U, __ATOMIC_RELAXED);
+            if (u8Contended == TRUE)
+            {
+                (void)__atomic_fetch_add(&pstSite->u64Contended, 1U, __ATOMIC_RELAXED);
+            }
+            (void)__atomic_fetch_add(&pstSite->u64WaitNsTotal, u64Wait, __ATOMIC_RELAXED);
+            (void)__atomic_fetch_add(&pstSite->au64WaitHist[lp_u32Bucket(u64Wait)], 1U, __ATOMIC_RELAXED);
+            lp_vUpdateMax(&pstSite->u64WaitNsMax, u64Wait);
+        }
+
+        if (lp_u32HeldDepth < LP_MAX_NESTING)
+        {
+            lp_astHeld[lp_u32HeldDepth].pstMutex = pstMutex;
+            lp_astHeld[lp_u32HeldDepth].pstSite = pstSite;
+            lp_astHeld[lp_u32HeldDepth].u64AcquiredNs = u64Acquired;
+        }
+        lp_u32HeldDepth++;
+    }
+
+    return s32Ret;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockProfiler_s32Unlock
+//*****************************************************************************
+/**
+*
+* @brief Releases a mutex taken through LockProfiler_s32Lock and records
+*        how long it was held.
+*
+* @param [in] pstMutex Mutex to release
+*
+* @return Same value pthread_mutex_unlock would return
+*/
+int LockProfiler_s32Unlock(pthread_mutex_t* pstMutex)
+{
+    uint64_t u64Hold;
+    uint32_t u32Idx;
+
+    if (lp_u32HeldDepth > LP_ZERO_INIT_U)
+    {
+        lp_u32HeldDepth--;
+        u32Idx = lp_u32HeldDepth;
+        if ((u32Idx < LP_MAX_NESTING) &&
+            (lp_astHeld[u32Idx].pstMutex == pstMutex) &&
+            (lp_astHeld[u32Idx].pstSite != NULL))
+        {
+            u64Hold = lp_u64NowNs() - lp_astHeld[u32Idx].u64AcquiredNs;
+            (void)__atomic_fetch_add(&lp_astHeld[u32Idx].pstSite->u64HoldNsTotal, u64Hold, __ATOMIC_RELAXED);
+            (void)__atomic_fetch_add(&lp_astHeld[u32Idx].pstSite->au64HoldHist[lp_u32Bucket(u64Hold)], 1U, __ATOMIC_RELAXED);
+            lp_vUpdateMax(&lp_astHeld[u32Idx].pstSite->u64HoldNsMax, u64Hold);
+        }
+    }
+
+    return pthread_mutex_unlock(pstMutex);
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockProfiler_vNoteLogCall
+//*****************************************************************************
+/**
+*
+* @brief Called from log_message; charges the log call to the innermost lock
+*        currently held by the calling thread, if any.
+*
+* @return none
+*/
+void LockProfiler_vNoteLogCall(void)
+{
+    uint32_t u32Idx;
+
+    if (lp_u32HeldDepth > LP_ZERO_INIT_U)
+    {
+        u32Idx = lp_u32HeldDepth - 1U;
+        if ((u32Idx < LP_MAX_NESTING) && (lp_astHeld[u32Idx].pstSite != NULL))
+        {
+            (void)__atomic_fetch_add(&lp_astHeld[u32Idx].pstSite->u64LogWhileHeld, 1U, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockProfiler_u64GetThreadLockOps
+//*****************************************************************************
+/**
+*
+* @brief Returns the number of profiled lock acquisitions made by the calling
+*        thread. The difference of two reads gives the lock operations of the
+*        code in between (e.g. per received message).
+*
+* @return Acquisitions made by the calling thread since it started
+*/
+uint64_t LockProfiler_u64GetThreadLockOps(void)
+{
+    return lp_u64ThreadLockOps;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : LockProfiler_vReport
+//*****************************************************************************
+/**
+*
+* @brief Writes the collected statistics, call sites ranked by total wait time.
+*
+* @param [in] pFile Log file the report is written to
+*
+* @return none
+*/
+void LockProfiler_vReport(FILE* pFile)
+{
+    LockSiteStats_t* apstRanked[LOCK_PROFILER_MAX_SITES];
+    LockSiteStats_t* pstTmp;
+    uint32_t u32Count = LP_ZERO_INIT_U;
+    uint32_t u32I;
+    uint32_t u32J;
+    uint32_t u32B;
+    char acWaitHist[LOCK_PROFILER_HIST_BUCKETS * 12U];
+    char acHoldHist[LOCK_PROFILER_HIST_BUCKETS * 12U];
+    int s32Len;
+    int s32Off;
+
+    for (u32I = LP_ZERO_INIT_U; u32I < LOCK_PROFILER_MAX_SITES; u32I++)
+    {
+        if (__atomic_load_n(&lp_astSites[u32I].pcSite, __ATOMIC_ACQUIRE) != NULL)
+        {
+            apstRanked[u32Count] = &lp_astSites[u32I];
+            u32Count++;
+        }
+    }
+
+    /* Insertion sort, descending by total wait time */
+    for (u32I = 1U; u32I < u32Count; u32I++)
+    {
+        pstTmp = apstRanked[u32I];
+        u32J = u32I;
+        while ((u32J > LP_ZERO_INIT_U) && (apstRanked[u32J - 1U]->u64WaitNsTotal < pstTmp->u64WaitNsTotal))
+        {
+            apstRanked[u32J] = apstRanked[u32J - 1U];
+            u32J--;
+        }
+        apstRanked[u32J] = pstTmp;
+    }
+
+    log_message(pFile, LOG_INFO, "Lock profile: %u call sites (dropped %lu), ranked by total wait",
+                u32Count, (unsigned long)lp_u64DroppedSites);
+
+    for (u32I = LP_ZERO_INIT_U; u32I < u32Count; u32I++)
+    {
+        pstTmp = apstRanked[u32I];
+        s32Off = 0;
+        for (u32B = LP_ZERO_INIT_U; u32B < LOCK_PROFILER_HIST_BUCKETS; u32B++)
+        {
+            s32Len = snprintf(&acWaitHist[s32Off], sizeof(acWaitHist) - (size_t)s32Off, "%s%lu",
+                              (u32B == LP_ZERO_INIT_U) ? "" : ",", (unsigned long)pstTmp->au64WaitHist[u32B]);
+            if ((s32Len < 0) || ((size_t)(s32Off + s32Len) >= sizeof(acWaitHist)))
+            {
+                break;
+            }
+            s32Off += s32Len;
+        }
+        s32Off = 0;
+        for (u32B = LP_ZERO_INIT_U; u32B < LOCK_PROFILER_HIST_BUCKETS; u32B++)
+        {
+            s32Len = snprintf(&acHoldHist[s32Off], sizeof(acHoldHist) - (size_t)s32Off, "%s%lu",
+                              (u32B == LP_ZERO_INIT_U) ? "" : ",", (unsigned long)pstTmp->au64HoldHist[u32B]);
+            if ((s32Len < 0) || ((size_t)(s32Off + s32Len) >= sizeof(acHoldHist)))
+            {
+                break;
+            }
+            s32Off += s32Len;
+        }
+
+        log_message(pFile, LOG_INFO,
+                    "#%u %s: acq=%lu contended=%lu wait_total=%luus wait_max=%luus "
+                    "hold_total=%luus hold_max=%luus log_while_held=%lu wait_hist_log2us=[%s] hold_hist_log2us=[%s]",
+                    u32I + 1U, pstTmp->pcSite,
+                    (unsigned long)pstTmp->u64Acquisitions,
+                    (unsigned long)pstTmp->u64Contended,
+                    (unsigned long)(pstTmp->u64WaitNsTotal / LP_NSEC_TO_USEC),
+                    (unsigned long)(pstTmp->u64WaitNsMax / LP_NSEC_TO_USEC),
+                    (unsigned long)(pstTmp->u64HoldNsTotal / LP_NSEC_TO_USEC),
+                    (unsigned long)(pstTmp->u64HoldNsMax / LP_NSEC_TO_USEC),
+                    (unsigned long)pstTmp->u64LogWhileHeld,
+                    acWaitHist, acHoldHist);
+    }
+}
+
+
+/*** Local Function Implementations ***/
+
+//*****************************************************************************
+// FUNCTION NAME : lp_u64NowNs
+//*****************************************************************************
+/**
+*
+* @brief Returns CLOCK_MONOTONIC time in nanoseconds.
+*
+* @return Current monotonic time in ns, 0 on failure
+*/
+static uint64_t lp_u64NowNs(void)
+{
+    struct timespec stNow;
+    uint64_t u64Ret = LP_ZERO_INIT_U;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &stNow) == 0)
+    {
+        u64Ret = ((uint64_t)stNow.tv_sec * LP_SEC_TO_NSEC) + (uint64_t)stNow.tv_nsec;
+    }
+
+    return u64Ret;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : lp_u32Bucket
+//*****************************************************************************
+/**
+*
+* @brief Maps a duration to its log2 microsecond histogram bucket.
+*
+* @param [in] u64Ns Duration in nanoseconds
+*
+* @return Bucket index, clamped to the last bucket
+*/
+static uint32_t lp_u32Bucket(uint64_t u64Ns)
+{
+    uint64_t u64Us = u64Ns / LP_NSEC_TO_USEC;
+    uint32_t u32Bucket = LP_ZERO_INIT_U;
+
+    while ((u64Us > LP_ZERO_INIT_U) && (u32Bucket < (LOCK_PROFILER_HIST_BUCKETS - 1U)))
+    {
+        u64Us >>= 1U;
+        u32Bucket++;
+    }
+
+    return u32Bucket;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : lp_pstFindSite
+//*****************************************************************************
+/**
+*
+* @brief Looks up (or claims) the statistics slot for a call site.
+*
+* @details Open addressing keyed on the site string pointer. Slots are
+*          claimed with a compare-and-swap so no lock is needed on the
+*          profiling path itself.
+*
+* @param [in] pcSite Call site tag
+*
+* @return Pointer to the slot, NULL if the table is full
+*/
+static LockSiteStats_t* lp_pstFindSite(const char* pcSite)
+{
+    uint32_t u32Start = (uint32_t)(((uintptr_t)pcSite >> LP_HASH_SHIFT) % LOCK_PROFILER_MAX_SITES);
+    uint32_t u32Probe;
+    uint32_t u32Idx;
+    const char* pcExpected;
+
+    for (u32Probe = LP_ZERO_INIT_U; u32Probe < LOCK_PROFILER_MAX_SITES; u32Probe++)
+    {
+        u32Idx = (u32Start + u32Probe) % LOCK_PROFILER_MAX_SITES;
+        pcExpected = __atomic_load_n(&lp_astSites[u32Idx].pcSite, __ATOMIC_ACQUIRE);
+        if (pcExpected == pcSite)
+        {
+            return &lp_astSites[u32Idx];
+        }
+        if (pcExpected == NULL)
+        {
+            if (__atomic_compare_exchange_n(&lp_astSites[u32Idx].pcSite, &pcExpected, pcSite,
+                                            false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ||
+                (pcExpected == pcSite))
+            {
+                return &lp_astSites[u32Idx];
+            }
+        }
+    }
+
+    (void)__atomic_fetch_add(&lp_u64DroppedSites, 1U, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+//*****************************************************************************
+// FUNCTION NAME : lp_vUpdateMax
+//*****************************************************************************
+/**
+*
+* @brief Lock-free monotonic maximum update.
+*
+* @param [in,out] pu64Max Stored maximum
+* @param [in] u64Value Candidate value
+*
+* @return none
+*/
+static void lp_vUpdateMax(uint64_t* pu64Max, uint64_t u64Value)
+{
+    uint64_t u64Cur = __atomic_load_n(pu64Max, __ATOMIC_RELAXED);
+
+    while ((u64Value > u64Cur) &&
+           (!__atomic_compare_exchange_n(pu64Max, &u64Cur, u64Value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)))
+    {
+        /* u64Cur reloaded by the failed exchange */
+    }
+}
+
+#endif /* ITCOM_LOCK_PROFILING */
@@ -0,0 +1,86 @@
+/**
+* @file lock_profiler.h
+*****************************************************************************
+* PROJECT NAME: Sonatus Automator
+* ORIGINATOR: Sonatus
+*
+* @brief instrumented mutex wrapper used to profile lock contention
+*
+* @authors Tusar Palauri
+*
+* @date Oct. 18 2026
+*
+* HISTORY:
+* DATE BY DESCRIPTION
+* date      |IN |Description
+* ----------|---|-----------
+* 10/18/2026|TP |Initial
+* 10/18/2026|TP |Lock sites note the mutex write for the false sharing check
+* 10/18/2026|TP |Per-thread lock operation counter
+* 10/18/2026|TP |Locks held by the calling thread tracked in every build
+* 10/18/2026|TP |Held locks only counted, a faulted thread holding one is not recovered in place
+* 10/18/2026|TP |Held lock count moved to lock_owner, profiler compiled out unless ITCOM_LOCK_PROFILING
+*
+*/
+
+#ifndef LOCK_PROFILER_H
+#define LOCK_PROFILER_H
+
+/*** Include Files ***/
+#include "gen_std_types.h"
+#include "false_sharing.h"
+
+/*** Definitions Provided to other modules ***/
+/**
+ * @def LOCK_PROFILER_MAX_SITES
+ * @brief Maximum number of distinct call sites tracked by the profiler.
+ */
+#define LOCK_PROFILER_MAX_SITES          (64U)
+
+/**
+ * @def LOCK_PROFILER_HIST_BUCKETS
+ * @brief Number of log2 histogram buckets (bucket n covers [2^(n-1), 2^n) us).
+ */
+#define LOCK_PROFILER_HIST_BUCKETS       (16U)
+
+/**
+ * @brief Lock/unlock calls used by the ITCOM lock wrappers (lock_owner.h).
+ *
+ * When ITCOM_LOCK_PROFILING is defined (make LOCK_PROFILING=1) every
+ * acquisition is routed through the profiler and tagged with the calling
+ * function name. In production builds the macros collapse to the plain
+ * pthread calls and the profiler costs nothing.
+ *
+ * Taking a mutex writes its cache line, so every lock is also reported to
+ * the false sharing check (no-op unless ITCOM_FALSE_SHARING_CHECK).
+ */
+#define LOCK_PROFILER_NOTE_MUTEX(pMutex)     FALSE_SHARING_NOTE_OBJECT((pMutex), sizeof(pthread_mutex_t), #pMutex)
+
+#ifdef ITCOM_LOCK_PROFILING
+#define LOCK_PROFILER_LOCK(pMutex)           LockProfiler_s32Lock((pMutex), __func__)
+#define LOCK_PROFILER_UNLOCK(pMutex)         LockProfiler_s32Unlock((pMutex))
+#define LOCK_PROFILER_NOTE_LOG_CALL()        LockProfiler_vNoteLogCall()
+#define LOCK_PROFILER_REPORT(pFile)          LockProfiler_vReport((pFile))
+#define LOCK_PROFILER_THREAD_LOCK_OPS()      LockProfiler_u64GetThreadLockOps()
+#else
+#define LOCK_PROFILER_LOCK(pMutex)           pthread_mutex_lock((pMutex))
+#define LOCK_PROFILER_UNLOCK(pMutex)         pthread_mutex_unlock((pMutex))
+#define LOCK_PROFILER_NOTE_LOG_CALL()        ((void)0)
+#define LOCK_PROFILER_REPORT(pFile)          ((void)(pFile))
+#define LOCK_PROFILER_THREAD_LOCK_OPS()      ((uint64_t)0U)
+#endif
+
+/*** Type Definitions ***/
+
+/*** Functions Provided to other modules ***/
+#ifdef ITCOM_LOCK_PROFILING
+extern int LockProfiler_s32Lock(pthread_mutex_t* pstMutex, const char* pcSite);
+extern int LockProfiler_s32Unlock(pthread_mutex_t* pstMutex);
+extern void LockProfiler_vNoteLogCall(void);
+extern uint64_t LockProfiler_u64GetThreadLockOps(void);
+extern void LockProfiler_vReport(FILE* pFile);
+#endif
+
+/*** Variables Provided to other modules ***/
+
+#endif /* LOCK_PROFILER_H */
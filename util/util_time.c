@@ -15,6 +15,7 @@
 * date      |IN |Description
 * ----------|---|-----------
 * 08/13/2024|BL |Initial
+* 10/18/2026|TP |Added selectable real/simulated time source
 *
 */
 
@@ -30,6 +31,7 @@
 #define MONTH_OFFSET         (1U)          /* Offset to adjust month count */
 #define SEC_TO_MSEC          (1000U)       /* Seconds to milliseconds conversion */
 #define NSEC_TO_MSEC         (1000000U)    /* Nanoseconds to milliseconds conversion */
+#define UT_MSEC_TO_NSEC      (1000000LL)   /* Milliseconds to nanoseconds conversion */
 
 
 /*** Internal Types ***/
@@ -39,6 +41,13 @@
 /*** External Variables ***/
 
 /*** Internal Variables ***/
+/* Selected backend, process local (a forked child inherits the parent's choice) */
+static TimeSource_t ut_enTimeSource = enTimeSourceReal;
+/* Simulated monotonic time in ns and the simulated time at which it was enabled */
+static int64_t ut_s64SimMonotonic_ns = 0;
+static int64_t ut_s64SimStart_ns = 0;
+/* Wall clock value captured when simulated time was enabled */
+static time_t ut_tSimWallBase = 0;
 
 //************************************************************************
 // Function UT_vGetDateTime
@@ -56,7 +65,7 @@ void UT_vGetDateTime(DateRecord_t* const pstDateRecord)
     struct tm *stGmTime = NULL;
 
     if(VALID_PTR(pstDateRecord)) {
-        stRawTime = time(&stRawTime);
+        stRawTime = UT_tGetWallTime_s();
         stGmTime = gmtime(&stRawTime);
 
         if(VALID_PTR(stGmTime)) {
@@ -74,13 +83,22 @@ void UT_vGetDateTime(DateRecord_t* const pstDateRecord)
     }
 }
 
+//************************************************************************
+// Function UT_u32GetCurrentTime_ms
+//************************************************************************
+/**
+* @brief Monotonic time in milliseconds from the selected time source.
+*        The value wraps at 2^32 ms; callers compare by unsigned difference.
+*
+* @return current time in ms, 0 if the clock could not be read
+*/
 uint32_t UT_u32GetCurrentTime_ms(void)
 {
     struct timespec ts;
     int32_t result;
     uint32_t u32ReturnValue = UT_ZERO_INIT_U;
     
-    result = clock_gettime(CLOCK_MONOTONIC, &ts);
+    result = UT_s32GetMonotonicTime(&ts);
     if (result == 0) {
         // Fixed type conversions
         uint32_t u32Seconds = (uint32_t)ts.tv_sec;
@@ -92,3 +110,117 @@ uint32_t UT_u32GetCurrentTime_ms(void)
     
     return u32ReturnValue;
 }
+
+//************************************************************************
+// Function UT_s32GetMonotonicTime
+//************************************************************************
+/**
+* @brief Drop-in replacement for clock_gettime(CLOCK_MONOTONIC, ...) that
+*        honours the selected time source.
+*
+* @param [out] pstTime Current monotonic time
+*
+* @return 0 on success, -1 on failure (same convention as clock_gettime)
+*/
+int32_t UT_s32GetMonotonicTime(struct timespec* const pstTime)
+{
+    int32_t s32Result = -1;
+
+    if(VALID_PTR(pstTime)) {
+        if(__atomic_load_n(&ut_enTimeSource, __ATOMIC_ACQUIRE) == enTimeSourceSimulated) {
+            int64_t s64Now_ns = __atomic_load_n(&ut_s64SimMonotonic_ns, __ATOMIC_ACQUIRE);
+            pstTime->tv_sec  = (time_t)(s64Now_ns / UT_SEC_TO_NSEC);
+            pstTime->tv_nsec = (long)(s64Now_ns % UT_SEC_TO_NSEC);
+            s32Result = 0;
+        }
+        else {
+            s32Result = (int32_t)clock_gettime(CLOCK_MONOTONIC, pstTime);
+        }
+    }
+
+    return s32Result;
+}
+
+//************************************************************************
+// Function UT_tGetWallTime_s
+//************************************************************************
+/**
+* @brief Drop-in replacement for time(NULL) that honours the selected time
+*        source. In simulated mode the wall clock advances together with the
+*        simulated monotonic clock.
+*
+* @return seconds since the epoch
+*/
+time_t UT_tGetWallTime_s(void)
+{
+    time_t tNow;
+
+    if(__atomic_load_n(&ut_enTimeSource, __ATOMIC_ACQUIRE) == enTimeSourceSimulated) {
+        int64_t s64Elapsed_ns = __atomic_load_n(&ut_s64SimMonotonic_ns, __ATOMIC_ACQUIRE) - ut_s64SimStart_ns;
+        tNow = ut_tSimWallBase + (time_t)(s64Elapsed_ns / UT_SEC_TO_NSEC);
+    }
+    else {
+        tNow = time(NULL);
+    }
+
+    return tNow;
+}
+
+//************************************************************************
+// Function UT_vSetTimeSource
+//************************************************************************
+/**
+* @brief Selects the time source. Switching to simulated time freezes both
+*        clocks at their current real values so stored timestamps stay
+*        comparable; from then on only UT_vSimAdvanceTime_ms() moves them.
+*        Must be called before the worker threads are started.
+*
+* @param [in] enSource Time source to use
+*
+* @return none
+*/
+void UT_vSetTimeSource(TimeSource_t enSource)
+{
+    struct timespec stNow = {0};
+
+    if(enSource == enTimeSourceSimulated) {
+        (void)clock_gettime(CLOCK_MONOTONIC, &stNow);
+        ut_s64SimStart_ns = ((int64_t)stNow.tv_sec * UT_SEC_TO_NSEC) + (int64_t)stNow.tv_nsec;
+        ut_tSimWallBase = time(NULL);
+        __atomic_store_n(&ut_s64SimMonotonic_ns, ut_s64SimStart_ns, __ATOMIC_RELEASE);
+        __atomic_store_n(&ut_enTimeSource, enTimeSourceSimulated, __ATOMIC_RELEASE);
+    }
+    else {
+        __atomic_store_n(&ut_enTimeSource, enTimeSourceReal, __ATOMIC_RELEASE);
+    }
+}
+
+//************************************************************************
+// Function UT_enGetTimeSource
+//************************************************************************
+/**
+* @brief Returns the selected time source.
+*
+* @return enTimeSourceReal or enTimeSourceSimulated
+*/
+TimeSource_t UT_enGetTimeSource(void)
+{
+    return __atomic_load_n(&ut_enTimeSource, __ATOMIC_ACQUIRE);
+}
+
+//************************************************************************
+// Function UT_vSimAdvanceTime_ms
+//************************************************************************
+/**
+* @brief Advances the simulated clocks. Has no effect with the real source.
+*
+* @param [in] u32Delta_ms Milliseconds to advance
+*
+* @return none
+*/
+void UT_vSimAdvanceTime_ms(uint32_t u32Delta_ms)
+{
+    if(__atomic_load_n(&ut_enTimeSource, __ATOMIC_ACQUIRE) == enTimeSourceSimulated) {
+        (void)__atomic_add_fetch(&ut_s64SimMonotonic_ns, (int64_t)u32Delta_ms * UT_MSEC_TO_NSEC, __ATOMIC_ACQ_REL);
+    }
+}
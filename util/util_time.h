@@ -16,6 +16,7 @@
 * ----------|---|-----------
 * 08/13/2024|BL |Initial
 * 08/13/2024|BL |SUD baseline 0.4
+* 10/18/2026|TP |Added selectable real/simulated time source
 *
 */
 
@@ -26,7 +27,7 @@
 #include "gen_std_types.h"
 
 /*** Definitions Provided to other modules ***/
-
+#define UT_SEC_TO_NSEC       (1000000000LL) /* Seconds to nanoseconds conversion */
 
 /*** Type Definitions ***/
 typedef char char_t;
@@ -45,9 +46,28 @@ typedef struct
     uint8_t u8Valid;     /**< Flag for if the time is valid */
 } DateRecord_t;
 
+/**
+ * @brief Backend behind every timeout, rate limiter and periodic check
+ *
+ * enTimeSourceReal reads the kernel clocks. enTimeSourceSimulated only moves
+ * when UT_vSimAdvanceTime_ms() is called, so timing behaviour can be driven
+ * deterministically (and much faster than real time) from a host test.
+ */
+typedef enum
+{
+    enTimeSourceReal = 0,     /**< CLOCK_MONOTONIC / time() */
+    enTimeSourceSimulated,    /**< Advanced explicitly by the caller */
+    enTotalTimeSources
+} TimeSource_t;
+
 /*** Functions Provided to other modules ***/
 extern void UT_vGetDateTime(DateRecord_t* const pstDateRecord);
 extern uint32_t UT_u32GetCurrentTime_ms(void);
+extern int32_t UT_s32GetMonotonicTime(struct timespec* const pstTime);
+extern time_t UT_tGetWallTime_s(void);
+extern void UT_vSetTimeSource(TimeSource_t enSource);
+extern TimeSource_t UT_enGetTimeSource(void);
+extern void UT_vSimAdvanceTime_ms(uint32_t u32Delta_ms);
 
 /*** Variables Provided to other modules ***/
 